@@ -0,0 +1,59262 @@
+lui t0,0x4A
+addi t0,t0,1492
+addi gp,t0,0
+addi a0,zero,0
+addi a7,zero,214
+ecall
+addi a0,a0,3
+addi t0,zero,4
+remu t0,a0,t0
+sub a0,a0,t0
+addi a7,zero,214
+ecall
+sw a0,-4(gp)
+lw t0,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,sp,8
+sw t0,4(sp)
+jal ra,55759
+addi sp,sp,-4
+sw a0,0(sp)
+lw a0,0(sp)
+addi sp,sp,4
+addi a7,zero,93
+ecall
+lw a0,0(sp)
+addi sp,sp,4
+lw a1,0(sp)
+addi sp,sp,4
+lw a2,0(sp)
+addi sp,sp,4
+addi a7,zero,63
+ecall
+jalr zero,0(ra)
+lw a0,0(sp)
+addi sp,sp,4
+lw a1,0(sp)
+addi sp,sp,4
+lw a2,0(sp)
+addi sp,sp,4
+addi a7,zero,64
+ecall
+jalr zero,0(ra)
+lw a1,0(sp)
+addi sp,sp,4
+lw a2,0(sp)
+addi sp,sp,4
+lw a3,0(sp)
+addi sp,sp,4
+addi a0,zero,-100
+addi a7,zero,56
+ecall
+jalr zero,0(ra)
+lw t0,0(sp)
+addi sp,sp,4
+addi t0,t0,3
+addi t1,zero,4
+remu t1,t0,t1
+sub t0,t0,t1
+lw t1,-4(gp)
+add a0,t1,t0
+addi a7,zero,214
+ecall
+beq a0,t1,2
+beq zero,zero,4
+beq zero,t0,3
+addi a0,zero,0
+beq zero,zero,3
+sw a0,-4(gp)
+addi a0,t1,0
+jalr zero,0(ra)
+lw a0,0(sp)
+addi sp,sp,4
+lw a1,0(sp)
+addi sp,sp,4
+addi a7,zero,401
+ecall
+addi a0,a6,0
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-8(gp)
+beq t0,zero,2
+jal zero,121
+addi t0,zero,-180
+add t0,gp,t0
+sw t0,-8(gp)
+addi t0,zero,4
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,-20(gp)
+addi t0,zero,4
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,-24(gp)
+lw t0,-20(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9614
+addi t0,a0,0
+sw t0,-28(gp)
+lw t0,-28(gp)
+addi t1,zero,1
+sw t1,0(t0)
+addi t0,zero,1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-20(gp)
+sltu t0,t0,t1
+beq t0,zero,22
+lw t0,-28(gp)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-28(gp)
+lw t2,-4(s0)
+addi t3,zero,1
+sub t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,2
+mul t1,t1,t2
+sw t1,0(t0)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-24
+addi t0,zero,1
+sub t0,zero,t0
+sw t0,-32(gp)
+lw t0,-20(gp)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6620
+addi t0,a0,0
+sw t0,-40(gp)
+lw t0,-40(gp)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-36(gp)
+addi t0,zero,4
+sw t0,-52(gp)
+addi t0,zero,4
+sw t0,-56(gp)
+lw t0,-32(gp)
+sw t0,-60(gp)
+lw t0,-40(gp)
+sw t0,-64(gp)
+addi t0,zero,4
+sw t0,-68(gp)
+lw t0,-68(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,-72(gp)
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9549
+addi t0,a0,0
+sw t0,-76(gp)
+lw t0,-76(gp)
+addi t1,zero,0
+sw t1,0(t0)
+lw t0,-20(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7362
+addi t0,a0,0
+sw t0,-80(gp)
+addi t0,zero,80
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7356
+addi t0,a0,0
+sw t0,-84(gp)
+lw t0,-88(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7350
+addi t0,a0,0
+sw t0,-92(gp)
+addi t0,zero,255
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7344
+addi t0,a0,0
+sw t0,-96(gp)
+addi t0,zero,4
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9516
+addi t0,a0,0
+sw t0,-100(gp)
+lw t0,-100(gp)
+addi t1,zero,0
+sw t1,0(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-136(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-424(gp)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9480
+addi t0,a0,0
+sw t0,-428(gp)
+lw t0,-428(gp)
+lw t1,-292(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-508
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-296(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-520
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-300(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-528
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-304(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-540
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-308(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-552
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-312(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-556
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-316(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-564
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-320(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-572
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-324(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-580
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-328(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-588
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-332(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-596
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-336(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-600
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-340(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-604
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-344(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-608
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-348(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-612
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-352(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-616
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-356(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-620
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-360(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-624
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-364(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-628
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-368(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-632
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-372(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-636
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-376(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-640
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-380(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-644
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-384(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-648
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-388(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-652
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-392(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-656
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-396(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-660
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-400(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-664
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-404(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-668
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-408(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-672
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-412(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-676
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-416(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-684
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-420(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-696
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-428(gp)
+lw t1,-424(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-704
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-184(gp)
+sw t0,-444(gp)
+lw t0,-288(gp)
+sw t0,-492(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-448(gp)
+addi t0,zero,1
+sw t0,-452(gp)
+jal ra,9557
+addi t0,zero,0
+sw t0,-456(gp)
+addi t0,zero,0
+sw t0,-460(gp)
+addi t0,zero,0
+sw t0,-464(gp)
+addi t0,zero,0
+sw t0,-468(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,2
+addi t1,zero,4
+mul t0,t0,t1
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9159
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-752(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,9039
+addi t0,a0,0
+sw t0,-756(gp)
+addi t0,zero,0
+sw t0,-760(gp)
+addi t0,zero,0
+sw t0,-764(gp)
+addi t0,zero,0
+sw t0,-768(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-788(gp)
+addi t0,zero,0
+sw t0,-792(gp)
+addi t0,zero,0
+sw t0,-796(gp)
+addi t0,zero,0
+sw t0,-800(gp)
+addi t0,zero,0
+sw t0,-804(gp)
+addi t0,zero,0
+sw t0,-808(gp)
+addi t0,zero,0
+sw t0,-812(gp)
+addi t0,zero,0
+sw t0,-816(gp)
+addi t0,zero,0
+sw t0,-468(gp)
+jal ra,9733
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,8(s0)
+lw t1,0(t1)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,8(s0)
+lw t1,0(t1)
+sw t1,0(t0)
+addi t0,zero,-820
+add t0,gp,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,8(s0)
+lw t1,0(t1)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,-836
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6636
+addi t0,a0,0
+sw t0,-824(gp)
+addi t0,zero,-844
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6629
+addi t0,a0,0
+sw t0,-828(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-848(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,8735
+addi t0,a0,0
+sw t0,-984(gp)
+lw t0,-984(gp)
+lw t1,-856(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-992
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-860(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-996
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-864(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1000
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-868(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1004
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-872(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1008
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-876(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1012
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-880(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1016
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-884(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1020
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-888(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1024
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-892(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1028
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1032
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-900(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1036
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1040
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-908(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1044
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-912(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1048
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-916(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1052
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-920(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1056
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-924(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1060
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-928(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1064
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-932(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1068
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-936(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1072
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-940(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1076
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-944(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1080
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-948(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1084
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-952(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1088
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-956(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1092
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-960(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1096
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-964(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1100
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-968(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1104
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-972(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1108
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-976(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1112
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-984(gp)
+lw t1,-980(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1116
+add t1,gp,t1
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-1516(gp)
+addi t0,zero,0
+sw t0,-1520(gp)
+addi t0,zero,0
+sw t0,-1524(gp)
+addi t0,zero,0
+sw t0,-1528(gp)
+addi t0,zero,0
+sw t0,-1532(gp)
+addi t0,zero,0
+sw t0,-1536(gp)
+addi t0,zero,0
+sw t0,-1540(gp)
+addi t0,zero,0
+sw t0,-1544(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-1440(gp)
+addi t0,zero,0
+sw t0,-1444(gp)
+addi t0,zero,0
+sw t0,-1448(gp)
+addi t0,zero,0
+sw t0,-1452(gp)
+addi t0,zero,0
+sw t0,-1456(gp)
+addi t0,zero,0
+sw t0,-1460(gp)
+addi t0,zero,0
+sw t0,-1464(gp)
+addi t0,zero,0
+sw t0,-1468(gp)
+addi t0,zero,0
+sw t0,-1472(gp)
+addi t0,zero,0
+sw t0,-1476(gp)
+addi t0,zero,0
+sw t0,-1480(gp)
+addi t0,zero,0
+sw t0,-1484(gp)
+addi t0,zero,0
+sw t0,-1488(gp)
+addi t0,zero,0
+sw t0,-1492(gp)
+addi t0,zero,0
+sw t0,-1496(gp)
+addi t0,zero,0
+sw t0,-1500(gp)
+addi t0,zero,0
+sw t0,-1504(gp)
+addi t0,zero,0
+sw t0,-1508(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,5
+addi t1,zero,4
+mul t0,t0,t1
+addi t1,zero,12
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,8385
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,8
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,9
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,10
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,11
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,12
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,13
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,14
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,15
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,16
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,8
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,9
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,10
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,11
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,12
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,13
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,14
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,15
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,16
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,4
+addi t1,zero,4
+mul t0,t0,t1
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7937
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,8
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,9
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,8
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,9
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1868(gp)
+addi t1,zero,4
+lw t2,-68(gp)
+divu t1,t1,t2
+mul t0,t0,t1
+sw t0,-1872(gp)
+lw t0,-1868(gp)
+addi t1,zero,4
+divu t0,t0,t1
+sw t0,-1880(gp)
+lw t0,8(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sw t0,8(s0)
+jal zero,9
+lw t0,8(s0)
+lui t1,0x1
+addi t1,t1,0
+sltu t0,t1,t0
+beq t0,zero,4
+lui t0,0x1
+addi t0,t0,0
+sw t0,8(s0)
+lw t0,8(s0)
+lw t1,-1852(gp)
+mul t0,t0,t1
+sw t0,-1888(gp)
+lw t0,-1892(gp)
+lw t1,-1872(gp)
+lw t2,-1868(gp)
+divu t1,t1,t2
+mul t0,t0,t1
+sw t0,-1892(gp)
+lw t0,-1900(gp)
+lw t1,-1896(gp)
+mul t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7210
+addi t0,a0,0
+sw t0,-1904(gp)
+addi t0,zero,0
+sw t0,-1920(gp)
+addi t0,zero,0
+sw t0,-1924(gp)
+lw t0,-1912(gp)
+lw t1,-1908(gp)
+mul t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7196
+addi t0,a0,0
+sw t0,-1916(gp)
+addi t0,zero,0
+sw t0,-1928(gp)
+addi t0,zero,0
+sw t0,-1932(gp)
+addi t0,zero,0
+sw t0,-1936(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-16(gp)
+beq t0,zero,18
+lw t0,-2000(gp)
+lw t1,-1976(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2012
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-2000(gp)
+lw t1,-1980(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2016
+add t1,gp,t1
+sw t1,0(t0)
+jal zero,17
+lw t0,-2000(gp)
+lw t1,-1976(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2020
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-2000(gp)
+lw t1,-1980(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2024
+add t1,gp,t1
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1996(gp)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6945
+addi t0,a0,0
+sw t0,-2000(gp)
+lw t0,-2000(gp)
+lw t1,-1944(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2028
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-2000(gp)
+lw t1,-1948(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2036
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-2000(gp)
+lw t1,-1952(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2040
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-2000(gp)
+lw t1,-1956(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2044
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-2000(gp)
+lw t1,-1960(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2048
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-2000(gp)
+lw t1,-1964(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2040
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-2000(gp)
+lw t1,-1968(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2032
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-2000(gp)
+lw t1,-1972(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2024
+add t1,gp,t1
+sw t1,0(t0)
+jal ra,-127
+lw t0,-2000(gp)
+lw t1,-1984(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2020
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-2000(gp)
+lw t1,-1988(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2016
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-2000(gp)
+lw t1,-1992(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2008
+add t1,gp,t1
+sw t1,0(t0)
+lw t0,-2000(gp)
+lw t1,-1996(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2000
+add t1,gp,t1
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1996(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6997
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1988(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1996(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6981
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1984(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1936(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6529
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1932(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1932(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1972(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1656
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1932(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1968(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1644
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1932(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1964(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1624
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1932(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1960(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1616
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1932(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1956(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1600
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1932(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1952(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1580
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1932(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1948(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1564
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1932(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1944(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1544
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1932(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1940(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1520
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1932(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1936(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1500
+add t1,gp,t1
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1844(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1840(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1836(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1832(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1828(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1820(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+sw t1,1824(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1816(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1808(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1804(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1800(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1796(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1792(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1788(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1784(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1780(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1776(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1772(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1768(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1764(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1760(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1756(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1752(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1748(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1524(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6423
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1740(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1524(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6401
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1524(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6383
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1732(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1524(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6365
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1728(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-848(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6341
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1724(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-848(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6327
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1720(t0)
+lw t1,-856(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1720(t0)
+lw t1,-864(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1720(t0)
+lw t1,-888(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1716(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1708(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1700(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1696(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1692(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1688(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1684(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1680(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1676(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1672(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-2398
+jal ra,-299
+jal ra,-238
+jal ra,-221
+jal ra,-132
+jal ra,-44
+jal ra,21923
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1496(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6023
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,8
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,9
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,10
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,11
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,12
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,13
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,14
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,15
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,16
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,17
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,18
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,19
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,20
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,22
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,23
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,24
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,25
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,27
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,28
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,29
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,30
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,31
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,39
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,40
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,8
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,9
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,10
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,11
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,12
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,13
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,14
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,15
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,16
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,17
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,18
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,19
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,20
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,21
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,22
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,23
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,24
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,25
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,26
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,27
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,28
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,29
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,30
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,31
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,32
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,33
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,34
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,35
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,36
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,37
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,38
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,39
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,40
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,41
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,8
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,9
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,10
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,11
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,12
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,13
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,14
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,15
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,16
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,17
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,18
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,19
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,20
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,21
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,22
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,23
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,24
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,25
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,26
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,27
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,28
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,29
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,30
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,31
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,32
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,33
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,34
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,35
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,36
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,37
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,38
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,39
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,40
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,41
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,38510
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1424(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1420(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1412(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1404(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1396(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1388(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1344(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1352(t0)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,3777
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1340(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1356(t0)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,3765
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1336(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1356(t0)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,3753
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1332(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1328(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1300(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,43793
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+sw t0,4(sp)
+jal ra,40115
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1296(t0)
+jal zero,-31
+jal ra,-195
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,39066
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1112(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3333
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1108(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1108(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1128(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1052
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1108(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1124(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1044
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1108(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1120(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1036
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1108(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1116(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1028
+add t1,gp,t1
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1108(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1112(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,1020
+add t1,gp,t1
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,1016(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,12(s0)
+sw t1,1012(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,48278
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1004(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,4
+addi t1,zero,4
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1188(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6482
+lw t0,-20(gp)
+addi t1,zero,64
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lw t0,-20(gp)
+addi t1,zero,32
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,zero,0
+sw t0,-12(gp)
+addi t0,zero,0
+sw t0,-16(gp)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1188(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6504
+jal ra,18620
+addi t0,a0,0
+beq t0,zero,67
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10645
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,511
+addi t0,a0,0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,988(t1)
+sw t1,980(t0)
+jal zero,43
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-100(gp)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-6534
+lw t0,-100(gp)
+lw t0,0(t0)
+lw t1,-1312(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,996(t1)
+sw t1,980(t0)
+jal zero,21
+lw t0,-100(gp)
+lw t0,0(t0)
+lw t1,-1328(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,992(t1)
+sw t1,980(t0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,988(t1)
+sw t1,980(t0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1000(t1)
+sw t1,980(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,980(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,992(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-116(gp)
+sw t0,-124(gp)
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,980(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,988(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-120(gp)
+sw t0,-124(gp)
+jal zero,3
+lw t0,-112(gp)
+sw t0,-124(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-16(gp)
+beq t0,zero,35
+lw t0,-12(gp)
+beq t0,zero,26
+addi t0,zero,4
+sw t0,-52(gp)
+addi t0,zero,4
+sw t0,-56(gp)
+lw t0,-32(gp)
+sw t0,-60(gp)
+lw t0,-40(gp)
+sw t0,-64(gp)
+addi t0,zero,4
+sw t0,-68(gp)
+lw t0,-68(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,-72(gp)
+addi t0,zero,20
+sw t0,-436(gp)
+lw t0,-1276(gp)
+sw t0,-1332(gp)
+addi t0,zero,64
+sw t0,-1372(gp)
+addi t0,zero,64
+sw t0,-1384(gp)
+addi t0,zero,56
+sw t0,-1388(gp)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1188(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6653
+jal zero,50
+lw t0,-12(gp)
+beq t0,zero,24
+lw t0,-44(gp)
+sw t0,-52(gp)
+lw t0,-44(gp)
+sw t0,-56(gp)
+lw t0,-48(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,80
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-60(gp)
+lw t0,-48(gp)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,70
+addi t0,a0,0
+sw t0,-64(gp)
+lw t0,-44(gp)
+sw t0,-68(gp)
+jal zero,11
+addi t0,zero,4
+sw t0,-52(gp)
+addi t0,zero,4
+sw t0,-56(gp)
+lw t0,-32(gp)
+sw t0,-60(gp)
+lw t0,-40(gp)
+sw t0,-64(gp)
+addi t0,zero,4
+sw t0,-68(gp)
+lw t0,-68(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,-72(gp)
+addi t0,zero,10
+sw t0,-436(gp)
+lw t0,-1280(gp)
+sw t0,-1332(gp)
+addi t0,zero,52
+sw t0,-1372(gp)
+addi t0,zero,52
+sw t0,-1384(gp)
+addi t0,zero,32
+sw t0,-1388(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-954
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,37115
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,1476(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,12(s0)
+sw t1,1004(t0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1492(t1)
+sw t1,1480(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-28(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+lw t0,8(s0)
+addi t1,zero,2
+divu t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,18
+jal zero,16
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-71
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,14
+jal zero,12
+lw t0,8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20
+addi t0,a0,0
+addi t1,zero,10
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,10
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+lw t0,8(s0)
+addi t1,zero,10
+divu t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-158
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-182
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,16(s0)
+lw t1,-20(gp)
+sltu t0,t0,t1
+beq t0,zero,21
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-38
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-216
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-58
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,39
+addi t0,a0,0
+beq t0,zero,6
+lw t0,8(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sltu t0,t1,t0
+beq t0,zero,5
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-40(gp)
+add t0,t0,t1
+lw t1,12(s0)
+lw t2,-40(gp)
+add t1,t1,t2
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-40(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,40
+lw t0,12(s0)
+lw t1,-40(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,115
+jal zero,29
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-46
+addi t0,a0,0
+beq t0,zero,15
+lw t0,-40(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-104
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,93
+jal zero,7
+lw t0,-40(gp)
+lw t1,12(s0)
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,86
+jal zero,84
+lw t0,12(s0)
+lw t1,-40(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,76
+jal zero,74
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-85
+addi t0,a0,0
+beq t0,zero,38
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-93
+addi t0,a0,0
+beq t0,zero,19
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-148
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-155
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,42
+jal zero,11
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-166
+addi t0,a0,0
+lw t1,12(s0)
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,31
+jal zero,29
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-130
+addi t0,a0,0
+beq t0,zero,16
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-188
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,8
+jal zero,6
+lw t0,8(s0)
+lw t1,12(s0)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-460
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,27
+jal zero,25
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-478
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t1,zero,t1
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-513
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,24
+jal zero,22
+lw t0,12(s0)
+lw t1,-20(gp)
+sltu t0,t0,t1
+beq t0,zero,15
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-533
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-367
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,12(s0)
+addi t1,zero,4
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-403
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,12(s0)
+addi t1,zero,4
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,8(s0)
+lw t2,-4(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-67
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-502
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+sub t1,t1,t2
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-522
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,0(t0)
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,97
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+lw t0,8(s0)
+addi t1,zero,122
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,8(s0)
+addi t1,zero,65
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+lw t0,8(s0)
+addi t1,zero,90
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,48
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+lw t0,8(s0)
+addi t1,zero,57
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2348
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-236
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-15
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-69
+addi t0,a0,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,20
+lw t0,-8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-291
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-257
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-22
+lw t0,-8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-270
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-106
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-8(s0)
+lw t0,-4(s0)
+lw t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,40
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-343
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-356
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-322
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+jal ra,-330
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-8(s0)
+jal zero,-42
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,1
+beq t0,zero,64
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-398
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-410
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,38
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,34
+jal zero,31
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-430
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-439
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,3
+jal zero,-64
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-478
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,45
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+addi t0,zero,1
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-498
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,3
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,116
+lw t0,-12(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,9
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+addi t0,t0,936
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,1681
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7851
+lw t0,-8(s0)
+lw t1,-32(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,8
+lw t0,-8(s0)
+addi t1,zero,10
+mul t0,t0,t1
+lw t1,-12(s0)
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,63
+lw t0,-8(s0)
+lw t1,-32(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+lw t0,-12(s0)
+lw t1,-32(gp)
+addi t2,zero,10
+remu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+lw t0,-8(s0)
+addi t1,zero,10
+mul t0,t0,t1
+lw t1,-12(s0)
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,892
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,1626
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7906
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,892
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,1606
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7926
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-620
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,-119
+lw t0,-16(s0)
+beq t0,zero,32
+lw t0,-8(s0)
+lw t1,-40(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,6
+lw t0,-8(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,26
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,892
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,1561
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7971
+jal zero,4
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,48
+sw t0,8(sp)
+jal ra,-653
+addi t0,zero,1
+sw t0,-4(s0)
+jal zero,22
+lw t0,20(s0)
+beq t0,zero,20
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-985
+addi t0,a0,0
+beq t0,zero,12
+lw t0,16(s0)
+addi t1,zero,10
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,8(s0)
+sub t0,zero,t0
+sw t0,8(s0)
+addi t0,zero,1
+sw t0,-8(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,43
+lw t0,8(s0)
+lw t1,16(s0)
+remu t0,t0,t1
+addi t1,zero,9
+sltu t0,t1,t0
+beq t0,zero,16
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+lw t1,16(s0)
+remu t0,t0,t1
+addi t1,zero,10
+sub t0,t0,t1
+addi t1,zero,65
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-702
+jal zero,13
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+lw t1,16(s0)
+remu t0,t0,t1
+addi t1,zero,48
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-715
+lw t0,8(s0)
+lw t1,16(s0)
+divu t0,t0,t1
+sw t0,8(s0)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-46
+lw t0,16(s0)
+addi t1,zero,10
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+lw t0,-8(s0)
+beq t0,zero,13
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,45
+sw t0,8(sp)
+jal ra,-740
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,32
+sw t0,8(sp)
+jal ra,-756
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-16
+jal zero,18
+lw t0,-4(s0)
+lw t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,48
+sw t0,8(sp)
+jal ra,-774
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-16
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-787
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-510
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+divu t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1339
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+mul t0,t0,t1
+lw t1,8(s0)
+lw t2,12(s0)
+remu t1,t1,t2
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1354
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+mul t1,t1,t2
+lw t2,12(s0)
+divu t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,79
+jal zero,77
+lw t0,8(s0)
+lw t1,12(s0)
+sltu t0,t1,t0
+beq t0,zero,29
+lw t0,16(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi t1,zero,4
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1398
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+addi t1,zero,2
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-85
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,47
+jal zero,45
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+addi t0,zero,4
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1427
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+addi t1,zero,2
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-114
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1452
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1480
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1504
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+addi t0,zero,2
+sw t0,8(sp)
+jal ra,-203
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,2
+sw t0,4(sp)
+jal ra,-66
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+addi t0,zero,2
+sw t0,8(sp)
+jal ra,-231
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,2
+sw t0,4(sp)
+jal ra,-70
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+addi t0,zero,2
+sw t0,8(sp)
+jal ra,-213
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,2
+sw t0,4(sp)
+jal ra,-122
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+addi t0,zero,2
+sw t0,8(sp)
+jal ra,-241
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,2
+sw t0,4(sp)
+jal ra,-126
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,980(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1000(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,888
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,1040
+addi sp,sp,4
+addi t0,a0,0
+addi a0,t0,0
+jal zero,21
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-8484
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+sw t0,4(sp)
+jal ra,-1261
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-148(gp)
+beq t0,zero,14
+lw t0,-148(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-152(gp)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,-1176
+lw t0,-152(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-152(gp)
+jal zero,52
+lw t0,-76(gp)
+beq t0,zero,44
+lw t0,-76(gp)
+lw t1,8(s0)
+sw t1,0(t0)
+lw t0,-144(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-76(gp)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-89
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,27
+lw t0,-144(gp)
+lw t1,-104(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lw t0,-104(gp)
+sw t0,-144(gp)
+lui t0,0xFFFFF
+addi t0,t0,836
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-140(gp)
+sw t0,8(sp)
+jal ra,954
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8578
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8585
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,828
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17
+jal zero,29
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1301
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1312
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-117
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-25
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,824
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,871
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-184(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,808
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,849
+jal zero,49
+lw t0,8(s0)
+lw t1,-192(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,796
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,836
+jal zero,36
+lw t0,8(s0)
+lw t1,-196(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,784
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,823
+jal zero,23
+lw t0,8(s0)
+lw t1,-200(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,764
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,810
+jal zero,10
+lui t0,0xFFFFF
+addi t0,t0,756
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,801
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,748
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,782
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-80(gp)
+sw t0,4(sp)
+addi t0,zero,10
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+addi t0,zero,0
+sw t0,16(sp)
+jal ra,-783
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-179
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-80(gp)
+sw t0,4(sp)
+addi t0,zero,10
+sw t0,8(sp)
+addi t0,zero,1
+sw t0,12(sp)
+addi t0,zero,0
+sw t0,16(sp)
+jal ra,-809
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-205
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1950
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,12(s0)
+lw t1,-4(s0)
+sltu t0,t1,t0
+beq t0,zero,10
+addi t0,zero,48
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-308
+lw t0,12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,12(s0)
+jal zero,-12
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-80(gp)
+sw t0,4(sp)
+addi t0,zero,10
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+addi t0,zero,0
+sw t0,16(sp)
+jal ra,-857
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-253
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-80(gp)
+sw t0,4(sp)
+addi t0,zero,10
+sw t0,8(sp)
+addi t0,zero,1
+sw t0,12(sp)
+addi t0,zero,0
+sw t0,16(sp)
+jal ra,-884
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1332
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,10
+lw t0,-188(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-366
+lw t0,8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,8(s0)
+jal zero,-12
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-80(gp)
+sw t0,4(sp)
+addi t0,zero,16
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+jal ra,-925
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-321
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,744
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,597
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-42
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-80(gp)
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+jal ra,-973
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-369
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,740
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,549
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-42
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-80(gp)
+sw t0,4(sp)
+addi t0,zero,2
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+jal ra,-1021
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-417
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,736
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,501
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-42
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1731
+addi t0,a0,0
+addi t1,zero,115
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-466
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,303
+jal zero,298
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1753
+addi t0,a0,0
+addi t1,zero,99
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-564
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,281
+jal zero,276
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1775
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,101
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1789
+addi t0,a0,0
+addi t1,zero,117
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-365
+lw t0,12(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,245
+jal zero,76
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1813
+addi t0,a0,0
+addi t1,zero,100
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-363
+lw t0,12(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,221
+jal zero,52
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1837
+addi t0,a0,0
+addi t1,zero,88
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-273
+lw t0,12(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,195
+jal zero,26
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1863
+addi t0,a0,0
+addi t1,zero,111
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-251
+lw t0,12(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,169
+jal zero,164
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1887
+addi t0,a0,0
+addi t1,zero,98
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-227
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,145
+jal zero,140
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1911
+addi t0,a0,0
+addi t1,zero,46
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,59
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1925
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1762
+addi t0,a0,0
+beq t0,zero,42
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1941
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,3
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1955
+addi t0,a0,0
+addi t1,zero,117
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-483
+lw t0,12(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,75
+jal zero,70
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1981
+addi t0,a0,0
+addi t1,zero,48
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,58
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-1995
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1832
+addi t0,a0,0
+beq t0,zero,42
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-2011
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi t1,zero,3
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-2025
+addi t0,a0,0
+addi t1,zero,88
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-463
+lw t0,12(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,5
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,132
+lw t0,12(s0)
+beq t0,zero,4
+lw t0,12(s0)
+sw t0,-148(gp)
+jal zero,3
+lw t0,-96(gp)
+sw t0,-148(gp)
+addi t0,zero,0
+sw t0,-152(gp)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-2084
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,78
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-2095
+addi t0,a0,0
+addi t1,zero,37
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-2111
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,35
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-2122
+addi t0,a0,0
+addi t1,zero,37
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lw t0,16(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,20(s0)
+lw a0,0(t0)
+addi t0,t0,4
+sw t0,20(s0)
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-419
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,9
+addi t0,zero,37
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-947
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,15
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-2157
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-962
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-87
+lw t0,-148(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-152(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2137
+lw t0,-152(gp)
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-152(gp)
+lw t0,12(s0)
+beq t0,zero,4
+addi t0,zero,0
+sw t0,-148(gp)
+jal zero,16
+lw t0,-148(gp)
+sw t0,12(s0)
+addi t0,zero,0
+sw t0,-148(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-1053
+addi t0,a0,0
+addi a0,t0,0
+jal zero,5
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,12
+add t0,s0,t0
+sw t0,-4(s0)
+addi t0,zero,1
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+jal ra,-174
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,16
+add t0,s0,t0
+sw t0,-4(s0)
+addi t0,zero,0
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+jal ra,-207
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,16
+add t0,s0,t0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+jal ra,-240
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-144(gp)
+lw t1,-104(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+addi t0,t0,888
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-84(gp)
+sw t0,4(sp)
+jal ra,-117
+addi sp,sp,4
+addi t0,a0,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+lw t0,-144(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-84(gp)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,-9642
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lw t0,8(s0)
+lw t1,8(s0)
+lw t2,12(s0)
+remu t1,t1,t2
+sub t0,t0,t1
+lw t1,12(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1480(t0)
+beq t0,zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3772
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,7
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-9685
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,31
+jal zero,29
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,22
+jal zero,20
+lw t0,-76(gp)
+beq t0,zero,12
+lui t0,0xFFFFF
+addi t0,t0,708
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-225
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1164(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-9757
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1480(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1492(t1)
+sw t1,1480(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-87
+addi t0,a0,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1480(t0)
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-147
+addi t0,a0,0
+addi t1,zero,4
+divu t0,t0,t1
+sw t0,12(s0)
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,12(s0)
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,8(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sw t1,0(t0)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-15
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-187
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-161
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-65
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1480(t0)
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3951
+addi t0,a0,0
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-9865
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,980(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1000(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,696
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1220
+jal zero,10
+lw t0,-428(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1230
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,668
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lw t0,-496(gp)
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+jal ra,-462
+addi sp,sp,16
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,652
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-452(gp)
+sw t0,4(sp)
+jal ra,-39
+lui t0,0xFFFFF
+addi t0,t0,648
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-489
+addi sp,sp,4
+lw t0,-468(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-468(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,652
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-452(gp)
+sw t0,4(sp)
+jal ra,-70
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1381
+lui t0,0xFFFFF
+addi t0,t0,632
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-522
+lw t0,-444(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1391
+lui t0,0xFFFFF
+addi t0,t0,624
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-532
+lw t0,-468(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-468(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-500(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-76(gp)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-10076
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,-76(gp)
+lw t0,0(t0)
+sw t0,-444(gp)
+lw t0,-448(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-448(gp)
+jal zero,29
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-184(gp)
+sw t0,-444(gp)
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,572
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-496(gp)
+sw t0,8(sp)
+jal ra,-592
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10124
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-444(gp)
+lw t1,-196(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-444(gp)
+lw t1,-200(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-444(gp)
+lw t1,-204(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,17
+jal zero,15
+lw t0,-444(gp)
+lw t1,-192(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,7
+jal zero,5
+jal ra,-59
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,156
+lw t0,-4(s0)
+beq t0,zero,23
+jal ra,-83
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,0
+sw t0,-4(s0)
+jal zero,16
+lw t0,-444(gp)
+lw t1,-184(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-444(gp)
+addi a0,t0,0
+jal zero,140
+jal zero,6
+lw t0,-456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-456(gp)
+jal ra,-167
+jal zero,131
+lw t0,-8(s0)
+beq t0,zero,58
+lw t0,-444(gp)
+lw t1,-252(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lw t0,-456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-456(gp)
+jal ra,-181
+lw t0,-444(gp)
+lw t1,-256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+sw t0,-8(s0)
+jal zero,-19
+lw t0,-8(s0)
+beq t0,zero,30
+lw t0,-444(gp)
+lw t1,-196(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-452(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-452(gp)
+jal zero,19
+lw t0,-444(gp)
+lw t1,-184(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,544
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-288
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10288
+lw t0,-456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-456(gp)
+jal ra,-226
+jal zero,72
+jal ra,-130
+addi t0,a0,0
+beq t0,zero,17
+lw t0,-444(gp)
+lw t1,-196(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-452(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-452(gp)
+lw t0,-456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-456(gp)
+jal ra,-245
+jal zero,53
+lw t0,-444(gp)
+lw t1,-256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+jal ra,-253
+lw t0,-444(gp)
+lw t1,-256(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+addi t0,zero,1
+sw t0,-4(s0)
+lw t0,-456(gp)
+addi t1,zero,2
+add t0,t0,t1
+sw t0,-456(gp)
+lw t0,-460(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-460(gp)
+jal ra,-270
+jal zero,24
+lw t0,-444(gp)
+lw t1,-252(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+addi t0,zero,1
+sw t0,-8(s0)
+lw t0,-456(gp)
+addi t1,zero,2
+add t0,t0,t1
+sw t0,-456(gp)
+lw t0,-460(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-460(gp)
+jal ra,-288
+jal zero,6
+lw t0,-372(gp)
+sw t0,-492(gp)
+lw t0,-444(gp)
+addi a0,t0,0
+jal zero,7
+jal zero,4
+lw t0,-444(gp)
+addi a0,t0,0
+jal zero,3
+jal zero,-156
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-444(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2951
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,-444(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2907
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-444(gp)
+lw t1,-208(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-444(gp)
+lw t1,-216(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,23
+jal zero,21
+jal ra,-302
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-444(gp)
+lw t1,-184(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-472(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-428(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-2775
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-308(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-308(gp)
+addi a0,t0,0
+jal zero,106
+jal zero,104
+lw t0,-312(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-312(gp)
+addi a0,t0,0
+jal zero,96
+jal zero,94
+lw t0,-316(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-53
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-316(gp)
+addi a0,t0,0
+jal zero,86
+jal zero,84
+lw t0,-320(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-63
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-320(gp)
+addi a0,t0,0
+jal zero,76
+jal zero,74
+lw t0,-324(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-73
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-324(gp)
+addi a0,t0,0
+jal zero,66
+jal zero,64
+lw t0,-328(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-83
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-328(gp)
+addi a0,t0,0
+jal zero,56
+jal zero,54
+lw t0,-332(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-93
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-332(gp)
+addi a0,t0,0
+jal zero,46
+jal zero,44
+lw t0,-412(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-103
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-308(gp)
+addi a0,t0,0
+jal zero,36
+jal zero,34
+lw t0,-416(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-113
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-308(gp)
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,-420(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-123
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-308(gp)
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-424(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-133
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-308(gp)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,-304(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-288(gp)
+sw t0,-492(gp)
+addi t0,zero,0
+sw t0,-472(gp)
+addi t0,zero,0
+sw t0,-476(gp)
+addi t0,zero,0
+sw t0,-484(gp)
+addi t0,zero,0
+sw t0,-480(gp)
+jal ra,-424
+addi t0,a0,0
+lw t1,-184(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,586
+lw t0,-492(gp)
+lw t1,-372(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,577
+lw t0,-444(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3207
+addi t0,a0,0
+beq t0,zero,56
+lw t0,-432(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3125
+addi t0,a0,0
+sw t0,-472(gp)
+addi t0,zero,0
+sw t0,-4(s0)
+jal ra,-275
+addi t0,a0,0
+beq t0,zero,33
+lw t0,-4(s0)
+lw t1,-432(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,524
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-669
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10669
+lw t0,-472(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,-444(gp)
+sw t0,8(sp)
+jal ra,-3324
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal ra,-615
+jal zero,-34
+lw t0,-472(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3338
+jal ra,-208
+addi t0,a0,0
+sw t0,-492(gp)
+jal zero,516
+lw t0,-444(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3214
+addi t0,a0,0
+beq t0,zero,118
+lw t0,-444(gp)
+addi t1,zero,48
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-641
+addi t0,zero,0
+sw t0,-484(gp)
+jal zero,105
+lw t0,-436(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3196
+addi t0,a0,0
+sw t0,-476(gp)
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-444(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3238
+addi t0,a0,0
+beq t0,zero,42
+lw t0,-4(s0)
+lw t1,-436(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,22
+lw t0,-488(gp)
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,496
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-745
+jal zero,7
+lui t0,0xFFFFF
+addi t0,t0,464
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-752
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10752
+lw t0,-476(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,-444(gp)
+sw t0,8(sp)
+jal ra,-3407
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal ra,-698
+jal zero,-46
+lw t0,-476(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3421
+lw t0,-476(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2999
+addi t0,a0,0
+sw t0,-484(gp)
+lw t0,-488(gp)
+beq t0,zero,18
+lw t0,-484(gp)
+lw t1,-64(gp)
+sltu t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,428
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-798
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10798
+jal zero,17
+lw t0,-484(gp)
+lw t1,-60(gp)
+sltu t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,388
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-815
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10815
+lw t0,-292(gp)
+sw t0,-492(gp)
+jal zero,393
+lw t0,-444(gp)
+lw t1,-212(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,56
+jal ra,-758
+lw t0,-444(gp)
+lw t1,-184(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+addi t0,t0,336
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-843
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10843
+jal zero,3
+lw t0,-444(gp)
+sw t0,-484(gp)
+jal ra,-780
+lw t0,-444(gp)
+lw t1,-212(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-787
+jal zero,22
+lw t0,-444(gp)
+lw t1,-184(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,-212(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-840
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10871
+jal zero,5
+lw t0,-212(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-851
+lw t0,-296(gp)
+sw t0,-492(gp)
+jal zero,332
+lw t0,-444(gp)
+lw t1,-216(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,81
+jal ra,-819
+lw t0,-440(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3371
+addi t0,a0,0
+sw t0,-480(gp)
+addi t0,zero,0
+sw t0,-4(s0)
+jal ra,-477
+addi t0,a0,0
+beq t0,zero,40
+lw t0,-4(s0)
+lw t1,-440(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,320
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-915
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10915
+lw t0,-444(gp)
+lw t1,-280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,299
+lw t0,-480(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,-444(gp)
+sw t0,8(sp)
+jal ra,-3577
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal ra,-868
+jal zero,-41
+lw t0,-444(gp)
+lw t1,-216(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-876
+jal zero,11
+lw t0,-216(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-923
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10954
+lw t0,-480(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3609
+lw t0,-300(gp)
+sw t0,-492(gp)
+jal zero,246
+lw t0,-444(gp)
+lw t1,-220(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-905
+lw t0,-336(gp)
+sw t0,-492(gp)
+jal zero,236
+lw t0,-444(gp)
+lw t1,-224(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-915
+lw t0,-340(gp)
+sw t0,-492(gp)
+jal zero,226
+lw t0,-444(gp)
+lw t1,-228(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-925
+lw t0,-344(gp)
+sw t0,-492(gp)
+jal zero,216
+lw t0,-444(gp)
+lw t1,-232(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-935
+lw t0,-348(gp)
+sw t0,-492(gp)
+jal zero,206
+lw t0,-444(gp)
+lw t1,-236(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-945
+lw t0,-352(gp)
+sw t0,-492(gp)
+jal zero,196
+lw t0,-444(gp)
+lw t1,-240(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-955
+lw t0,-356(gp)
+sw t0,-492(gp)
+jal zero,186
+lw t0,-444(gp)
+lw t1,-244(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-965
+lw t0,-360(gp)
+sw t0,-492(gp)
+jal zero,176
+lw t0,-444(gp)
+lw t1,-248(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-975
+lw t0,-364(gp)
+sw t0,-492(gp)
+jal zero,166
+lw t0,-444(gp)
+lw t1,-252(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-985
+lw t0,-368(gp)
+sw t0,-492(gp)
+jal zero,156
+lw t0,-444(gp)
+lw t1,-260(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-995
+lw t0,-376(gp)
+sw t0,-492(gp)
+jal zero,146
+lw t0,-444(gp)
+lw t1,-264(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1005
+lw t0,-444(gp)
+lw t1,-264(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1012
+lw t0,-384(gp)
+sw t0,-492(gp)
+jal zero,3
+lw t0,-380(gp)
+sw t0,-492(gp)
+jal zero,126
+lw t0,-444(gp)
+lw t1,-268(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-1025
+lw t0,-444(gp)
+lw t1,-264(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1032
+jal zero,5
+lw t0,-264(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1079
+lw t0,-388(gp)
+sw t0,-492(gp)
+jal zero,104
+lw t0,-444(gp)
+lw t1,-272(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1047
+lw t0,-444(gp)
+lw t1,-264(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1054
+lw t0,-396(gp)
+sw t0,-492(gp)
+jal zero,3
+lw t0,-392(gp)
+sw t0,-492(gp)
+jal zero,84
+lw t0,-444(gp)
+lw t1,-276(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1067
+lw t0,-444(gp)
+lw t1,-264(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1074
+lw t0,-404(gp)
+sw t0,-492(gp)
+jal zero,3
+lw t0,-400(gp)
+sw t0,-492(gp)
+jal zero,64
+lw t0,-444(gp)
+lw t1,-284(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+jal ra,-1087
+lw t0,-444(gp)
+lw t1,-284(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1094
+lw t0,-444(gp)
+lw t1,-284(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1101
+jal zero,5
+lw t0,-284(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1148
+jal zero,5
+lw t0,-284(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1153
+lw t0,-408(gp)
+sw t0,-492(gp)
+jal zero,30
+lui t0,0xFFFFF
+addi t0,t0,652
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-452(gp)
+sw t0,4(sp)
+jal ra,-1222
+lui t0,0xFFFFF
+addi t0,t0,292
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1670
+lw t0,-444(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2539
+jal ra,-2556
+lw t0,-468(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-468(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11210
+lw t0,-464(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-464(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-456(gp)
+jal ra,-1163
+lw t0,-444(gp)
+addi t1,zero,110
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-196(gp)
+sw t0,-444(gp)
+jal zero,67
+lw t0,-444(gp)
+addi t1,zero,116
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-192(gp)
+sw t0,-444(gp)
+jal zero,58
+lw t0,-444(gp)
+addi t1,zero,98
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-188(gp)
+sw t0,-444(gp)
+jal zero,49
+lw t0,-444(gp)
+lw t1,-212(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-212(gp)
+sw t0,-444(gp)
+jal zero,40
+lw t0,-444(gp)
+lw t1,-216(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-216(gp)
+sw t0,-444(gp)
+jal zero,31
+lw t0,-444(gp)
+lw t1,-260(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-260(gp)
+sw t0,-444(gp)
+jal zero,22
+lw t0,-444(gp)
+lw t1,-280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-280(gp)
+sw t0,-444(gp)
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,260
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1305
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1180(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11305
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+lw t1,8(s0)
+lw t1,0(t1)
+lw t2,8(s0)
+lw t2,0(t2)
+lw t3,8(s0)
+lw t3,0(t3)
+lw t4,8(s0)
+lw t4,0(t4)
+lw t5,8(s0)
+lw t5,0(t5)
+lw t6,-752(gp)
+divu t5,t5,t6
+add t4,t4,t5
+lw t5,-752(gp)
+divu t4,t4,t5
+add t3,t3,t4
+lw t4,-752(gp)
+divu t3,t3,t4
+add t2,t2,t3
+lw t3,-752(gp)
+divu t2,t2,t3
+add t1,t1,t2
+lw t2,-752(gp)
+divu t1,t1,t2
+add t0,t0,t1
+lw t1,-752(gp)
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-10835
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-10658
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-10647
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,20(s0)
+sw t0,4(sp)
+jal ra,-10636
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,24(s0)
+sw t0,4(sp)
+jal ra,-10625
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,28(s0)
+sw t0,4(sp)
+jal ra,-10614
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,32(s0)
+sw t0,4(sp)
+jal ra,-10603
+lw t0,8(s0)
+lw t1,-744(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-868(gp)
+sw t0,4(sp)
+jal ra,-10598
+lw t0,-756(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-105
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-10734
+lw t0,-8(s0)
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,15
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-888(gp)
+sw t0,4(sp)
+jal ra,-10629
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-760(gp)
+sw t0,4(sp)
+jal ra,-10750
+lw t0,-4(s0)
+sw t0,-760(gp)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-764(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-764(gp)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,41
+lw t0,-768(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-768(gp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10882
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10934
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-3801
+addi t0,a0,0
+beq t0,zero,4
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10961
+addi t0,a0,0
+sw t0,8(s0)
+jal zero,-44
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-756(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-222
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-88
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-760(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-708(gp)
+sw t0,8(sp)
+jal ra,-110
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-708(gp)
+sw t0,4(sp)
+jal ra,-80
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11022
+addi t0,a0,0
+lw t1,-720(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,41
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10977
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10991
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,8461
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6714
+addi t0,a0,0
+lw t1,-1148(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,-752(gp)
+sltu t0,t0,t1
+beq t0,zero,62
+lw t0,-756(gp)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,45
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-91
+addi t0,a0,0
+beq t0,zero,32
+addi t0,zero,1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+addi t0,t0,652
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11137
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1755
+lui t0,0xFFFFF
+addi t0,t0,236
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11168
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2209
+addi sp,sp,4
+lw t0,-468(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-468(gp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11195
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,-48
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-64
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-772(gp)
+lw t1,-852(gp)
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-772(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-772(gp)
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,216
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1787
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11787
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-772(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,19
+lw t0,-772(gp)
+addi t1,zero,4
+sltu t0,t0,t1
+beq t0,zero,7
+lw t0,-872(gp)
+lw t1,-772(gp)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,23
+jal zero,8
+lw t0,-964(gp)
+lw t1,-772(gp)
+add t0,t0,t1
+addi t1,zero,3
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,192
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1831
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11831
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-772(gp)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,18
+lw t0,-772(gp)
+addi t1,zero,4
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-884(gp)
+addi a0,t0,0
+jal zero,22
+jal zero,7
+jal ra,-64
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,192
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1875
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11875
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-772(gp)
+lw t1,-852(gp)
+sltu t0,t0,t1
+beq t0,zero,18
+lw t0,-772(gp)
+addi t1,zero,3
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-968(gp)
+addi a0,t0,0
+jal zero,22
+jal zero,7
+jal ra,-108
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,216
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1919
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11919
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-772(gp)
+lw t1,8(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,6
+lw t0,-772(gp)
+lw t1,8(s0)
+sub t0,t0,t1
+sw t0,-772(gp)
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,160
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1953
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11953
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-492(gp)
+lw t1,-308(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-492(gp)
+lw t1,-292(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-492(gp)
+lw t1,-296(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,162
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-492(gp)
+lw t1,-384(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,56
+jal zero,54
+lw t0,-492(gp)
+lw t1,-388(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,46
+jal zero,44
+lw t0,-492(gp)
+lw t1,-392(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,36
+jal zero,34
+lw t0,-492(gp)
+lw t1,-400(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,-492(gp)
+lw t1,-396(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-492(gp)
+lw t1,-404(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-492(gp)
+lw t1,-360(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-492(gp)
+lw t1,-364(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-492(gp)
+lw t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,-492(gp)
+lw t1,-372(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-492(gp)
+lw t1,-376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-492(gp)
+lw t1,-344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,53
+jal zero,51
+lw t0,-492(gp)
+lw t1,-364(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,43
+jal zero,41
+lw t0,-492(gp)
+lw t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,33
+jal zero,31
+lw t0,-492(gp)
+lw t1,-332(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,23
+jal zero,21
+jal ra,26
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-492(gp)
+lw t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-277
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-492(gp)
+lw t1,-300(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-492(gp)
+lw t1,-356(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-492(gp)
+lw t1,-288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-492(gp)
+lw t1,-336(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-389
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,-492(gp)
+lw t1,-320(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-492(gp)
+lw t1,-288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-492(gp)
+lw t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,56
+jal zero,54
+lw t0,-492(gp)
+lw t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,46
+jal zero,44
+lw t0,-492(gp)
+lw t1,-312(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,36
+jal zero,34
+lw t0,-492(gp)
+lw t1,-328(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,-492(gp)
+lw t1,-324(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-492(gp)
+lw t1,-288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-285
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,-492(gp)
+lw t1,-288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,652
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-452(gp)
+sw t0,4(sp)
+jal ra,-2534
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2570
+lui t0,0xFFFFF
+addi t0,t0,632
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2986
+lw t0,-492(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2580
+lui t0,0xFFFFF
+addi t0,t0,624
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2996
+lw t0,-468(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-468(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,652
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-452(gp)
+sw t0,4(sp)
+jal ra,-2576
+lui t0,0xFFFFF
+addi t0,t0,140
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3024
+lw t0,-492(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2618
+lui t0,0xFFFFF
+addi t0,t0,624
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3034
+lw t0,-468(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-468(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-492(gp)
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1972
+addi t0,zero,1
+addi a0,t0,0
+jal zero,9
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-98
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1176(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12617
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,652
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-452(gp)
+sw t0,4(sp)
+jal ra,-2668
+lui t0,0xFFFFF
+addi t0,t0,124
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-3118
+addi sp,sp,4
+lw t0,-468(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-468(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,652
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-452(gp)
+sw t0,4(sp)
+jal ra,-2699
+lui t0,0xFFFFF
+addi t0,t0,96
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-472(gp)
+sw t0,8(sp)
+jal ra,-3151
+addi sp,sp,8
+lw t0,-468(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-468(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,zero,-552
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3177
+jal zero,45
+lw t0,8(s0)
+lw t1,-732(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,84
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3190
+jal zero,32
+lw t0,8(s0)
+lw t1,-736(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,zero,-572
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3202
+jal zero,20
+lw t0,8(s0)
+lw t1,-740(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,72
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3215
+jal zero,7
+lui t0,0xFFFFF
+addi t0,t0,64
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3222
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,56
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-452(gp)
+sw t0,4(sp)
+jal ra,-2798
+lui t0,0xFFFFF
+addi t0,t0,40
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3246
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-88
+lui t0,0xFFFFF
+addi t0,t0,632
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3256
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-98
+lui t0,0xFFFFF
+addi t0,t0,624
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3266
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,-492(gp)
+lw t1,-288(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,143
+jal ra,-465
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-280
+lw t0,-492(gp)
+lw t1,-288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1176(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12823
+jal zero,2
+jal ra,-2217
+jal zero,-18
+jal ra,-868
+addi t0,a0,0
+beq t0,zero,79
+jal ra,257
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-492(gp)
+lw t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,65
+lw t0,-472(gp)
+sw t0,-8(s0)
+jal ra,-2233
+lw t0,-492(gp)
+lw t1,-344(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,50
+lw t0,-8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,102
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,266
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-12089
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12231
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12219
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12301
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,8114
+lw t0,-1496(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1496(gp)
+lw t0,-340(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-325
+jal zero,7
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,2621
+jal zero,5
+lw t0,-304(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-417
+jal zero,42
+lw t0,-492(gp)
+lw t1,-320(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+jal ra,-2306
+lw t0,-492(gp)
+lw t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-2313
+lw t0,-732(gp)
+sw t0,-4(s0)
+jal zero,3
+lw t0,-736(gp)
+sw t0,-4(s0)
+lw t0,-492(gp)
+lw t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,-472(gp)
+sw t0,-8(s0)
+jal ra,-2327
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,2581
+jal zero,5
+lw t0,-304(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-457
+jal zero,2
+jal ra,-417
+jal zero,-146
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,61
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-708(gp)
+sw t0,4(sp)
+jal ra,-1450
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+lw t0,-1536(gp)
+lw t1,-68(gp)
+add t0,t0,t1
+sw t0,-1536(gp)
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-452(gp)
+sw t0,8(sp)
+lw t0,-708(gp)
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,-1536(gp)
+sub t0,zero,t0
+sw t0,24(sp)
+jal ra,-1648
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-788(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-788(gp)
+jal zero,18
+lui t0,0xFFFFF
+addi t0,t0,56
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-452(gp)
+sw t0,4(sp)
+jal ra,-3049
+lui t0,0xFFFFF
+addi t0,t0,-4
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-3499
+addi sp,sp,4
+jal zero,51
+lw t0,-492(gp)
+lw t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+lw t0,-748(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,-472(gp)
+sw t0,4(sp)
+lw t0,-452(gp)
+sw t0,8(sp)
+lw t0,-708(gp)
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,16(s0)
+sw t0,24(sp)
+jal ra,-1695
+addi t0,a0,0
+sw t0,-4(s0)
+jal ra,-2443
+jal zero,25
+lw t0,-304(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-567
+lw t0,-748(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-12
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-452(gp)
+sw t0,8(sp)
+lw t0,-708(gp)
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,16(s0)
+sw t0,24(sp)
+jal ra,-1721
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-728(gp)
+sw t0,-4(s0)
+jal ra,-1136
+addi t0,a0,0
+beq t0,zero,18
+jal ra,-2490
+jal ra,-1140
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-2494
+jal zero,-4
+lw t0,-492(gp)
+lw t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-732(gp)
+sw t0,-4(s0)
+jal ra,-2504
+jal zero,-9
+jal zero,5
+lw t0,-308(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-629
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-492(gp)
+lw t1,-380(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+jal ra,-2533
+lw t0,-492(gp)
+lw t1,-344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-2540
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,48
+jal zero,12
+lw t0,8(s0)
+lw t1,-728(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-728(gp)
+sw t0,4(sp)
+jal ra,-411
+lw t0,-492(gp)
+lw t1,-364(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sw t0,-488(gp)
+jal ra,-2565
+jal ra,65
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-488(gp)
+beq t0,zero,8
+addi t0,zero,0
+sw t0,-488(gp)
+lw t0,-4(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,10
+jal zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,-119
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+lw t1,-740(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lw t0,8(s0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-471
+lw t0,-348(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-659
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,-1268
+addi t0,a0,0
+beq t0,zero,8
+lw t0,-484(gp)
+sw t0,-4(s0)
+jal ra,-2642
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,7
+jal zero,5
+jal ra,-724
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,-888
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-744
+lw t0,-492(gp)
+lw t1,-288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1176(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13287
+jal zero,2
+jal ra,-2681
+jal zero,-18
+lw t0,-492(gp)
+lw t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,357
+lw t0,-340(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-735
+jal zero,56
+lw t0,-492(gp)
+lw t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+lw t0,-472(gp)
+sw t0,-4(s0)
+jal ra,-2706
+lw t0,-492(gp)
+lw t1,-344(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,334
+jal zero,5
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2893
+lw t0,-340(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-763
+jal zero,28
+lw t0,-492(gp)
+lw t1,-312(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,1614
+jal zero,20
+lw t0,-492(gp)
+lw t1,-328(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,1740
+jal zero,12
+lw t0,-492(gp)
+lw t1,-324(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,3075
+lw t0,-340(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-791
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,12
+sw t0,8(sp)
+jal ra,-6441
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,20
+sw t0,8(sp)
+jal ra,-6451
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,11
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6655
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,40
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+jal ra,-6175
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,6932
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,19
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6685
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,6998
+jal zero,13
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+jal ra,-6210
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,6897
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-6219
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12825
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-6300
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+jal ra,-1736
+jal ra,-1706
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-138
+addi t0,a0,0
+sw t0,-4(s0)
+jal ra,-1715
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12838
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1725
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6889
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-67
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12892
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+jal ra,-1796
+jal ra,-1766
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12889
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,7031
+jal zero,11
+jal ra,-1780
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-1784
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,7020
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12966
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2027
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-995
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1176(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13624
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-115
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,44
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-76
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13002
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-211
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13036
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+jal ra,-1908
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13087
+addi t0,a0,0
+sw t0,-20(s0)
+jal zero,56
+lw t0,-368(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1117
+addi t0,zero,1
+sw t0,-4(s0)
+lw t0,-492(gp)
+lw t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,-472(gp)
+sw t0,8(s0)
+jal ra,-3117
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-94
+addi t0,a0,0
+sw t0,-20(s0)
+jal zero,29
+lw t0,-492(gp)
+lw t1,-344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-3131
+jal ra,115
+addi t0,a0,0
+sw t0,-20(s0)
+lw t0,-348(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1177
+jal zero,14
+jal ra,-1217
+jal ra,-1987
+jal ra,-1957
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,6622
+lw t0,-732(gp)
+sw t0,-20(s0)
+jal ra,-1968
+addi t0,a0,0
+sw t0,-12(s0)
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-492(gp)
+lw t1,-380(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+jal ra,-3164
+lw t0,-4(s0)
+beq t0,zero,15
+lw t0,-20(s0)
+lw t1,-732(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lw t0,-732(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-20(s0)
+sw t0,4(sp)
+jal ra,-1032
+jal zero,3
+lw t0,-728(gp)
+sw t0,-20(s0)
+jal ra,66
+addi t0,a0,0
+sw t0,-24(s0)
+lw t0,-20(s0)
+lw t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,-20(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-24(s0)
+sw t0,4(sp)
+jal ra,-1049
+lw t0,-12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-16(s0)
+sw t0,4(sp)
+jal ra,-2015
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6840
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1889
+lw t0,-800(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-800(gp)
+jal zero,5
+lw t0,-380(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1335
+lw t0,-4(s0)
+beq t0,zero,6
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1904
+jal zero,18
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13180
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1922
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+jal ra,236
+addi t0,a0,0
+sw t0,-4(s0)
+jal ra,-1838
+addi t0,a0,0
+beq t0,zero,221
+lw t0,-492(gp)
+sw t0,-8(s0)
+jal ra,-3261
+jal ra,227
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-4(s0)
+lw t1,-12(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-1130
+lw t0,-728(gp)
+sw t0,-4(s0)
+lw t0,-8(s0)
+lw t1,-384(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+jal ra,-2054
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2103
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2061
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6540
+jal ra,-2110
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,6469
+jal ra,-2074
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2078
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2126
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6648
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2000
+jal zero,160
+lw t0,-8(s0)
+lw t1,-388(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+jal ra,-2096
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2145
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2103
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6498
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2022
+jal ra,-2156
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+jal ra,-2162
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6612
+jal zero,128
+lw t0,-8(s0)
+lw t1,-392(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-2128
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2132
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2180
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6594
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2054
+jal zero,106
+lw t0,-8(s0)
+lw t1,-400(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-2150
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2199
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2157
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6572
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2076
+jal zero,84
+lw t0,-8(s0)
+lw t1,-396(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+jal ra,-2172
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2221
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2179
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6550
+jal ra,-2228
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,6351
+jal ra,-2192
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2241
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2199
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6402
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2118
+jal zero,42
+lw t0,-8(s0)
+lw t1,-404(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+jal ra,-2214
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2218
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2266
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6508
+jal ra,-2270
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,6309
+jal ra,-2234
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2283
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2241
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6360
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2160
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+jal ra,182
+addi t0,a0,0
+sw t0,-4(s0)
+jal ra,-2006
+addi t0,a0,0
+beq t0,zero,167
+lw t0,-492(gp)
+sw t0,-8(s0)
+jal ra,-3503
+jal ra,173
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-8(s0)
+lw t1,-360(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,55
+lw t0,-4(s0)
+lw t1,-732(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lw t0,-12(s0)
+lw t1,-728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-2340
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-52(gp)
+sw t0,4(sp)
+jal ra,2704
+jal zero,7
+lui t0,0xFFFFF
+addi t0,t0,-52
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4152
+jal zero,16
+lw t0,-12(s0)
+lw t1,-732(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-2316
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-52(gp)
+sw t0,4(sp)
+jal ra,2683
+lw t0,-732(gp)
+sw t0,-4(s0)
+jal ra,-2325
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2329
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2377
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6237
+jal zero,96
+lw t0,-8(s0)
+lw t1,-364(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,90
+lw t0,-4(s0)
+lw t1,-732(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,60
+lw t0,-12(s0)
+lw t1,-728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-2400
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-52(gp)
+sw t0,4(sp)
+jal ra,2644
+jal ra,-2362
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2366
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2414
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6232
+jal zero,34
+jal ra,-2374
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2378
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2426
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6220
+jal ra,-2430
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-52(gp)
+sw t0,8(sp)
+jal ra,6149
+jal ra,-2394
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2398
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2446
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6264
+lw t0,-728(gp)
+sw t0,-4(s0)
+jal zero,25
+lw t0,-12(s0)
+lw t1,-732(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-92
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4263
+jal zero,12
+jal ra,-2421
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2425
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2473
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6173
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2347
+jal zero,-168
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+jal ra,91
+addi t0,a0,0
+sw t0,-4(s0)
+jal ra,-2160
+addi t0,a0,0
+beq t0,zero,76
+lw t0,-492(gp)
+sw t0,-8(s0)
+jal ra,-3691
+jal ra,82
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-4(s0)
+lw t1,-12(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-1560
+lw t0,-8(s0)
+lw t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-2482
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2486
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2534
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6144
+jal zero,36
+lw t0,-8(s0)
+lw t1,-372(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-2500
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2504
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2552
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6158
+jal zero,18
+lw t0,-8(s0)
+lw t1,-376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-2518
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2522
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2570
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,6172
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2444
+jal zero,-77
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-20
+jal ra,-1930
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-1860
+lw t0,-492(gp)
+lw t1,-288(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1176(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14403
+jal zero,2
+jal ra,-3797
+jal zero,-18
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-492(gp)
+lw t1,-344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+jal ra,-3807
+jal ra,-2457
+addi t0,a0,0
+beq t0,zero,8
+lw t0,-740(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1222
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,11
+jal ra,-571
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-348(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1863
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,221
+lw t0,-492(gp)
+lw t1,-364(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+addi t0,zero,1
+sw t0,-12(s0)
+addi t0,zero,1
+sw t0,-488(gp)
+jal ra,-3838
+addi t0,zero,0
+sw t0,-488(gp)
+jal zero,3
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-492(gp)
+lw t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+sw t0,-16(s0)
+jal ra,-3852
+jal zero,3
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-492(gp)
+lw t1,-332(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+jal ra,-3862
+lw t0,-344(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1905
+jal ra,-1388
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-348(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1912
+jal ra,-2720
+lw t0,-8(s0)
+lw t1,-728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+jal ra,-2696
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-52(gp)
+sw t0,8(sp)
+jal ra,5883
+jal zero,10
+jal ra,-2706
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-56(gp)
+sw t0,8(sp)
+jal ra,5873
+lw t0,-728(gp)
+sw t0,-8(s0)
+jal zero,83
+jal ra,-2262
+addi t0,a0,0
+beq t0,zero,5
+jal ra,397
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,76
+lw t0,-492(gp)
+lw t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+lw t0,-472(gp)
+sw t0,-20(s0)
+jal ra,-3918
+lw t0,-492(gp)
+lw t1,-344(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lw t0,-20(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-900
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,32
+lw t0,-20(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1679
+addi t0,a0,0
+sw t0,-8(s0)
+jal ra,-2783
+lw t0,-8(s0)
+lw t1,-736(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+jal ra,-2758
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-896(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,5821
+jal zero,10
+jal ra,-2768
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,5811
+jal zero,23
+lw t0,-492(gp)
+lw t1,-344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-3969
+jal ra,-723
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-348(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2015
+jal zero,8
+jal ra,-2055
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,181
+lw t0,-728(gp)
+sw t0,-8(s0)
+lw t0,-16(s0)
+beq t0,zero,24
+lw t0,-8(s0)
+lw t1,-732(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,-732(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-1852
+jal ra,-2813
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2817
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,5987
+lw t0,-728(gp)
+sw t0,-8(s0)
+lw t0,-12(s0)
+beq t0,zero,24
+lw t0,-8(s0)
+lw t1,-728(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lw t0,-728(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-1877
+lw t0,-728(gp)
+sw t0,-8(s0)
+jal ra,-2840
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+jal ra,-2846
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,5800
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-7481
+addi t0,a0,0
+beq t0,zero,10
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,5698
+jal zero,17
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1322
+addi t0,a0,0
+sw t0,12(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,5681
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-476(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-712(gp)
+sw t0,4(sp)
+jal ra,-3194
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+lw t0,-1536(gp)
+lw t1,-68(gp)
+add t0,t0,t1
+sw t0,-1536(gp)
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,-476(gp)
+sw t0,4(sp)
+lw t0,-452(gp)
+sw t0,8(sp)
+lw t0,-712(gp)
+sw t0,12(sp)
+lw t0,-728(gp)
+sw t0,16(sp)
+lw t0,8(s0)
+sw t0,20(sp)
+lw t0,-1536(gp)
+sub t0,zero,t0
+sw t0,24(sp)
+jal ra,-3392
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1536(gp)
+sub t0,zero,t0
+sw t0,4(sp)
+lw t0,-452(gp)
+sw t0,8(sp)
+jal ra,6244
+lw t0,-1508(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1508(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1232
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+jal ra,-7590
+addi t0,a0,0
+beq t0,zero,10
+jal ra,-3022
+jal ra,-2992
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-129
+jal zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-91
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14152
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43
+jal ra,-3022
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14145
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-3032
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,5582
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-480(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-716(gp)
+sw t0,4(sp)
+jal ra,-3323
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+lw t0,-1536(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-480(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7321
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-5203
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-1536(gp)
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,-480(gp)
+sw t0,4(sp)
+lw t0,-452(gp)
+sw t0,8(sp)
+lw t0,-716(gp)
+sw t0,12(sp)
+lw t0,-732(gp)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,-1536(gp)
+sub t0,zero,t0
+sw t0,24(sp)
+jal ra,-3537
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6138
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-98
+lw t0,-796(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-796(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-2939
+addi t0,a0,0
+beq t0,zero,10
+lw t0,-484(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-151
+jal ra,-1684
+lw t0,-728(gp)
+addi a0,t0,0
+jal zero,23
+jal zero,21
+lw t0,-492(gp)
+lw t1,-300(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-100
+jal ra,-4327
+lw t0,-732(gp)
+addi a0,t0,0
+jal zero,11
+jal zero,9
+jal ra,-2409
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-173
+lw t0,-728(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,-492(gp)
+lw t1,-312(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,109
+jal ra,-4358
+lw t0,-492(gp)
+lw t1,-344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,97
+jal ra,-4365
+jal ra,-1119
+lw t0,-1524(gp)
+sw t0,-4(s0)
+jal ra,-3184
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,5715
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3063
+lw t0,-492(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,69
+jal ra,-4388
+lw t0,-492(gp)
+lw t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-4395
+jal ra,-2724
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-1741
+jal zero,-4
+lw t0,-356(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2415
+jal zero,2
+jal ra,-1748
+lw t0,-492(gp)
+lw t1,-316(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,39
+jal ra,-4413
+lw t0,-1524(gp)
+sw t0,-8(s0)
+lw t0,-856(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,5701
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,5783
+lw t0,-492(gp)
+lw t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-4432
+jal ra,-2761
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-1778
+jal zero,-4
+lw t0,-356(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2452
+jal zero,2
+jal ra,-1785
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1524(gp)
+sw t0,4(sp)
+jal ra,5813
+jal zero,5
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,5754
+jal zero,5
+lw t0,-348(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2578
+jal zero,5
+lw t0,-344(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2583
+jal zero,5
+lw t0,-312(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2588
+lw t0,-808(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-808(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,-1524(gp)
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-492(gp)
+lw t1,-328(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,61
+jal ra,-4496
+lw t0,-492(gp)
+lw t1,-344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,49
+jal ra,-4503
+jal ra,-1257
+lw t0,-1524(gp)
+sw t0,-8(s0)
+jal ra,-3322
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,5577
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3201
+lw t0,-492(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+jal ra,-4526
+lw t0,-492(gp)
+lw t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-4533
+jal ra,-2862
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-1879
+jal zero,-4
+lw t0,-356(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2553
+jal zero,2
+jal ra,-1886
+jal zero,5
+lw t0,-348(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2668
+jal zero,5
+lw t0,-344(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2673
+jal zero,5
+lw t0,-328(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2678
+lw t0,-856(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+lw t1,-1524(gp)
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,5555
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,5632
+lw t0,-804(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-804(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-116
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7508
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+addi t0,t0,-124
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7642
+addi t0,a0,0
+addi a0,t0,0
+jal zero,46
+jal zero,44
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-152
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7528
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+addi t0,t0,-160
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7662
+addi t0,a0,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-188
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7548
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+addi t0,t0,-196
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7682
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-204
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7582
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,65
+jal zero,60
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-220
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7596
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,51
+jal zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1484(t0)
+beq t0,zero,42
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-240
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7614
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,33
+jal zero,28
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-264
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7628
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,19
+jal zero,14
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-288
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-7642
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sub t0,zero,t0
+sw t0,8(sp)
+jal ra,5011
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+lw t0,-860(gp)
+sw t0,8(sp)
+jal ra,5274
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sub t0,zero,t0
+sw t0,8(sp)
+jal ra,4994
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+lw t0,-888(gp)
+sw t0,8(sp)
+jal ra,5257
+lw t0,-888(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,4978
+lw t0,8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,32
+lw t0,8(s0)
+sub t0,zero,t0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-8222
+addi t0,a0,0
+beq t0,zero,11
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,8(s0)
+sub t0,zero,t0
+sw t0,8(sp)
+jal ra,4956
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-316
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5437
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15437
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,9
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-888(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,4921
+lw t0,-888(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,5135
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,4905
+lw t0,-860(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,5119
+lw t0,-68(gp)
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-8300
+addi t0,a0,0
+beq t0,zero,12
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+lw t1,12(s0)
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,4877
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-344
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5516
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15516
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sw t0,-760(gp)
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-492(gp)
+lw t1,-344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,104
+jal ra,-4932
+lw t0,-492(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,96
+jal ra,-3587
+addi t0,a0,0
+beq t0,zero,88
+addi t0,zero,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2465
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2601
+addi t0,a0,0
+sw t0,-12(s0)
+addi t0,zero,1
+sw t0,-8(s0)
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,2
+lw t1,-68(gp)
+mul t0,t0,t1
+lw t1,-8(s0)
+addi t2,zero,1
+sub t1,t1,t2
+lw t2,-68(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-14781
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3265
+addi t0,a0,0
+beq t0,zero,50
+jal ra,-4974
+lw t0,-492(gp)
+lw t1,-408(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4981
+addi t0,zero,1
+sw t0,-4(s0)
+jal zero,38
+jal ra,-3634
+addi t0,a0,0
+beq t0,zero,31
+addi t0,zero,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2512
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2648
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,2
+lw t1,-68(gp)
+mul t0,t0,t1
+lw t1,-8(s0)
+addi t2,zero,1
+sub t1,t1,t2
+lw t2,-68(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-14830
+jal zero,5
+lw t0,-308(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3140
+jal zero,-54
+lw t0,-348(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3065
+jal zero,5
+lw t0,-308(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3150
+jal zero,2
+jal ra,-5033
+jal zero,5
+lw t0,-344(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3157
+lw t0,-4(s0)
+beq t0,zero,4
+lw t0,-8(s0)
+sub t0,zero,t0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-460
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-720(gp)
+sw t0,4(sp)
+jal ra,-4141
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-452(gp)
+sw t0,8(sp)
+lw t0,-720(gp)
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+lw t0,-8(s0)
+sw t0,20(sp)
+addi t0,zero,0
+sw t0,24(sp)
+jal ra,-4334
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,17
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15074
+addi t0,a0,0
+lw t1,-740(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-14946
+lw t0,-492(gp)
+lw t1,-340(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15096
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15105
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-2978
+jal ra,-5124
+jal zero,208
+lw t0,-492(gp)
+lw t1,-352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,201
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4128
+addi t0,a0,0
+beq t0,zero,72
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-452(gp)
+sw t0,4(sp)
+jal ra,-15025
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15135
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15144
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-3017
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-15016
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15122
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15131
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1524(gp)
+sw t0,4(sp)
+jal ra,5117
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1524(gp)
+sw t0,4(sp)
+jal ra,-15007
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-824(gp)
+sw t0,4(sp)
+jal ra,-8108
+addi t0,a0,0
+beq t0,zero,3
+lw t0,-496(gp)
+sw t0,-1512(gp)
+lw t0,-792(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-792(gp)
+jal zero,28
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-551
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+addi t0,t0,56
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-452(gp)
+sw t0,4(sp)
+jal ra,-5867
+lui t0,0xFFFFF
+addi t0,t0,-384
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-6317
+addi sp,sp,4
+jal ra,-5236
+addi t0,zero,0
+sw t0,-16(s0)
+jal ra,-3888
+addi t0,a0,0
+beq t0,zero,20
+lw t0,-16(s0)
+lw t1,-68(gp)
+add t0,t0,t1
+sw t0,-16(s0)
+addi t0,zero,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-2770
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-16(s0)
+sub t0,zero,t0
+sw t0,8(sp)
+jal ra,-2907
+lw t0,-340(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3298
+jal zero,-21
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-516
+lw t0,-12(s0)
+sw t0,-776(gp)
+addi t0,zero,0
+sw t0,-780(gp)
+lw t0,12(s0)
+sw t0,-784(gp)
+jal ra,-3599
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-2616
+jal zero,-4
+addi t0,zero,0
+sw t0,-784(gp)
+lw t0,12(s0)
+lw t1,-736(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,4482
+lw t0,-780(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1524(gp)
+sw t0,4(sp)
+jal ra,5008
+addi t0,zero,0
+sw t0,-780(gp)
+lw t0,-4(s0)
+beq t0,zero,11
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sub t0,zero,t0
+lw t1,-68(gp)
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-474
+jal zero,9
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,-68(gp)
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-483
+lw t0,-856(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-860(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,4822
+lw t0,-356(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3369
+jal zero,2
+jal ra,-3409
+addi t0,zero,0
+sw t0,-776(gp)
+addi t0,zero,0
+sw t0,-760(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-772(gp)
+sw t0,-4(s0)
+lw t0,-772(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,24
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sub t0,zero,t0
+sw t0,8(sp)
+jal ra,4409
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-4184
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,4671
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4058
+jal zero,-26
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-772(gp)
+lw t1,8(s0)
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-4243
+jal ra,-4213
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,4588
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,4358
+jal zero,-22
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15475
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-396
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-8349
+addi t0,a0,0
+beq t0,zero,3
+jal ra,469
+jal zero,24
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-404
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-8361
+addi t0,a0,0
+beq t0,zero,3
+jal ra,574
+jal zero,12
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-412
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-8373
+addi t0,a0,0
+beq t0,zero,2
+jal ra,667
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15459
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3482
+lw t0,-740(gp)
+sw t0,-4(s0)
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-452(gp)
+sw t0,8(sp)
+lw t0,-720(gp)
+sw t0,12(sp)
+lw t0,-4(s0)
+sw t0,16(sp)
+lw t0,16(s0)
+sw t0,20(sp)
+lw t0,-1524(gp)
+sw t0,24(sp)
+jal ra,-4770
+lw t0,-860(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,4601
+jal zero,81
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15514
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15482
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1524(gp)
+sw t0,4(sp)
+jal ra,-15358
+lw t0,-860(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,4572
+jal zero,52
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15505
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3947
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2200
+addi t0,a0,0
+lw t1,-1148(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lw t0,-860(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15526
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,4543
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1524(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-15403
+jal zero,13
+lw t0,-860(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15547
+addi t0,a0,0
+lw t1,-1524(gp)
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,4520
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,-5619
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-724(gp)
+sw t0,4(sp)
+jal ra,-4711
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-215
+addi t0,a0,0
+addi a0,t0,0
+jal zero,178
+jal ra,-297
+addi t0,a0,0
+sw t0,-8(s0)
+jal ra,-4240
+addi t0,a0,0
+beq t0,zero,65
+jal ra,-2399
+lw t0,-1524(gp)
+sw t0,-12(s0)
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,4116
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-4477
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,4378
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4351
+addi t0,zero,1
+sw t0,-16(s0)
+lw t0,-492(gp)
+lw t1,-336(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+jal ra,-5678
+jal ra,-2432
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-16(s0)
+lw t1,-68(gp)
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-4502
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,4353
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4376
+lw t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,-27
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-16(s0)
+lw t1,-68(gp)
+mul t0,t0,t1
+sub t0,zero,t0
+sw t0,4(sp)
+jal ra,4632
+jal zero,3
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-492(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,82
+jal ra,-5718
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-720(gp)
+sw t0,4(sp)
+jal ra,-4810
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-16(s0)
+sw t0,8(sp)
+jal ra,-252
+addi t0,a0,0
+sw t0,-24(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,57
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15714
+addi t0,a0,0
+sw t0,-20(s0)
+lw t0,-20(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-9329
+addi t0,a0,0
+beq t0,zero,32
+lw t0,-20(s0)
+sub t0,zero,t0
+sw t0,-20(s0)
+lw t0,-16(s0)
+lw t1,-20(s0)
+sltu t0,t1,t0
+beq t0,zero,14
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-16(s0)
+lw t1,-20(s0)
+sub t0,t0,t1
+lw t1,-68(gp)
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,3998
+jal zero,11
+lw t0,-16(s0)
+lw t1,-20(s0)
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+addi t0,t0,-448
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6399
+jal zero,12
+lw t0,-16(s0)
+lw t1,-20(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+addi t0,t0,-500
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6411
+jal zero,7
+lw t0,-348(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3921
+lw t0,-728(gp)
+sw t0,-24(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-420
+lw t0,-812(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-812(gp)
+lw t0,-24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-324(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3871
+lw t0,-492(gp)
+lw t1,-340(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,34
+jal ra,-2591
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-784(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,-784(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-3706
+lw t0,-784(gp)
+lw t1,-736(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-4675
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,3907
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4551
+jal zero,20
+lw t0,-784(gp)
+lw t1,-736(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+lw t0,-784(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-736(gp)
+sw t0,4(sp)
+jal ra,-3736
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,3883
+lw t0,-856(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-780(gp)
+sw t0,4(sp)
+jal ra,4227
+lw t0,-1524(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+sub t0,t0,t1
+sw t0,-780(gp)
+lw t0,-816(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-816(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-776(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15892
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-9505
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+addi t0,t0,-544
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6555
+lw t0,-492(gp)
+lw t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,72
+lw t0,-472(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5002
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,55
+jal ra,-5959
+lw t0,-492(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+jal ra,-5966
+addi t0,zero,2
+lw t1,-68(gp)
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-776(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15944
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lw t2,-68(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1821
+jal ra,-4800
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-888(gp)
+sw t0,4(sp)
+jal ra,-4806
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,3808
+lw t0,-888(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15951
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-4819
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,4036
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4693
+jal zero,6
+lw t0,-472(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4001
+jal ra,-6017
+jal zero,5
+lw t0,-304(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4141
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-492(gp)
+lw t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,80
+lw t0,-472(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5099
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,63
+jal ra,-6056
+lw t0,-492(gp)
+lw t1,-348(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+jal ra,-6063
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16017
+addi t0,a0,0
+sw t0,-8(s0)
+jal ra,-4916
+jal ra,-4886
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-888(gp)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+jal ra,3915
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-4898
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,3906
+jal ra,-4904
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-4908
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,3674
+lw t0,-888(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-4919
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,3936
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4793
+jal zero,5
+lw t0,-348(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4235
+jal zero,6
+lw t0,-472(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4106
+jal ra,-6122
+jal zero,5
+lw t0,-304(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4246
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-776(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16111
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-9724
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+addi t0,t0,-588
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6774
+lw t0,-492(gp)
+lw t1,-304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-6167
+lw t0,-348(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4210
+jal zero,5
+lw t0,-304(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4295
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-5033
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,8(sp)
+jal ra,3575
+jal ra,-5013
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,3566
+jal ra,-5022
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-5028
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,3714
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-5037
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,3609
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4911
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-4966
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,3524
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-4980
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,3609
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,21
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,3452
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-9
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,-1296(gp)
+sw t0,-1520(gp)
+lw t0,-1524(gp)
+lw t1,-68(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,3425
+lw t0,-1520(gp)
+lw t1,-1524(gp)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1868(gp)
+sw t0,4(sp)
+jal ra,-7253
+addi t0,a0,0
+sw t0,-1532(gp)
+lw t0,-1532(gp)
+lw t1,-1536(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-1524(gp)
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-1524(gp)
+jal ra,-5252
+addi t0,a0,0
+beq t0,zero,10
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,3441
+jal zero,185
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,31
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10203
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,11
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10214
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+sub t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2199
+jal zero,13
+lui t0,0xFFFFF
+addi t0,t0,-620
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-6983
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16983
+lw t0,-868(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-5194
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,3388
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5070
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,3376
+lw t0,-924(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-1580(gp)
+sw t0,8(sp)
+jal ra,3368
+jal ra,3773
+lw t0,-896(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-229
+lw t0,-924(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-1580(gp)
+sw t0,8(sp)
+jal ra,3353
+jal ra,3758
+lw t0,-828(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-708(gp)
+sw t0,4(sp)
+jal ra,-5512
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16363
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16389
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-896(gp)
+sw t0,8(sp)
+jal ra,3599
+jal ra,-5291
+jal ra,-5261
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,3540
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sub t0,zero,t0
+sw t0,8(sp)
+jal ra,3309
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-5284
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,3571
+jal ra,-5288
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,2
+lw t1,-68(gp)
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,3289
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-5304
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,3551
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5178
+lw t0,-824(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-720(gp)
+sw t0,4(sp)
+jal ra,-5588
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-824(gp)
+sw t0,4(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16482
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-1034
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sub t0,zero,t0
+sw t0,8(sp)
+jal ra,3247
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+lw t0,-896(gp)
+sw t0,8(sp)
+jal ra,3510
+lw t0,-1444(gp)
+lw t1,-1524(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+divu t1,t1,t2
+sub t0,t0,t1
+sw t0,-1444(gp)
+lw t0,-8(s0)
+sw t0,-1524(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-108(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-17148
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+sw t0,4(sp)
+jal ra,-9934
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+addi t0,zero,0
+sw t0,-12(s0)
+addi t0,zero,1
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+addi t0,t0,-632
+add t0,gp,t0
+sw t0,-496(gp)
+lw t0,-496(gp)
+sw t0,-1512(gp)
+jal ra,-15980
+lw t0,-1288(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7333
+addi t0,a0,0
+sw t0,-1516(gp)
+lw t0,-1292(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7339
+addi t0,a0,0
+sw t0,-1528(gp)
+lw t0,-1288(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7351
+addi t0,a0,0
+sw t0,-1540(gp)
+lw t0,-1292(gp)
+lw t1,-68(gp)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7361
+addi t0,a0,0
+sw t0,-1544(gp)
+jal ra,-16413
+jal ra,-15990
+jal ra,-372
+jal ra,5861
+jal ra,5974
+jal ra,6662
+jal ra,7034
+jal ra,7393
+jal ra,7921
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1484(t0)
+beq t0,zero,6
+jal ra,25612
+jal ra,25659
+lw t0,-1524(gp)
+sw t0,-12(s0)
+jal ra,25704
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-396
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-9694
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-724(gp)
+sw t0,12(sp)
+lw t0,-736(gp)
+sw t0,16(sp)
+addi t0,zero,1
+sw t0,20(sp)
+addi t0,zero,0
+sw t0,24(sp)
+jal ra,-5927
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-404
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-9716
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-724(gp)
+sw t0,12(sp)
+lw t0,-728(gp)
+sw t0,16(sp)
+addi t0,zero,1
+sw t0,20(sp)
+addi t0,zero,0
+sw t0,24(sp)
+jal ra,-5949
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-412
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-9738
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-724(gp)
+sw t0,12(sp)
+lw t0,-736(gp)
+sw t0,16(sp)
+addi t0,zero,1
+sw t0,20(sp)
+addi t0,zero,0
+sw t0,24(sp)
+jal ra,-5971
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,-824(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-720(gp)
+sw t0,12(sp)
+lw t0,-728(gp)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+addi t0,zero,0
+sw t0,24(sp)
+jal ra,-5987
+lw t0,-4(s0)
+beq t0,zero,235
+jal ra,37329
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sw t0,-4(s0)
+jal zero,224
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,37348
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-10046
+addi t0,a0,0
+addi t1,zero,45
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sw t0,-4(s0)
+jal zero,205
+jal ra,37362
+addi t0,a0,0
+sw t0,-496(gp)
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFF
+addi t0,t0,-720
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-7867
+addi sp,sp,4
+lui t0,0xFFFFF
+addi t0,t0,-784
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-496(gp)
+sw t0,8(sp)
+lw t0,-72(gp)
+sw t0,12(sp)
+lw t0,-20(gp)
+sw t0,16(sp)
+jal ra,-7884
+addi sp,sp,16
+lw t0,-496(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-256
+addi t0,a0,0
+sw t0,-500(gp)
+lw t0,-500(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-10390
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFF
+addi t0,t0,-820
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-496(gp)
+sw t0,8(sp)
+jal ra,-7911
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17443
+jal ra,-16943
+jal ra,-16593
+jal ra,-4649
+lui t0,0xFFFFF
+addi t0,t0,-908
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-7931
+addi sp,sp,4
+lui t0,0xFFFFF
+addi t0,t0,-964
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-448(gp)
+sw t0,8(sp)
+lw t0,-452(gp)
+sw t0,12(sp)
+lw t0,-460(gp)
+sw t0,16(sp)
+jal ra,-7948
+addi sp,sp,16
+lui t0,0xFFFFF
+addi t0,t0,-1024
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-448(gp)
+lw t1,-456(gp)
+sub t0,t0,t1
+sw t0,8(sp)
+lw t0,-448(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-448(gp)
+lw t1,-456(gp)
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-9093
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-448(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-448(gp)
+lw t1,-456(gp)
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-9075
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-464(gp)
+sw t0,20(sp)
+jal ra,-7985
+addi sp,sp,20
+lui t0,0xFFFFF
+addi t0,t0,-1088
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-788(gp)
+sw t0,8(sp)
+lw t0,-792(gp)
+sw t0,12(sp)
+lw t0,-796(gp)
+sw t0,16(sp)
+jal ra,-8002
+addi sp,sp,16
+lui t0,0xFFFFF
+addi t0,t0,-1152
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-800(gp)
+sw t0,8(sp)
+lw t0,-804(gp)
+sw t0,12(sp)
+lw t0,-808(gp)
+sw t0,16(sp)
+lw t0,-812(gp)
+sw t0,20(sp)
+lw t0,-816(gp)
+sw t0,24(sp)
+jal ra,-8023
+addi sp,sp,24
+lw t0,-468(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFF
+addi t0,t0,-1224
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-468(gp)
+sw t0,8(sp)
+lw t0,-496(gp)
+sw t0,12(sp)
+jal ra,-8043
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1168(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17575
+jal zero,-235
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+addi t0,t0,-1268
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-496(gp)
+sw t0,8(sp)
+jal ra,-8069
+addi sp,sp,8
+jal ra,3515
+jal ra,-702
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1484(t0)
+beq t0,zero,5
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,25400
+lw t0,-764(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,29
+lui t0,0xFFFFF
+addi t0,t0,-908
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-8094
+addi sp,sp,4
+lui t0,0xFFFFF
+addi t0,t0,-1328
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-764(gp)
+sw t0,8(sp)
+lw t0,-768(gp)
+lw t1,-764(gp)
+divu t0,t0,t1
+sw t0,12(sp)
+jal ra,-8111
+addi sp,sp,12
+lui t0,0xFFFFF
+addi t0,t0,-1416
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-8122
+addi sp,sp,4
+lui t0,0xFFFFF
+addi t0,t0,-1488
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1524(gp)
+lw t1,-1536(gp)
+add t0,t0,t1
+sw t0,8(sp)
+lw t0,-1524(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+divu t0,t0,t1
+sw t0,12(sp)
+lw t0,-1536(gp)
+sw t0,16(sp)
+jal ra,-8145
+addi sp,sp,16
+jal ra,1889
+lui t0,0xFFFFF
+addi t0,t0,-908
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-8157
+addi sp,sp,4
+lui t0,0xFFFFF
+addi t0,t0,-1524
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-8168
+addi sp,sp,4
+lui t0,0xFFFFF
+addi t0,t0,-1564
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1496(gp)
+sw t0,8(sp)
+lw t0,-1496(gp)
+lw t1,-68(gp)
+mul t0,t0,t1
+sw t0,12(sp)
+jal ra,-8185
+addi sp,sp,12
+lui t0,0xFFFFF
+addi t0,t0,-1604
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1500(gp)
+sw t0,8(sp)
+lw t0,-1504(gp)
+sw t0,12(sp)
+jal ra,-8200
+addi sp,sp,12
+lui t0,0xFFFFF
+addi t0,t0,-1644
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1508(gp)
+sw t0,8(sp)
+lw t0,-1508(gp)
+lw t1,-68(gp)
+mul t0,t0,t1
+sw t0,12(sp)
+jal ra,-8217
+addi sp,sp,12
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-984(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,888
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-8260
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-864(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+lw t0,8(s0)
+lw t1,-888(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+lw t0,8(s0)
+lw t1,-860(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-868(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-62
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-896(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+lw t0,8(s0)
+lw t1,-924(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-876(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,25
+lw t0,8(s0)
+lw t1,-884(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,20
+jal zero,14
+lw t0,8(s0)
+lw t1,-968(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1720(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,64
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1724(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-32(gp)
+sltu t0,t0,t1
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1724(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1724(t1)
+lw t2,8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+lw t0,12(s0)
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-60(gp)
+sltu t0,t1,t0
+beq t0,zero,21
+jal ra,17198
+lui t0,0xFFFFF
+addi t0,t0,-1688
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8476
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-236
+jal ra,-9362
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1936(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,18175
+jal zero,21
+jal ra,17177
+lui t0,0xFFFFF
+addi t0,t0,-1728
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8497
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-257
+jal ra,-9383
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1940(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,18154
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-114
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-10791
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1720(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-32(gp)
+sltu t0,t0,t1
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1720(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1720(t1)
+lw t2,8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-20(gp)
+lw t1,-72(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+sw t0,4(sp)
+jal ra,-80
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-10962
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,43
+lui t0,0xFFFFF
+addi t0,t0,-1744
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-452(gp)
+sw t0,4(sp)
+jal ra,-8200
+lui t0,0xFFFFF
+addi t0,t0,-1780
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11436
+addi t0,a0,0
+sub t0,zero,t0
+sw t0,8(sp)
+lw t0,12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11445
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,12(sp)
+jal ra,-8669
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18201
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11326
+addi t0,a0,0
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11334
+addi t0,a0,0
+lw t1,16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,3
+sw t0,4(sp)
+jal ra,-11342
+addi t0,a0,0
+lw t1,20(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11350
+addi t0,a0,0
+lw t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+jal ra,-11358
+addi t0,a0,0
+lw t1,28(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,28
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,25
+sw t0,4(sp)
+addi t0,zero,7
+sw t0,8(sp)
+jal ra,-11334
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+addi t0,zero,5
+sw t0,8(sp)
+jal ra,-11356
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,15
+sw t0,4(sp)
+addi t0,zero,5
+sw t0,8(sp)
+jal ra,-11378
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,3
+sw t0,8(sp)
+jal ra,-11400
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+addi t0,zero,5
+sw t0,8(sp)
+jal ra,-11422
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,7
+sw t0,8(sp)
+jal ra,-11444
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-142
+addi t0,a0,0
+sw t0,-1268(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-128
+addi t0,a0,0
+sw t0,-1252(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-114
+addi t0,a0,0
+sw t0,-1248(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-100
+addi t0,a0,0
+sw t0,-1264(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-86
+addi t0,a0,0
+sw t0,-1256(gp)
+addi t0,zero,0
+sw t0,-1260(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-312
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-11167
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11578
+addi t0,a0,0
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,3
+sw t0,4(sp)
+jal ra,-11586
+addi t0,a0,0
+lw t1,16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11594
+addi t0,a0,0
+lw t1,20(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+jal ra,-11602
+addi t0,a0,0
+lw t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+addi t0,zero,12
+sw t0,8(sp)
+jal ra,-11578
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-11279
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-1268(gp)
+lw t0,-856(gp)
+sw t0,-1252(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-242
+addi t0,a0,0
+sw t0,-1248(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-228
+addi t0,a0,0
+sw t0,-1264(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-214
+addi t0,a0,0
+sw t0,-1256(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-66
+addi t0,a0,0
+sw t0,-1260(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-447
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-11302
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+addi t0,zero,7
+sw t0,8(sp)
+jal ra,-11667
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,5
+sw t0,8(sp)
+jal ra,-11677
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11733
+addi t0,a0,0
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11741
+addi t0,a0,0
+lw t1,16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,3
+sw t0,4(sp)
+jal ra,-11749
+addi t0,a0,0
+lw t1,20(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11757
+addi t0,a0,0
+lw t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+jal ra,-11765
+addi t0,a0,0
+lw t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,25
+sw t0,4(sp)
+addi t0,zero,7
+sw t0,8(sp)
+jal ra,-11743
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+addi t0,zero,5
+sw t0,8(sp)
+jal ra,-11753
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11809
+addi t0,a0,0
+lw t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-11464
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-1268(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-448
+addi t0,a0,0
+sw t0,-1252(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-434
+addi t0,a0,0
+sw t0,-1248(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-420
+addi t0,a0,0
+sw t0,-1264(gp)
+lw t0,-856(gp)
+sw t0,-1256(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-88
+addi t0,a0,0
+sw t0,-1260(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,13
+sw t0,4(sp)
+jal ra,-633
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,13
+sw t0,4(sp)
+jal ra,-11488
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-11853
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+addi t0,zero,6
+sw t0,8(sp)
+jal ra,-11863
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+addi t0,zero,4
+sw t0,8(sp)
+jal ra,-11873
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,11
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-11883
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,6
+sw t0,4(sp)
+jal ra,-11939
+addi t0,a0,0
+lw t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11947
+addi t0,a0,0
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-11955
+addi t0,a0,0
+lw t1,16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,3
+sw t0,4(sp)
+jal ra,-11963
+addi t0,a0,0
+lw t1,20(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-11971
+addi t0,a0,0
+lw t1,-12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-11979
+addi t0,a0,0
+lw t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+jal ra,-11987
+addi t0,a0,0
+lw t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,31
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-11965
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,25
+sw t0,4(sp)
+addi t0,zero,6
+sw t0,8(sp)
+jal ra,-11975
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+addi t0,zero,4
+sw t0,8(sp)
+jal ra,-11985
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-11995
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-12051
+addi t0,a0,0
+lw t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,6
+sw t0,4(sp)
+jal ra,-12059
+addi t0,a0,0
+lw t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-12067
+addi t0,a0,0
+lw t1,-12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-12075
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,13
+sw t0,4(sp)
+jal ra,-11728
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-1268(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-712
+addi t0,a0,0
+sw t0,-1252(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-698
+addi t0,a0,0
+sw t0,-1248(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-684
+addi t0,a0,0
+sw t0,-1264(gp)
+lw t0,-856(gp)
+sw t0,-1256(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-130
+addi t0,a0,0
+sw t0,-1260(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,21
+sw t0,4(sp)
+jal ra,-897
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,21
+sw t0,4(sp)
+jal ra,-11752
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-12117
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+addi t0,zero,10
+sw t0,8(sp)
+jal ra,-12127
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,11
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-12137
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-12147
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,10
+sw t0,4(sp)
+jal ra,-12203
+addi t0,a0,0
+lw t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-12211
+addi t0,a0,0
+lw t1,-12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+jal ra,-12219
+addi t0,a0,0
+lw t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-12227
+addi t0,a0,0
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+jal ra,-12235
+addi t0,a0,0
+lw t1,16(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,31
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-12213
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,21
+sw t0,4(sp)
+addi t0,zero,10
+sw t0,8(sp)
+jal ra,-12223
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-12233
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-12243
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+jal ra,-12299
+addi t0,a0,0
+lw t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-12307
+addi t0,a0,0
+lw t1,-12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,10
+sw t0,4(sp)
+jal ra,-12315
+addi t0,a0,0
+lw t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-12323
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,21
+sw t0,4(sp)
+jal ra,-11976
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-1268(gp)
+lw t0,-856(gp)
+sw t0,-1252(gp)
+lw t0,-856(gp)
+sw t0,-1248(gp)
+addi t0,zero,0
+sw t0,-1264(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-900
+addi t0,a0,0
+sw t0,-1256(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-118
+addi t0,a0,0
+sw t0,-1260(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+jal ra,-1132
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+jal ra,-11987
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,5
+sw t0,4(sp)
+jal ra,-12398
+addi t0,a0,0
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,7
+sw t0,4(sp)
+jal ra,-12406
+addi t0,a0,0
+lw t1,16(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,20
+sw t0,8(sp)
+jal ra,-12382
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+jal ra,-12083
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sw t0,-1268(gp)
+lw t0,-856(gp)
+sw t0,-1252(gp)
+lw t0,-856(gp)
+sw t0,-1248(gp)
+addi t0,zero,0
+sw t0,-1264(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1006
+addi t0,a0,0
+sw t0,-1256(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-54
+addi t0,a0,0
+sw t0,-1260(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1440(gp)
+lw t1,-1444(gp)
+add t0,t0,t1
+lw t1,-1448(gp)
+add t0,t0,t1
+lw t1,-1452(gp)
+add t0,t0,t1
+lw t1,-1456(gp)
+add t0,t0,t1
+lw t1,-1460(gp)
+add t0,t0,t1
+lw t1,-1464(gp)
+add t0,t0,t1
+lw t1,-1468(gp)
+add t0,t0,t1
+lw t1,-1472(gp)
+add t0,t0,t1
+lw t1,-1476(gp)
+add t0,t0,t1
+lw t1,-1480(gp)
+add t0,t0,t1
+lw t1,-1484(gp)
+add t0,t0,t1
+lw t1,-1488(gp)
+add t0,t0,t1
+lw t1,-1492(gp)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1808(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1804(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1800(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1796(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1792(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1788(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1784(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1780(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1776(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1772(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1768(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1764(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1760(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1804
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,15686
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,-122
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-11097
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-131
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-11078
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-9986
+addi sp,sp,16
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-53
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1924(t0)
+beq t0,zero,24
+lui t0,0xFFFFF
+addi t0,t0,-1820
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-11141
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-11121
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-10029
+addi sp,sp,8
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-908
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-10050
+addi sp,sp,4
+lui t0,0xFFFFF
+addi t0,t0,-1864
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-10061
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1924(t0)
+beq t0,zero,7
+lui t0,0xFFFFF
+addi t0,t0,-1876
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10072
+jal ra,-10954
+lui t0,0xFFFFF
+addi t0,t0,-1892
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-10083
+addi sp,sp,4
+lw t0,-1440(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1808(t0)
+sw t0,4(sp)
+lw t0,-1944(gp)
+sw t0,8(sp)
+jal ra,-101
+lui t0,0xFFFFF
+addi t0,t0,-1896
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10100
+lw t0,-1444(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1804(t0)
+sw t0,4(sp)
+lw t0,-1948(gp)
+sw t0,8(sp)
+jal ra,-117
+jal ra,-10992
+lui t0,0xFFFFF
+addi t0,t0,-1912
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-10121
+addi sp,sp,4
+lw t0,-1472(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1776(t0)
+sw t0,4(sp)
+lw t0,-1976(gp)
+sw t0,8(sp)
+jal ra,-139
+lui t0,0xFFFFF
+addi t0,t0,-1896
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10138
+lw t0,-1476(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1772(t0)
+sw t0,4(sp)
+lw t0,-1980(gp)
+sw t0,8(sp)
+jal ra,-155
+jal ra,-11030
+lui t0,0xFFFFF
+addi t0,t0,-1928
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-10159
+addi sp,sp,4
+lw t0,-1448(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1800(t0)
+sw t0,4(sp)
+lw t0,-1952(gp)
+sw t0,8(sp)
+jal ra,-177
+lui t0,0xFFFFF
+addi t0,t0,-1896
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10176
+lw t0,-1452(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1796(t0)
+sw t0,4(sp)
+lw t0,-1956(gp)
+sw t0,8(sp)
+jal ra,-193
+lui t0,0xFFFFF
+addi t0,t0,-1896
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10192
+lw t0,-1456(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1792(t0)
+sw t0,4(sp)
+lw t0,-1960(gp)
+sw t0,8(sp)
+jal ra,-209
+jal ra,-11084
+lui t0,0xFFFFF
+addi t0,t0,-1928
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-10213
+addi sp,sp,4
+lw t0,-1460(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1788(t0)
+sw t0,4(sp)
+lw t0,-1964(gp)
+sw t0,8(sp)
+jal ra,-231
+lui t0,0xFFFFF
+addi t0,t0,-1896
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10230
+lw t0,-1464(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1784(t0)
+sw t0,4(sp)
+lw t0,-1968(gp)
+sw t0,8(sp)
+jal ra,-247
+jal ra,-11122
+lui t0,0xFFFFF
+addi t0,t0,-1944
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-10251
+addi sp,sp,4
+lw t0,-1468(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1780(t0)
+sw t0,4(sp)
+lw t0,-1972(gp)
+sw t0,8(sp)
+jal ra,-269
+jal ra,-11144
+lui t0,0xFFFFF
+addi t0,t0,-1960
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-10273
+addi sp,sp,4
+lw t0,-1480(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1768(t0)
+sw t0,4(sp)
+lw t0,-1984(gp)
+sw t0,8(sp)
+jal ra,-291
+lui t0,0xFFFFF
+addi t0,t0,-1896
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10290
+lw t0,-1484(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1764(t0)
+sw t0,4(sp)
+lw t0,-1988(gp)
+sw t0,8(sp)
+jal ra,-307
+lui t0,0xFFFFF
+addi t0,t0,-1896
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10306
+lw t0,-1488(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1760(t0)
+sw t0,4(sp)
+lw t0,-1992(gp)
+sw t0,8(sp)
+jal ra,-323
+jal ra,-11198
+lui t0,0xFFFFF
+addi t0,t0,-1976
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-10327
+addi sp,sp,4
+lw t0,-1492(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1996(gp)
+sw t0,4(sp)
+jal ra,-384
+jal ra,-11216
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+lw t0,-48(gp)
+sw t0,8(sp)
+jal ra,-12939
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-48(gp)
+sw t0,4(sp)
+lw t0,-48(gp)
+sw t0,8(sp)
+jal ra,-12961
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-12(gp)
+beq t0,zero,53
+lw t0,-16(gp)
+beq t0,zero,13
+lw t0,16(s0)
+beq t0,zero,11
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,50
+lw t0,12(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-83
+addi t0,a0,0
+addi a0,t0,0
+jal zero,28
+jal zero,15
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-76
+addi t0,a0,0
+addi a0,t0,0
+jal zero,13
+jal zero,11
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-12(gp)
+beq t0,zero,109
+lw t0,-16(gp)
+beq t0,zero,13
+lw t0,16(s0)
+beq t0,zero,11
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,20(s0)
+sw t1,0(t0)
+jal zero,104
+lw t0,12(s0)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,-44(gp)
+add t0,t0,t1
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-122
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-48(gp)
+sw t0,4(sp)
+jal ra,-13147
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,20(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-48(gp)
+sw t0,4(sp)
+jal ra,-12757
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,0(t0)
+jal zero,40
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,20(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-48(gp)
+sw t0,4(sp)
+jal ra,-13183
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,-44(gp)
+sub t0,t0,t1
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-181
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,0(t0)
+jal zero,10
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,20(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1516(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-216
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1288(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-2004
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10158
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20158
+lw t0,-1516(gp)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,12(s0)
+sw t0,12(sp)
+jal ra,-183
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1516(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-276
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1528(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-298
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1292(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-2032
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10240
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1172(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20240
+lw t0,-1528(gp)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,12(s0)
+sw t0,12(sp)
+jal ra,-265
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1524(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-130
+lw t0,-1540(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,27
+lw t0,-1540(gp)
+lw t1,-1524(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,-1540(gp)
+lw t1,-1524(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-452(gp)
+sw t1,0(t0)
+lw t0,-1524(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+add t0,t0,t1
+sw t0,-1524(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-1156(gp)
+sw t0,8(sp)
+lw t0,-856(gp)
+sw t0,12(sp)
+lw t0,-1124(gp)
+sw t0,16(sp)
+jal ra,-1880
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-31
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-88
+lw t0,-1444(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1444(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-1136(gp)
+sw t0,8(sp)
+jal ra,-1101
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-114
+lw t0,-1440(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1440(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,16(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-1160(gp)
+sw t0,8(sp)
+lw t0,8(s0)
+sw t0,12(sp)
+lw t0,-1124(gp)
+sw t0,16(sp)
+jal ra,-1951
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-144
+lw t0,-1444(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1444(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1216(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-1164(gp)
+sw t0,12(sp)
+lw t0,8(s0)
+sw t0,16(sp)
+lw t0,-1132(gp)
+sw t0,20(sp)
+jal ra,-2221
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-176
+lw t0,-1448(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1448(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1224(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-1168(gp)
+sw t0,12(sp)
+lw t0,8(s0)
+sw t0,16(sp)
+lw t0,-1132(gp)
+sw t0,20(sp)
+jal ra,-2253
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-208
+lw t0,-1452(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1452(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1220(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-1172(gp)
+sw t0,12(sp)
+lw t0,8(s0)
+sw t0,16(sp)
+lw t0,-1132(gp)
+sw t0,20(sp)
+jal ra,-2285
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-240
+lw t0,-1456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1456(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1228(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-1176(gp)
+sw t0,12(sp)
+lw t0,8(s0)
+sw t0,16(sp)
+lw t0,-1132(gp)
+sw t0,20(sp)
+jal ra,-2317
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-272
+lw t0,-1460(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1460(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1232(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-1180(gp)
+sw t0,12(sp)
+lw t0,8(s0)
+sw t0,16(sp)
+lw t0,-1132(gp)
+sw t0,20(sp)
+jal ra,-2349
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-304
+lw t0,-1464(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1464(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1236(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-1184(gp)
+sw t0,12(sp)
+lw t0,8(s0)
+sw t0,16(sp)
+lw t0,-1132(gp)
+sw t0,20(sp)
+jal ra,-2381
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-336
+lw t0,-1468(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1468(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-16(gp)
+beq t0,zero,18
+lw t0,16(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-1188(gp)
+sw t0,8(sp)
+lw t0,8(s0)
+sw t0,12(sp)
+lw t0,-1120(gp)
+sw t0,16(sp)
+jal ra,-2175
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-368
+jal zero,17
+lw t0,16(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-1196(gp)
+sw t0,8(sp)
+lw t0,8(s0)
+sw t0,12(sp)
+lw t0,-1120(gp)
+sw t0,16(sp)
+jal ra,-2192
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-385
+lw t0,-1472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1472(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-16(gp)
+beq t0,zero,18
+lw t0,12(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lw t0,-1192(gp)
+sw t0,12(sp)
+lw t0,-1128(gp)
+sw t0,16(sp)
+jal ra,-2090
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-417
+jal zero,17
+lw t0,12(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lw t0,-1200(gp)
+sw t0,12(sp)
+lw t0,-1128(gp)
+sw t0,16(sp)
+jal ra,-2107
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-434
+lw t0,-1476(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1476(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,16(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lw t0,-1204(gp)
+sw t0,12(sp)
+lw t0,-1140(gp)
+sw t0,16(sp)
+jal ra,-1951
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-464
+lw t0,-1480(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1480(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-1148(gp)
+sw t0,8(sp)
+jal ra,-1713
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-490
+lw t0,-1484(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1484(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,16(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-1208(gp)
+sw t0,8(sp)
+lw t0,8(s0)
+sw t0,12(sp)
+lw t0,-1144(gp)
+sw t0,16(sp)
+jal ra,-2327
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-520
+lw t0,-1488(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1488(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1240(gp)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-1212(gp)
+sw t0,8(sp)
+lw t0,-856(gp)
+sw t0,12(sp)
+lw t0,-1152(gp)
+sw t0,16(sp)
+jal ra,-2357
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-550
+lw t0,-1492(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1492(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-711
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1524(gp)
+lw t1,8(s0)
+sub t0,t0,t1
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2556
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2540
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2524
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2486
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-2095
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-727
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-765
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,8(s0)
+sub t0,t0,t1
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2544
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2528
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-1873
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-769
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-812
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1791
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-68
+lw t0,-4(s0)
+sw t0,8(s0)
+jal zero,-23
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-843
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2664
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2648
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2632
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2616
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-2545
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-857
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1292(gp)
+lw t1,12(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-794
+lw t0,-1544(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lw t0,-1544(gp)
+lw t1,-1292(gp)
+lw t2,12(s0)
+add t1,t1,t2
+lw t2,-68(gp)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,16(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20480
+addi t0,a0,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13512
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-11394
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-8(s0)
+lw t1,-12(s0)
+sltu t0,t0,t1
+beq t0,zero,32
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-1163
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20422
+addi t0,a0,0
+lw t1,-8(s0)
+add t0,t0,t1
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20506
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-91
+lw t0,-8(s0)
+lw t1,-68(gp)
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-34
+lw t0,-1500(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1500(gp)
+lw t0,-1504(gp)
+lw t1,-12(s0)
+add t0,t0,t1
+sw t0,-1504(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-1536(gp)
+sltu t0,t0,t1
+beq t0,zero,45
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1292(gp)
+lw t1,-1536(gp)
+sub t0,t0,t1
+lw t1,-4(s0)
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-937
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-918
+lw t0,-1544(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lw t0,-1544(gp)
+lw t1,-4(s0)
+lw t2,-68(gp)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-1544(gp)
+lw t2,-1292(gp)
+lw t3,-1536(gp)
+sub t2,t2,t3
+lw t3,-4(s0)
+add t2,t2,t3
+lw t3,-68(gp)
+divu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lw t0,-4(s0)
+lw t1,-68(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-47
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+sw t0,-4(s0)
+lw t0,12(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,4
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,12(s0)
+lw t1,-1868(gp)
+sltu t0,t1,t0
+beq t0,zero,17
+lw t0,12(s0)
+lw t1,-1868(gp)
+sub t0,t0,t1
+sw t0,12(s0)
+lw t0,-4(s0)
+lw t1,-1868(gp)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,-8(s0)
+jal zero,-19
+lw t0,12(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,14
+lw t0,-4(s0)
+lw t1,12(s0)
+addi t2,zero,1
+sub t1,t1,t2
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-11372
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-82
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1384(gp)
+lw t1,-1392(gp)
+lw t2,-1388(gp)
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1296(gp)
+sw t0,-1368(gp)
+addi t0,zero,2
+sw t0,-1392(gp)
+lw t0,-1272(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-55
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1312(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1316(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+jal ra,-14423
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1320(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+jal ra,-14435
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1324(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+jal ra,-14447
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1359
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1332(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1336(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+jal ra,-14469
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1340(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+jal ra,-14481
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1344(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+jal ra,-14493
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1405
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1348(gp)
+sw t0,12(sp)
+jal ra,-1415
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1352(gp)
+sw t0,12(sp)
+jal ra,-1425
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1356(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1360(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+jal ra,-14535
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1447
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1364(gp)
+sw t0,12(sp)
+jal ra,-1457
+lw t0,-1332(gp)
+lw t1,-1276(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,112
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1368(gp)
+sw t0,12(sp)
+jal ra,-1473
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1372(gp)
+sw t0,12(sp)
+jal ra,-1483
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,40
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1376(gp)
+sw t0,12(sp)
+jal ra,-1493
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,48
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1380(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1384(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+jal ra,-14603
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1388(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,48
+sw t0,4(sp)
+jal ra,-14615
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1527
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,56
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1392(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1396(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+jal ra,-14637
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1400(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+jal ra,-14649
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1404(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,48
+sw t0,4(sp)
+jal ra,-14661
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1573
+jal zero,107
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1368(gp)
+sw t0,12(sp)
+jal ra,-1584
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,28
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1372(gp)
+sw t0,12(sp)
+jal ra,-1594
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1376(gp)
+sw t0,12(sp)
+jal ra,-1604
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,36
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1380(gp)
+sw t0,12(sp)
+jal ra,-1614
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,40
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1384(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1388(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+jal ra,-14724
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1636
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,44
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1392(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1396(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+jal ra,-14746
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1658
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,48
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1400(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1404(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+jal ra,-14768
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1680
+lw t0,-1300(gp)
+sw t0,-1408(gp)
+lw t0,-1304(gp)
+sw t0,-1412(gp)
+lw t0,-1272(gp)
+sw t0,-1416(gp)
+lw t0,-1520(gp)
+sw t0,-1420(gp)
+lw t0,-1520(gp)
+sw t0,-1424(gp)
+lw t0,-1524(gp)
+sw t0,-1428(gp)
+lw t0,-1524(gp)
+sw t0,-1432(gp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,41
+lw t0,-1308(gp)
+sw t0,-1412(gp)
+lw t0,-1272(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1524(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1868(gp)
+sw t0,4(sp)
+jal ra,-12031
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-1416(gp)
+lw t0,-1532(gp)
+sw t0,-1420(gp)
+lw t0,-1532(gp)
+sw t0,-1424(gp)
+lw t0,-1536(gp)
+sw t0,-1428(gp)
+lw t0,-1536(gp)
+sw t0,-1432(gp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,11
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1384(gp)
+lw t1,-1388(gp)
+lw t2,12(s0)
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-1332(gp)
+lw t1,-1276(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,98
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,0
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1408(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1412(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+jal ra,-14870
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,12(sp)
+jal ra,-1782
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,8
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1416(gp)
+sw t0,12(sp)
+jal ra,-1794
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,16
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1420(gp)
+sw t0,12(sp)
+jal ra,-1806
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,24
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1424(gp)
+sw t0,12(sp)
+jal ra,-1818
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,32
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1428(gp)
+sw t0,12(sp)
+jal ra,-1830
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,40
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1432(gp)
+sw t0,12(sp)
+jal ra,-1842
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,48
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-1436(gp)
+sw t0,12(sp)
+jal ra,-1854
+jal zero,97
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,0
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1408(gp)
+sw t0,12(sp)
+jal ra,-1867
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,4
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1416(gp)
+sw t0,12(sp)
+jal ra,-1879
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,8
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1420(gp)
+sw t0,12(sp)
+jal ra,-1891
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,12
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1424(gp)
+sw t0,12(sp)
+jal ra,-1903
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,16
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1428(gp)
+sw t0,12(sp)
+jal ra,-1915
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,20
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1432(gp)
+sw t0,12(sp)
+jal ra,-1927
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,24
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1412(gp)
+sw t0,12(sp)
+jal ra,-1939
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,28
+add t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-1436(gp)
+sw t0,12(sp)
+jal ra,-1951
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2046
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-15027
+addi t0,a0,0
+lw t1,-1312(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,84
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-15041
+addi t0,a0,0
+lw t1,-1316(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,70
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-15055
+addi t0,a0,0
+lw t1,-1320(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,56
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-15069
+addi t0,a0,0
+lw t1,-1324(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2112
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-15091
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,-1276(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,zero,1
+sw t0,-16(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,17
+jal zero,12
+lw t0,-8(s0)
+lw t1,-1280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,zero,0
+sw t0,-16(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1332(gp)
+lw t1,-1276(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,77
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,48
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2174
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+addi t0,zero,16
+sw t0,8(sp)
+jal ra,-15153
+addi t0,a0,0
+lw t1,-1384(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,54
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,48
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2196
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,48
+sw t0,4(sp)
+addi t0,zero,16
+sw t0,8(sp)
+jal ra,-15175
+addi t0,a0,0
+lw t1,-1388(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2218
+addi t0,a0,0
+sw t0,-1368(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,56
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2228
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,16
+sw t0,8(sp)
+jal ra,-15207
+addi t0,a0,0
+sw t0,-1392(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,87
+jal zero,82
+lw t0,-1332(gp)
+lw t1,-1280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,76
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,40
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2256
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,16
+sw t0,8(sp)
+jal ra,-15235
+addi t0,a0,0
+lw t1,-1384(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,54
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,40
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2278
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+addi t0,zero,16
+sw t0,8(sp)
+jal ra,-15257
+addi t0,a0,0
+lw t1,-1388(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2300
+addi t0,a0,0
+sw t0,-1368(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,44
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2310
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,16
+sw t0,8(sp)
+jal ra,-15289
+addi t0,a0,0
+sw t0,-1392(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,-1332(gp)
+lw t1,-1276(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,111
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2352
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2362
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,40
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2372
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2385
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,62
+lw t0,-8(s0)
+lw t1,-12(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,56
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2406
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,32
+sw t0,8(sp)
+jal ra,-15385
+addi t0,a0,0
+sw t0,-1408(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2424
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,32
+sw t0,4(sp)
+addi t0,zero,32
+sw t0,8(sp)
+jal ra,-15403
+addi t0,a0,0
+sw t0,-1412(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-2442
+addi t0,a0,0
+sw t0,-1416(gp)
+lw t0,-4(s0)
+sw t0,-1420(gp)
+lw t0,-8(s0)
+sw t0,-1428(gp)
+lw t0,-12(s0)
+sw t0,-1432(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,105
+jal zero,100
+lw t0,-1332(gp)
+lw t1,-1280(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,94
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2468
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,16
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2478
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2488
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2501
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,46
+lw t0,-8(s0)
+lw t1,-12(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,40
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2522
+addi t0,a0,0
+sw t0,-1408(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2532
+addi t0,a0,0
+sw t0,-1416(gp)
+lw t0,-4(s0)
+sw t0,-1420(gp)
+lw t0,-8(s0)
+sw t0,-1428(gp)
+lw t0,-12(s0)
+sw t0,-1432(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+addi t0,zero,24
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2548
+addi t0,a0,0
+sw t0,-1412(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-124(gp)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-22464
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+sw t0,4(sp)
+jal ra,-15250
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+sw t0,-1512(gp)
+lw t0,-1524(gp)
+lw t1,-1536(gp)
+add t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,2024
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1512(gp)
+sw t0,8(sp)
+jal ra,-13006
+addi sp,sp,8
+jal zero,178
+lw t0,-1512(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-132(gp)
+sw t0,4(sp)
+jal ra,-65
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-15515
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,1980
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1512(gp)
+sw t0,8(sp)
+jal ra,-13036
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22568
+jal ra,-1286
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-1272(gp)
+sw t0,8(sp)
+jal ra,-22566
+addi t0,a0,0
+lw t1,-1272(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,1920
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1512(gp)
+sw t0,8(sp)
+jal ra,-13071
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22603
+lw t0,-1524(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1868(gp)
+sw t0,4(sp)
+jal ra,-12944
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-1516(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-1444
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1516(gp)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+jal ra,-22612
+addi t0,a0,0
+lw t1,-12(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,1864
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1512(gp)
+sw t0,8(sp)
+jal ra,-13117
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22649
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1528(gp)
+sw t0,4(sp)
+lw t0,-1536(gp)
+sw t0,8(sp)
+jal ra,-22644
+addi t0,a0,0
+lw t1,-1536(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,1808
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1512(gp)
+sw t0,8(sp)
+jal ra,-13149
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22681
+lui t0,0xFFFFE
+addi t0,t0,1716
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1272(gp)
+lw t1,-12(s0)
+add t0,t0,t1
+lw t1,-1536(gp)
+add t0,t0,t1
+sw t0,8(sp)
+lw t0,-1524(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+divu t0,t0,t1
+sw t0,12(sp)
+lw t0,-72(gp)
+sw t0,16(sp)
+lw t0,-1536(gp)
+sw t0,20(sp)
+lw t0,-1512(gp)
+sw t0,24(sp)
+jal ra,-13184
+addi sp,sp,24
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-44
+lw t0,8(s0)
+sw t0,-1512(gp)
+lw t0,-1512(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5570
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-15704
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFF
+addi t0,t0,-820
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1512(gp)
+sw t0,8(sp)
+jal ra,-13225
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22757
+jal ra,-21532
+lw t0,-1284(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13065
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,8
+sw t0,4(sp)
+jal ra,-1600
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,8
+sw t0,8(sp)
+jal ra,-22774
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,8
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,294
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-847
+addi t0,a0,0
+beq t0,zero,288
+jal ra,-16179
+jal ra,-20099
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+addi t1,zero,8
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1384(gp)
+addi t1,zero,8
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-1634
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-1384(gp)
+addi t1,zero,8
+sub t0,t0,t1
+sw t0,8(sp)
+jal ra,-22810
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-1384(gp)
+addi t2,zero,8
+sub t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,256
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-762
+addi t0,a0,0
+beq t0,zero,250
+addi t0,zero,0
+sw t0,-16(s0)
+addi t0,zero,0
+sw t0,-20(s0)
+addi t0,zero,0
+sw t0,-24(s0)
+addi t0,zero,0
+sw t0,-28(s0)
+lw t0,-8(s0)
+lw t1,-1384(gp)
+add t0,t0,t1
+sw t0,-32(s0)
+addi t0,zero,0
+sw t0,-36(s0)
+lw t0,-36(s0)
+lw t1,-1392(gp)
+sltu t0,t0,t1
+beq t0,zero,73
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-32(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1388(gp)
+sw t0,4(sp)
+jal ra,-1684
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-1388(gp)
+sw t0,8(sp)
+jal ra,-22858
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-1388(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+lw t0,-32(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-631
+addi t0,a0,0
+beq t0,zero,36
+lw t0,-1408(gp)
+lw t1,-1300(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lw t0,-1412(gp)
+lw t1,-1304(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lw t0,-1416(gp)
+sw t0,-16(s0)
+lw t0,-1428(gp)
+sw t0,-20(s0)
+lw t0,-1420(gp)
+sw t0,-1520(gp)
+lw t0,-1432(gp)
+sw t0,-1524(gp)
+jal zero,15
+lw t0,-1412(gp)
+lw t1,-1308(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,-1416(gp)
+sw t0,-24(s0)
+lw t0,-1428(gp)
+sw t0,-28(s0)
+lw t0,-1420(gp)
+sw t0,-1532(gp)
+lw t0,-1432(gp)
+sw t0,-1536(gp)
+lw t0,-32(s0)
+lw t1,-1388(gp)
+add t0,t0,t1
+sw t0,-32(s0)
+lw t0,-36(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-36(s0)
+jal zero,-75
+lw t0,-20(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,156
+lw t0,-20(s0)
+lw t1,-1524(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,150
+lw t0,-28(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,146
+lw t0,-16(s0)
+lw t1,-20(s0)
+add t0,t0,t1
+lw t1,-24(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,138
+lw t0,-8(s0)
+lw t1,-16(s0)
+add t0,t0,t1
+sw t0,-1516(gp)
+jal ra,-1682
+addi t0,a0,0
+sw t0,-40(s0)
+lw t0,-16(s0)
+lw t1,-20(s0)
+add t0,t0,t1
+lw t1,-40(s0)
+sub t0,t0,t1
+sw t0,-44(s0)
+lw t0,-44(s0)
+lw t1,-40(s0)
+add t0,t0,t1
+lw t1,-1284(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,117
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,-40(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-44(s0)
+sw t0,4(sp)
+jal ra,-1801
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-44(s0)
+sw t0,8(sp)
+jal ra,-22975
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+sw t0,4(sp)
+jal ra,-15743
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-44(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,85
+lw t0,-40(s0)
+lw t1,-12(s0)
+add t0,t0,t1
+sw t0,-40(s0)
+lw t0,-8(s0)
+lw t1,-24(s0)
+add t0,t0,t1
+sw t0,-1528(gp)
+lw t0,-24(s0)
+lw t1,-28(s0)
+add t0,t0,t1
+lw t1,-40(s0)
+sub t0,t0,t1
+sw t0,-44(s0)
+lw t0,-44(s0)
+lw t1,-40(s0)
+add t0,t0,t1
+lw t1,-1284(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,63
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,-40(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-44(s0)
+sw t0,4(sp)
+jal ra,-1855
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-44(s0)
+sw t0,8(sp)
+jal ra,-23029
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+sw t0,4(sp)
+jal ra,-15797
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-44(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,31
+lw t0,-40(s0)
+lw t1,-12(s0)
+add t0,t0,t1
+sw t0,-40(s0)
+lui t0,0xFFFFE
+addi t0,t0,1624
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-40(s0)
+sw t0,8(sp)
+lw t0,-20(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+divu t0,t0,t1
+sw t0,12(sp)
+lw t0,-72(gp)
+sw t0,16(sp)
+lw t0,-28(s0)
+sw t0,20(sp)
+lw t0,-1512(gp)
+sw t0,24(sp)
+jal ra,-13552
+addi sp,sp,24
+jal zero,20
+lui t0,0xFFFFE
+addi t0,t0,1564
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1512(gp)
+sw t0,8(sp)
+jal ra,-13566
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23098
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1556
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15545
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-720(gp)
+sw t0,12(sp)
+lw t0,-736(gp)
+sw t0,16(sp)
+addi t0,zero,1
+sw t0,20(sp)
+lw t0,-1524(gp)
+sw t0,24(sp)
+jal ra,-11778
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2537
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,-2767
+lw t0,-924(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-1564(gp)
+sw t0,8(sp)
+jal ra,-2775
+jal ra,-2370
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,1544
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13652
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,12580
+lui t0,0xFFFFE
+addi t0,t0,1536
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13662
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18882
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+sw t0,4(sp)
+jal ra,-15915
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-17877
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1528
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15659
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-720(gp)
+sw t0,12(sp)
+lw t0,-728(gp)
+sw t0,16(sp)
+addi t0,zero,3
+sw t0,20(sp)
+lw t0,-1524(gp)
+sw t0,24(sp)
+jal ra,-11892
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2651
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,-2881
+lw t0,-900(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2667
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,-2897
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2683
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,-2913
+lw t0,-924(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-1568(gp)
+sw t0,8(sp)
+jal ra,-2921
+jal ra,-2516
+lw t0,-856(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-860(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-2554
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-20
+lw t0,20(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lw t0,-88(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,20(s0)
+addi t0,zero,1
+sw t0,-4(s0)
+jal zero,3
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,12(s0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,12(s0)
+sub t0,t0,t1
+lw t1,20(s0)
+sltu t0,t0,t1
+beq t0,zero,250
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,7625
+addi t0,a0,0
+beq t0,zero,225
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,19438
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,195
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19041
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,7631
+addi t0,a0,0
+beq t0,zero,166
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7559
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7569
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,13
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7544
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7554
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,12(s0)
+sub t0,t0,t1
+lw t1,20(s0)
+sltu t0,t1,t0
+beq t0,zero,5
+lw t0,12(s0)
+lw t1,20(s0)
+add t0,t0,t1
+sw t0,-12(s0)
+lw t0,24(s0)
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1240(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,15
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19101
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,7507
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,26167
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19115
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,7581
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-8(s0)
+lw t1,-12(s0)
+sltu t0,t0,t1
+beq t0,zero,87
+lw t0,24(s0)
+beq t0,zero,26
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,12(s0)
+sub t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-3560
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,6461
+lw t0,-1604(gp)
+beq t0,zero,7
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-16(s0)
+sw t0,4(sp)
+jal ra,5209
+jal zero,17
+lw t0,16(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,12(s0)
+sub t0,t0,t1
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6424
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-3513
+lw t0,-4(s0)
+beq t0,zero,31
+addi t0,zero,0
+sw t0,-20(s0)
+lw t0,-20(s0)
+lw t1,-68(gp)
+sltu t0,t0,t1
+beq t0,zero,25
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,12(s0)
+sub t0,t0,t1
+lw t1,-20(s0)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-16200
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,91
+lw t0,-20(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-20(s0)
+jal zero,-27
+lw t0,-8(s0)
+lw t1,-68(gp)
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-16(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,-89
+jal zero,17
+lui t0,0xFFFFE
+addi t0,t0,1484
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+jal ra,-14029
+addi sp,sp,8
+addi t0,zero,0
+addi a0,t0,0
+jal zero,58
+jal zero,17
+lui t0,0xFFFFE
+addi t0,t0,1428
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+jal ra,-14046
+addi sp,sp,8
+addi t0,zero,0
+addi a0,t0,0
+jal zero,41
+jal zero,17
+lui t0,0xFFFFE
+addi t0,t0,1388
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+jal ra,-14063
+addi sp,sp,8
+addi t0,zero,0
+addi a0,t0,0
+jal zero,24
+jal zero,-254
+lw t0,-4(s0)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,1336
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+jal ra,-14082
+addi sp,sp,8
+addi t0,zero,0
+addi a0,t0,0
+jal zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,39
+lui t0,0xFFFFE
+addi t0,t0,1324
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14112
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,12184
+addi t0,zero,-600
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14121
+lw t0,-900(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,12111
+addi t0,zero,-600
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14130
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,12166
+lui t0,0xFFFFE
+addi t0,t0,1316
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14140
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,12156
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19364
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19375
+addi t0,a0,0
+lw t1,-900(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19386
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-12(s0)
+lw t0,-1548(gp)
+beq t0,zero,18
+lui t0,0xFFFFE
+addi t0,t0,1216
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+lw t0,-8(s0)
+sw t0,16(sp)
+jal ra,-14195
+addi sp,sp,16
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-14062
+addi t0,a0,0
+lw t1,-1592(gp)
+sltu t0,t1,t0
+beq t0,zero,21
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-14072
+addi t0,a0,0
+sw t0,-1592(gp)
+lw t0,-1592(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14046
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1592(gp)
+sw t0,4(sp)
+jal ra,-2576
+addi t0,a0,0
+sw t0,-1588(gp)
+lw t0,-1588(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-14095
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-13962
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19458
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1588(gp)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+jal ra,-23778
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19481
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+sw t0,4(sp)
+jal ra,-16559
+addi t0,a0,0
+sw t0,-12(s0)
+addi t0,zero,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-16779
+addi t0,a0,0
+beq t0,zero,43
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-1588(gp)
+sw t0,8(sp)
+lw t0,-12(s0)
+sw t0,12(sp)
+addi t0,zero,1
+sw t0,16(sp)
+jal ra,-509
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19526
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+sw t0,4(sp)
+jal ra,-16557
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19572
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-18789
+lw t0,-1548(gp)
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,1156
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+jal ra,-14360
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,1148
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14371
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,11925
+jal ra,-15257
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1140
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16348
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-720(gp)
+sw t0,12(sp)
+lw t0,-728(gp)
+sw t0,16(sp)
+addi t0,zero,3
+sw t0,20(sp)
+lw t0,-1524(gp)
+sw t0,24(sp)
+jal ra,-12581
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3340
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,-3570
+lw t0,-900(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3356
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,-3586
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3372
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,-3602
+lw t0,-924(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-1572(gp)
+sw t0,8(sp)
+jal ra,-3610
+jal ra,-3205
+lw t0,-856(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-860(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3243
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,39
+lui t0,0xFFFFE
+addi t0,t0,1128
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14495
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,11801
+addi t0,zero,-600
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14504
+lw t0,-900(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,11728
+addi t0,zero,-600
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14513
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,11783
+lui t0,0xFFFFE
+addi t0,t0,1316
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14523
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,11773
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19747
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19758
+addi t0,a0,0
+lw t1,-900(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19769
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-12(s0)
+lw t0,-1552(gp)
+beq t0,zero,18
+lui t0,0xFFFFE
+addi t0,t0,1028
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+lw t0,-8(s0)
+sw t0,12(sp)
+lw t0,-4(s0)
+sw t0,16(sp)
+jal ra,-14578
+addi sp,sp,16
+lw t0,-12(s0)
+lw t1,-1592(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,23
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,4
+sw t0,4(sp)
+jal ra,-14453
+addi t0,a0,0
+sw t0,-1592(gp)
+lw t0,-1592(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14427
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1592(gp)
+sw t0,4(sp)
+jal ra,-2957
+addi t0,a0,0
+sw t0,-1588(gp)
+lw t0,-1588(gp)
+lw t1,-12(s0)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-1588(gp)
+sw t0,8(sp)
+lw t0,-12(s0)
+sw t0,12(sp)
+addi t0,zero,0
+sw t0,16(sp)
+jal ra,-837
+addi t0,a0,0
+beq t0,zero,33
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19850
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1588(gp)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+jal ra,-15716
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+sw t0,4(sp)
+jal ra,-16888
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+jal zero,25
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19882
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+sw t0,4(sp)
+jal ra,-16913
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19928
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-19145
+lw t0,-1552(gp)
+beq t0,zero,33
+lui t0,0xFFFFE
+addi t0,t0,968
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19931
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+sw t0,4(sp)
+jal ra,-17009
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+jal ra,-14733
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,1148
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14744
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,11552
+jal ra,-15630
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,960
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16721
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-720(gp)
+sw t0,12(sp)
+lw t0,-728(gp)
+sw t0,16(sp)
+addi t0,zero,3
+sw t0,20(sp)
+lw t0,-1524(gp)
+sw t0,24(sp)
+jal ra,-12954
+lw t0,-900(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3713
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,-3943
+lw t0,-904(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3729
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,-3959
+lw t0,-908(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3745
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,-3975
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-1584(gp)
+sw t0,8(sp)
+jal ra,-3983
+lw t0,-924(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-1576(gp)
+sw t0,8(sp)
+jal ra,-3991
+jal ra,-3586
+lw t0,-856(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-860(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-3624
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+addi t0,zero,0
+sw t0,16(sp)
+jal ra,-1086
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,48
+lui t0,0xFFFFE
+addi t0,t0,948
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14902
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,11330
+addi t0,zero,-600
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14911
+lw t0,-900(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,11321
+addi t0,zero,-600
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14920
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,11312
+addi t0,zero,-600
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14929
+lw t0,-908(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,11335
+lui t0,0xFFFFE
+addi t0,t0,1316
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14939
+lw t0,-900(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,11357
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20163
+addi t0,a0,0
+lw t1,-900(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20174
+addi t0,a0,0
+lw t1,-904(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20185
+addi t0,a0,0
+lw t1,-908(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,-92(gp)
+sw t0,8(sp)
+jal ra,-123
+addi t0,a0,0
+beq t0,zero,33
+lw t0,-8(s0)
+lw t1,-112(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+lw t0,-124(gp)
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20214
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-92(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+jal ra,-24516
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+jal zero,25
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20238
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+sw t0,4(sp)
+jal ra,-17269
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20284
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-19501
+lw t0,-1556(gp)
+beq t0,zero,37
+lui t0,0xFFFFE
+addi t0,t0,864
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-92(gp)
+sw t0,8(sp)
+lw t0,-8(s0)
+sw t0,12(sp)
+lw t0,-12(s0)
+sw t0,16(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20293
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+sw t0,4(sp)
+jal ra,-17371
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-15093
+addi sp,sp,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,1148
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15104
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,11192
+jal ra,-15990
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,856
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17082
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-720(gp)
+sw t0,12(sp)
+lw t0,-732(gp)
+sw t0,16(sp)
+addi t0,zero,1
+sw t0,20(sp)
+lw t0,-1524(gp)
+sw t0,24(sp)
+jal ra,-13315
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-204
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17104
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-720(gp)
+sw t0,12(sp)
+lw t0,-732(gp)
+sw t0,16(sp)
+addi t0,zero,1
+sw t0,20(sp)
+lw t0,-1524(gp)
+sw t0,24(sp)
+jal ra,-13337
+lw t0,-1536(gp)
+lw t1,-68(gp)
+add t0,t0,t1
+sw t0,-1536(gp)
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,-828(gp)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+lw t0,-708(gp)
+sw t0,12(sp)
+lw t0,-728(gp)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,-1536(gp)
+sub t0,zero,t0
+sw t0,24(sp)
+jal ra,-13358
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24078
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24066
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24148
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-3733
+lw t0,-1496(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1496(gp)
+jal ra,-12976
+jal ra,-12946
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-4145
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,-4375
+jal ra,-12963
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-7972
+jal ra,-13001
+jal ra,-12971
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24094
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24119
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-4178
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-12991
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-12949
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-4380
+lw t0,-924(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-1580(gp)
+sw t0,8(sp)
+jal ra,-4418
+jal ra,-4013
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-13010
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,2
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-4112
+lw t0,-856(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+addi t0,zero,4
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-4124
+lw t0,-856(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-12990
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,3
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-4137
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-4465
+lw t0,-856(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+addi t0,zero,3
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-4157
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24184
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24210
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-896(gp)
+sw t0,8(sp)
+jal ra,-4222
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,-13084
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-4502
+addi t0,zero,2
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-12960
+lw t0,-856(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-860(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-4138
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20392
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,6057
+addi t0,a0,0
+beq t0,zero,33
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,17772
+addi t0,a0,0
+beq t0,zero,25
+lw t0,-1560(gp)
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,816
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-15417
+addi sp,sp,8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-19665
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,20
+lw t0,-1560(gp)
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,768
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-15441
+addi sp,sp,8
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20678
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20480
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-105
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,760
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15493
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10739
+lui t0,0xFFFFE
+addi t0,t0,1316
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15503
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10729
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20730
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lw t2,-896(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20746
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20402
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-19657
+jal zero,12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20773
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-8(s0)
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20806
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-20023
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,1148
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15588
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10644
+jal ra,-16474
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25102
+addi t0,a0,0
+sw t0,-4(s0)
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25108
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,13
+lw t0,-4(s0)
+lw t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-220
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17610
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-720(gp)
+sw t0,12(sp)
+lw t0,-732(gp)
+sw t0,16(sp)
+addi t0,zero,2
+sw t0,20(sp)
+lw t0,-1524(gp)
+sw t0,24(sp)
+jal ra,-13843
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-4602
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,-4832
+lw t0,-900(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-4618
+lw t0,-864(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,-4848
+lw t0,-924(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-1596(gp)
+sw t0,8(sp)
+jal ra,-4856
+jal ra,-4451
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-920(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-4865
+lw t0,-856(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-860(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-4497
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20675
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1216(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-920(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20678
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-920(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1300(t1)
+sw t1,0(t0)
+lw t0,-920(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7187
+lw t0,-1600(gp)
+beq t0,zero,43
+lui t0,0xFFFFE
+addi t0,t0,716
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20696
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20702
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-15812
+addi sp,sp,12
+lw t0,12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+lui t0,0xFFFFE
+addi t0,t0,684
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-15828
+addi sp,sp,4
+jal ra,-16711
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,20541
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,1300(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,12(s0)
+sw t1,1824(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,30
+lui t0,0xFFFFE
+addi t0,t0,672
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15863
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10369
+addi t0,zero,-600
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15872
+lw t0,-900(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10424
+lui t0,0xFFFFE
+addi t0,t0,1316
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15882
+lw t0,-920(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10414
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1904(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7382
+lw t0,-900(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7386
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-900(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,21750
+jal ra,748
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,21474
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,22534
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-209
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1820(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1816(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,1148
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15961
+lw t0,-920(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,10271
+jal ra,-16847
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,22490
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-253
+jal ra,14726
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,21682
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-43
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-23856
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-23845
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-23800
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1604(gp)
+beq t0,zero,43
+lw t0,-1668(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39
+lw t0,-1664(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43
+lw t0,-1672(gp)
+beq t0,zero,5
+lw t0,-1728(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49
+lw t0,-1676(gp)
+beq t0,zero,5
+lw t0,-1732(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-55
+addi t0,zero,0
+sw t0,-1776(gp)
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-1772(gp)
+sltu t0,t0,t1
+beq t0,zero,15
+lw t0,-1768(gp)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-72
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-17
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24307
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24276
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15965
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-24029
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24324
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24334
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,1
+add t1,t1,t2
+mul t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15824
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-23829
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15836
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-23824
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,88
+jal ra,-23797
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-16(s0)
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24209
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24374
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16056
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-23590
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24410
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+sw t0,4(sp)
+jal ra,-23538
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24426
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+remu t0,t0,t1
+sw t0,4(sp)
+jal ra,-23605
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23735
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,716
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-16(s0)
+sw t0,4(sp)
+jal ra,1112
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-90
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16121
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-24031
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24020
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-24190
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-24179
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,20(s0)
+sw t0,4(sp)
+jal ra,-24168
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,24(s0)
+sw t0,4(sp)
+jal ra,-24106
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,28(s0)
+sw t0,4(sp)
+jal ra,-24044
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24033
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1712(gp)
+sw t0,4(sp)
+jal ra,-24022
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1756(gp)
+sw t0,4(sp)
+jal ra,-24147
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-23983
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-261
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-349
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,28
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,-24614
+addi t0,a0,0
+sw t0,-1668(gp)
+lw t0,-1668(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,-1620(gp)
+sw t0,4(sp)
+lw t0,-1628(gp)
+sw t0,8(sp)
+lw t0,-1636(gp)
+sw t0,12(sp)
+lw t0,-1660(gp)
+sw t0,16(sp)
+addi t0,zero,1
+sw t0,20(sp)
+jal ra,-94
+jal ra,-24631
+addi t0,a0,0
+sw t0,-1664(gp)
+lw t0,-1664(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,-1624(gp)
+sw t0,4(sp)
+lw t0,-1632(gp)
+sw t0,8(sp)
+lw t0,-1640(gp)
+sw t0,12(sp)
+lw t0,-1612(gp)
+sw t0,16(sp)
+addi t0,zero,1
+sw t0,20(sp)
+jal ra,-111
+lw t0,-1672(gp)
+beq t0,zero,78
+lw t0,-1752(gp)
+lw t1,-1708(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-1636(gp)
+sw t0,-4(s0)
+jal zero,3
+lw t0,-1696(gp)
+sw t0,-4(s0)
+jal ra,-24661
+addi t0,a0,0
+sw t0,-1728(gp)
+lw t0,-1728(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,-1680(gp)
+sw t0,4(sp)
+lw t0,-1688(gp)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+lw t0,-1612(gp)
+sw t0,16(sp)
+addi t0,zero,2
+sw t0,20(sp)
+jal ra,-141
+lw t0,-1728(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1716(gp)
+sw t0,4(sp)
+jal ra,-24123
+lw t0,-1668(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1728(gp)
+sw t0,4(sp)
+jal ra,-24146
+lw t0,-1664(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1728(gp)
+sw t0,4(sp)
+jal ra,-24152
+lw t0,-1676(gp)
+beq t0,zero,30
+jal ra,-24698
+addi t0,a0,0
+sw t0,-1732(gp)
+lw t0,-1732(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,-1684(gp)
+sw t0,4(sp)
+lw t0,-1692(gp)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+lw t0,-1612(gp)
+sw t0,16(sp)
+addi t0,zero,3
+sw t0,20(sp)
+jal ra,-178
+lw t0,-1732(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1720(gp)
+sw t0,4(sp)
+jal ra,-24160
+lw t0,-1728(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1732(gp)
+sw t0,4(sp)
+jal ra,-24183
+lw t0,-1760(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,2
+jal ra,3285
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24708
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24677
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24739
+addi t0,a0,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,37
+lw t0,-8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-16(s0)
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24039
+addi t0,a0,0
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-16(s0)
+sw t0,4(sp)
+jal ra,2140
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24142
+addi t0,a0,0
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-16(s0)
+sw t0,4(sp)
+jal ra,1202
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-39
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24304
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1604(gp)
+beq t0,zero,9
+lw t0,-1668(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-92
+lw t0,-1664(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-96
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24658
+addi t0,a0,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24650
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,25
+lw t0,-4(s0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24133
+addi t0,a0,0
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,2046
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-35
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24386
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1604(gp)
+beq t0,zero,15
+lw t0,-1668(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24759
+addi t0,a0,0
+lw t1,-1616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-1668(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-82
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24897
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24885
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-37
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-76
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24940
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24964
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+divu t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24974
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-47
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25074
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-127
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25060
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24477
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-223
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24399
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25095
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24967
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-1748(gp)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24938
+addi t0,a0,0
+lw t1,12(s0)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25176
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+addi t3,zero,1
+add t2,t2,t3
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24957
+addi t0,a0,0
+lw t1,12(s0)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-344
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+addi sp,sp,-4
+sw t2,0(sp)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25210
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+lw t2,0(sp)
+addi sp,sp,4
+addi t3,a0,0
+divu t2,t2,t3
+mul t1,t1,t2
+lw t2,16(s0)
+add t1,t1,t2
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25267
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+addi sp,sp,-4
+sw t2,0(sp)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25244
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+lw t2,0(sp)
+addi sp,sp,4
+addi t3,a0,0
+divu t2,t2,t3
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24687
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24598
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-109
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-24419
+lw t0,-4(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24727
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24638
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-149
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t0,0(t0)
+lw t1,12(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24638
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+jal zero,30
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24650
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24659
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,-15
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24669
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-24500
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24506
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-225
+addi t0,a0,0
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24824
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24739
+addi t0,a0,0
+lw t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,12
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24733
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-34
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24736
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24745
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24733
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-24568
+jal zero,11
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24744
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-24510
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24751
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24760
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24786
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-24619
+jal zero,11
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24797
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-24531
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24636
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-24625
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24622
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24835
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-118
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24649
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-24669
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24656
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24665
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-24705
+jal zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-24613
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-24632
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24683
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,33
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-185
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24701
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-24753
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24708
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-24746
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-24670
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24995
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-544
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24726
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25712
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25074
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,35
+lw t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi t1,zero,2
+divu t0,t0,t1
+sw t0,-12(s0)
+lw t0,-8(s0)
+addi t1,zero,2
+lw t2,-12(s0)
+mul t1,t1,t2
+addi t2,zero,1
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,-4(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sw t1,0(t0)
+jal zero,8
+lw t0,-4(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sw t1,0(t0)
+lw t0,-12(s0)
+sw t0,-8(s0)
+jal zero,-37
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24800
+addi t0,a0,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25791
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,1
+sub t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,26
+lw t0,-4(s0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+addi t0,zero,2
+lw t1,-8(s0)
+mul t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,7
+addi t0,zero,2
+lw t1,-8(s0)
+mul t0,t0,t1
+addi t1,zero,2
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-38
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25830
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,1
+sub t1,t1,t2
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25589
+addi t0,a0,0
+lui t1,0x41C65
+addi t1,t1,-403
+mul t0,t0,t1
+lui t1,0x3
+addi t1,t1,57
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-25316
+lw t0,-4(s0)
+lui t1,0x10
+addi t1,t1,0
+divu t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25879
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25825
+addi t0,a0,0
+lw t1,-1644(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25210
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-759
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-363
+jal zero,17
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25852
+addi t0,a0,0
+lw t1,-1648(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-253
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-632
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-25182
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25265
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-814
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-342
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-1100
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1084
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-601
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,71
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25354
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-897
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+lw t0,20(s0)
+beq t0,zero,19
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26005
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-25699
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-161
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,34
+jal zero,29
+lw t0,20(s0)
+beq t0,zero,24
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25379
+addi t0,a0,0
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,800
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-132
+lw t0,-1784(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1784(gp)
+jal zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25406
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-955
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25158
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25531
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,62
+jal zero,60
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26063
+addi t0,a0,0
+lw t1,-1648(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-383
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,33
+jal zero,31
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26092
+addi t0,a0,0
+lw t1,-1656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-335
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26192
+addi t0,a0,0
+addi t1,zero,4
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25591
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-1255
+addi t0,a0,0
+sw t0,16(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,25
+lw t0,-8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2313
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-27
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-1381
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-25489
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1159
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-25448
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-25518
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1020
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25607
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1156
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-760
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26248
+addi t0,a0,0
+lw t1,-1648(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-649
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25666
+addi t0,a0,0
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,513
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25769
+addi t0,a0,0
+beq t0,zero,86
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1293
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-433
+lw t0,-1752(gp)
+lw t1,-1708(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26199
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26208
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,121
+jal zero,46
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26238
+addi t0,a0,0
+addi t1,zero,2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1668(gp)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,34
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1664(gp)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,26
+jal zero,19
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26265
+addi t0,a0,0
+addi t1,zero,3
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1728(gp)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,7
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,16(s0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,16(s0)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26455
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,37
+lw t0,12(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+jal ra,-508
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-163
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26493
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-53
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+jal ra,-556
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1523
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-461
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-224
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-308
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26400
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-1776(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1776(gp)
+jal zero,76
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+addi t0,zero,1
+sw t0,12(sp)
+jal ra,-629
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+lw t0,-1752(gp)
+lw t1,-1708(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-686
+jal zero,46
+lw t0,-1752(gp)
+lw t1,-1708(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26589
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-26285
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-76
+jal zero,21
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1638
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-576
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,7
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26639
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-26335
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-126
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-371
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26546
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-529
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-473
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+lw t0,20(s0)
+sw t0,12(sp)
+jal ra,-780
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,32
+jal zero,30
+lw t0,20(s0)
+beq t0,zero,25
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1757
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-695
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-112
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26802
+addi t0,a0,0
+addi t1,zero,4
+divu t0,t0,t1
+sw t0,-4(s0)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26201
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-1865
+addi t0,a0,0
+sw t0,16(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,21
+lw t0,16(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,1718
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-23
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1809
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-78
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-26035
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26789
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-26491
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-2030
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-2014
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-1531
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1006
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+addi t0,zero,1
+sw t0,12(sp)
+jal ra,-225
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26352
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1985
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+addi t0,zero,1
+sw t0,12(sp)
+jal ra,-276
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26403
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-2036
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,20(s0)
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26961
+addi t0,a0,0
+lw t1,-1616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,85
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26381
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,74
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26924
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27102
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27075
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+divu t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2326
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26979
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26967
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26982
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-26688
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-26284
+jal zero,9
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-342
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1664(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-214
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1772(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,865
+lw t0,-1668(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-244
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1772(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,834
+lw t0,-1668(gp)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,16(s0)
+sw t0,12(sp)
+jal ra,-226
+lw t0,-1608(gp)
+beq t0,zero,28
+lw t0,-1664(gp)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+jal ra,-499
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lw t0,-1664(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1315
+lw t0,-1780(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1780(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1668(gp)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+jal ra,-538
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,26
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26670
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1668(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-2301
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1240
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1668(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-433
+lw t0,-1664(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-441
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-1772(gp)
+sltu t0,t0,t1
+beq t0,zero,19
+lw t0,-1768(gp)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-460
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-21
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+lw t1,12(s0)
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFE
+addi t0,t0,660
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+jal ra,-19240
+addi sp,sp,12
+lui t0,0xFFFFE
+addi t0,t0,624
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-20377
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-20357
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,12(s0)
+sw t0,16(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-20395
+addi t0,a0,0
+sw t0,20(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-20375
+addi t0,a0,0
+sw t0,24(sp)
+jal ra,-19283
+addi sp,sp,24
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27430
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27418
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27276
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-1672(gp)
+beq t0,zero,82
+lw t0,-1752(gp)
+lw t1,-1708(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,568
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-19356
+addi sp,sp,4
+jal zero,12
+lui t0,0xFFFFE
+addi t0,t0,512
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-19368
+addi sp,sp,4
+lw t0,-1728(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27504
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1728(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27492
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFE
+addi t0,t0,496
+add t0,gp,t0
+sw t0,8(sp)
+jal ra,-170
+jal ra,-20269
+lw t0,-1728(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-101
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-1676(gp)
+beq t0,zero,26
+lw t0,-1732(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27531
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1732(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27519
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFE
+addi t0,t0,480
+add t0,gp,t0
+sw t0,8(sp)
+jal ra,-197
+jal ra,-20296
+lw t0,-1732(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-128
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-1668(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27556
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1668(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27544
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1664(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27573
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1664(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27564
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-1668(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-170
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1664(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-177
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+lw t1,-8(s0)
+add t0,t0,t1
+lw t1,-12(s0)
+add t0,t0,t1
+lw t1,-1776(gp)
+lw t2,-1724(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-16(s0)
+lui t0,0xFFFFE
+addi t0,t0,416
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-19491
+addi sp,sp,4
+lui t0,0xFFFFE
+addi t0,t0,380
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1712(gp)
+sw t0,8(sp)
+lw t0,-1716(gp)
+sw t0,12(sp)
+lw t0,-1720(gp)
+sw t0,16(sp)
+lw t0,-1724(gp)
+sw t0,20(sp)
+jal ra,-19510
+addi sp,sp,20
+lui t0,0xFFFFE
+addi t0,t0,332
+add t0,gp,t0
+addi sp,sp,-32
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1668(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-233
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1664(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-240
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,8(sp)
+lw t0,-8(s0)
+sw t0,12(sp)
+lw t0,-12(s0)
+sw t0,16(sp)
+lw t0,-1776(gp)
+lw t1,-1724(gp)
+mul t0,t0,t1
+sw t0,20(sp)
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-20729
+addi t0,a0,0
+sw t0,24(sp)
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-20709
+addi t0,a0,0
+sw t0,28(sp)
+jal ra,-19561
+addi sp,sp,28
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,328
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-21407
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-1644(gp)
+addi a0,t0,0
+jal zero,48
+jal zero,46
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,320
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-21421
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-1648(gp)
+addi a0,t0,0
+jal zero,34
+jal zero,32
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,312
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-21435
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-1652(gp)
+addi a0,t0,0
+jal zero,20
+jal zero,18
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,304
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-21449
+addi t0,a0,0
+beq t0,zero,5
+lw t0,-1656(gp)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,-32(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1644(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,328
+add t0,gp,t0
+addi a0,t0,0
+jal zero,32
+jal zero,30
+lw t0,8(s0)
+lw t1,-1648(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,320
+add t0,gp,t0
+addi a0,t0,0
+jal zero,20
+jal zero,18
+lw t0,8(s0)
+lw t1,-1652(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,312
+add t0,gp,t0
+addi a0,t0,0
+jal zero,8
+jal zero,6
+lui t0,0xFFFFE
+addi t0,t0,304
+add t0,gp,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-20
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-1760(gp)
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,-1764(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,73
+addi t0,zero,1
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-1736(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,60
+lw t0,-1740(gp)
+sw t0,-16(s0)
+lw t0,-16(s0)
+lw t1,-1744(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,47
+lw t0,-12(s0)
+lw t1,-16(s0)
+mul t0,t0,t1
+lw t1,-8(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,34
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,25
+jal ra,-27963
+addi t0,a0,0
+sw t0,-20(s0)
+lw t0,-20(s0)
+addi sp,sp,-24
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+lw t0,-16(s0)
+sw t0,12(sp)
+lw t0,-1612(gp)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+jal ra,-3443
+lw t0,8(s0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-20(s0)
+sw t1,0(t0)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-16(s0)
+addi t1,zero,2
+mul t0,t0,t1
+sw t0,-16(s0)
+jal zero,-51
+lw t0,-12(s0)
+addi t1,zero,2
+mul t0,t0,t1
+sw t0,-12(s0)
+jal zero,-64
+lw t0,-8(s0)
+addi t1,zero,2
+mul t0,t0,t1
+sw t0,-8(s0)
+jal zero,-77
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-106
+addi t0,a0,0
+sw t0,-1772(gp)
+lw t0,-1772(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19633
+addi t0,a0,0
+sw t0,-1768(gp)
+lw t0,-1768(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-120
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+addi t0,zero,1
+sw t0,12(sp)
+jal ra,-2017
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27957
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-27653
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-2996
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1934
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27443
+addi t0,a0,0
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2099
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-1787
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-1772(gp)
+sltu t0,t0,t1
+beq t0,zero,17
+lw t0,-1768(gp)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-96
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-19
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFE
+addi t0,t0,224
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1756(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-304
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-19946
+addi sp,sp,8
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-1772(gp)
+sltu t0,t0,t1
+beq t0,zero,57
+lw t0,-1768(gp)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,-84(gp)
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,208
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-28159
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-28146
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-28133
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-19953
+addi sp,sp,12
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-28122
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-28110
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-84(gp)
+sw t0,8(sp)
+jal ra,-786
+jal ra,-20885
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-59
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1812(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-128(gp)
+sw t0,4(sp)
+jal ra,-7077
+addi t0,a0,0
+sw t0,-1820(gp)
+lw t0,-1820(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-22527
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,172
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1812(gp)
+sw t0,8(sp)
+jal ra,-20048
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-29580
+lw t0,-1824(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lw t0,-1808(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19893
+addi t0,a0,0
+sw t0,-1824(gp)
+lw t0,-1804(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19721
+addi t0,a0,0
+sw t0,-1836(gp)
+lw t0,-1804(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19729
+addi t0,a0,0
+sw t0,-1840(gp)
+addi t0,zero,0
+sw t0,-1828(gp)
+addi t0,zero,0
+sw t0,-1832(gp)
+lw t0,-100(gp)
+lw t1,-1788(gp)
+sw t1,0(t0)
+lw t0,-1820(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-100(gp)
+sw t0,4(sp)
+addi t0,zero,4
+sw t0,8(sp)
+jal ra,-29610
+addi t0,a0,0
+addi t1,zero,4
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,132
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1812(gp)
+sw t0,8(sp)
+jal ra,-20115
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-29647
+addi t0,zero,4
+sw t0,-1832(gp)
+addi t0,zero,1
+sw t0,-1816(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1820(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1824(gp)
+sw t0,4(sp)
+lw t0,-1828(gp)
+sw t0,8(sp)
+jal ra,-29656
+addi t0,a0,0
+lw t1,-1828(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,132
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1812(gp)
+sw t0,8(sp)
+jal ra,-20161
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-29693
+lw t0,-1832(gp)
+lw t1,-1828(gp)
+add t0,t0,t1
+sw t0,-1832(gp)
+addi t0,zero,0
+sw t0,-1828(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-53
+lui t0,0xFFFFE
+addi t0,t0,60
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1840(gp)
+lw t1,-1792(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+lw t0,-1840(gp)
+lw t1,-1796(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,12(sp)
+lw t0,-1840(gp)
+lw t1,-1800(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,16(sp)
+lw t0,-1832(gp)
+sw t0,20(sp)
+lw t0,-1812(gp)
+sw t0,24(sp)
+jal ra,-20220
+addi sp,sp,24
+addi t0,zero,0
+sw t0,-1816(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1828(gp)
+lw t1,-1808(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-108
+lw t0,-1828(gp)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,-1824(gp)
+lw t1,-1828(gp)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,8(s0)
+sw t1,0(t0)
+jal zero,37
+lw t0,-1824(gp)
+lw t1,-1828(gp)
+addi t2,zero,4
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-1824(gp)
+lw t2,-1828(gp)
+addi t3,zero,4
+divu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1828(gp)
+addi t1,zero,4
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-22921
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,0(t0)
+lw t0,-1828(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1828(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,-1836(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,12(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+lw t0,12(s0)
+lw t1,-4(s0)
+sub t0,t0,t1
+addi t1,zero,2
+mul t0,t0,t1
+sw t0,-8(s0)
+jal zero,9
+lw t0,-4(s0)
+lw t1,12(s0)
+sub t0,t0,t1
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,-1804(gp)
+mul t0,t0,t1
+lw t1,8(s0)
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,128
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,14
+lw t0,-8(s0)
+addi t1,zero,128
+remu t0,t0,t1
+addi t1,zero,128
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-128
+lw t0,-8(s0)
+addi t1,zero,128
+divu t0,t0,t1
+sw t0,-8(s0)
+jal zero,-18
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-137
+lw t0,-1836(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw t0,-1840(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-1840(gp)
+lw t2,8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1880(gp)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lw t2,-1880(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1884(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,12(s0)
+lw t1,16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,80
+jal zero,78
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-74
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+jal zero,21
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-93
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,1045
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,29
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,18
+jal zero,16
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-114
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,2
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1884(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,71
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-189
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+jal zero,21
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-208
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,930
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-76
+addi t0,a0,0
+beq t0,zero,19
+lw t0,-4(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-217
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lw t2,-1872(gp)
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-224
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+addi t0,zero,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-120
+addi t0,a0,0
+addi a0,t0,0
+jal zero,7
+jal zero,5
+lw t0,-4(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1884(gp)
+beq t0,zero,31
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-311
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-327
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+lw t1,-1880(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,7
+lw t0,12(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1904(gp)
+lw t1,8(s0)
+lw t2,-1900(gp)
+remu t1,t1,t2
+lw t2,-1896(gp)
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27946
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27941
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-27915
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1916(gp)
+lw t1,8(s0)
+addi t2,zero,4
+divu t1,t1,t2
+lw t2,12(s0)
+add t1,t1,t2
+lw t2,-1912(gp)
+remu t1,t1,t2
+lw t2,-1908(gp)
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1928(gp)
+beq t0,zero,13
+lw t0,-1916(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1912(gp)
+lw t1,-1908(gp)
+mul t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-20600
+addi t0,zero,0
+sw t0,-1928(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-474
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-65
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-1884(gp)
+beq t0,zero,66
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27948
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,52
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27943
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27934
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-512
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+lw t0,-1932(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1932(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27937
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-518
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,95
+lw t0,-1936(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1936(gp)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-512
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,72
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,488
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,57
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,497
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-1884(gp)
+beq t0,zero,43
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-27987
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-27980
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-609
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-27973
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-606
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-27974
+addi t0,zero,1
+sw t0,-1928(gp)
+lw t0,-12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-306
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-28221
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-28216
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,-1920(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1920(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-28211
+addi t0,a0,0
+addi a0,t0,0
+jal zero,40
+lw t0,-1924(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1924(gp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-442
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,19
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-28218
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-28211
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-28200
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-98
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-772
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-4(s0)
+jal ra,17933
+addi t0,a0,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-1880(gp)
+sltu t0,t0,t1
+beq t0,zero,17
+lw t0,-8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+lw t2,-12(s0)
+lw t3,-1872(gp)
+mul t2,t2,t3
+add t1,t1,t2
+sw t1,0(t0)
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-19
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-814
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-8(s0)
+sw t1,0(t0)
+lw t0,-1940(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1940(gp)
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-480
+lw t0,-1884(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-437
+lw t0,8(s0)
+lw t1,12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,16(s0)
+sw t1,0(t0)
+jal zero,107
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-890
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,17811
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-914
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,52
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-781
+addi t0,a0,0
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-175
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-928
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-946
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-536
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-965
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,16(s0)
+sw t1,0(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1868(gp)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1868(gp)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-1864(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+lw t0,8(s0)
+lw t1,12(s0)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-74
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-342
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-96
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-457
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,12(s0)
+lw t1,-4(s0)
+lw t2,-1868(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+lw t1,-1872(gp)
+lw t2,-1868(gp)
+divu t1,t1,t2
+mul t0,t0,t1
+lw t1,-8(s0)
+add t0,t0,t1
+sw t0,-12(s0)
+lw t0,-1844(gp)
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,-24
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+lw t0,-8(s0)
+sw t0,16(sp)
+lw t0,-12(s0)
+sw t0,20(sp)
+jal ra,-21556
+addi sp,sp,20
+lw t0,-12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-73
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1188
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1240(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,11
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-192
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,18468
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-114
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-1218
+lw t0,-1604(gp)
+beq t0,zero,7
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2470
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1604(gp)
+beq t0,zero,17
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-152
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2646
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-102
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1604(gp)
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1240(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,11
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-281
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,18379
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-206
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-2672
+jal zero,9
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-133
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1604(gp)
+beq t0,zero,17
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-241
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2646
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-191
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1604(gp)
+beq t0,zero,17
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-279
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2795
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-229
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1540(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+lw t0,-84(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-32
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-1540(gp)
+lw t1,8(s0)
+lw t2,12(s0)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-21804
+addi sp,sp,4
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21743
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1924(t0)
+beq t0,zero,62
+lw t0,-84(gp)
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-48
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-1512(gp)
+sw t0,8(sp)
+lw t0,8(s0)
+sw t0,12(sp)
+jal ra,-21844
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21783
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1520(gp)
+sw t0,4(sp)
+jal ra,-84
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1896(t0)
+beq t0,zero,5
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,123
+jal zero,22
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-84(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-52
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-21882
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21820
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,101
+jal zero,99
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1892(t0)
+beq t0,zero,42
+lw t0,-144(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-60
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,-21874
+addi sp,sp,4
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1520(gp)
+sw t0,4(sp)
+jal ra,-143
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-144(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-52
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-21898
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,56
+jal zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1900(t0)
+beq t0,zero,47
+lw t0,-144(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-60
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,-21919
+addi sp,sp,4
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-188
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-144(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-72
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+sw t0,8(sp)
+jal ra,-21947
+addi sp,sp,4
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-186
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-84(gp)
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-84
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3591
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13839
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1260(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,20
+sw t0,4(sp)
+jal ra,-24303
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-22042
+addi sp,sp,12
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-21981
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-92
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22103
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,4129
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1148
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22123
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,4109
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3932
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,40
+lw t0,-1260(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-24804
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1808(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1808(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1808(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1808(t0)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13616
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1440(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1440(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1992(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+lw t3,1996(t3)
+remu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-423
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,34
+lw t0,-1248(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lw t0,-1260(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-84(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-96
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-22277
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22215
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,46
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-84(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-112
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3313
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14117
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14123
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-1260(gp)
+sw t0,20(sp)
+jal ra,-22320
+addi sp,sp,16
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22259
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-52
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22382
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3914
+lui t0,0xFFFFE
+addi t0,t0,1316
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22392
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3904
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1148
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22412
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3884
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1248(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1260(gp)
+sw t0,4(sp)
+jal ra,-14021
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,43
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1260(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1804(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1804(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1804(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1804(t0)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13893
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1444(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1444(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-667
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-84(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-124
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3110
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14320
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14326
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-1252(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14332
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-22527
+addi sp,sp,16
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22466
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-52
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22588
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3708
+addi t0,zero,-600
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22597
+lw t0,-1252(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3699
+lui t0,0xFFFFE
+addi t0,t0,1316
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22607
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3689
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14110
+lw t0,-1252(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14114
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+lw t2,-1252(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1800(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1800(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1800(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1800(t0)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14097
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1448(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1448(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14210
+lw t0,-1252(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14214
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+lw t2,-1252(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sub t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1796(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1796(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1796(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1796(t0)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14197
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1452(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1452(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14310
+lw t0,-1252(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14314
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+lw t2,-1252(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+mul t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1792(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1792(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1792(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1792(t0)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14297
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1456(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1252(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,86
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14422
+lw t0,-1252(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14426
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+lw t2,-1252(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+divu t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1788(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1788(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1788(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1788(t0)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14409
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1952(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,3635
+lw t0,-1460(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1460(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1252(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,86
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14545
+lw t0,-1252(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14549
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+lw t2,-1252(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+remu t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1784(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1784(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1784(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1784(t0)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14532
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1952(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,3512
+lw t0,-1464(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1464(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14656
+lw t0,-1252(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14660
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+lw t2,-1252(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sw t0,-4(s0)
+jal zero,3
+addi t0,zero,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-4(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1780(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1780(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1780(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1780(t0)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14648
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1468(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1468(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1422
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-84(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-140
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2355
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15075
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1260(gp)
+sw t0,16(sp)
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15083
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-23278
+addi sp,sp,16
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23217
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1260(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFE
+addi t0,t0,-52
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23351
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2881
+addi t0,zero,-600
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23360
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-1916
+addi t0,a0,0
+beq t0,zero,87
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2980
+addi t0,a0,0
+beq t0,zero,71
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1901
+addi t0,a0,0
+beq t0,zero,51
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15077
+addi t0,a0,0
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,-164
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1837
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-23408
+addi sp,sp,8
+jal zero,20
+lui t0,0xFFFFE
+addi t0,t0,-184
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1857
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-23428
+addi sp,sp,8
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2867
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-216
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-23442
+addi sp,sp,4
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-260
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-23452
+addi sp,sp,4
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-280
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-23462
+addi sp,sp,4
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-2030
+addi t0,a0,0
+beq t0,zero,36
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2866
+addi t0,a0,0
+beq t0,zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-2015
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,1148
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23504
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2792
+lui t0,0xFFFFE
+addi t0,t0,-296
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-23516
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1260(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-2095
+addi t0,a0,0
+beq t0,zero,28
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2801
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2080
+addi t0,a0,0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2506
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15074
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1260(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-2157
+addi t0,a0,0
+beq t0,zero,158
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2739
+addi t0,a0,0
+beq t0,zero,143
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2142
+addi t0,a0,0
+beq t0,zero,120
+lw t0,-1816(gp)
+beq t0,zero,15
+lw t0,-1796(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2133
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-3337
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,42
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2012
+addi t0,a0,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-8(s0)
+sw t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1776(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1776(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1776(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1776(t0)
+lw t0,-1256(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-15169
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+lw t1,-1520(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+divu t0,t0,t1
+sw t0,-12(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1472(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1732(t0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1732(t1)
+lw t2,-12(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1968(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2335
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,2908
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1964(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,2899
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1948(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,2890
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1939
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-84(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-140
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1838
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1252(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15592
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1260(gp)
+sw t0,16(sp)
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15600
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-23795
+addi sp,sp,16
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23734
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1260(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFE
+addi t0,t0,-52
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23868
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2364
+addi t0,zero,-600
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23877
+lw t0,-1252(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2419
+lui t0,0xFFFFE
+addi t0,t0,1316
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-23887
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-2443
+addi t0,a0,0
+beq t0,zero,83
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2533
+addi t0,a0,0
+beq t0,zero,67
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2428
+addi t0,a0,0
+beq t0,zero,47
+lw t0,-1252(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15604
+addi t0,a0,0
+beq t0,zero,21
+lui t0,0xFFFFE
+addi t0,t0,-316
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2364
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-23935
+addi sp,sp,8
+jal zero,20
+lui t0,0xFFFFE
+addi t0,t0,-332
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2384
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-23955
+addi sp,sp,8
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-216
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-23965
+addi sp,sp,4
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-260
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-23975
+addi sp,sp,4
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-280
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-23985
+addi sp,sp,4
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-2553
+addi t0,a0,0
+beq t0,zero,30
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2423
+addi t0,a0,0
+beq t0,zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-2538
+addi t0,a0,0
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,-352
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-24029
+addi sp,sp,4
+lw t0,-1252(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2266
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1260(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-2612
+addi t0,a0,0
+beq t0,zero,29
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2364
+addi t0,a0,0
+beq t0,zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2597
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2520
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1988
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15592
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1260(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-2675
+addi t0,a0,0
+beq t0,zero,169
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2301
+addi t0,a0,0
+beq t0,zero,154
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2660
+addi t0,a0,0
+beq t0,zero,131
+lw t0,-1252(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-15737
+lw t0,-1816(gp)
+beq t0,zero,15
+lw t0,-1800(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2657
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-3861
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2442
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+lw t2,-1252(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1252(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-2522
+jal zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1772(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1772(t0)
+lw t0,-1604(gp)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1252(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-2550
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+lw t1,-1520(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+divu t0,t0,t1
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1476(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1476(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1728(t0)
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1728(t1)
+lw t2,-8(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1968(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2864
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,2379
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1964(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,2370
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1948(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,2361
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1260(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1984(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1992(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1996(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-2761
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2515
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-84(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-112
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1262
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16168
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1252(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16174
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-1260(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1980(t0)
+sw t0,4(sp)
+jal ra,-26882
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-24379
+addi sp,sp,16
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24318
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1900(t0)
+beq t0,zero,26
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-144(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-360
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+lw t1,-1260(gp)
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-24377
+addi sp,sp,4
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-52
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24472
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1824
+addi t0,zero,-600
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24481
+lw t0,-1252(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1815
+lui t0,0xFFFFE
+addi t0,t0,-376
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,-24495
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-392
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,-24516
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1549
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16029
+lw t0,-1252(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16033
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+lw t2,-1252(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lw t2,-1260(gp)
+add t1,t1,t2
+sw t1,1844(t0)
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1768(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1768(t0)
+lw t0,-1480(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1480(gp)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2761
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-84(gp)
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-404
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1016
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16414
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1260(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1980(t0)
+sw t0,4(sp)
+jal ra,-27122
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-24619
+addi sp,sp,12
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24558
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1900(t0)
+beq t0,zero,26
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-144(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-360
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+lw t1,-1260(gp)
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-24617
+addi sp,sp,4
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-92
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24712
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1515
+addi t0,zero,-600
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24726
+lui t0,0xFFFFE
+addi t0,t0,-416
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,-24736
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-246
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+addi t0,zero,-600
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24758
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1474
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,61
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lw t2,-1260(gp)
+add t1,t1,t2
+sw t1,1844(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+lw t1,-1520(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+divu t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1748(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1748(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1744(t0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1744(t1)
+lw t2,-4(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+jal zero,78
+lw t0,-1260(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-27337
+addi t0,a0,0
+beq t0,zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lw t2,-1260(gp)
+add t1,t1,t2
+sw t1,1844(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+lw t1,-1520(gp)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+divu t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1740(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1740(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1736(t0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1736(t1)
+lw t2,-4(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+jal zero,25
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lw t2,-1260(gp)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1260(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1764(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1764(t0)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16320
+lw t0,-1484(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1484(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3084
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-84(gp)
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-140
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,693
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16737
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1260(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1980(t0)
+sw t0,4(sp)
+jal ra,-27445
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16753
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-24948
+addi sp,sp,16
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-24887
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-52
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25009
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1223
+lui t0,0xFFFFE
+addi t0,t0,1316
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25019
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,1208
+addi t0,zero,-600
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25033
+lui t0,0xFFFFE
+addi t0,t0,-416
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,-25043
+addi sp,sp,4
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1248(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16543
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1260(gp)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-27684
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-27714
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1760(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1760(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1844(t0)
+jal zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1844(t0)
+lw t0,-1256(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16537
+lw t0,-1488(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1488(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3301
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-84(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,888
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,476
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-25143
+addi sp,sp,4
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-25082
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,871
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-924(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16707
+lw t0,-1492(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1492(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1908(t0)
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1992(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+lw t3,1996(t3)
+remu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+jal ra,-26135
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+jal zero,142
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-924(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1596(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,57
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1912(t0)
+beq t0,zero,19
+lui t0,0xFFFFE
+addi t0,t0,-472
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-25292
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34824
+jal zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1896(t0)
+beq t0,zero,19
+lui t0,0xFFFFE
+addi t0,t0,-536
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-25314
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1144(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34846
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+jal ra,-9485
+jal zero,73
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16822
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-924(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1564(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,42
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-924(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1580(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,26
+lw t0,-900(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16850
+lw t0,-904(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16854
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-924(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-908(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16871
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16792
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1960(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-924(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,1258
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1984(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1992(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+lw t3,1996(t3)
+remu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1984(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1992(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1996(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-1544(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,27
+lw t0,-144(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-32
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-1544(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lw t2,-1524(gp)
+sub t1,t1,t2
+lw t2,-68(gp)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-25434
+addi sp,sp,4
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-144(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-60
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,8(sp)
+jal ra,-25465
+addi sp,sp,4
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-66
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-144(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-52
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-25484
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1900(t0)
+beq t0,zero,5
+jal ra,-58
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,3
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-16(gp)
+beq t0,zero,18
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-144(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-544
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-25525
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,17
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-144(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-552
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-25542
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-144(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-60
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+lw t1,-1524(gp)
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-14960
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-25568
+addi sp,sp,4
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-2000(gp)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1948(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3413
+addi t0,a0,0
+addi a0,t0,0
+jal zero,175
+jal zero,173
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1976(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-2426
+addi t0,a0,0
+addi a0,t0,0
+jal zero,162
+jal zero,160
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1980(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1922
+addi t0,a0,0
+addi a0,t0,0
+jal zero,149
+jal zero,147
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1952(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3207
+addi t0,a0,0
+addi a0,t0,0
+jal zero,136
+jal zero,134
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1956(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3220
+addi t0,a0,0
+addi a0,t0,0
+jal zero,123
+jal zero,121
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1960(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3233
+addi t0,a0,0
+addi a0,t0,0
+jal zero,110
+jal zero,108
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1964(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3246
+addi t0,a0,0
+addi a0,t0,0
+jal zero,97
+jal zero,95
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1968(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3259
+addi t0,a0,0
+addi a0,t0,0
+jal zero,84
+jal zero,82
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1972(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3272
+addi t0,a0,0
+addi a0,t0,0
+jal zero,71
+jal zero,69
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1984(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1438
+addi t0,a0,0
+addi a0,t0,0
+jal zero,58
+jal zero,56
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1205
+addi t0,a0,0
+addi a0,t0,0
+jal zero,45
+jal zero,43
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1992(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-894
+addi t0,a0,0
+addi a0,t0,0
+jal zero,32
+jal zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1944(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3805
+addi t0,a0,0
+addi a0,t0,0
+jal zero,19
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1996(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-703
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,19339
+addi t0,a0,0
+sw t0,-2004(gp)
+lw t0,-1524(gp)
+lw t1,-1536(gp)
+add t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFE
+addi t0,t0,-600
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-2004(gp)
+sw t0,8(sp)
+jal ra,-25892
+addi sp,sp,8
+jal zero,180
+lw t0,-2004(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-128(gp)
+sw t0,4(sp)
+jal ra,-12951
+addi t0,a0,0
+sw t0,-2008(gp)
+lw t0,-2008(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-28401
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,-648
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-2004(gp)
+sw t0,8(sp)
+jal ra,-25922
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35454
+lw t0,-2004(gp)
+sw t0,-140(gp)
+lw t0,-2008(gp)
+sw t0,-144(gp)
+jal ra,-35266
+jal ra,-32152
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1924(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,1900(t0)
+addi t0,zero,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+lw t1,-1524(gp)
+sltu t0,t0,t1
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15372
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1840(t0)
+jal ra,993
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-302
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-144(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,824
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-25918
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+jal zero,-54
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+lw t1,-1524(gp)
+sub t0,t0,t1
+lw t1,-1536(gp)
+sltu t0,t0,t1
+beq t0,zero,33
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-449
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-144(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,824
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-25960
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lw t2,-68(gp)
+add t1,t1,t2
+sw t1,1844(t0)
+jal zero,-39
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1900(t0)
+addi t0,zero,0
+sw t0,-140(gp)
+lw t0,-104(gp)
+sw t0,-144(gp)
+lui t0,0xFFFFE
+addi t0,t0,-756
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+lw t0,-1524(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+divu t0,t0,t1
+sw t0,12(sp)
+lw t0,-72(gp)
+sw t0,16(sp)
+lw t0,-1536(gp)
+sw t0,20(sp)
+lw t0,-2004(gp)
+sw t0,24(sp)
+jal ra,-26072
+addi sp,sp,24
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1988(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1992(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1996(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1984(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1992(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1996(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,8(s0)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1992(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1992(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1992(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1996(t1)
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1992(t0)
+sw t0,-4(s0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1996(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1912(t0)
+lw t0,-4(s0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1992(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sw t1,1992(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1988(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1992(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+lw t3,1996(t3)
+remu t2,t2,t3
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,1844(t0)
+jal ra,628
+jal ra,770
+jal ra,2570
+lw t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-8(s0)
+jal zero,-36
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1908(t0)
+lw t0,-4(s0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,17
+jal ra,610
+jal ra,752
+jal ra,2593
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1992(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1992(t0)
+lw t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-8(s0)
+jal zero,-19
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1908(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1912(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-768
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18024
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-26261
+addi sp,sp,8
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-780
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18056
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-26293
+addi sp,sp,8
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17997
+addi t0,a0,0
+beq t0,zero,6
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-78
+jal zero,32
+lui t0,0xFFFFE
+addi t0,t0,-796
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18099
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,12(sp)
+jal ra,-26345
+addi sp,sp,12
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,6667
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1692(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1692(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,50
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,6702
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1684(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1684(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,6722
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1676(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1676(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,6587
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1688(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1688(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,50
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,6622
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1680(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1680(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,6642
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1672(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1672(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,888
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1932(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-26531
+addi sp,sp,4
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1968(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-816
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-26548
+addi sp,sp,4
+jal zero,109
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1964(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-836
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-26566
+addi sp,sp,4
+jal zero,91
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1960(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-844
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-26584
+addi sp,sp,4
+jal zero,73
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1952(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-836
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-26602
+addi sp,sp,4
+jal zero,55
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1948(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-856
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-26620
+addi sp,sp,4
+jal zero,37
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1944(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-836
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-26638
+addi sp,sp,4
+jal zero,19
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1940(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-860
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26654
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18414
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31662
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1972(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,68
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31675
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,57
+lui t0,0xFFFFE
+addi t0,t0,-896
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31600
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-26710
+addi sp,sp,8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-205
+lui t0,0xFFFFE
+addi t0,t0,-936
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26723
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31717
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31707
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-229
+jal ra,-27623
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1140(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36273
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-30980
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-30971
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1820(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1928(t0)
+beq t0,zero,39
+lui t0,0xFFFFE
+addi t0,t0,-896
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31680
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-26790
+addi sp,sp,8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-285
+lui t0,0xFFFFE
+addi t0,t0,-988
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-26807
+addi sp,sp,4
+jal ra,-1141
+jal ra,-27691
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1980(t0)
+sw t0,4(sp)
+jal ra,-5380
+addi t0,a0,0
+beq t0,zero,103
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,6132
+addi t0,a0,0
+beq t0,zero,80
+lw t0,-1816(gp)
+beq t0,zero,17
+lw t0,-1792(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,-5354
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-6558
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+lw t1,-68(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,-5117
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16549
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1840(t0)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-5144
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16554
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1840(t0)
+jal zero,32
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1964(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,-269
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1948(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,-280
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16165
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1840(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18123
+addi t0,a0,0
+sw t0,-1244(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1836(t0)
+lw t0,-1244(gp)
+lw t1,-1124(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-17974
+lw t0,-1264(gp)
+lw t1,-1160(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1948(gp)
+sw t1,1836(t0)
+jal zero,237
+lw t0,-1244(gp)
+lw t1,-1120(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+jal ra,-17992
+lw t0,-16(gp)
+beq t0,zero,12
+lw t0,-1264(gp)
+lw t1,-1188(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1976(gp)
+sw t1,1836(t0)
+jal zero,11
+lw t0,-1264(gp)
+lw t1,-1196(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1976(gp)
+sw t1,1836(t0)
+jal zero,206
+lw t0,-1244(gp)
+lw t1,-1128(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+jal ra,-17837
+lw t0,-16(gp)
+beq t0,zero,12
+lw t0,-1264(gp)
+lw t1,-1192(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1980(gp)
+sw t1,1836(t0)
+jal zero,11
+lw t0,-1264(gp)
+lw t1,-1200(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1980(gp)
+sw t1,1836(t0)
+jal zero,175
+lw t0,-1244(gp)
+lw t1,-1132(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,92
+jal ra,-18194
+lw t0,-1264(gp)
+lw t1,-1164(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,34
+lw t0,-1268(gp)
+lw t1,-1216(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1952(gp)
+sw t1,1836(t0)
+jal zero,22
+lw t0,-1268(gp)
+lw t1,-1224(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1956(gp)
+sw t1,1836(t0)
+jal zero,11
+lw t0,-1268(gp)
+lw t1,-1220(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1960(gp)
+sw t1,1836(t0)
+jal zero,51
+lw t0,-1264(gp)
+lw t1,-1176(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,-1268(gp)
+lw t1,-1228(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1964(gp)
+sw t1,1836(t0)
+jal zero,34
+lw t0,-1264(gp)
+lw t1,-1180(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,-1268(gp)
+lw t1,-1232(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1968(gp)
+sw t1,1836(t0)
+jal zero,17
+lw t0,-1264(gp)
+lw t1,-1184(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,-1268(gp)
+lw t1,-1236(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1972(gp)
+sw t1,1836(t0)
+jal zero,78
+lw t0,-1244(gp)
+lw t1,-1140(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-17701
+lw t0,-1264(gp)
+lw t1,-1204(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1984(gp)
+sw t1,1836(t0)
+jal zero,60
+lw t0,-1244(gp)
+lw t1,-1148(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-17471
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1988(gp)
+sw t1,1836(t0)
+jal zero,48
+lw t0,-1244(gp)
+lw t1,-1144(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-18181
+lw t0,-1264(gp)
+lw t1,-1208(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1992(gp)
+sw t1,1836(t0)
+jal zero,30
+lw t0,-1244(gp)
+lw t1,-1136(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-17395
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1944(gp)
+sw t1,1836(t0)
+jal zero,18
+lw t0,-1244(gp)
+lw t1,-1152(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-18211
+lw t0,-1264(gp)
+lw t1,-1212(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1996(gp)
+sw t1,1836(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1924(t0)
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1944(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,-587
+jal zero,30
+lw t0,-104(gp)
+sw t0,-144(gp)
+lui t0,0xFFFFE
+addi t0,t0,-1068
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+sw t0,12(sp)
+lw t0,-1244(gp)
+sw t0,16(sp)
+jal ra,-27274
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1152(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36806
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32398
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,12(s0)
+lw t1,-4(s0)
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32390
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,66
+lw t0,12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,56
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-31991
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32422
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+divu t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1880(t1)
+mul t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-27001
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-31291
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32025
+addi t0,a0,0
+lw t1,12(s0)
+lw t2,-4(s0)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1880(t2)
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32062
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,93
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1812(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1812(t0)
+lw t0,12(s0)
+sw t0,-8(s0)
+lw t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,33
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-139
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-33916
+lw t0,12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+add t0,t0,t1
+sw t0,12(s0)
+lw t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+sub t0,t0,t1
+sw t0,16(s0)
+jal zero,-39
+addi t0,zero,1
+sw t0,-12(s0)
+lw t0,-12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1848(t1)
+sltu t0,t0,t1
+beq t0,zero,35
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t1,-12(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-185
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34090
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-33881
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-39
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1840(t0)
+sw t0,4(sp)
+jal ra,-34003
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+sw t0,4(sp)
+jal ra,-33998
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1256(gp)
+sw t0,4(sp)
+jal ra,-33987
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1248(gp)
+sw t0,4(sp)
+jal ra,-33976
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1252(gp)
+sw t0,4(sp)
+jal ra,-33965
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1260(gp)
+sw t0,4(sp)
+jal ra,-33954
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+sw t0,4(sp)
+jal ra,-33945
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,-287
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,66
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34189
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,57
+lw t0,-1604(gp)
+beq t0,zero,3
+jal ra,-777
+jal zero,4
+lw t0,-1816(gp)
+beq t0,zero,2
+jal ra,-781
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34224
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1840(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34221
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1836(t0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34210
+addi t0,a0,0
+sw t0,-1256(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34197
+addi t0,a0,0
+sw t0,-1248(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34184
+addi t0,a0,0
+sw t0,-1252(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34171
+addi t0,a0,0
+sw t0,-1260(gp)
+jal zero,25
+jal ra,-831
+jal ra,-689
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-163
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,592
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34289
+addi t0,a0,0
+lw t1,-1948(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,34
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34280
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34271
+addi t0,a0,0
+lw t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34243
+addi t0,a0,0
+lw t1,20(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34346
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34318
+addi t0,a0,0
+lw t1,-864(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,40
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34290
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lw t0,12(s0)
+lw t1,-1976(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34363
+addi t0,a0,0
+lw t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,17
+jal zero,12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34337
+addi t0,a0,0
+lw t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,-20(gp)
+lw t1,-72(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,394
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-541
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-555
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,363
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1880(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-864(gp)
+sw t0,8(sp)
+lw t0,-68(gp)
+sub t0,zero,t0
+sw t0,12(sp)
+jal ra,-193
+addi t0,a0,0
+beq t0,zero,133
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1856(t1)
+addi t2,zero,1
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-603
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,73
+lw t0,-8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1980(gp)
+sw t0,4(sp)
+lw t0,-860(gp)
+sw t0,8(sp)
+jal ra,-169
+addi t0,a0,0
+beq t0,zero,63
+lw t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1880(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-864(gp)
+sw t0,8(sp)
+lw t0,-68(gp)
+sub t0,zero,t0
+sw t0,12(sp)
+jal ra,-245
+addi t0,a0,0
+beq t0,zero,44
+lw t0,-8(s0)
+addi t1,zero,2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1880(t2)
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1980(gp)
+sw t0,4(sp)
+lw t0,-888(gp)
+sw t0,8(sp)
+jal ra,-206
+addi t0,a0,0
+beq t0,zero,26
+lw t0,-8(s0)
+addi t1,zero,3
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1880(t2)
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-888(gp)
+sw t0,4(sp)
+lw t0,-864(gp)
+sw t0,8(sp)
+addi t0,zero,0
+sw t0,12(sp)
+jal ra,-283
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1868(t0)
+addi a0,t0,0
+jal zero,247
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34575
+addi t0,a0,0
+lw t1,-1980(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34528
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lw t0,-8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1980(gp)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+jal ra,-262
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1876(t0)
+addi a0,t0,0
+jal zero,211
+jal zero,206
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34612
+addi t0,a0,0
+lw t1,-1976(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,149
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34603
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,137
+lw t0,-12(s0)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,132
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1976(gp)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+jal ra,-304
+addi t0,a0,0
+beq t0,zero,122
+lw t0,-8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-864(gp)
+sw t0,4(sp)
+lw t0,-864(gp)
+sw t0,8(sp)
+lw t0,-68(gp)
+sw t0,12(sp)
+jal ra,-373
+addi t0,a0,0
+beq t0,zero,110
+lw t0,-12(s0)
+lw t1,-888(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,99
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1852(t1)
+addi t2,zero,1
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-789
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,76
+lw t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1880(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1976(gp)
+sw t0,4(sp)
+lw t0,-860(gp)
+sw t0,8(sp)
+jal ra,-361
+addi t0,a0,0
+beq t0,zero,60
+lw t0,-8(s0)
+addi t1,zero,2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1880(t2)
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34713
+addi t0,a0,0
+lw t1,-1948(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+lw t0,-8(s0)
+addi t1,zero,2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1880(t2)
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34712
+addi t0,a0,0
+lw t1,-864(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+lw t0,-8(s0)
+addi t1,zero,2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1880(t2)
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34711
+addi t0,a0,0
+lw t1,-864(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1864(t0)
+addi a0,t0,0
+jal zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1872(t0)
+addi a0,t0,0
+jal zero,53
+jal zero,48
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34770
+addi t0,a0,0
+lw t1,-1944(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34761
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,27
+lw t0,-12(s0)
+lw t1,-864(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lw t0,-8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34727
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-525
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1860(t0)
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1868(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1856(t0)
+addi a0,t0,0
+jal zero,20
+jal zero,18
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1864(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1852(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,2
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1848(t1)
+sltu t0,t0,t1
+beq t0,zero,67
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+lw t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-1002
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,41
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34904
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,32
+lw t0,8(s0)
+lw t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-508
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-106
+addi t0,a0,0
+lw t1,-8(s0)
+sltu t0,t1,t0
+beq t0,zero,7
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-34728
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-71
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,-1076
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,59
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34978
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35006
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1840(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34908
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1836(t0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34992
+addi t0,a0,0
+sw t0,-1256(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34979
+addi t0,a0,0
+sw t0,-1248(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34966
+addi t0,a0,0
+sw t0,-1252(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34953
+addi t0,a0,0
+sw t0,-1260(gp)
+jal zero,2
+jal ra,-870
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1912(t0)
+beq t0,zero,3
+jal ra,148
+jal zero,2
+jal ra,350
+jal zero,140
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1948(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6039
+jal zero,130
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1976(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4890
+jal zero,120
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1980(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4382
+jal zero,110
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1952(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5874
+jal zero,100
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1956(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5784
+jal zero,90
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1960(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5694
+jal zero,80
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1964(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5604
+jal zero,70
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1968(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5491
+jal zero,60
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1972(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5378
+jal zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1984(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4014
+jal zero,40
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3793
+jal zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1992(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3521
+jal zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1944(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6427
+jal zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1996(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-3376
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1948(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6477
+jal ra,-6189
+jal zero,143
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1976(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5098
+jal ra,-5041
+jal zero,132
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1980(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4592
+jal ra,-4534
+jal zero,121
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1952(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6510
+jal ra,-6027
+jal zero,110
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1956(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6521
+jal ra,-5938
+jal zero,99
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1960(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6532
+jal ra,-5849
+jal zero,88
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1964(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6543
+jal ra,-5760
+jal zero,77
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1968(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6554
+jal ra,-5648
+jal zero,66
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1972(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6565
+jal ra,-5536
+jal zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1984(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4186
+jal ra,-4173
+jal zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6587
+jal ra,-3953
+jal zero,33
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1992(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6598
+jal ra,-3682
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1944(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-6609
+jal ra,-6589
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1996(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3559
+jal ra,-3539
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1980(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4459
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1984(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,13
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1996(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3381
+jal zero,2
+jal ra,-6559
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-3138
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1948(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6443
+jal ra,-6394
+jal ra,-6415
+jal zero,161
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1976(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-5498
+jal ra,-5247
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-5362
+jal zero,146
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1980(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-4996
+jal ra,-4744
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4854
+jal zero,131
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1952(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6279
+jal ra,-6241
+jal ra,-6457
+jal zero,119
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1956(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6291
+jal ra,-6153
+jal ra,-6469
+jal zero,107
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1960(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6303
+jal ra,-6065
+jal ra,-6481
+jal zero,95
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1964(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6315
+jal ra,-5977
+jal ra,-6493
+jal zero,83
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1968(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6327
+jal ra,-5866
+jal ra,-6505
+jal zero,71
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1972(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6339
+jal ra,-5755
+jal ra,-6517
+jal zero,59
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1984(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4467
+jal ra,-4393
+jal ra,-4429
+jal zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4239
+jal ra,-4174
+jal ra,-4200
+jal zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1992(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-3954
+jal ra,-3904
+jal ra,-4212
+jal zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1944(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6872
+jal ra,-6812
+jal ra,-6854
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1996(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3762
+jal zero,2
+jal ra,-29860
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+lw t0,-20(gp)
+lw t1,-72(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-72(gp)
+sw t0,4(sp)
+jal ra,-31236
+addi t0,a0,0
+sw t0,12(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1260(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-7594
+addi t0,a0,0
+beq t0,zero,84
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,4167
+addi t0,a0,0
+beq t0,zero,65
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-7583
+addi t0,a0,0
+beq t0,zero,42
+lw t0,-1256(gp)
+lw t1,-856(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-7520
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1472(gp)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1968(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7698
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2455
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1964(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2464
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1948(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2473
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1260(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-7720
+addi t0,a0,0
+beq t0,zero,75
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,4041
+addi t0,a0,0
+beq t0,zero,56
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-7709
+addi t0,a0,0
+beq t0,zero,33
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1252(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-7617
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1476(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1476(gp)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1968(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7815
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-2572
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1964(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2581
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1948(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-2590
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1948(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,31
+lw t0,-1256(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1260(gp)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-308
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1444(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1444(gp)
+jal zero,570
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1976(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-295
+jal zero,560
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1980(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-179
+jal zero,550
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1952(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+lw t0,-1256(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+lw t2,-1252(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-373
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1448(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1448(gp)
+jal zero,505
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1956(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+lw t0,-1256(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+lw t2,-1252(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-418
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1452(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1452(gp)
+jal zero,460
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1960(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+lw t0,-1256(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+lw t2,-1252(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+mul t0,t0,t1
+sw t0,4(sp)
+jal ra,-463
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1456(gp)
+jal zero,415
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1964(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,61
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1252(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,34
+lw t0,-1256(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+lw t2,-1252(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+divu t0,t0,t1
+sw t0,4(sp)
+jal ra,-520
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1952(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,-2862
+lw t0,-1460(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1460(gp)
+jal zero,347
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1968(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,61
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1252(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,34
+lw t0,-1256(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+lw t2,-1252(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+remu t0,t0,t1
+sw t0,4(sp)
+jal ra,-588
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1952(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,-2930
+lw t0,-1464(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1464(gp)
+jal zero,279
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1972(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+lw t2,-1252(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,8
+lw t0,-1256(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-646
+jal zero,7
+lw t0,-1256(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-653
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1468(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1468(gp)
+jal zero,225
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1984(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1832(t1)
+lw t2,-1252(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lw t2,-1260(gp)
+add t1,t1,t2
+sw t1,1844(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1480(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1480(gp)
+jal zero,173
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1988(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+lw t0,-1256(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-740
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lw t2,-1260(gp)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1484(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1484(gp)
+jal zero,140
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1992(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1248(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1260(gp)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-32371
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-32401
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-1256(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-796
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1844(t0)
+lw t0,-1488(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1488(gp)
+jal zero,88
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1944(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lw t0,-1256(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1260(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-32441
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-825
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+lw t0,-1440(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1440(gp)
+jal zero,53
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1996(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,45
+lw t0,-1492(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1492(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-924(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+lw t1,-1596(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+add t1,t1,t2
+sw t1,1844(t0)
+jal ra,-14013
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1960(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-924(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-3213
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-8444
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,3317
+addi t0,a0,0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-8433
+addi t0,a0,0
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,12(s0)
+sltu t0,t0,t1
+beq t0,zero,70
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36565
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1840(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36562
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1836(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36551
+addi t0,a0,0
+sw t0,-1256(gp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36538
+addi t0,a0,0
+sw t0,-1248(gp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36525
+addi t0,a0,0
+sw t0,-1252(gp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36512
+addi t0,a0,0
+sw t0,-1260(gp)
+jal ra,-722
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1820(t0)
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,18
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1880(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,8(s0)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-72
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,-2746
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1821
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,8(s0)
+sltu t0,t1,t0
+beq t0,zero,10
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,1
+sw t0,4(sp)
+jal ra,-126
+addi t0,a0,0
+addi a0,t0,0
+jal zero,491
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-864(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-12(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1876(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,66
+lw t0,-12(s0)
+lw t1,-68(gp)
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-197
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-166
+addi t0,a0,0
+addi a0,t0,0
+jal zero,451
+lw t0,-12(s0)
+lw t1,-68(gp)
+sub t0,t0,t1
+sw t0,-12(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1880(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36669
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-8539
+lw t0,-1444(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1444(gp)
+lw t0,-1476(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1476(gp)
+jal zero,366
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1872(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,54
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-270
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-239
+addi t0,a0,0
+addi a0,t0,0
+jal zero,378
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-8618
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-12(s0)
+lw t1,-68(gp)
+add t0,t0,t1
+sw t0,-12(s0)
+lw t0,-1472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1472(gp)
+lw t0,-1444(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1444(gp)
+jal zero,303
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1868(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,110
+lw t0,-12(s0)
+lw t1,-68(gp)
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-335
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-304
+addi t0,a0,0
+addi a0,t0,0
+jal zero,313
+jal zero,24
+lw t0,-12(s0)
+addi t1,zero,2
+lw t2,-68(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-359
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-328
+addi t0,a0,0
+addi a0,t0,0
+jal zero,289
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+lw t1,-68(gp)
+sub t0,t0,t1
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-860(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-8685
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+addi t1,zero,2
+lw t2,-68(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-888(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-8706
+lw t0,-12(s0)
+addi t1,zero,2
+lw t2,-68(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+sw t0,-12(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-888(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-12(s0)
+sw t1,0(t0)
+lw t0,-1444(gp)
+addi t1,zero,3
+add t0,t0,t1
+sw t0,-1444(gp)
+lw t0,-1476(gp)
+addi t1,zero,2
+add t0,t0,t1
+sw t0,-1476(gp)
+jal zero,184
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1864(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,117
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-452
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-421
+addi t0,a0,0
+addi a0,t0,0
+jal zero,196
+jal zero,22
+lw t0,-12(s0)
+lw t1,-68(gp)
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-474
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-443
+addi t0,a0,0
+addi a0,t0,0
+jal zero,174
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-888(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-8822
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-860(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1828(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+lw t1,-68(gp)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-8845
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-12(s0)
+lw t1,-68(gp)
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi t1,zero,3
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1880(t2)
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36962
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-12(s0)
+lw t0,-1472(gp)
+addi t1,zero,2
+add t0,t0,t1
+sw t0,-1472(gp)
+lw t0,-1444(gp)
+addi t1,zero,2
+add t0,t0,t1
+sw t0,-1444(gp)
+jal zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1860(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-1256(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-1260(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,12
+sw t0,4(sp)
+jal ra,-33107
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1880(t1)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37018
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,0(t0)
+lw t0,-1440(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1440(gp)
+lw t0,-1444(gp)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-1444(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1832(t0)
+lw t1,-864(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-12(s0)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1844(t1)
+lw t2,-8(s0)
+lui t3,0xFFFFF
+add t3,gp,t3
+lw t3,1980(t3)
+mul t2,t2,t3
+add t1,t1,t2
+sw t1,1844(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1756(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1756(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1752(t1)
+lw t2,-8(s0)
+add t1,t1,t2
+sw t1,1752(t0)
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1816(t0)
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1816(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1820(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1824(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1824(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sw t1,1824(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1824(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35588
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1972(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1956(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-3952
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1824(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1904(t0)
+beq t0,zero,48
+lw t0,-4(s0)
+lw t1,8(s0)
+sltu t0,t0,t1
+beq t0,zero,43
+jal ra,-2295
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1836(t0)
+lw t1,-1996(gp)
+sltu t0,t1,t0
+beq t0,zero,23
+lw t0,8(s0)
+lw t1,-4(s0)
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-637
+addi t0,a0,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1820(t0)
+beq t0,zero,6
+lw t0,-4(s0)
+lw t1,-8(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,42
+lw t0,-4(s0)
+lw t1,-8(s0)
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,13
+jal ra,-1407
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1820(t0)
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,29
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-45
+jal zero,19
+lw t0,-4(s0)
+lw t1,8(s0)
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-3131
+jal ra,-2255
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1820(t0)
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,10
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-17
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1820(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1820(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,62
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1824(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1884(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lw t0,-32(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-118
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1824(t0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-129
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1816(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1824(t1)
+lw t2,-4(s0)
+sub t1,t1,t2
+sw t1,1824(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1820(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-3224
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1904(t0)
+beq t0,zero,3
+jal ra,-1523
+jal zero,2
+jal ra,-2354
+jal ra,-238
+jal zero,-68
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1820(t0)
+jal ra,-14122
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,-32(gp)
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-1524(gp)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,33
+lw t0,8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-16(s0)
+lw t0,-8(s0)
+lw t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,17
+lw t0,-16(s0)
+lw t1,12(s0)
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-16(s0)
+sw t0,-8(s0)
+lw t0,-12(s0)
+sw t0,-4(s0)
+jal zero,8
+lw t0,-12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,23
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-39
+lw t0,-4(s0)
+lw t1,-32(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1980(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,-32(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-86
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-32(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,77
+lw t0,12(s0)
+lw t1,-4(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,12(s0)
+lw t1,-4(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sw t1,0(t0)
+lui t0,0xFFFFE
+addi t0,t0,-1092
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-32055
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-32035
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-4(s0)
+sw t0,16(sp)
+jal ra,-30945
+addi sp,sp,16
+lw t0,-1540(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,19
+lui t0,0xFFFFE
+addi t0,t0,-32
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1540(gp)
+lw t1,-4(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+divu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-30968
+addi sp,sp,4
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lui t0,0xFFFFE
+addi t0,t0,-1104
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-30979
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1116
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lw t0,12(s0)
+sw t0,12(sp)
+jal ra,-31008
+addi sp,sp,12
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+lw t0,-32(gp)
+sw t0,8(sp)
+jal ra,-148
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-151
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-154
+jal ra,-31915
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,16(s0)
+lw t1,20(s0)
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,48
+lw t0,20(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sw t0,20(s0)
+lui t0,0xFFFFE
+addi t0,t0,-1148
+add t0,gp,t0
+addi sp,sp,-36
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+lw t0,12(s0)
+sw t0,12(sp)
+lw t0,16(s0)
+lw t1,20(s0)
+add t0,t0,t1
+sw t0,16(sp)
+lw t0,16(s0)
+sw t0,20(sp)
+lw t0,20(s0)
+sw t0,24(sp)
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,20(s0)
+sw t0,4(sp)
+jal ra,-32264
+addi t0,a0,0
+sw t0,28(sp)
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,20(s0)
+sw t0,4(sp)
+jal ra,-32244
+addi t0,a0,0
+sw t0,32(sp)
+jal ra,-31096
+addi sp,sp,32
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22886
+addi t0,a0,0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1164
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1724(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1720(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,12(sp)
+jal ra,-97
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFE
+addi t0,t0,-1224
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-31158
+addi sp,sp,4
+lui t0,0xFFFFE
+addi t0,t0,-1240
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,-820
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1676(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1672(t0)
+sw t0,12(sp)
+jal ra,-136
+lw t0,-868(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-77
+lui t0,0xFFFFE
+addi t0,t0,-1256
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,-820
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1692(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1688(t0)
+sw t0,12(sp)
+jal ra,-157
+addi t0,zero,1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-848(gp)
+sltu t0,t0,t1
+beq t0,zero,46
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22940
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1716(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1724(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,1716(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1712(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1720(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,1712(t0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-140
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-48
+lui t0,0xFFFFE
+addi t0,t0,-1272
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,-820
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1716(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1712(t0)
+sw t0,12(sp)
+jal ra,-225
+lui t0,0xFFFFE
+addi t0,t0,-1288
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,-820
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1684(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1680(t0)
+sw t0,12(sp)
+jal ra,-242
+addi t0,zero,1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-848(gp)
+sltu t0,t0,t1
+beq t0,zero,46
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22953
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1708(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1724(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,1708(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1704(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1720(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,1704(t0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-225
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-48
+lui t0,0xFFFFE
+addi t0,t0,-1304
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,-820
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1708(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1704(t0)
+sw t0,12(sp)
+jal ra,-310
+addi t0,zero,1
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-848(gp)
+sltu t0,t0,t1
+beq t0,zero,46
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22992
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1700(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1724(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,1700(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1696(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1720(t2)
+lw t3,-4(s0)
+addi t4,zero,4
+mul t3,t3,t4
+add t2,t2,t3
+lw t2,0(t2)
+add t1,t1,t2
+sw t1,1696(t0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-293
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-48
+lui t0,0xFFFFE
+addi t0,t0,-1320
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+addi t0,zero,-820
+add t0,gp,t0
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1700(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1696(t0)
+sw t0,12(sp)
+jal ra,-378
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36365
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36635
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36356
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36923
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-9891
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-35567
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36867
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-9907
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-35498
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36937
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-9923
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-35582
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36935
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-9939
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-35581
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36933
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-9955
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-35580
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,34
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36482
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1216(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36170
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1372(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-148
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36846
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-37
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lui t0,0xFFFFE
+addi t0,t0,-1400
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36479
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-21762
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36489
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32741
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-21775
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36502
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32726
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-21788
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36515
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32823
+addi t0,a0,0
+sw t0,20(sp)
+jal ra,-21801
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36528
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32808
+addi t0,a0,0
+sw t0,24(sp)
+jal ra,-31660
+addi sp,sp,24
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,62
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36609
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,45
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36565
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36539
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36530
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36521
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37001
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,-65
+lw t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,76
+lui t0,0xFFFFE
+addi t0,t0,-1504
+add t0,gp,t0
+addi sp,sp,-32
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36628
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-32939
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36643
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32895
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36655
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32879
+addi t0,a0,0
+sw t0,20(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36664
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-32975
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,24(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36678
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-32961
+addi t0,a0,0
+sw t0,28(sp)
+jal ra,-31813
+addi sp,sp,28
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+addi t0,t0,-908
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-31836
+addi sp,sp,4
+lui t0,0xFFFFE
+addi t0,t0,-1520
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-31847
+addi sp,sp,4
+jal ra,-22003
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,42
+lui t0,0xFFFFE
+addi t0,t0,-1576
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+jal ra,-22013
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-22016
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,-21980
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32992
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-22026
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,-21990
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32974
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-31882
+addi sp,sp,12
+lui t0,0xFFFFE
+addi t0,t0,-1592
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-31893
+addi sp,sp,4
+lui t0,0xFFFFE
+addi t0,t0,-1660
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+jal ra,7210
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-33085
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,7201
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-33066
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-1888(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,7189
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-33047
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-1888(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,7180
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-33028
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-1888(gp)
+lw t1,-1852(gp)
+divu t0,t0,t1
+sw t0,20(sp)
+jal ra,-31940
+addi sp,sp,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1264(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,-1712
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1264(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1260(t0)
+sw t0,12(sp)
+jal ra,-31965
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1236(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,18
+lui t0,0xFFFFE
+addi t0,t0,-1764
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1236(t0)
+sw t0,8(sp)
+lw t0,-1940(gp)
+sw t0,12(sp)
+jal ra,-31988
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1232(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,-1832
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1232(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1228(t0)
+sw t0,12(sp)
+jal ra,-32013
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1328(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,24
+lui t0,0xFFFFE
+addi t0,t0,-1888
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1328(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1360(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,4617
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-32042
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1224(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,40
+lui t0,0xFFFFE
+addi t0,t0,-1980
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1224(t0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1220(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1224(t0)
+sw t0,4(sp)
+jal ra,-33251
+addi t0,a0,0
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1220(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1224(t0)
+sw t0,4(sp)
+jal ra,-33235
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-32087
+addi sp,sp,16
+jal ra,-556
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,466
+lui t0,0xFFFFF
+addi t0,t0,-720
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-32108
+addi sp,sp,4
+lui t0,0xFFFFE
+addi t0,t0,-2000
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37015
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-32125
+addi sp,sp,8
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37004
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,236
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-551
+lui t0,0xFFFFE
+addi t0,t0,-2044
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36930
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1848(gp)
+sw t0,4(sp)
+jal ra,-33336
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36942
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1848(gp)
+sw t0,4(sp)
+jal ra,-33320
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-32172
+addi sp,sp,12
+lui t0,0xFFFFD
+addi t0,t0,1952
+add t0,gp,t0
+addi sp,sp,-36
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37193
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37219
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-33381
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37215
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37241
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-33375
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37085
+addi t0,a0,0
+sw t0,16(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36996
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-33421
+addi t0,a0,0
+sw t0,20(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37008
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-33405
+addi t0,a0,0
+sw t0,24(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37267
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37293
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1868(gp)
+sw t0,4(sp)
+jal ra,-32136
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37043
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-33409
+addi t0,a0,0
+sw t0,28(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37299
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37325
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1868(gp)
+sw t0,4(sp)
+jal ra,-32168
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37075
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-33413
+addi t0,a0,0
+sw t0,32(sp)
+jal ra,-32321
+addi sp,sp,32
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36896
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,40
+lui t0,0xFFFFD
+addi t0,t0,1864
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36913
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37223
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36926
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-33538
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36954
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-32368
+addi sp,sp,16
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37209
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37197
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37188
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,160
+lui t0,0xFFFFD
+addi t0,t0,1824
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37246
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37234
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37225
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,8(sp)
+jal ra,-32433
+addi sp,sp,8
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37369
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1216(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,888
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-32456
+addi sp,sp,4
+jal zero,18
+lui t0,0xFFFFF
+addi t0,t0,888
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37398
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37364
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32474
+addi sp,sp,4
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37353
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,44
+lui t0,0xFFFFD
+addi t0,t0,1784
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37366
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37335
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37323
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37314
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-33701
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32525
+addi sp,sp,4
+jal ra,-33408
+lui t0,0xFFFFD
+addi t0,t0,1716
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37376
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37363
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37350
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-32555
+addi sp,sp,16
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37829
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-469
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1484(t0)
+beq t0,zero,16
+lui t0,0xFFFFF
+addi t0,t0,-720
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-32577
+addi sp,sp,4
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,2948
+jal ra,-22737
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,105
+jal ra,-22552
+lui t0,0xFFFFF
+addi t0,t0,-908
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-32598
+addi sp,sp,4
+lw t0,-1540(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFD
+addi t0,t0,1652
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-32614
+addi sp,sp,4
+jal zero,12
+lui t0,0xFFFFD
+addi t0,t0,1596
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-32626
+addi sp,sp,4
+lui t0,0xFFFFD
+addi t0,t0,1584
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1748(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1744(t0)
+sw t0,8(sp)
+jal ra,-1651
+lui t0,0xFFFFD
+addi t0,t0,1572
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1740(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1736(t0)
+sw t0,8(sp)
+jal ra,-1665
+lui t0,0xFFFFD
+addi t0,t0,1560
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1472(gp)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1732(t0)
+sw t0,8(sp)
+jal ra,-1677
+lui t0,0xFFFFD
+addi t0,t0,1548
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1476(gp)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1728(t0)
+sw t0,8(sp)
+jal ra,-1689
+lui t0,0xFFFFF
+addi t0,t0,-908
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-32689
+addi sp,sp,4
+jal ra,-1548
+lw t0,-1604(gp)
+beq t0,zero,124
+lui t0,0xFFFFF
+addi t0,t0,-908
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-32703
+addi sp,sp,4
+lui t0,0xFFFFD
+addi t0,t0,1488
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1756(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-13078
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-32720
+addi sp,sp,8
+lw t0,-1668(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40856
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1668(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40844
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFD
+addi t0,t0,1472
+add t0,gp,t0
+sw t0,8(sp)
+jal ra,-13522
+lw t0,-1668(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40817
+addi t0,a0,0
+lw t1,-1616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFD
+addi t0,t0,1452
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1668(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40813
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-32761
+addi sp,sp,4
+jal ra,-33644
+lw t0,-1664(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40898
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1664(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40886
+addi t0,a0,0
+sw t0,4(sp)
+lui t0,0xFFFFD
+addi t0,t0,1436
+add t0,gp,t0
+sw t0,8(sp)
+jal ra,-13564
+lw t0,-1608(gp)
+beq t0,zero,10
+lui t0,0xFFFFD
+addi t0,t0,1404
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1780(gp)
+sw t0,4(sp)
+jal ra,-32791
+addi sp,sp,4
+jal ra,-33674
+lw t0,-1784(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,14
+lui t0,0xFFFFD
+addi t0,t0,1336
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-1784(gp)
+sw t0,8(sp)
+jal ra,-32809
+addi sp,sp,8
+jal ra,-13482
+lw t0,-1772(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,2
+jal ra,-12891
+lui t0,0xFFFFF
+addi t0,t0,-908
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-32826
+addi sp,sp,4
+lui t0,0xFFFFD
+addi t0,t0,1292
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-32837
+addi sp,sp,4
+lw t0,-1920(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1924(gp)
+sw t0,4(sp)
+lui t0,0xFFFFD
+addi t0,t0,1276
+add t0,gp,t0
+sw t0,8(sp)
+jal ra,-13631
+jal ra,-33730
+lw t0,-1932(gp)
+lw t1,-1936(gp)
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,12
+lw t0,-1932(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1936(gp)
+sw t0,4(sp)
+lui t0,0xFFFFD
+addi t0,t0,1260
+add t0,gp,t0
+sw t0,8(sp)
+jal ra,-13648
+jal ra,-33747
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,980(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1000(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,1252
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32893
+jal zero,75
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,980(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,996(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,1244
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32910
+jal zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,980(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,992(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,1236
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32927
+jal zero,41
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,980(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,988(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,1228
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32944
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,980(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,984(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,1216
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32961
+jal zero,7
+lui t0,0xFFFFF
+addi t0,t0,64
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32968
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38087
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,30
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38101
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38093
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38106
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,30
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38120
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38112
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38315
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lw t2,-864(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+lw t0,12(s0)
+lw t1,-1864(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38167
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,16
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38162
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38191
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,21
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38414
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lw t2,-864(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-200
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-155
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,18
+jal zero,16
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-125
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-250
+addi t0,a0,0
+beq t0,zero,19
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38351
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38339
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,36
+jal zero,34
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-219
+addi t0,a0,0
+beq t0,zero,7
+lw t0,-1864(gp)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,22
+jal zero,20
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-191
+addi t0,a0,0
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38334
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-240
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35306
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-720(gp)
+sw t0,12(sp)
+lw t0,-728(gp)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,-1524(gp)
+sw t0,24(sp)
+jal ra,-31539
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-864(gp)
+sw t0,8(sp)
+jal ra,-22490
+lw t0,-856(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-860(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-22152
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-264
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35354
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-720(gp)
+sw t0,12(sp)
+lw t0,-728(gp)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,-1524(gp)
+sw t0,24(sp)
+jal ra,-31587
+lw t0,-896(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-856(gp)
+sw t0,4(sp)
+lw t0,-868(gp)
+sw t0,8(sp)
+jal ra,-22538
+lw t0,-856(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-860(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-22200
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-744(gp)
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-288
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35402
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+lw t0,-720(gp)
+sw t0,12(sp)
+lw t0,-728(gp)
+sw t0,16(sp)
+addi t0,zero,0
+sw t0,20(sp)
+lw t0,-1524(gp)
+sw t0,24(sp)
+jal ra,-31635
+jal ra,-22654
+jal ra,-22655
+jal ra,-22656
+lw t0,-856(gp)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-860(gp)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-22243
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1524(gp)
+sw t0,-4(s0)
+lw t0,8(s0)
+sw t0,-1524(gp)
+lw t0,-896(gp)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1536(gp)
+sw t0,4(sp)
+jal ra,-28358
+lw t0,-1444(gp)
+lw t1,-1524(gp)
+lw t2,8(s0)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+divu t1,t1,t2
+sub t0,t0,t1
+sw t0,-1444(gp)
+lw t0,-4(s0)
+sw t0,-1524(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38739
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38544
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,128
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,1204
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33552
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7320
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38570
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,1316
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33578
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7346
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38802
+addi t0,a0,0
+lw t1,-896(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,1334
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1916(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,1148
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33613
+lw t0,-896(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7381
+jal ra,-34499
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38819
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,268
+addi t0,a0,0
+lw t1,-68(gp)
+sub t0,t0,t1
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38644
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-12048
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38502
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-37757
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38894
+addi t0,a0,0
+addi t1,zero,8
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1980(t2)
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-38113
+jal zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18220
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32
+addi t0,a0,0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1468(t0)
+sw t0,4(sp)
+jal ra,905
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1468(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33560
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+addi t0,zero,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,67
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-56
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-37419
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37483
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-37416
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37474
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-37409
+lw t0,-12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37465
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-37402
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-12(s0)
+sw t0,-4(s0)
+jal zero,7
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-37464
+lw t0,-12(s0)
+sw t0,-8(s0)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37542
+addi t0,a0,0
+sw t0,12(s0)
+jal zero,-70
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-161
+addi t0,a0,0
+beq t0,zero,6
+jal ra,-37609
+addi t0,a0,0
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39068
+addi t0,a0,0
+lw t1,-864(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-195
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1452(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38951
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-225
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1448(t0)
+addi a0,t0,0
+jal zero,20
+jal zero,18
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38981
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38969
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-265
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1444(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38983
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-295
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1440(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38994
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-325
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1436(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38758
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-355
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1432(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38769
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-385
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1428(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38780
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-415
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1480(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38791
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-445
+addi t0,a0,0
+beq t0,zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37883
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1448(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1448(t1)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-37883
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+sub t1,t1,t2
+sw t1,1452(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-33921
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1444(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1444(t1)
+sw t1,1440(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-505
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,12(s0)
+sw t1,1436(t0)
+jal zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-38201
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-532
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,12(s0)
+sw t1,1432(t0)
+jal zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-38211
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-559
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,12(s0)
+sw t1,1428(t0)
+jal zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-38221
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-586
+addi t0,a0,0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1488(t1)
+sw t1,1480(t0)
+jal zero,9
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1488(t0)
+sw t0,4(sp)
+jal ra,-38235
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-210
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1488(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-37899
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+addi t2,zero,2
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+sw t1,1468(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-666
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,4
+sw t1,1464(t0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-68(gp)
+sw t1,1464(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-244
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-190
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-169
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-148
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-125
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-373
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,66
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38100
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38153
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-229
+jal zero,11
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38164
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-38095
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-454
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-38105
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-283
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,14
+lw t0,-8(s0)
+sw t0,-4(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38192
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,-69
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-811
+addi t0,a0,0
+beq t0,zero,6
+lw t0,12(s0)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,32
+jal zero,30
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39699
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-13027
+addi t0,a0,0
+beq t0,zero,15
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39711
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-12952
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-862
+addi t0,a0,0
+beq t0,zero,5
+lw t0,12(s0)
+lw t1,16(s0)
+sw t1,0(t0)
+jal zero,25
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39749
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-13077
+addi t0,a0,0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39761
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-12980
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38295
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38285
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-4(s0)
+lw t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,16
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-79
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1464(t1)
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-18
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-956
+addi t0,a0,0
+beq t0,zero,25
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-34402
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,12(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1440(t1)
+sltu t0,t1,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+lw t2,12(s0)
+add t1,t1,t2
+sw t1,1440(t0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,33
+jal zero,28
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39673
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+lw t1,12(s0)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-19300
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,-4(s0)
+lw t2,12(s0)
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-322
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-146
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38436
+addi t0,a0,0
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,10
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1424(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1424(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1404(t1)
+lw t2,12(s0)
+add t1,t1,t2
+sw t1,1404(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-89
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1412(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1412(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1392(t1)
+lw t2,12(s0)
+add t1,t1,t2
+sw t1,1392(t0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,112
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-194
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,87
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1128
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,72
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-849
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-38500
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-678
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-38499
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-38488
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1460(t0)
+sw t0,4(sp)
+jal ra,-38479
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1420(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1420(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1416(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1400(t1)
+lw t2,12(s0)
+add t1,t1,t2
+sw t1,1400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1396(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1468(t2)
+add t1,t1,t2
+sw t1,1396(t0)
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1404(t1)
+lw t2,12(s0)
+sub t1,t1,t2
+sw t1,1404(t0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-884
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1476(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,551
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-728
+jal zero,13
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-910
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-741
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1464(t0)
+sw t0,4(sp)
+jal ra,-34840
+addi t0,a0,0
+sw t0,12(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-246
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1073
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,96
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1058
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,79
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1042
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,64
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1370
+addi t0,a0,0
+beq t0,zero,18
+lw t0,12(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+lw t0,12(s0)
+lw t1,-4(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1468(t2)
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,45
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38781
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,12(s0)
+lw t1,-8(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,22
+lw t0,12(s0)
+lw t1,-8(s0)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38780
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,12
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38829
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-67
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-648
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,7
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1475
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-13717
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,74
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-182
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,59
+jal zero,23
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38864
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1460(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1456(t0)
+sw t0,4(sp)
+jal ra,-38814
+jal zero,2
+jal zero,36
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38924
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38914
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+sw t0,-12(s0)
+lw t0,-8(s0)
+lw t1,-12(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-120
+lw t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1464(t1)
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-16
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1464(t1)
+sub t0,t0,t1
+sw t0,12(s0)
+lw t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1464(t1)
+sub t0,t0,t1
+sw t0,16(s0)
+lw t0,12(s0)
+lw t1,16(s0)
+sltu t0,t0,t1
+beq t0,zero,18
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1464(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-164
+lw t0,12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1464(t1)
+add t0,t0,t1
+sw t0,12(s0)
+jal zero,-20
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1308
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,31
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1486
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-1860(gp)
+lw t1,-1856(gp)
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-72
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1466
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1442
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-88
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39088
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1191
+jal zero,11
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39099
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-39030
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1472(t0)
+beq t0,zero,17
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1363
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-39044
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1195
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1388(t1)
+addi sp,sp,-4
+sw t1,0(sp)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39101
+lw t0,0(sp)
+addi sp,sp,4
+lw t1,0(sp)
+addi sp,sp,4
+addi t2,a0,0
+add t1,t1,t2
+sw t1,1388(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,6
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1453
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,41
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39184
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39137
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1460(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-135
+jal zero,11
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1460(t0)
+sw t0,4(sp)
+jal ra,-39096
+lw t0,-8(s0)
+sw t0,-4(s0)
+lw t0,-12(s0)
+sw t0,-8(s0)
+jal zero,-44
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-215
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-91
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1408(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1408(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1128
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1404(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-36730
+addi t0,a0,0
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1404(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-36712
+addi t0,a0,0
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1424(t0)
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1420(t0)
+sw t0,20(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1412(t0)
+sw t0,24(sp)
+jal ra,-35576
+addi sp,sp,24
+lui t0,0xFFFFD
+addi t0,t0,1060
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1392(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-36773
+addi t0,a0,0
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1392(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-36755
+addi t0,a0,0
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1404(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1392(t0)
+sw t0,4(sp)
+jal ra,-36739
+addi t0,a0,0
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1404(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1392(t0)
+sw t0,4(sp)
+jal ra,-36723
+addi t0,a0,0
+sw t0,20(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1412(t0)
+sw t0,24(sp)
+jal ra,-35635
+addi sp,sp,24
+lui t0,0xFFFFD
+addi t0,t0,1008
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1388(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-36832
+addi t0,a0,0
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1388(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-36814
+addi t0,a0,0
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1408(t0)
+sw t0,16(sp)
+jal ra,-35670
+addi sp,sp,16
+lui t0,0xFFFFD
+addi t0,t0,920
+add t0,gp,t0
+addi sp,sp,-36
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1400(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1396(t1)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-36871
+addi t0,a0,0
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1400(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1396(t1)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-36857
+addi t0,a0,0
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1404(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1400(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1396(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-36845
+addi t0,a0,0
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1404(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1400(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1396(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-36833
+addi t0,a0,0
+sw t0,20(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1420(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1416(t1)
+add t0,t0,t1
+sw t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1420(t0)
+sw t0,28(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1416(t0)
+sw t0,32(sp)
+jal ra,-35757
+addi sp,sp,32
+lui t0,0xFFFFD
+addi t0,t0,848
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1400(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-36954
+addi t0,a0,0
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1400(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-36936
+addi t0,a0,0
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1404(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1400(t0)
+sw t0,4(sp)
+jal ra,-36920
+addi t0,a0,0
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1404(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1400(t0)
+sw t0,4(sp)
+jal ra,-36904
+addi t0,a0,0
+sw t0,20(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1420(t0)
+sw t0,24(sp)
+jal ra,-35816
+addi sp,sp,24
+lui t0,0xFFFFD
+addi t0,t0,776
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1396(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-37013
+addi t0,a0,0
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1396(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1852(gp)
+sw t0,4(sp)
+jal ra,-36995
+addi t0,a0,0
+sw t0,12(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1404(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1396(t0)
+sw t0,4(sp)
+jal ra,-36979
+addi t0,a0,0
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1404(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1396(t0)
+sw t0,4(sp)
+jal ra,-36963
+addi t0,a0,0
+sw t0,20(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1416(t0)
+sw t0,24(sp)
+jal ra,-35875
+addi sp,sp,24
+lw t0,8(s0)
+beq t0,zero,7
+lui t0,0xFFFFD
+addi t0,t0,764
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35884
+jal ra,-36766
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1352(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35555
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1356(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35571
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1340(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1356(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35587
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1336(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1344(t0)
+lw t1,8(s0)
+addi t2,zero,4
+divu t1,t1,t2
+lw t2,12(s0)
+addi t3,zero,4
+divu t2,t2,t3
+add t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1352(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40919
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40907
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-49
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-39925
+lw t0,-4(s0)
+lw t1,8(s0)
+sw t1,0(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40957
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40945
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-87
+addi t0,a0,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,51
+lw t0,-12(s0)
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40713
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+jal zero,11
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40725
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40000
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40006
+jal zero,10
+lw t0,-12(s0)
+sw t0,-8(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40741
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,-54
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40703
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40023
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1336(t0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1340(t0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,8(s0)
+sw t1,0(t0)
+jal zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1336(t0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-40059
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1336(t0)
+lw t1,-4(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,8(s0)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1332(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1332(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1340(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1340(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40841
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1340(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1336(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sw t1,0(t0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40147
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1332(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sw t1,1332(t0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1384(t0)
+sw t0,4(sp)
+jal ra,-40161
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-176
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1376(t0)
+sw t0,4(sp)
+jal ra,-40183
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1372(t0)
+sw t0,4(sp)
+jal ra,-40202
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41262
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40949
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1372(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-4927
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41629
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-40
+jal ra,-19771
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,4083
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+lw t1,8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41000
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1380(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-119
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1380(t0)
+sw t0,4(sp)
+jal ra,-40298
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40991
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-40276
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1360(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1364(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,58
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41438
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1956(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41051
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1356(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41066
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-40349
+jal zero,21
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41076
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41087
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-40370
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1332(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,79
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1328(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1328(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1328(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1348(t1)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1356(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+lw t0,-4(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-379
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,33
+jal zero,-22
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1356(t1)
+sltu t0,t0,t1
+beq t0,zero,20
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-402
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,10
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-24
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,760
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-38448
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1368(t0)
+addi a0,t0,0
+jal zero,22
+jal zero,20
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,748
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-38464
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1364(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,-32(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1368(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFD
+addi t0,t0,736
+add t0,gp,t0
+addi a0,t0,0
+jal zero,8
+jal zero,6
+lui t0,0xFFFFD
+addi t0,t0,748
+add t0,gp,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1292(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-42563
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1292(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1292(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41986
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1292(t0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+sw t0,4(sp)
+jal ra,-41204
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41197
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-41212
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-4(s0)
+sw t1,1296(t0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1292(t0)
+sw t0,4(sp)
+jal ra,-41252
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,1292(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-778
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42068
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42077
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42069
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41280
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42076
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42085
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42107
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41316
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41309
+jal zero,7
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42121
+addi t0,a0,0
+sw t0,12(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-93
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-848(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36530
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41313
+lw t0,-1884(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1876(gp)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36548
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41314
+jal zero,15
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1876(gp)
+lw t1,-1880(gp)
+divu t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36563
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41329
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41318
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42109
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41311
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1864(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-15523
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41304
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42091
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41297
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1312(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36793
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40784
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-40773
+lw t0,12(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1216(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,152
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-848(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1308(t1)
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-36822
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-40779
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42201
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42694
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-15446
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41343
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42221
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42696
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-15466
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41346
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42241
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42698
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-15486
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41349
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42261
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42700
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-15506
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41352
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42281
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42702
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-15526
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-41355
+lw t0,-88(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39107
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42307
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42602
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-15552
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-22264
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-41270
+jal zero,23
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1972(t0)
+sw t0,4(sp)
+jal ra,-41364
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41353
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1204(t0)
+sw t0,4(sp)
+jal ra,-41344
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-41333
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-41322
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41294
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41283
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41272
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41261
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41250
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41239
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41228
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41217
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41206
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41195
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1492(t0)
+sw t0,4(sp)
+jal ra,-41186
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41175
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41164
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41153
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1384(t0)
+sw t0,4(sp)
+jal ra,-41144
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41133
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41122
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-41111
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+jal ra,-605
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-433
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1326
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1324(t0)
+beq t0,zero,26
+lui t0,0xFFFFD
+addi t0,t0,688
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42215
+addi t0,a0,0
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42223
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-37333
+addi sp,sp,12
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-1407
+addi t0,a0,0
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42299
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42290
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,12
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42037
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-34
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-73
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-149
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-15953
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1220(t1)
+lw t2,20(s0)
+add t1,t1,t2
+sw t1,1220(t0)
+lw t0,20(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,54
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17085
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,16(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,16(s0)
+lw t0,20(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,20(s0)
+lw t0,12(s0)
+lw t1,-68(gp)
+add t0,t0,t1
+sw t0,12(s0)
+lw t0,20(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,24
+lw t0,12(s0)
+lw t1,-1868(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-16010
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,7
+lw t0,-4(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-56
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,92
+lw t0,16(s0)
+lw t0,0(t0)
+lw t1,20(s0)
+lw t1,0(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,42
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-16057
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-17162
+lw t0,-1604(gp)
+beq t0,zero,7
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-18414
+lw t0,20(s0)
+lw t1,16(s0)
+lw t1,0(t1)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1220(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1220(t0)
+lw t0,16(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,16(s0)
+lw t0,20(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,20(s0)
+lw t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,24(s0)
+lw t0,12(s0)
+lw t1,-68(gp)
+add t0,t0,t1
+sw t0,12(s0)
+lw t0,12(s0)
+lw t1,-1868(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sw t0,-4(s0)
+jal zero,12
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lw t0,-4(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-94
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,20(s0)
+lw t1,16(s0)
+lw t1,0(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,20(s0)
+sw t0,8(sp)
+jal ra,-16067
+lw t0,16(s0)
+lw t1,20(s0)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1220(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1220(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1844(t0)
+sw t0,4(sp)
+jal ra,-42134
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42624
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1216(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,243
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42635
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42905
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42626
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43532
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42964
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-16140
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42230
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43539
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-16183
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42973
+addi t0,a0,0
+sw t0,8(sp)
+lw t0,-16(s0)
+sw t0,12(sp)
+lw t0,-848(gp)
+sw t0,16(sp)
+jal ra,-232
+lw t0,-16(s0)
+lw t1,-848(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43370
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-16(s0)
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42792
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-147
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43370
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-16(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42795
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-169
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43374
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-16(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42798
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-191
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43378
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-16(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42801
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-213
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43238
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-16(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42614
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-235
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43242
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-16(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42617
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-257
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43246
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-16(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42620
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-279
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43250
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-16(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,8(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42623
+addi t0,a0,0
+sw t0,12(sp)
+jal ra,-301
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,-28100
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42827
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-42081
+lw t0,-1860(gp)
+lw t1,-1856(gp)
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43184
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lw t2,-864(gp)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sub t0,t0,t1
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42764
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-42033
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lw t1,12(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,7
+lw t0,8(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,12(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43257
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-16811
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16643
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-5106
+addi t0,a0,0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16655
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-1868(gp)
+sw t0,8(sp)
+jal ra,-10706
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43108
+addi t0,a0,0
+lw t1,-68(gp)
+sub t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16689
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,34
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43302
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-124
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-42524
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43299
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-118
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-42523
+jal zero,33
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43297
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-157
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-42523
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43294
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-151
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-42522
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42696
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1312(t1)
+sltu t0,t0,t1
+beq t0,zero,12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42727
+addi t0,a0,0
+lw t1,-8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,12(s0)
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-42009
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1320(t0)
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,632
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,16(s0)
+sw t0,12(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43124
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-38234
+addi sp,sp,16
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,20(s0)
+lw t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,63
+lw t0,16(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,20(s0)
+sw t0,8(sp)
+jal ra,-17375
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-17876
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,11
+lw t0,16(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,20(s0)
+sw t0,8(sp)
+jal ra,-17697
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-16877
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-17233
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,20(s0)
+sw t0,4(sp)
+lw t0,-8(s0)
+sw t0,8(sp)
+jal ra,-257
+lw t0,20(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,20(s0)
+jal zero,-65
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,32
+lw t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,24(s0)
+lw t0,16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,20(s0)
+lw t1,24(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-16775
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+sw t0,12(sp)
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,16(sp)
+jal ra,-117
+jal zero,-34
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43573
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,78
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43322
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,61
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43316
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44181
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-16843
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43602
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43589
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-191
+lw t0,-8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43584
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43571
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-211
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-90
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43730
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,-81
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-36
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43411
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1216(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,399
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43422
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43692
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43413
+addi t0,a0,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1224(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1224(t0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44330
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-16956
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-42972
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43025
+addi t0,a0,0
+sw t0,-20(s0)
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44334
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-16978
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-20(s0)
+sw t0,8(sp)
+lw t0,-848(gp)
+sw t0,12(sp)
+jal ra,-1106
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43775
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-12(s0)
+lw t1,-848(gp)
+sltu t0,t0,t1
+beq t0,zero,18
+lw t0,-16(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-20(s0)
+lw t2,-12(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-20
+lw t0,-20(s0)
+lw t1,-848(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-20(s0)
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44188
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-20(s0)
+sw t0,8(sp)
+addi t0,zero,4
+sw t0,12(sp)
+jal ra,-1155
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-20(s0)
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-42850
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-20(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-42844
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-20(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-42838
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-20(s0)
+addi t1,zero,3
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-42832
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44422
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-17084
+addi t0,a0,0
+sw t0,-24(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43948
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-17096
+addi t0,a0,0
+sw t0,-28(s0)
+lw t0,-28(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1312(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,23
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-24(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43993
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-17123
+addi t0,a0,0
+sw t0,12(sp)
+lw t0,-28(s0)
+sw t0,16(sp)
+jal ra,-376
+lw t0,-28(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1312(t1)
+sltu t0,t1,t0
+beq t0,zero,2
+jal ra,-17843
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44465
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-17145
+addi t0,a0,0
+sw t0,-32(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44459
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-17157
+addi t0,a0,0
+sw t0,-36(s0)
+lw t0,-28(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1312(t1)
+sltu t0,t1,t0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-24(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+lw t0,-32(s0)
+sw t0,12(sp)
+lw t0,-36(s0)
+sw t0,16(sp)
+jal ra,-503
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44507
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-36(s0)
+sw t0,8(sp)
+jal ra,-17165
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44483
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-17199
+addi t0,a0,0
+sw t0,-32(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44477
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-17211
+addi t0,a0,0
+sw t0,-36(s0)
+lw t0,-28(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1312(t1)
+sltu t0,t1,t0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lw t0,-24(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+lw t0,-32(s0)
+sw t0,12(sp)
+lw t0,-36(s0)
+sw t0,16(sp)
+jal ra,-557
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44507
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-32(s0)
+sw t0,8(sp)
+jal ra,-17219
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44105
+addi t0,a0,0
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-17231
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44207
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-20(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,8(sp)
+addi t0,zero,4
+sw t0,12(sp)
+jal ra,-1394
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-20(s0)
+addi t1,zero,4
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-42855
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-20(s0)
+addi t1,zero,5
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-42849
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-20(s0)
+addi t1,zero,6
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-42843
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-20(s0)
+addi t1,zero,7
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-42837
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44128
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1844(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44121
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1832(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44114
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1828(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,26
+addi t0,a0,0
+sw t0,-1748(gp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,-29085
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43812
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-43066
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43510
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1316(t1)
+divu t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1256(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1252(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1316(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1256(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1252(t0)
+jal ra,-22400
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1256(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1316(t1)
+mul t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1252(t1)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-42842
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1252(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1252(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43572
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1316(t1)
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1284(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,33
+jal zero,31
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1268(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,22
+jal zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1288(t0)
+lw t1,-1852(gp)
+add t0,t0,t1
+lw t1,-1888(gp)
+lw t2,-1892(gp)
+mul t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1288(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1284(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1280(t1)
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-29
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1276(t1)
+sltu t0,t1,t0
+beq t0,zero,6
+jal ra,-36
+addi t0,a0,0
+addi a0,t0,0
+jal zero,8
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1276(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1268(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1268(t0)
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1268(t1)
+lw t1,0(t1)
+sw t1,1268(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1280(t1)
+lw t2,-1872(gp)
+sub t1,t1,t2
+sw t1,1280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1260(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1260(t0)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-38907
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,127
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1284(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,76
+jal ra,-160
+addi t0,a0,0
+beq t0,zero,56
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-1852(gp)
+lw t2,-1872(gp)
+lw t3,-1868(gp)
+divu t2,t2,t3
+mul t1,t1,t2
+sw t1,1284(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1284(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-38971
+addi t0,a0,0
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1288(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1284(t2)
+add t1,t1,t2
+sw t1,1288(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-39093
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1272(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+lw t1,-4(s0)
+sltu t0,t1,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1284(t1)
+lw t2,-1872(gp)
+sub t1,t1,t2
+sw t1,1284(t0)
+jal zero,18
+lui t0,0xFFFFD
+addi t0,t0,596
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-39262
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1160(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48794
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1272(t0)
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1272(t1)
+lw t2,-1872(gp)
+add t1,t1,t2
+sw t1,1272(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1284(t1)
+lw t2,-1872(gp)
+sub t1,t1,t2
+sw t1,1284(t0)
+jal ra,-38908
+addi t0,a0,0
+beq t0,zero,11
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-27650
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-39032
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-218
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1276(t0)
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1268(t1)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,1268(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1280(t1)
+lw t2,-1872(gp)
+add t1,t1,t2
+sw t1,1280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1264(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1264(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,-1880(gp)
+lw t1,-1872(gp)
+mul t0,t0,t1
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1288(t0)
+lw t1,-4(s0)
+add t0,t0,t1
+lw t1,-1888(gp)
+lw t2,-1892(gp)
+mul t1,t1,t2
+sltu t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,48
+lw t0,-4(s0)
+lw t1,-1872(gp)
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39151
+addi t0,a0,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1288(t1)
+lw t2,-4(s0)
+add t1,t1,t2
+sw t1,1288(t0)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-39267
+addi t0,a0,0
+sw t0,-8(s0)
+jal ra,-39028
+addi t0,a0,0
+beq t0,zero,11
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-27770
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-39152
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lw t0,-1884(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,263
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44654
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19044
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,233
+jal zero,10
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-18920
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,223
+lw t0,-1880(gp)
+sw t0,-16(s0)
+lw t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+lw t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-16(s0)
+lw t0,-8(s0)
+lw t1,-16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,199
+jal zero,-22
+jal ra,-156
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,186
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19099
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sub t0,t0,t1
+sw t0,12(s0)
+lw t0,-16(s0)
+lw t1,-1880(gp)
+sltu t0,t0,t1
+beq t0,zero,58
+lw t0,-8(s0)
+lw t1,-16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-20(s0)
+addi t0,zero,0
+sw t0,-24(s0)
+lw t0,-24(s0)
+lw t1,-1872(gp)
+addi t2,zero,4
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,26
+lw t0,-12(s0)
+lw t1,-16(s0)
+lw t2,-1872(gp)
+addi t3,zero,4
+divu t2,t2,t3
+mul t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-24(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-20(s0)
+lw t2,-24(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lw t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-24(s0)
+jal zero,-30
+lw t0,-20(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,450
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,-16(s0)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-18808
+lw t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,-60
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19188
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-12(s0)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,0(t0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-305
+jal ra,-18765
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1262
+jal ra,-23037
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44818
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1640
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44040
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,-1880(gp)
+add t0,t0,t1
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44819
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1638
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44043
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44186
+addi t0,a0,0
+lw t1,-1880(gp)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-43477
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1236(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1236(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1320(t0)
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,528
+add t0,gp,t0
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+lw t0,-12(s0)
+sw t0,12(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44600
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-39710
+addi sp,sp,16
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1248(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1304(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39394
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1248(t0)
+lw t1,8(s0)
+lw t2,-1872(gp)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1304(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-59
+addi t0,a0,0
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43241
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,12
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43269
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-24
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-57
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,73
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1244(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+addi t0,zero,3
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-39679
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1244(t0)
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1244(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43331
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1244(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-154
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-43295
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-43288
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,2
+sw t0,4(sp)
+jal ra,-43277
+lw t0,-4(s0)
+lw t1,-8(s0)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1240(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1240(t0)
+jal zero,13
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43345
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-43301
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43369
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,4(sp)
+jal ra,-43325
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43378
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,79
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43407
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-241
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t0,0(t0)
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43442
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+jal zero,30
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43454
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43463
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,-15
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43473
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-43423
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1244(t0)
+sw t0,4(sp)
+jal ra,-43431
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,1244(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1240(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sw t1,1240(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1240(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-283
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,3
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-141
+jal zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-755
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-19027
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,60
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-331
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,49
+jal ra,-973
+addi t0,a0,0
+sw t0,-12(s0)
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+lw t1,-1872(gp)
+addi t2,zero,4
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,18
+lw t0,-12(s0)
+lw t1,-16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+lw t2,-16(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lw t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,-22
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-214
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+jal ra,-18891
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1228(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1228(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-20
+jal ra,-3485
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45111
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45098
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-3321
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45431
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44644
+addi t0,zero,0
+sw t0,-20(s0)
+lw t0,-20(s0)
+lw t1,-848(gp)
+sltu t0,t0,t1
+beq t0,zero,30
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45425
+addi t0,a0,0
+lw t1,-20(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45436
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+lw t2,-20(s0)
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+lw t1,0(t1)
+sw t1,0(t0)
+lw t0,-20(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-20(s0)
+jal zero,-32
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45343
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44570
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45334
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44563
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45325
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44556
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45316
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44549
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45307
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44542
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45298
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44535
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45289
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44528
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45280
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44521
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45271
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44514
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45224
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44473
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45085
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-6605
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44353
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45082
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-6621
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44352
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45076
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44345
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45067
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-44338
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45587
+addi t0,a0,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-1876(gp)
+sltu t0,t0,t1
+beq t0,zero,35
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-19729
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lw t0,-16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-595
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+lw t0,-16(s0)
+sw t0,8(sp)
+jal ra,-2372
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-19709
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,-37
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1232(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1232(t0)
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-36
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45657
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45397
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1216(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sw t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-1884(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+lw t0,-8(s0)
+beq t0,zero,39
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-1876(gp)
+sltu t0,t0,t1
+beq t0,zero,33
+lw t0,-4(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lw t0,-4(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-472
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-19261
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-35
+jal zero,106
+addi t0,zero,0
+sw t0,-36(s0)
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+lw t1,-1876(gp)
+lw t2,-1880(gp)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,93
+lw t0,-4(s0)
+lw t1,-16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-20(s0)
+lw t0,-20(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,76
+lw t0,-20(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19984
+addi t0,a0,0
+sw t0,-24(s0)
+addi t0,zero,0
+sw t0,-28(s0)
+lw t0,-28(s0)
+lw t1,-1880(gp)
+sltu t0,t0,t1
+beq t0,zero,45
+lw t0,-24(s0)
+beq t0,zero,10
+lw t0,-20(s0)
+addi t1,zero,1
+sub t0,t0,t1
+lw t1,-28(s0)
+lw t2,-1872(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-32(s0)
+jal zero,8
+lw t0,-20(s0)
+lw t1,-28(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-32(s0)
+lw t0,-32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+lw t0,-8(s0)
+beq t0,zero,5
+lw t0,-32(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-549
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-16(s0)
+lw t1,-1880(gp)
+mul t0,t0,t1
+lw t1,-28(s0)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-19809
+lw t0,-28(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-28(s0)
+jal zero,-47
+lw t0,-4(s0)
+lw t1,-16(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sw t1,0(t0)
+addi t0,zero,1
+sw t0,-36(s0)
+lw t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lw t0,-20(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1304
+lw t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,-97
+lw t0,-36(s0)
+beq t0,zero,2
+jal ra,-19771
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45843
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-19171
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19247
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1530
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-2620
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45872
+addi t0,a0,0
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-19091
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-7715
+addi t0,a0,0
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,-68(gp)
+sw t0,8(sp)
+jal ra,-13311
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45892
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45917
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-19573
+addi t0,a0,0
+beq t0,zero,6
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-16
+jal ra,-1699
+addi t0,a0,0
+beq t0,zero,33
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1604
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-2694
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-20311
+addi t0,a0,0
+lw t1,-1880(gp)
+addi t2,zero,1
+sub t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-1324
+lw t0,-4(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-4(s0)
+jal zero,-34
+lw t0,-1892(gp)
+lw t1,-1872(gp)
+lw t2,-1868(gp)
+divu t1,t1,t2
+add t0,t0,t1
+sw t0,-1892(gp)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,20(s0)
+sltu t0,t0,t1
+beq t0,zero,134
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45993
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,-4(s0)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-19323
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,-4(s0)
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19401
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-1684
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-2774
+lw t0,-4(s0)
+sw t0,-8(s0)
+lw t0,12(s0)
+lw t1,-4(s0)
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19415
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19405
+addi t0,a0,0
+lw t1,12(s0)
+sub t0,t0,t1
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,20(s0)
+sltu t0,t1,t0
+beq t0,zero,3
+lw t0,20(s0)
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46050
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,-4(s0)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-19356
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-4(s0)
+lw t1,-12(s0)
+sltu t0,t0,t1
+beq t0,zero,36
+lw t0,-16(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-30493
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-20472
+lw t0,-1604(gp)
+beq t0,zero,9
+lw t0,12(s0)
+lw t1,-4(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-16(s0)
+sw t0,4(sp)
+jal ra,-21726
+lw t0,-4(s0)
+lw t1,-68(gp)
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-16(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-16(s0)
+jal zero,-38
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,-8(s0)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-7936
+addi t0,a0,0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+lw t1,-8(s0)
+add t0,t0,t1
+sw t0,4(sp)
+lw t0,-4(s0)
+lw t1,-8(s0)
+sub t0,t0,t1
+sw t0,8(sp)
+jal ra,-13536
+jal zero,-136
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1368(gp)
+sw t0,4(sp)
+jal ra,-45387
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1520(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19531
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-45346
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46137
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-45339
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1520(gp)
+sw t0,4(sp)
+jal ra,-45294
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1524(gp)
+sw t0,4(sp)
+jal ra,-45283
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1532(gp)
+sw t0,4(sp)
+jal ra,-45272
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1536(gp)
+sw t0,4(sp)
+jal ra,-45261
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1532(gp)
+lw t1,-1536(gp)
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1868(gp)
+sw t0,4(sp)
+jal ra,-40857
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-45258
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46033
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-45251
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46119
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-1516(gp)
+sw t0,8(sp)
+lw t0,-1524(gp)
+sw t0,12(sp)
+jal ra,-243
+lw t0,8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46095
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-1528(gp)
+sw t0,8(sp)
+lw t0,-1536(gp)
+sw t0,12(sp)
+jal ra,-257
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43039
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-40921
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,16(s0)
+lw t1,-4(s0)
+sub t0,t0,t1
+sw t0,16(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,24
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,16(s0)
+lw t1,-8(s0)
+add t0,t0,t1
+sw t0,4(sp)
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+addi t0,zero,1
+sw t0,8(sp)
+jal ra,-30703
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-453
+lw t0,-8(s0)
+lw t1,-68(gp)
+add t0,t0,t1
+sw t0,-8(s0)
+jal zero,-26
+lw t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,-1860(gp)
+lw t1,-1856(gp)
+mul t0,t0,t1
+sw t0,-4(s0)
+lw t0,12(s0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-40950
+addi t0,a0,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,12(s0)
+sltu t0,t0,t1
+beq t0,zero,28
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,16(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-99
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,-30
+lw t0,-4(s0)
+lw t1,-68(gp)
+sub t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-531
+lw t0,-4(s0)
+lw t1,-68(gp)
+sub t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-543
+lw t0,-12(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,23
+lw t0,-4(s0)
+lw t1,-68(gp)
+sub t0,t0,t1
+sw t0,-4(s0)
+lw t0,-12(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-12(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,-8(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-568
+jal zero,-25
+lw t0,-4(s0)
+lw t1,-68(gp)
+sub t0,t0,t1
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+lw t0,12(s0)
+sw t0,8(sp)
+jal ra,-581
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46439
+addi t0,a0,0
+lw t1,-864(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-4(s0)
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46450
+addi t0,a0,0
+lw t1,-888(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sw t1,0(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43243
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43250
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,16(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43262
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43289
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43275
+addi t0,a0,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,46
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,29
+lw t0,-12(s0)
+addi t1,zero,47
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,14
+lw t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-43529
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,3
+addi t0,zero,46
+sw t0,-12(s0)
+jal zero,-32
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,8(s0)
+sw t0,-16(s0)
+jal zero,30
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43345
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+lw t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-8(s0)
+lw t0,-16(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-43569
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-43535
+jal zero,-22
+lw t0,-4(s0)
+addi sp,sp,-20
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,520
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-16(s0)
+sw t0,8(sp)
+lw t0,12(s0)
+sw t0,12(sp)
+lw t0,16(s0)
+sw t0,16(sp)
+jal ra,-41345
+addi sp,sp,12
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43385
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43411
+addi t0,a0,0
+sw t0,-8(s0)
+addi t0,zero,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+lw t1,-4(s0)
+sltu t0,t0,t1
+beq t0,zero,38
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-43628
+addi t0,a0,0
+addi t1,zero,62
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lw t0,-8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+addi t0,zero,62
+sw t0,8(sp)
+jal ra,-43605
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+jal zero,12
+lw t0,-8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-43618
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,-40
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-80
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43462
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43473
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43500
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,512
+add t0,gp,t0
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+lw t0,12(s0)
+sw t0,12(sp)
+jal ra,-41475
+addi sp,sp,8
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-596
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1512(gp)
+sw t0,4(sp)
+jal ra,-78
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-45681
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46439
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,3710
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+jal ra,3593
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,3606
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-453
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1072(t0)
+lw t1,8(s0)
+lw t2,-1872(gp)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1304(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44896
+addi t0,a0,0
+lw t1,8(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,12
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44924
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-24
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-65
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,90
+addi t0,zero,2
+addi t1,zero,4
+mul t0,t0,t1
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41477
+addi t0,a0,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1072(t0)
+lw t1,8(s0)
+lw t2,-1872(gp)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+lw t2,1304(t2)
+remu t1,t1,t2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-4(s0)
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-44916
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+sw t0,4(sp)
+jal ra,-44909
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1060(t0)
+sw t0,4(sp)
+jal ra,-44900
+lw t0,-8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-44889
+lw t0,-4(s0)
+lw t1,-8(s0)
+sw t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1068(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-8(s0)
+sw t1,1068(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1064(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-44913
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,-8(s0)
+sw t1,1064(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1060(t1)
+addi t2,zero,1
+add t1,t1,t2
+sw t1,1060(t0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45014
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46949
+addi t0,a0,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-16(s0)
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+lw t1,-1876(gp)
+sltu t0,t0,t1
+beq t0,zero,31
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-21093
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-157
+lw t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-21069
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,-33
+lw t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-51327
+addi t0,a0,0
+lw t1,16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,464
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1084(t0)
+sw t0,8(sp)
+jal ra,-41834
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51366
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,12(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-30212
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,16(s0)
+sw t0,8(sp)
+jal ra,-51386
+addi t0,a0,0
+lw t1,16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,420
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1080(t0)
+sw t0,8(sp)
+jal ra,-41884
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51416
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,-100(gp)
+lw t1,12(s0)
+sw t1,0(t0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-100(gp)
+sw t0,4(sp)
+addi t0,zero,4
+sw t0,8(sp)
+jal ra,-109
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-100(gp)
+sw t0,4(sp)
+addi t0,zero,4
+sw t0,8(sp)
+jal ra,-83
+lw t0,-100(gp)
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-20
+lw t0,16(s0)
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41782
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+sw t0,-12(s0)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47159
+addi t0,a0,0
+sw t0,-4(s0)
+addi t0,zero,0
+sw t0,-16(s0)
+lw t0,-16(s0)
+lw t1,-1876(gp)
+sltu t0,t0,t1
+beq t0,zero,51
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-16(s0)
+sw t0,4(sp)
+jal ra,-21301
+addi t0,a0,0
+sw t0,-20(s0)
+lw t0,-20(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,29
+lw t0,-12(s0)
+lw t1,-16(s0)
+sw t1,0(t0)
+lw t0,-12(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-20(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-431
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45283
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-12(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-12(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-16(s0)
+sw t0,4(sp)
+jal ra,-21297
+addi t0,a0,0
+sw t0,-16(s0)
+jal zero,-53
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,16(s0)
+sw t0,4(sp)
+jal ra,-129
+lw t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,13
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,16(s0)
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-239
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-140
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,95
+lw t0,-4(s0)
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41900
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-4(s0)
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-239
+lw t0,-4(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,69
+lw t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-12(s0)
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47032
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1216(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+lw t0,20(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+beq t0,zero,11
+lw t0,16(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-2305
+jal zero,8
+lw t0,20(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sw t1,0(t0)
+lw t0,12(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+lw t0,0(t0)
+sw t0,4(sp)
+lw t0,16(s0)
+lw t1,-12(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,8(sp)
+jal ra,-4096
+lw t0,-8(s0)
+addi t1,zero,2
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-4(s0)
+jal zero,-71
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,20
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1216(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,25
+addi t0,zero,0
+sw t0,-8(s0)
+lw t0,8(s0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lw t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-8(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47467
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,-15
+lw t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1084(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-128(gp)
+sw t0,4(sp)
+jal ra,-29276
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-44726
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,376
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1084(t0)
+sw t0,8(sp)
+jal ra,-42249
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51781
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1304(t0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-41916
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1072(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1068(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1064(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1060(t0)
+addi t0,zero,0
+sw t0,-12(s0)
+addi t0,zero,0
+sw t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1296(t0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-558
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-12(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47578
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+lw t0,-8(s0)
+sw t0,-16(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47590
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,-31
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1088(t0)
+sw t0,4(sp)
+jal ra,-435
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-68(gp)
+sw t0,4(sp)
+jal ra,-441
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1872(gp)
+sw t0,4(sp)
+jal ra,-447
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+jal ra,-32502
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-454
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1328(t0)
+sw t0,4(sp)
+jal ra,-462
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1520(gp)
+sw t0,4(sp)
+jal ra,-468
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1524(gp)
+sw t0,4(sp)
+jal ra,-474
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1532(gp)
+sw t0,4(sp)
+jal ra,-480
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1536(gp)
+sw t0,4(sp)
+jal ra,-486
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-12(s0)
+sw t0,4(sp)
+jal ra,-492
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1060(t0)
+sw t0,4(sp)
+jal ra,-500
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-239
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-510
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-1512(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44400
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-520
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1512(gp)
+sw t0,4(sp)
+lw t0,-1512(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44412
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-626
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1068(t0)
+sw t0,-20(s0)
+lw t0,-20(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-20(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45746
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-1872(gp)
+sw t0,8(sp)
+jal ra,-647
+lw t0,-20(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45717
+addi t0,a0,0
+sw t0,-20(s0)
+jal zero,-23
+lw t0,-16(s0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,262
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47402
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-310
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-581
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47397
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-591
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47730
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-601
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47721
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-848(gp)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-709
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47621
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-625
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47612
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-635
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47603
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-645
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47594
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-655
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47585
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-665
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47576
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-675
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47567
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-685
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47558
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-695
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47549
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-705
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47350
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-715
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47341
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-725
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47332
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-735
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47323
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-745
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47257
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-755
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47248
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-765
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47239
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-775
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47572
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44669
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-789
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47586
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47592
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44689
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-903
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-972
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-777
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47976
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,-265
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1332(t0)
+sw t0,4(sp)
+jal ra,-836
+addi t0,zero,0
+sw t0,-24(s0)
+lw t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1356(t1)
+sltu t0,t0,t1
+beq t0,zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1340(t0)
+lw t1,-24(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-597
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-868
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47396
+addi t0,a0,0
+sw t0,-8(s0)
+jal zero,-21
+lw t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-24(s0)
+jal zero,-41
+lui t0,0xFFFFD
+addi t0,t0,284
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1060(t0)
+sw t0,12(sp)
+jal ra,-32947
+addi t0,a0,0
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1084(t0)
+sw t0,20(sp)
+jal ra,-42800
+addi sp,sp,20
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1084(t0)
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t1,8(s0)
+sw t1,1080(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1080(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-35194
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-45328
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,244
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1080(t0)
+sw t0,8(sp)
+jal ra,-42851
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52383
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-944
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1088(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+lui t0,0xFFFFD
+addi t0,t0,208
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1080(t0)
+sw t0,8(sp)
+jal ra,-42883
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52415
+jal zero,62
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-977
+addi t0,a0,0
+lw t1,-68(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+lui t0,0xFFFFD
+addi t0,t0,156
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1080(t0)
+sw t0,8(sp)
+jal ra,-42914
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52446
+jal zero,31
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1008
+addi t0,a0,0
+lw t1,-1872(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,108
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1080(t0)
+sw t0,8(sp)
+jal ra,-42945
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1184(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52477
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1038
+addi t0,a0,0
+sw t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1048
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1328(t0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1056
+addi t0,a0,0
+sw t0,-1520(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1062
+addi t0,a0,0
+sw t0,-1524(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1068
+addi t0,a0,0
+sw t0,-1532(gp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1074
+addi t0,a0,0
+sw t0,-1536(gp)
+jal ra,-49088
+addi t0,zero,0
+sw t0,-48(s0)
+lw t0,-48(s0)
+lw t1,-848(gp)
+sltu t0,t0,t1
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1720(t0)
+lw t1,-48(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1720(t0)
+lw t1,-48(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sw t1,0(t0)
+lw t0,-48(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-48(s0)
+jal zero,-30
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1114
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1120
+addi t0,a0,0
+sw t0,-16(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1126
+addi t0,a0,0
+sw t0,-20(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1132
+addi t0,a0,0
+sw t0,-24(s0)
+lw t0,-24(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45062
+addi t0,a0,0
+sw t0,-1512(gp)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-1512(gp)
+sw t0,4(sp)
+lw t0,-24(s0)
+sw t0,8(sp)
+jal ra,-1219
+lw t0,-16(s0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42900
+addi t0,a0,0
+sw t0,-28(s0)
+lw t0,-16(s0)
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42728
+addi t0,a0,0
+sw t0,-32(s0)
+addi t0,zero,0
+sw t0,-48(s0)
+lw t0,-48(s0)
+lw t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,63
+jal ra,-4054
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+lui t0,0xFFFFD
+addi t0,t0,44
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1080(t0)
+sw t0,8(sp)
+lw t0,-1888(gp)
+lw t1,-1852(gp)
+divu t0,t0,t1
+sw t0,12(sp)
+jal ra,-43113
+addi sp,sp,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1160(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-52645
+lw t0,-28(s0)
+lw t1,-48(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3990
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,0(t0)
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-28(s0)
+lw t1,-48(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+lw t0,-1872(gp)
+sw t0,8(sp)
+jal ra,-1298
+lw t0,-48(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-48(s0)
+jal zero,-65
+lw t0,-12(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42986
+addi t0,a0,0
+sw t0,-36(s0)
+lw t0,-36(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1216(t1)
+sw t1,0(t0)
+addi t0,zero,1
+sw t0,-48(s0)
+lw t0,-48(s0)
+lw t1,-12(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,300
+jal ra,-6488
+addi t0,a0,0
+sw t0,-40(s0)
+lw t0,-40(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1216(t0)
+sw t0,4(sp)
+addi t0,zero,0
+sw t0,8(sp)
+jal ra,-6318
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1272
+addi t0,a0,0
+sw t0,-44(s0)
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-36(s0)
+lw t1,-44(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,4(sp)
+jal ra,-47376
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1292
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47369
+lw t0,-44(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-848(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1308(t1)
+add t0,t0,t1
+addi t1,zero,4
+mul t0,t0,t1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-43059
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47016
+lw t0,-40(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7259
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1327
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47693
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-40(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48471
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-848(gp)
+addi t1,zero,4
+mul t0,t0,t1
+sw t0,8(sp)
+jal ra,-1415
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1351
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47598
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1361
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47591
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1371
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47584
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1381
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47577
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1391
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47570
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1401
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47563
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1411
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47556
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1421
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47549
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1431
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47542
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1441
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47365
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1451
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47358
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1461
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47351
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1471
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47344
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1481
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47286
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1491
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47279
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1501
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47272
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1508
+addi t0,a0,0
+sw t0,-24(s0)
+lw t0,-40(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-24(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-45441
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-47577
+lw t0,-4(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-40(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48338
+addi t0,a0,0
+sw t0,4(sp)
+lw t0,-24(s0)
+sw t0,8(sp)
+jal ra,-1603
+lw t0,-4(s0)
+addi sp,sp,-16
+sw t0,0(sp)
+lw t0,-40(s0)
+sw t0,4(sp)
+lw t0,-28(s0)
+sw t0,8(sp)
+lw t0,-32(s0)
+sw t0,12(sp)
+jal ra,-1411
+lw t0,-36(s0)
+lw t1,-48(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t1,-40(s0)
+sw t1,0(t0)
+lw t0,-48(s0)
+addi t1,zero,1
+add t0,t0,t1
+sw t0,-48(s0)
+jal zero,-304
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1558
+addi t0,a0,0
+sw t0,-48(s0)
+lw t0,-48(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,23
+lw t0,-36(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1571
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7394
+lw t0,-48(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sw t0,-48(s0)
+jal zero,-25
+lui t0,0xFFFFD
+addi t0,t0,-44
+add t0,gp,t0
+addi sp,sp,-24
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-12(s0)
+sw t0,8(sp)
+lw t0,-16(s0)
+sw t0,12(sp)
+lw t0,-8(s0)
+sw t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1080(t0)
+sw t0,20(sp)
+jal ra,-43524
+addi sp,sp,20
+lw t0,-36(s0)
+lw t1,-20(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1972(t0)
+sw t0,4(sp)
+jal ra,-47778
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48397
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-47654
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48786
+addi t0,a0,0
+lw t1,-924(gp)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-1580(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-9298
+addi t0,a0,0
+beq t0,zero,6
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10079
+jal zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-28145
+jal zero,76
+lw t0,-4(s0)
+lw t1,-1568(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-29512
+jal zero,65
+lw t0,-4(s0)
+lw t1,-1572(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-29140
+jal zero,54
+lw t0,-4(s0)
+lw t1,-1576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-28744
+jal zero,43
+lw t0,-4(s0)
+lw t1,-1564(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-30005
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1208(t0)
+addi a0,t0,0
+jal zero,34
+jal zero,27
+lui t0,0xFFFFD
+addi t0,t0,-76
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-43660
+addi sp,sp,8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1148(t0)
+sw t0,4(sp)
+jal ra,-47859
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1208(t0)
+addi a0,t0,0
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1212(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1972(t0)
+sw t0,4(sp)
+jal ra,-47924
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48524
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-47783
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48685
+addi t0,a0,0
+sw t0,-4(s0)
+jal ra,-4684
+addi t0,a0,0
+beq t0,zero,46
+lw t0,8(s0)
+addi sp,sp,-12
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-4589
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-5679
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-22303
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-10610
+addi t0,a0,0
+beq t0,zero,19
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48509
+addi t0,a0,0
+lw t1,-1868(gp)
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-47774
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-4321
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1212(t0)
+addi a0,t0,0
+jal zero,29
+jal zero,27
+lui t0,0xFFFFD
+addi t0,t0,-124
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-4(s0)
+sw t0,8(sp)
+jal ra,-43778
+addi sp,sp,8
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1160(t0)
+sw t0,4(sp)
+jal ra,-47977
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1208(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1972(t0)
+sw t0,4(sp)
+jal ra,-48036
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1912(t0)
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,-160
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-43826
+addi sp,sp,4
+jal ra,-17698
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1204(t0)
+sw t0,4(sp)
+jal ra,-48026
+jal zero,20
+lui t0,0xFFFFD
+addi t0,t0,-184
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-43847
+addi sp,sp,4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1156(t0)
+sw t0,4(sp)
+jal ra,-48046
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1208(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1972(t0)
+sw t0,4(sp)
+jal ra,-48104
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48685
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sw t0,4(sp)
+jal ra,-47946
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1212(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48901
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1960(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-386
+addi t0,a0,0
+addi a0,t0,0
+jal zero,92
+jal zero,90
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1968(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-256
+addi t0,a0,0
+addi a0,t0,0
+jal zero,76
+jal zero,74
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1952(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-159
+addi t0,a0,0
+addi a0,t0,0
+jal zero,60
+jal zero,58
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1956(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-107
+addi t0,a0,0
+addi a0,t0,0
+jal zero,44
+jal zero,42
+lui t0,0xFFFFD
+addi t0,t0,-228
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48885
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-43995
+addi sp,sp,8
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48972
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-17494
+jal ra,-44888
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1136(t0)
+sw t0,4(sp)
+jal ra,-48205
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1208(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1888(t0)
+sw t0,-4(s0)
+addi t0,zero,1
+beq t0,zero,101
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-28072
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48982
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1216(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7775
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48997
+addi t0,a0,0
+sw t0,8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,-4(s0)
+jal zero,66
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7645
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-177
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1208(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7788
+jal zero,5
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7833
+jal ra,-7590
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49061
+addi t0,a0,0
+addi a0,t0,0
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1888(t0)
+sw t0,-4(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1084(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+jal ra,-34280
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1076(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1926
+jal zero,-101
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+addi t0,zero,1
+beq t0,zero,53
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1888(t0)
+sw t0,4(sp)
+jal ra,-53637
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7736
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-268
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1208(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7879
+jal zero,5
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7924
+jal ra,-7681
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lw t0,-4(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49152
+addi t0,a0,0
+addi a0,t0,0
+jal zero,3
+jal zero,-53
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1888(t0)
+sw t0,-4(s0)
+lw t0,-4(s0)
+lw t1,-32(gp)
+addi t2,zero,100
+divu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+lw t0,-4(s0)
+lw t1,12(s0)
+mul t0,t0,t1
+addi t1,zero,100
+divu t0,t0,t1
+sw t0,-4(s0)
+jal zero,24
+lw t0,-4(s0)
+lw t1,-32(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+lw t0,-4(s0)
+addi t1,zero,10
+divu t0,t0,t1
+lw t1,12(s0)
+addi t2,zero,10
+divu t1,t1,t2
+mul t0,t0,t1
+sw t0,-4(s0)
+jal zero,7
+lw t0,-4(s0)
+addi t1,zero,100
+divu t0,t0,t1
+lw t1,12(s0)
+mul t0,t0,t1
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,6
+addi t0,zero,1
+sw t0,12(s0)
+lw t0,-4(s0)
+sw t0,-8(s0)
+jal zero,7
+addi t0,zero,0
+sw t0,12(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1888(t0)
+sw t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,114
+lw t0,12(s0)
+beq t0,zero,10
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-28313
+addi t0,a0,0
+sw t0,-12(s0)
+jal zero,9
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+sw t0,4(sp)
+jal ra,-53770
+addi t0,a0,0
+sw t0,-12(s0)
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49232
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1216(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8025
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49247
+addi t0,a0,0
+sw t0,8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,-8(s0)
+jal zero,68
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-7895
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-427
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1208(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8038
+jal zero,5
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8083
+jal ra,-7840
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lw t0,-12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49311
+addi t0,a0,0
+addi a0,t0,0
+jal zero,29
+lw t0,12(s0)
+beq t0,zero,17
+lw t0,-4(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1888(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+addi t0,zero,0
+sw t0,12(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1888(t0)
+lw t1,-4(s0)
+sub t0,t0,t1
+sw t0,-8(s0)
+jal zero,9
+lw t0,-4(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+sw t0,12(s0)
+lw t0,-4(s0)
+sw t0,-8(s0)
+jal zero,-114
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1888(t0)
+sw t0,-4(s0)
+addi t0,zero,1
+beq t0,zero,130
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-4(s0)
+sw t0,4(sp)
+jal ra,-28443
+addi t0,a0,0
+sw t0,-8(s0)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49353
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1216(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8146
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49368
+addi t0,a0,0
+sw t0,8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1884(t0)
+sw t0,-4(s0)
+jal zero,95
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49436
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1968(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+lui t0,0xFFFFD
+addi t0,t0,-228
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49362
+addi t0,a0,0
+sw t0,8(sp)
+jal ra,-44472
+addi sp,sp,8
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49465
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49453
+addi t0,a0,0
+sw t0,4(sp)
+jal ra,-17975
+jal ra,-45369
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1136(t0)
+addi a0,t0,0
+jal zero,48
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8065
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-597
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1208(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8208
+jal zero,5
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-8253
+jal ra,-8010
+addi t0,a0,0
+sw t0,8(s0)
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lw t0,-8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-49481
+addi t0,a0,0
+addi a0,t0,0
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1888(t0)
+sw t0,-4(s0)
+jal zero,-130
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3850
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-160
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-178
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,-1524(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1080(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFD
+addi t0,t0,-264
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-44616
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1196(t0)
+addi a0,t0,0
+jal zero,519
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1124(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,980(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1000(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+lui t0,0xFFFFD
+addi t0,t0,-300
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-44649
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1196(t0)
+addi a0,t0,0
+jal zero,486
+jal zero,82
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1104(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1920(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1916(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1128(t0)
+sw t0,8(s0)
+jal zero,61
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1100(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-51347
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1920(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1912(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1128(t0)
+sw t0,8(s0)
+jal zero,39
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1096(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-28327
+addi t0,zero,1
+sw t0,-1604(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1128(t0)
+sw t0,8(s0)
+jal zero,23
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1092(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lw t0,-1812(gp)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1904(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1128(t0)
+sw t0,8(s0)
+jal ra,-50955
+jal ra,-50619
+jal ra,-48103
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,435
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-46494
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-51657
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1080(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1080(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1957
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1300(t0)
+jal zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1216(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-7501
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1300(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-3276
+lw t0,-1812(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-24786
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sw t1,1924(t0)
+lui t0,0xFFFFD
+addi t0,t0,-380
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-20(gp)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1108(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,12(sp)
+lw t0,-72(gp)
+sw t0,16(sp)
+lw t0,-1512(gp)
+sw t0,20(sp)
+lw t0,-1888(gp)
+lw t1,-1852(gp)
+divu t0,t0,t1
+sw t0,24(sp)
+jal ra,-44835
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1484(t0)
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-10533
+lui t0,0xFFFFD
+addi t0,t0,-408
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1476(t0)
+sw t0,4(sp)
+jal ra,-44856
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1472(t0)
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-424
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44867
+jal zero,7
+lui t0,0xFFFFD
+addi t0,t0,-444
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44874
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1920(t0)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1912(t0)
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-460
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44888
+jal zero,7
+lui t0,0xFFFFD
+addi t0,t0,-476
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-44895
+lui t0,0xFFFFD
+addi t0,t0,-564
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-44905
+addi sp,sp,4
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1128(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-892
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,73
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1124(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-790
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,56
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1120(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-407
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,39
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1116(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-402
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,22
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1112(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1300(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+addi t0,zero,0
+sw t0,4(sp)
+jal ra,-776
+addi t0,a0,0
+sw t0,-4(s0)
+jal zero,3
+addi t0,zero,0
+sw t0,-4(s0)
+lui t0,0xFFFFD
+addi t0,t0,-652
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-45005
+addi sp,sp,4
+lui t0,0xFFFFD
+addi t0,t0,-724
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-20(gp)
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1108(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+sw t0,12(sp)
+lw t0,-72(gp)
+sw t0,16(sp)
+lw t0,-1512(gp)
+sw t0,20(sp)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1132(t0)
+sw t0,4(sp)
+jal ra,-47319
+addi t0,a0,0
+sw t0,24(sp)
+jal ra,-45041
+addi sp,sp,24
+lw t0,-1816(gp)
+beq t0,zero,2
+jal ra,-24865
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1904(t0)
+beq t0,zero,46
+lui t0,0xFFFFD
+addi t0,t0,-824
+add t0,gp,t0
+addi sp,sp,-28
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-35213
+addi t0,a0,0
+sw t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1752(t0)
+sw t0,12(sp)
+jal ra,-35220
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1752(t0)
+sw t0,4(sp)
+jal ra,-46197
+addi t0,a0,0
+sw t0,16(sp)
+jal ra,-35231
+addi t0,a0,0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1752(t0)
+sw t0,4(sp)
+jal ra,-46180
+addi t0,a0,0
+sw t0,20(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1756(t0)
+sw t0,24(sp)
+jal ra,-45092
+addi sp,sp,24
+jal zero,2
+jal ra,-13274
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1924(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1904(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1084(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1080(t0)
+addi t0,zero,0
+sw t0,-1812(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1912(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1916(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sw t1,1920(t0)
+lui t0,0xFFFFD
+addi t0,t0,-912
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-45135
+addi sp,sp,4
+lw t0,-4(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1016(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1012(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-37
+addi t0,a0,0
+lw t1,8(s0)
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1012(t0)
+lw t1,8(s0)
+addi t2,zero,4
+mul t1,t1,t2
+add t0,t0,t1
+lw t0,0(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-42
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1008(t0)
+jal ra,-79
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1016(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sw t1,1016(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1012(t1)
+addi t2,zero,1
+addi t3,zero,4
+mul t2,t2,t3
+add t1,t1,t2
+sw t1,1012(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1012(t0)
+lw t1,8(s0)
+sw t1,0(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1200(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1196(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,18
+jal zero,16
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1192(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-984
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,8(s0)
+sw t0,8(sp)
+jal ra,-45341
+addi sp,sp,8
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+jal ra,-206
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1200(t0)
+addi a0,t0,0
+jal zero,690
+jal zero,688
+lui t0,0xFFFFD
+addi t0,t0,-1072
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-45375
+addi sp,sp,4
+lui t0,0xFFFFD
+addi t0,t0,-1116
+add t0,gp,t0
+addi sp,sp,-12
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-8(gp)
+sw t0,8(sp)
+jal ra,-45388
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,-1180
+add t0,gp,t0
+addi sp,sp,-16
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+lw t0,-20(gp)
+sw t0,8(sp)
+lw t0,-24(gp)
+sw t0,12(sp)
+jal ra,-45403
+addi sp,sp,12
+jal ra,-12532
+jal ra,-46287
+lui t0,0xFFFFD
+addi t0,t0,-1072
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-45416
+addi sp,sp,4
+jal ra,-54738
+jal ra,-54016
+jal ra,-53993
+jal ra,-51796
+jal ra,-52207
+jal ra,-276
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,610
+jal ra,-219
+jal ra,630
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1184
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47265
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-37779
+jal zero,577
+jal ra,-297
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1196(t0)
+addi a0,t0,0
+jal zero,599
+jal zero,564
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1188
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47292
+addi t0,a0,0
+beq t0,zero,7
+jal ra,-260
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32494
+jal zero,546
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1192
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47310
+addi t0,a0,0
+beq t0,zero,6
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19626
+jal zero,529
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1196
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47327
+addi t0,a0,0
+beq t0,zero,6
+addi t0,zero,1
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-19643
+jal zero,512
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1200
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47344
+addi t0,a0,0
+beq t0,zero,7
+jal ra,-312
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-32333
+jal zero,494
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1212
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47362
+addi t0,a0,0
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-334
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1084(t0)
+jal ra,-401
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1196(t0)
+addi a0,t0,0
+jal zero,495
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-355
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47314
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1076(t0)
+jal zero,447
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1224
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47409
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-381
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1080(t0)
+jal zero,425
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1232
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47431
+addi t0,a0,0
+beq t0,zero,5
+jal ra,-399
+addi t0,a0,0
+sw t0,-1812(gp)
+jal zero,409
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1240
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47447
+addi t0,a0,0
+beq t0,zero,69
+jal ra,-415
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47374
+addi t0,a0,0
+sw t0,-1760(gp)
+jal ra,-484
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1196(t0)
+addi a0,t0,0
+jal zero,412
+jal ra,-434
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-47393
+addi t0,a0,0
+sw t0,-1764(gp)
+lw t0,-1760(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48385
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1196(t0)
+addi a0,t0,0
+jal zero,390
+jal zero,26
+lw t0,-1764(gp)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-48401
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1196(t0)
+addi a0,t0,0
+jal zero,374
+jal zero,10
+lw t0,-1760(gp)
+lw t1,-1764(gp)
+sltu t0,t1,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1196(t0)
+addi a0,t0,0
+jal zero,364
+jal zero,329
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1256
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47527
+addi t0,a0,0
+beq t0,zero,20
+jal ra,-495
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-26139
+addi t0,a0,0
+sw t0,-1756(gp)
+lw t0,-1756(gp)
+lw t1,-32(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1196(t0)
+addi a0,t0,0
+jal zero,333
+jal zero,298
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1268
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47558
+addi t0,a0,0
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-530
+addi t0,a0,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-9133
+lw t0,0(sp)
+addi sp,sp,4
+addi t1,a0,0
+sw t1,1360(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1360(t0)
+lw t1,-32(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1196(t0)
+addi a0,t0,0
+jal zero,294
+jal zero,259
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1280
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47597
+addi t0,a0,0
+beq t0,zero,4
+lw t0,-1708(gp)
+sw t0,-1752(gp)
+jal zero,244
+lw t0,8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,233
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1284
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47618
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1128(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1213
+addi t0,a0,0
+addi a0,t0,0
+jal zero,251
+jal zero,210
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1288
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47640
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1104(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1235
+addi t0,a0,0
+addi a0,t0,0
+jal zero,229
+jal zero,188
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1292
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47662
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1100(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1257
+addi t0,a0,0
+addi a0,t0,0
+jal zero,207
+jal zero,166
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1296
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47684
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1124(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1279
+addi t0,a0,0
+addi a0,t0,0
+jal zero,185
+jal zero,144
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1304
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47706
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1120(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1301
+addi t0,a0,0
+addi a0,t0,0
+jal zero,163
+jal zero,122
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1312
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47728
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1116(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1323
+addi t0,a0,0
+addi a0,t0,0
+jal zero,141
+jal zero,100
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1316
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47750
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1096(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1345
+addi t0,a0,0
+addi a0,t0,0
+jal zero,119
+jal zero,78
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1320
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47772
+addi t0,a0,0
+beq t0,zero,13
+addi t0,zero,1
+sw t0,-1672(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1096(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1369
+addi t0,a0,0
+addi a0,t0,0
+jal zero,95
+jal zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1324
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47796
+addi t0,a0,0
+beq t0,zero,15
+addi t0,zero,1
+sw t0,-1672(gp)
+addi t0,zero,1
+sw t0,-1676(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1096(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1395
+addi t0,a0,0
+addi a0,t0,0
+jal zero,69
+jal zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1332
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47822
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1092(t0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-1417
+addi t0,a0,0
+addi a0,t0,0
+jal zero,47
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1196(t0)
+addi a0,t0,0
+jal zero,41
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1192(t0)
+addi a0,t0,0
+jal zero,35
+jal ra,-873
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,-1420
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-46034
+addi sp,sp,4
+jal zero,-613
+lui t0,0xFFFFD
+addi t0,t0,-912
+add t0,gp,t0
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1004(t0)
+sw t0,4(sp)
+jal ra,-46046
+addi sp,sp,4
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1204(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1428
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47899
+addi t0,a0,0
+beq t0,zero,8
+addi t0,zero,0
+sw t0,-16(gp)
+jal ra,-48989
+jal ra,-52909
+jal ra,-54379
+jal ra,-872
+jal zero,92
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1436
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47918
+addi t0,a0,0
+beq t0,zero,8
+addi t0,zero,1
+sw t0,-16(gp)
+jal ra,-49008
+jal ra,-52928
+jal ra,-54398
+jal ra,-891
+jal zero,73
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1440
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47937
+addi t0,a0,0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1488(t1)
+sw t1,1484(t0)
+jal ra,-911
+jal zero,53
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1448
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47957
+addi t0,a0,0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1488(t1)
+sw t1,1484(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1492(t1)
+sw t1,1472(t0)
+jal ra,-937
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1008(t0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1452
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-47983
+addi t0,a0,0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1492(t1)
+sw t1,1472(t0)
+jal ra,-957
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1492(t1)
+sw t1,1484(t0)
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,4
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+lw t0,8(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-912
+addi t0,a0,0
+beq t0,zero,5
+lw t0,12(s0)
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-868
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1192(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1196(t0)
+addi a0,t0,0
+jal zero,20
+jal zero,18
+lw t0,8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+lw t1,1200(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lw t0,1204(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+lw t0,8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+addi sp,sp,-4
+sw ra,0(sp)
+addi sp,sp,-4
+sw s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-4
+lw t0,8(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lw t0,12(s0)
+sw t0,4(sp)
+jal ra,-49328
+jal ra,-55710
+jal ra,-49303
+jal ra,-49156
+jal ra,-49426
+addi t0,zero,0
+addi sp,sp,-4
+sw t0,0(sp)
+jal ra,-902
+addi t0,a0,0
+sw t0,-4(s0)
+lw t0,-4(s0)
+addi sp,sp,-8
+sw t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1492
+add t0,gp,t0
+sw t0,4(sp)
+jal ra,-81
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+lw s0,0(sp)
+addi sp,sp,4
+lw ra,0(sp)
+addi sp,sp,12
+jalr zero,0(ra)
+.4byte 0x28205B20
+.4byte 0x206D2D20
+.4byte 0x642D207C
+.4byte 0x2D207C20
+.4byte 0x207C2072
+.4byte 0x2920792D
+.4byte 0x342D3020
+.4byte 0x20363930
+.4byte 0x202E2E2E
+.4byte 0x5D
+.4byte 0x726E2D
+.4byte 0x67726E2D
+.4byte 0x63
+.4byte 0x63672D
+.4byte 0x34366D2D
+.4byte 0x0
+.4byte 0x32336D2D
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0x2A2A2A2A
+.4byte 0xA
+.4byte 0x61666D2D
+.4byte 0x7473
+.4byte 0x334C2D
+.4byte 0x324C2D
+.4byte 0x314C2D
+.4byte 0x626F6D2D
+.4byte 0x0
+.4byte 0x6E696D2D
+.4byte 0x0
+.4byte 0x792D
+.4byte 0x722D
+.4byte 0x642D
+.4byte 0x6D2D
+.4byte 0x6378652D
+.4byte 0x6973756C
+.4byte 0x6576
+.4byte 0x6863732D
+.4byte 0x6C756465
+.4byte 0x7265
+.4byte 0x7065722D
+.4byte 0x6563616C
+.4byte 0x746E656D
+.4byte 0x0
+.4byte 0x6577732D
+.4byte 0x7065
+.4byte 0x6172742D
+.4byte 0x6563
+.4byte 0x7365722D
+.4byte 0x65726F74
+.4byte 0x0
+.4byte 0x6568632D
+.4byte 0x6F706B63
+.4byte 0x746E69
+.4byte 0x6C2D
+.4byte 0x532D
+.4byte 0x732D
+.4byte 0x6F2D
+.4byte 0x632D
+.4byte 0x203A7325
+.4byte 0x2D756C25
+.4byte 0x20746962
+.4byte 0x69736E75
+.4byte 0x64656E67
+.4byte 0x746E6920
+.4byte 0x72656765
+.4byte 0x6E612073
+.4byte 0x6C252064
+.4byte 0x69622D75
+.4byte 0x6F702074
+.4byte 0x65746E69
+.4byte 0x68207372
+.4byte 0x6574736F
+.4byte 0x6E6F2064
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x73696874
+.4byte 0x20736920
+.4byte 0x20656874
+.4byte 0x666C6573
+.4byte 0x73206569
+.4byte 0x65747379
+.4byte 0x7266206D
+.4byte 0x25206D6F
+.4byte 0x69772073
+.4byte 0xA6874
+.4byte 0x203A7325
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0x3D3D3D3D
+.4byte 0xA
+.4byte 0x7B207325
+.4byte 0x20632D20
+.4byte 0x6F73207B
+.4byte 0x65637275
+.4byte 0x7C207D20
+.4byte 0x206F2D20
+.4byte 0x616E6962
+.4byte 0x7C207972
+.4byte 0x2D202820
+.4byte 0x207C2073
+.4byte 0x2920532D
+.4byte 0x73736120
+.4byte 0x6C626D65
+.4byte 0x207C2079
+.4byte 0x62206C2D
+.4byte 0x72616E69
+.4byte 0x257D2079
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0x23232323
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x6D6D7573
+.4byte 0x3A797261
+.4byte 0x756C2520
+.4byte 0x65786520
+.4byte 0x65747563
+.4byte 0x6E692064
+.4byte 0x75727473
+.4byte 0x6F697463
+.4byte 0x6920736E
+.4byte 0x6F74206E
+.4byte 0x2C6C6174
+.4byte 0x756C2520
+.4byte 0x756C2528
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x75662029
+.4byte 0x20646573
+.4byte 0x6F746E69
+.4byte 0x756C2520
+.4byte 0x70757320
+.4byte 0x6E697265
+.4byte 0x75727473
+.4byte 0x6F697463
+.4byte 0xA736E
+.4byte 0x203A7325
+.4byte 0x2D756C25
+.4byte 0x20746962
+.4byte 0x74207325
+.4byte 0x696D7265
+.4byte 0x6974616E
+.4byte 0x2520676E
+.4byte 0x622D756C
+.4byte 0x52207469
+.4byte 0x2D435349
+.4byte 0x69622055
+.4byte 0x7972616E
+.4byte 0x20732520
+.4byte 0x68746977
+.4byte 0x69786520
+.4byte 0x6F632074
+.4byte 0x25206564
+.4byte 0xA646C
+.4byte 0x3A73250A
+.4byte 0x3C3C3C20
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0x3C3C3C3C
+.4byte 0xA3C
+.4byte 0x3A73250A
+.4byte 0x3E3E3E20
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0x3E3E3E3E
+.4byte 0xA0A3E
+.4byte 0x6E61202C
+.4byte 0x65642064
+.4byte 0x67677562
+.4byte 0x7265
+.4byte 0x6E61202C
+.4byte 0x65722064
+.4byte 0x79616C70
+.4byte 0x0
+.4byte 0x20746F6E
+.4byte 0x73756572
+.4byte 0x20676E69
+.4byte 0x6F6D656D
+.4byte 0x7972
+.4byte 0x73756572
+.4byte 0x20676E69
+.4byte 0x6F6D656D
+.4byte 0x7972
+.4byte 0x6367202C
+.4byte 0x20676E69
+.4byte 0x72657665
+.4byte 0x6C252079
+.4byte 0x616D2075
+.4byte 0x636F6C6C
+.4byte 0x202C73
+.4byte 0x203A7325
+.4byte 0x2D756C25
+.4byte 0x20746962
+.4byte 0x65207325
+.4byte 0x75636578
+.4byte 0x676E6974
+.4byte 0x756C2520
+.4byte 0x7469622D
+.4byte 0x53495220
+.4byte 0x20552D43
+.4byte 0x616E6962
+.4byte 0x25207972
+.4byte 0x69772073
+.4byte 0x25206874
+.4byte 0x424D756C
+.4byte 0x79687020
+.4byte 0x61636973
+.4byte 0x656D206C
+.4byte 0x79726F6D
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x73707968
+.4byte 0x20726574
+.4byte 0x796C6E6F
+.4byte 0x6E757220
+.4byte 0x6E6F2073
+.4byte 0x70696D20
+.4byte 0x72657473
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x68746F6E
+.4byte 0x20676E69
+.4byte 0x72206F74
+.4byte 0x202C6E75
+.4byte 0x75626564
+.4byte 0x6F202C67
+.4byte 0x6F682072
+.4byte 0xA7473
+.4byte 0x203A7325
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0x74207325
+.4byte 0x77657268
+.4byte 0x636E7520
+.4byte 0x68677561
+.4byte 0x78652074
+.4byte 0x74706563
+.4byte 0x3A6E6F69
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x69766964
+.4byte 0x6E6F6973
+.4byte 0x20796220
+.4byte 0x6F72657A
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x69766964
+.4byte 0x6E6F6973
+.4byte 0x20796220
+.4byte 0x6F72657A
+.4byte 0x6572202C
+.4byte 0x79616C70
+.4byte 0x2E676E69
+.4byte 0xA2E2E
+.4byte 0x203A7325
+.4byte 0x65676170
+.4byte 0x75616620
+.4byte 0x6120746C
+.4byte 0x78302074
+.4byte 0x20586C25
+.4byte 0x2074756F
+.4byte 0x7020666F
+.4byte 0x69737968
+.4byte 0x206C6163
+.4byte 0x6F6D656D
+.4byte 0xA7972
+.4byte 0x203A7325
+.4byte 0x6E6B6E75
+.4byte 0x206E776F
+.4byte 0x74737973
+.4byte 0x63206D65
+.4byte 0x206C6C61
+.4byte 0xA756C25
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x74736572
+.4byte 0x6465726F
+.4byte 0x756C2520
+.4byte 0x6E6F6320
+.4byte 0x74786574
+.4byte 0x69772073
+.4byte 0x25206874
+.4byte 0x7020756C
+.4byte 0x20656761
+.4byte 0x6D617266
+.4byte 0x61207365
+.4byte 0x72657466
+.4byte 0x756C2520
+.4byte 0x65786520
+.4byte 0x65747563
+.4byte 0x6E692064
+.4byte 0x75727473
+.4byte 0x6F697463
+.4byte 0x6620736E
+.4byte 0x206D6F72
+.4byte 0xA7325
+.4byte 0x203A7325
+.4byte 0x63656863
+.4byte 0x696F706B
+.4byte 0x6620746E
+.4byte 0x20656C69
+.4byte 0x64207325
+.4byte 0x2073656F
+.4byte 0x20746F6E
+.4byte 0x20746966
+.4byte 0x6F746E69
+.4byte 0x756C2520
+.4byte 0x7020424D
+.4byte 0x69737968
+.4byte 0x206C6163
+.4byte 0x6F6D656D
+.4byte 0xA7972
+.4byte 0x203A7325
+.4byte 0x63656863
+.4byte 0x696F706B
+.4byte 0x6620746E
+.4byte 0x20656C69
+.4byte 0x69207325
+.4byte 0x6F662073
+.4byte 0x20612072
+.4byte 0x66666964
+.4byte 0x6E657265
+.4byte 0x6F682074
+.4byte 0xA7473
+.4byte 0x203A7325
+.4byte 0x63656863
+.4byte 0x696F706B
+.4byte 0x6620746E
+.4byte 0x20656C69
+.4byte 0x69207325
+.4byte 0x6F662073
+.4byte 0x20612072
+.4byte 0x66666964
+.4byte 0x6E657265
+.4byte 0x61742074
+.4byte 0x74656772
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x69207325
+.4byte 0x6F6E2073
+.4byte 0x20612074
+.4byte 0x63656863
+.4byte 0x696F706B
+.4byte 0x6620746E
+.4byte 0xA656C69
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x706F2074
+.4byte 0x63206E65
+.4byte 0x6B636568
+.4byte 0x6E696F70
+.4byte 0x69662074
+.4byte 0x2520656C
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x63656863
+.4byte 0x696F706B
+.4byte 0x6465746E
+.4byte 0x756C2520
+.4byte 0x6E6F6320
+.4byte 0x74786574
+.4byte 0x69772073
+.4byte 0x25206874
+.4byte 0x7020756C
+.4byte 0x20656761
+.4byte 0x6D617266
+.4byte 0x61207365
+.4byte 0x72657466
+.4byte 0x756C2520
+.4byte 0x65786520
+.4byte 0x65747563
+.4byte 0x6E692064
+.4byte 0x75727473
+.4byte 0x6F697463
+.4byte 0x6920736E
+.4byte 0x206F746E
+.4byte 0xA7325
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72632074
+.4byte 0x65746165
+.4byte 0x65686320
+.4byte 0x6F706B63
+.4byte 0x20746E69
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x65722074
+.4byte 0x66206461
+.4byte 0x206D6F72
+.4byte 0x63656863
+.4byte 0x696F706B
+.4byte 0x6620746E
+.4byte 0x20656C69
+.4byte 0xA7325
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72772074
+.4byte 0x20657469
+.4byte 0x6F746E69
+.4byte 0x65686320
+.4byte 0x6F706B63
+.4byte 0x20746E69
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203E7325
+.4byte 0x7325
+.4byte 0x73257325
+.4byte 0x73252E
+.4byte 0x203A7325
+.4byte 0x65707573
+.4byte 0x67617072
+.4byte 0x78302065
+.4byte 0x6C343025
+.4byte 0x72702058
+.4byte 0x746F6D6F
+.4byte 0x74206465
+.4byte 0x7573206F
+.4byte 0x66726570
+.4byte 0x656D6172
+.4byte 0x25783020
+.4byte 0x586C3830
+.4byte 0x206E6920
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0xA7325
+.4byte 0x203A7325
+.4byte 0x6C6C6170
+.4byte 0x6F20636F
+.4byte 0x6F207475
+.4byte 0x68702066
+.4byte 0x63697379
+.4byte 0x6D206C61
+.4byte 0x726F6D65
+.4byte 0xA79
+.4byte 0x203A7325
+.4byte 0x65676170
+.4byte 0x25783020
+.4byte 0x586C3430
+.4byte 0x70616D20
+.4byte 0x20646570
+.4byte 0x66206F74
+.4byte 0x656D6172
+.4byte 0x25783020
+.4byte 0x586C3830
+.4byte 0x206E6920
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0xA7325
+.4byte 0x203A7325
+.4byte 0x65726170
+.4byte 0x6320746E
+.4byte 0x65746E6F
+.4byte 0x25207478
+.4byte 0x72632073
+.4byte 0x65746165
+.4byte 0x68632064
+.4byte 0x20646C69
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0xA7325
+.4byte 0x6E756F72
+.4byte 0x6F722D64
+.4byte 0x6E6962
+.4byte 0x6F697270
+.4byte 0x79746972
+.4byte 0x0
+.4byte 0x7272
+.4byte 0x78652820
+.4byte 0x6E726574
+.4byte 0x296C61
+.4byte 0x203A7325
+.4byte 0x203A6367
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424D756C
+.4byte 0x756C2528
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x6C612029
+.4byte 0x61636F6C
+.4byte 0x20646574
+.4byte 0x25206E69
+.4byte 0x7520756C
+.4byte 0x6563676E
+.4byte 0x616D2064
+.4byte 0x636F6C6C
+.4byte 0x73
+.4byte 0x203A7325
+.4byte 0x203A6367
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424D756C
+.4byte 0x756C2528
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x6C612029
+.4byte 0x61636F6C
+.4byte 0x20646574
+.4byte 0x25206E69
+.4byte 0x6720756C
+.4byte 0x20646563
+.4byte 0x6C6C616D
+.4byte 0xA73636F
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x203A6367
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424D756C
+.4byte 0x756C2528
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x6C612029
+.4byte 0x61636F6C
+.4byte 0x20646574
+.4byte 0x25206E69
+.4byte 0x6D20756C
+.4byte 0x6F6C6C61
+.4byte 0x28207363
+.4byte 0x20756C25
+.4byte 0x64656367
+.4byte 0x6C25202C
+.4byte 0x6E752075
+.4byte 0x64656367
+.4byte 0xA29
+.4byte 0x203A7325
+.4byte 0x203A6367
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424D756C
+.4byte 0x6C6F6320
+.4byte 0x7463656C
+.4byte 0x69206465
+.4byte 0x6C25206E
+.4byte 0x63672075
+.4byte 0x6E757220
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x203A6367
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424D756C
+.4byte 0x756C2528
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x65722029
+.4byte 0x64657375
+.4byte 0x206E6920
+.4byte 0x20756C25
+.4byte 0x73756572
+.4byte 0x6D206465
+.4byte 0x6F6C6C61
+.4byte 0xA7363
+.4byte 0x203A7325
+.4byte 0x203A6367
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424D756C
+.4byte 0x71657220
+.4byte 0x74736575
+.4byte 0x69206465
+.4byte 0x6C25206E
+.4byte 0x616D2075
+.4byte 0x636F6C6C
+.4byte 0x25282073
+.4byte 0x6720756C
+.4byte 0x2C646563
+.4byte 0x756C2520
+.4byte 0x75657220
+.4byte 0x29736573
+.4byte 0xA
+.4byte 0x5F636728
+.4byte 0x296B7262
+.4byte 0x203A
+.4byte 0x65726162
+.4byte 0x74656D20
+.4byte 0x6C61
+.4byte 0x646E6957
+.4byte 0x73776F
+.4byte 0x4F63616D
+.4byte 0x53
+.4byte 0x756E694C
+.4byte 0x78
+.4byte 0x666C6573
+.4byte 0x6569
+.4byte 0x7473656E
+.4byte 0x77206465
+.4byte 0x736B6C61
+.4byte 0x20203A
+.4byte 0x6E617274
+.4byte 0x74616C73
+.4byte 0x736E6F69
+.4byte 0x20203A
+.4byte 0x203A7325
+.4byte 0x3A424C54
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x61202020
+.4byte 0x73656363
+.4byte 0x2C736573
+.4byte 0x73746968
+.4byte 0x73696D2C
+.4byte 0xA736573
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6F6E7973
+.4byte 0x736D796E
+.4byte 0x2020203A
+.4byte 0x25202020
+.4byte 0x6220756C
+.4byte 0x6B636F6C
+.4byte 0x6E692073
+.4byte 0x696C6176
+.4byte 0x65746164
+.4byte 0x63612064
+.4byte 0x73736F72
+.4byte 0x64646120
+.4byte 0x73736572
+.4byte 0x61707320
+.4byte 0xA736563
+.4byte 0x0
+.4byte 0x6F632820
+.4byte 0x65726568
+.4byte 0x2079636E
+.4byte 0x61766E69
+.4byte 0x6164696C
+.4byte 0x6E6F6974
+.4byte 0x25203A73
+.4byte 0x29756C
+.4byte 0x74736E69
+.4byte 0x74637572
+.4byte 0x3A6E6F69
+.4byte 0x202020
+.4byte 0x72772820
+.4byte 0x2D657469
+.4byte 0x6B636162
+.4byte 0x25203A73
+.4byte 0x29756C
+.4byte 0x61746164
+.4byte 0x2020203A
+.4byte 0x20202020
+.4byte 0x202020
+.4byte 0x203A7325
+.4byte 0x6320314C
+.4byte 0x65686361
+.4byte 0x20203A73
+.4byte 0x61202020
+.4byte 0x73656363
+.4byte 0x2C736573
+.4byte 0x73746968
+.4byte 0x73696D2C
+.4byte 0x20736573
+.4byte 0x20732528
+.4byte 0x6C706572
+.4byte 0x6D656361
+.4byte 0x29746E65
+.4byte 0xA
+.4byte 0x726F7473
+.4byte 0x203A7365
+.4byte 0x20
+.4byte 0x64616F6C
+.4byte 0x20203A73
+.4byte 0x20
+.4byte 0x706F6F6C
+.4byte 0x20203A73
+.4byte 0x20
+.4byte 0x6C6C6163
+.4byte 0x20203A73
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x666F7270
+.4byte 0x3A656C69
+.4byte 0x746F7420
+.4byte 0x6D2C6C61
+.4byte 0x72287861
+.4byte 0x6F697461
+.4byte 0x40292525
+.4byte 0x72646461
+.4byte 0x2C737365
+.4byte 0x6D646E32
+.4byte 0x332C7861
+.4byte 0x616D6472
+.4byte 0xA78
+.4byte 0x203A7325
+.4byte 0x666F7270
+.4byte 0x3A656C69
+.4byte 0x746F7420
+.4byte 0x6D2C6C61
+.4byte 0x72287861
+.4byte 0x6F697461
+.4byte 0x40292525
+.4byte 0x72646461
+.4byte 0x28737365
+.4byte 0x656E696C
+.4byte 0x322C2923
+.4byte 0x616D646E
+.4byte 0x72332C78
+.4byte 0x78616D64
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x73797320
+.4byte 0x6C6C6163
+.4byte 0x25202C73
+.4byte 0x7020756C
+.4byte 0x20656761
+.4byte 0x6C756166
+.4byte 0x202C7374
+.4byte 0x20756C25
+.4byte 0x656D6974
+.4byte 0x6E692072
+.4byte 0x72726574
+.4byte 0x73747075
+.4byte 0xA
+.4byte 0x6E6F202C
+.4byte 0x76652065
+.4byte 0x20797265
+.4byte 0x20756C25
+.4byte 0x63657865
+.4byte 0x64657475
+.4byte 0x736E6920
+.4byte 0x63757274
+.4byte 0x6E6F6974
+.4byte 0x73
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x63786520
+.4byte 0x69747065
+.4byte 0x20736E6F
+.4byte 0x646E6168
+.4byte 0x2064656C
+.4byte 0x207962
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x6D697420
+.4byte 0x6C732065
+.4byte 0x73656369
+.4byte 0x20666F20
+.4byte 0x20756C25
+.4byte 0x63657865
+.4byte 0x64657475
+.4byte 0x736E6920
+.4byte 0x63757274
+.4byte 0x6E6F6974
+.4byte 0x6E6F2073
+.4byte 0x65766120
+.4byte 0x65676172
+.4byte 0x20746120
+.4byte 0x6F697270
+.4byte 0x79746972
+.4byte 0x756C2520
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424D756C
+.4byte 0x6C6C6120
+.4byte 0x7461636F
+.4byte 0x69206465
+.4byte 0x6C25206E
+.4byte 0x616D2075
+.4byte 0x636F6C6C
+.4byte 0x25282073
+.4byte 0x252E756C
+.4byte 0x756C322E
+.4byte 0x6F20424D
+.4byte 0x6C252072
+.4byte 0x2E252E75
+.4byte 0x25756C32
+.4byte 0x63612025
+.4byte 0x6C617574
+.4byte 0x6120796C
+.4byte 0x73656363
+.4byte 0x29646573
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x424B756C
+.4byte 0x61657020
+.4byte 0x7473206B
+.4byte 0x206B6361
+.4byte 0x657A6973
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x746E6F63
+.4byte 0x3A747865
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x73656E20
+.4byte 0x20646574
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0x74697773
+.4byte 0x73656863
+.4byte 0x6E797320
+.4byte 0x676E6963
+.4byte 0x756C2520
+.4byte 0x322E252E
+.4byte 0x7220756C
+.4byte 0x73696765
+.4byte 0x20726574
+.4byte 0x20646E61
+.4byte 0x74617473
+.4byte 0x6F772065
+.4byte 0x20736472
+.4byte 0x68636165
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x68637320
+.4byte 0x6C756465
+.4byte 0x20676E69
+.4byte 0x69636564
+.4byte 0x6E6F6973
+.4byte 0x79622073
+.4byte 0x20732520
+.4byte 0x65686373
+.4byte 0x656C7564
+.4byte 0xA72
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x6E6F6320
+.4byte 0x74786574
+.4byte 0x6F662073
+.4byte 0x64656B72
+.4byte 0x6C25202C
+.4byte 0x61702075
+.4byte 0x66206567
+.4byte 0x656D6172
+.4byte 0x6F632073
+.4byte 0x64656970
+.4byte 0x206E6F20
+.4byte 0x74697277
+.4byte 0xA65
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x70757320
+.4byte 0x61707265
+.4byte 0x20736567
+.4byte 0x6D6F7270
+.4byte 0x6465746F
+.4byte 0x6C25202C
+.4byte 0x65642075
+.4byte 0x65746F6D
+.4byte 0xA64
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x67617020
+.4byte 0x72662065
+.4byte 0x73656D61
+.4byte 0x63657220
+.4byte 0x6D69616C
+.4byte 0x202C6465
+.4byte 0x20756C25
+.4byte 0x73756572
+.4byte 0xA6465
+.4byte 0x2E756C25
+.4byte 0x6C322E25
+.4byte 0x20424D75
+.4byte 0x7070616D
+.4byte 0x6D206465
+.4byte 0x726F6D65
+.4byte 0x255B2079
+.4byte 0x252E756C
+.4byte 0x756C322E
+.4byte 0x6F202525
+.4byte 0x6C252066
+.4byte 0x20424D75
+.4byte 0x73796870
+.4byte 0x6C616369
+.4byte 0x6D656D20
+.4byte 0x5D79726F
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x20
+.4byte 0x20756C25
+.4byte 0x63657865
+.4byte 0x64657475
+.4byte 0x736E6920
+.4byte 0x63757274
+.4byte 0x6E6F6974
+.4byte 0x6E692073
+.4byte 0x746F7420
+.4byte 0x5B206C61
+.4byte 0x2E756C25
+.4byte 0x6C322E25
+.4byte 0x20252575
+.4byte 0x73706F6E
+.4byte 0xA5D
+.4byte 0x203A7325
+.4byte 0x6D6D7573
+.4byte 0x3A797261
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x63786520
+.4byte 0x69747065
+.4byte 0x20736E6F
+.4byte 0x646E6168
+.4byte 0x2064656C
+.4byte 0x25207962
+.4byte 0x6920756C
+.4byte 0x7274736E
+.4byte 0x69746375
+.4byte 0x20736E6F
+.4byte 0x68636165
+.4byte 0x6C255B20
+.4byte 0x2E252E75
+.4byte 0x25756C32
+.4byte 0x766F2025
+.4byte 0x65687265
+.4byte 0x202C6461
+.4byte 0x74636166
+.4byte 0x2520726F
+.4byte 0x252E756C
+.4byte 0x756C322E
+.4byte 0xA5D
+.4byte 0x203A7325
+.4byte 0x20202020
+.4byte 0x20202020
+.4byte 0x756C2520
+.4byte 0x65786520
+.4byte 0x65747563
+.4byte 0x6E692064
+.4byte 0x75727473
+.4byte 0x6F697463
+.4byte 0x5B20736E
+.4byte 0x2E756C25
+.4byte 0x6C322E25
+.4byte 0x20252575
+.4byte 0x72616873
+.4byte 0x66202C65
+.4byte 0x6F746361
+.4byte 0x6C252072
+.4byte 0x2E252E75
+.4byte 0x5D756C32
+.4byte 0xA
+.4byte 0x706D6574
+.4byte 0x6F742073
+.4byte 0x3A6C6174
+.4byte 0x202020
+.4byte 0x73677261
+.4byte 0x746F7420
+.4byte 0x203A6C61
+.4byte 0x202020
+.4byte 0x63617473
+.4byte 0x6573206B
+.4byte 0x6E656D67
+.4byte 0x203A74
+.4byte 0x63617473
+.4byte 0x6F74206B
+.4byte 0x3A6C6174
+.4byte 0x202020
+.4byte 0x61746164
+.4byte 0x67657320
+.4byte 0x746E656D
+.4byte 0x20203A
+.4byte 0x70616568
+.4byte 0x67657320
+.4byte 0x746E656D
+.4byte 0x20203A
+.4byte 0x203A7325
+.4byte 0x2B555043
+.4byte 0x6F6D656D
+.4byte 0x203A7972
+.4byte 0x72202020
+.4byte 0x73646165
+.4byte 0x6972772B
+.4byte 0x2C736574
+.4byte 0x64616572
+.4byte 0x72772C73
+.4byte 0x73657469
+.4byte 0x6165725B
+.4byte 0x772F7364
+.4byte 0x65746972
+.4byte 0xA5D73
+.4byte 0x67657220
+.4byte 0x65747369
+.4byte 0x20203A72
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x73257325
+.4byte 0x2C756C25
+.4byte 0x2C756C25
+.4byte 0x5B756C25
+.4byte 0x2E756C25
+.4byte 0x6C322E25
+.4byte 0xA5D75
+.4byte 0x203A7325
+.4byte 0x6C257325
+.4byte 0x75
+.4byte 0x3028302C
+.4byte 0x2530302E
+.4byte 0x2925
+.4byte 0x756C252C
+.4byte 0x756C2528
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x78304029
+.4byte 0x586C25
+.4byte 0x203A7325
+.4byte 0x61207461
+.4byte 0x65726464
+.4byte 0x30207373
+.4byte 0x38302578
+.4byte 0x7520586C
+.4byte 0x6F6E6B6E
+.4byte 0x69206E77
+.4byte 0x7274736E
+.4byte 0x69746375
+.4byte 0x30206E6F
+.4byte 0x586C2578
+.4byte 0x74697720
+.4byte 0x706F2068
+.4byte 0x65646F63
+.4byte 0x25783020
+.4byte 0x6420586C
+.4byte 0x63657465
+.4byte 0xA646574
+.4byte 0x0
+.4byte 0x3A73250A
+.4byte 0x63786520
+.4byte 0x69747065
+.4byte 0x74206E6F
+.4byte 0x67676972
+.4byte 0x64657265
+.4byte 0x20796220
+.4byte 0x74736E69
+.4byte 0x74637572
+.4byte 0x206E6F69
+.4byte 0x62206E69
+.4byte 0x72616E69
+.4byte 0x2079
+.4byte 0x206E6920
+.4byte 0x73657270
+.4byte 0x65636E65
+.4byte 0x20666F20
+.4byte 0x73697865
+.4byte 0x676E6974
+.4byte 0x63786520
+.4byte 0x69747065
+.4byte 0x203A6E6F
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0x74207325
+.4byte 0x776F7268
+.4byte 0x78652073
+.4byte 0x74706563
+.4byte 0x3A6E6F69
+.4byte 0x20
+.4byte 0x20
+.4byte 0x25783020
+.4byte 0x586C3830
+.4byte 0x0
+.4byte 0x20444920
+.4byte 0x756C25
+.4byte 0x20746120
+.4byte 0x72646461
+.4byte 0x20737365
+.4byte 0x30257830
+.4byte 0x586C38
+.4byte 0x20746120
+.4byte 0x65676170
+.4byte 0x25783020
+.4byte 0x586C3430
+.4byte 0x0
+.4byte 0x3D3D7325
+.4byte 0x28646C25
+.4byte 0x6C257830
+.4byte 0x2958
+.4byte 0x3D3D7325
+.4byte 0x6C256F30
+.4byte 0x6F
+.4byte 0x3D3D7325
+.4byte 0x6C257830
+.4byte 0x58
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x72616863
+.4byte 0x65746361
+.4byte 0x6F207372
+.4byte 0x73612066
+.4byte 0x626D6573
+.4byte 0x7720796C
+.4byte 0x20687469
+.4byte 0x20756C25
+.4byte 0x2D756C25
+.4byte 0x20746962
+.4byte 0x43534952
+.4byte 0x6920552D
+.4byte 0x7274736E
+.4byte 0x69746375
+.4byte 0x20736E6F
+.4byte 0x20646E61
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x666F2073
+.4byte 0x74616420
+.4byte 0x72772061
+.4byte 0x65747469
+.4byte 0x6E69206E
+.4byte 0x25206F74
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72632074
+.4byte 0x65746165
+.4byte 0x73736120
+.4byte 0x6C626D65
+.4byte 0x756F2079
+.4byte 0x74757074
+.4byte 0x6C696620
+.4byte 0x73252065
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x68746F6E
+.4byte 0x20676E69
+.4byte 0x64206F74
+.4byte 0x73617369
+.4byte 0x626D6573
+.4byte 0x7420656C
+.4byte 0x756F206F
+.4byte 0x74757074
+.4byte 0x6C696620
+.4byte 0x73252065
+.4byte 0xA
+.4byte 0x7962342E
+.4byte 0x206574
+.4byte 0x7962382E
+.4byte 0x206574
+.4byte 0x203A7325
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0x74697773
+.4byte 0x6E696863
+.4byte 0x75642067
+.4byte 0x676E6972
+.4byte 0x6D797320
+.4byte 0x696C6F62
+.4byte 0x78652063
+.4byte 0x74756365
+.4byte 0x206E6F69
+.4byte 0x75207369
+.4byte 0x7075736E
+.4byte 0x74726F70
+.4byte 0xA6465
+.4byte 0x203A7325
+.4byte 0x746E6F63
+.4byte 0x20747865
+.4byte 0x74697773
+.4byte 0x6E696863
+.4byte 0x75642067
+.4byte 0x676E6972
+.4byte 0x63657220
+.4byte 0x6964726F
+.4byte 0x6920676E
+.4byte 0x6E752073
+.4byte 0x70707573
+.4byte 0x6574726F
+.4byte 0xA64
+.4byte 0x3D3D6370
+.4byte 0x6C257830
+.4byte 0x58
+.4byte 0x25207325
+.4byte 0x6C252C73
+.4byte 0x64
+.4byte 0x203E2D20
+.4byte 0x3D3D6370
+.4byte 0x6C257830
+.4byte 0x58
+.4byte 0x202D7C20
+.4byte 0x3D3D6370
+.4byte 0x6C257830
+.4byte 0x58
+.4byte 0x2578305B
+.4byte 0x5D586C
+.4byte 0x203E2D20
+.4byte 0x5B6D656D
+.4byte 0x6C257830
+.4byte 0x3D3D5D58
+.4byte 0x0
+.4byte 0x5B6D656D
+.4byte 0x6C257830
+.4byte 0x3D3D5D58
+.4byte 0x646C25
+.4byte 0x5B6D656D
+.4byte 0x6C257830
+.4byte 0x3D3D5D58
+.4byte 0x6C257830
+.4byte 0x58
+.4byte 0x656D3D3D
+.4byte 0x78305B6D
+.4byte 0x5D586C25
+.4byte 0x0
+.4byte 0x6C257830
+.4byte 0x73692058
+.4byte 0x766E6920
+.4byte 0x64696C61
+.4byte 0x0
+.4byte 0x6C257830
+.4byte 0x73692058
+.4byte 0x6C6C6920
+.4byte 0x6765732D
+.4byte 0x746E656D
+.4byte 0x28206465
+.4byte 0x6D676573
+.4byte 0x61746E65
+.4byte 0x6E6F6974
+.4byte 0x75616620
+.4byte 0x29746C
+.4byte 0x6C257830
+.4byte 0x73692058
+.4byte 0x6D6E7520
+.4byte 0x65707061
+.4byte 0x70282064
+.4byte 0x20656761
+.4byte 0x6C756166
+.4byte 0x2974
+.4byte 0x5B6D656D
+.4byte 0x6C257830
+.4byte 0x3D3D5D58
+.4byte 0x20646C25
+.4byte 0x202D7C
+.4byte 0x5B6D656D
+.4byte 0x6C257830
+.4byte 0x3D3D5D58
+.4byte 0x6C257830
+.4byte 0x2D7C2058
+.4byte 0x20
+.4byte 0x25207325
+.4byte 0x6C252C73
+.4byte 0x73252864
+.4byte 0x29
+.4byte 0x25207325
+.4byte 0x73252C73
+.4byte 0x73252C
+.4byte 0x25207325
+.4byte 0x73252C73
+.4byte 0x646C252C
+.4byte 0x0
+.4byte 0x706F6E
+.4byte 0x2D7C203A
+.4byte 0x20
+.4byte 0x25207325
+.4byte 0x78302C73
+.4byte 0x586C25
+.4byte 0x7830203A
+.4byte 0x6C383025
+.4byte 0x203A58
+.4byte 0x6C257830
+.4byte 0x58
+.4byte 0x203A
+.4byte 0x203A7325
+.4byte 0x3D3D6370
+.4byte 0x6C257830
+.4byte 0x58
+.4byte 0x6C257E28
+.4byte 0x2975
+.4byte 0x203A7325
+.4byte 0x6E617274
+.4byte 0x74616C73
+.4byte 0x3A676E69
+.4byte 0x6176200A
+.4byte 0x3A726464
+.4byte 0x25783020
+.4byte 0x586C3830
+.4byte 0x6170200A
+.4byte 0x203A6567
+.4byte 0x30257830
+.4byte 0xA586C34
+.4byte 0x61726620
+.4byte 0x203A656D
+.4byte 0x30257830
+.4byte 0xA586C38
+.4byte 0x64617020
+.4byte 0x203A7264
+.4byte 0x30257830
+.4byte 0xA586C38
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x63617274
+.4byte 0x25206465
+.4byte 0x6620756C
+.4byte 0x68637465
+.4byte 0x202C7365
+.4byte 0x20756C25
+.4byte 0x64616F6C
+.4byte 0x61202C73
+.4byte 0x2520646E
+.4byte 0x7320756C
+.4byte 0x65726F74
+.4byte 0x6E692073
+.4byte 0x756C2520
+.4byte 0x74796220
+.4byte 0x69207365
+.4byte 0x206F746E
+.4byte 0xA7325
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72772074
+.4byte 0x20657469
+.4byte 0x6F746E69
+.4byte 0x61727420
+.4byte 0x66206563
+.4byte 0x20656C69
+.4byte 0xA7325
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72632074
+.4byte 0x65746165
+.4byte 0x61727420
+.4byte 0x66206563
+.4byte 0x20656C69
+.4byte 0xA7325
+.4byte 0x2C756C25
+.4byte 0x2C756C25
+.4byte 0x3A756C25
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x6420314C
+.4byte 0x2D617461
+.4byte 0x68636163
+.4byte 0x77732065
+.4byte 0x3A706565
+.4byte 0x7A697320
+.4byte 0x61772C65
+.4byte 0x622C7379
+.4byte 0x6B636F6C
+.4byte 0x6363613A
+.4byte 0x65737365
+.4byte 0x69682C73
+.4byte 0x6D2C7374
+.4byte 0x65737369
+.4byte 0x25282073
+.4byte 0x65722073
+.4byte 0x63616C70
+.4byte 0x6E656D65
+.4byte 0xA2974
+.4byte 0x646E6172
+.4byte 0x6D6F
+.4byte 0x6F666966
+.4byte 0x0
+.4byte 0x75726C70
+.4byte 0x0
+.4byte 0x75726C
+.4byte 0x203A7325
+.4byte 0x61746F74
+.4byte 0x20203A6C
+.4byte 0x20202020
+.4byte 0x25202020
+.4byte 0x252C756C
+.4byte 0x252C756C
+.4byte 0x252C756C
+.4byte 0x255B756C
+.4byte 0x252E756C
+.4byte 0x756C322E
+.4byte 0xA5D
+.4byte 0x203A7325
+.4byte 0x6574616C
+.4byte 0x6569636E
+.4byte 0x20203A73
+.4byte 0x25202020
+.4byte 0x252C756C
+.4byte 0x252C756C
+.4byte 0x252C756C
+.4byte 0xA756C
+.4byte 0x203A7325
+.4byte 0x6C637963
+.4byte 0x203A7365
+.4byte 0x20202020
+.4byte 0x4C202020
+.4byte 0x324C2C31
+.4byte 0x2C334C2C
+.4byte 0x6F6D656D
+.4byte 0x615B7972
+.4byte 0x61726576
+.4byte 0x6D206567
+.4byte 0x726F6D65
+.4byte 0x63612079
+.4byte 0x73736563
+.4byte 0x6D697420
+.4byte 0xA5D65
+.4byte 0x66696E75
+.4byte 0x20646569
+.4byte 0x203A334C
+.4byte 0x202020
+.4byte 0x66696E75
+.4byte 0x20646569
+.4byte 0x203A324C
+.4byte 0x202020
+.4byte 0x203A7325
+.4byte 0x4C2B324C
+.4byte 0x61632033
+.4byte 0x73656863
+.4byte 0x6120203A
+.4byte 0x73656363
+.4byte 0x2C736573
+.4byte 0x73746968
+.4byte 0x73696D2C
+.4byte 0x20736573
+.4byte 0x636E6928
+.4byte 0x6973756C
+.4byte 0xA296576
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x4C2B324C
+.4byte 0x61632033
+.4byte 0x73656863
+.4byte 0x6120203A
+.4byte 0x73656363
+.4byte 0x2C736573
+.4byte 0x73746968
+.4byte 0x73696D2C
+.4byte 0x20736573
+.4byte 0x63786528
+.4byte 0x6973756C
+.4byte 0xA296576
+.4byte 0x0
+.4byte 0x28756C25
+.4byte 0x2E756C25
+.4byte 0x6C322E25
+.4byte 0x29252575
+.4byte 0x756C252C
+.4byte 0x756C2528
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x29
+.4byte 0x203A7325
+.4byte 0x6C257325
+.4byte 0x2C75
+.4byte 0x69777328
+.4byte 0x29686374
+.4byte 0x203A
+.4byte 0x206F7420
+.4byte 0x63657865
+.4byte 0x20657475
+.4byte 0x20756C25
+.4byte 0x74736E69
+.4byte 0x74637572
+.4byte 0x736E6F69
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x74697773
+.4byte 0x6E696863
+.4byte 0x72662067
+.4byte 0x63206D6F
+.4byte 0x65746E6F
+.4byte 0x25207478
+.4byte 0x6F742073
+.4byte 0x6E6F6320
+.4byte 0x74786574
+.4byte 0x732520
+.4byte 0x6B726228
+.4byte 0x203A29
+.4byte 0x203A7325
+.4byte 0x72746572
+.4byte 0x69766569
+.4byte 0x6320676E
+.4byte 0x65727275
+.4byte 0x7020746E
+.4byte 0x72676F72
+.4byte 0x62206D61
+.4byte 0x6B616572
+.4byte 0x25783020
+.4byte 0x586C3830
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x74746573
+.4byte 0x20676E69
+.4byte 0x676F7270
+.4byte 0x206D6172
+.4byte 0x61657262
+.4byte 0x6F74206B
+.4byte 0x25783020
+.4byte 0x586C3830
+.4byte 0xA
+.4byte 0x6C6C616D
+.4byte 0x636F
+.4byte 0x203A7325
+.4byte 0x6E65706F
+.4byte 0x66206465
+.4byte 0x20656C69
+.4byte 0x77207325
+.4byte 0x20687469
+.4byte 0x67616C66
+.4byte 0x78302073
+.4byte 0x20586C25
+.4byte 0x20646E61
+.4byte 0x65646F6D
+.4byte 0x256F3020
+.4byte 0x72206F6C
+.4byte 0x72757465
+.4byte 0x676E696E
+.4byte 0x6C696620
+.4byte 0x65642065
+.4byte 0x69726373
+.4byte 0x726F7470
+.4byte 0x756C2520
+.4byte 0xA
+.4byte 0x65706F28
+.4byte 0x2974616E
+.4byte 0x203A
+.4byte 0x6E65706F
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x75746361
+.4byte 0x796C6C61
+.4byte 0x6F727720
+.4byte 0x25206574
+.4byte 0x6220756C
+.4byte 0x73657479
+.4byte 0x746E6920
+.4byte 0x6966206F
+.4byte 0x7720656C
+.4byte 0x20687469
+.4byte 0x63736564
+.4byte 0x74706972
+.4byte 0x2520726F
+.4byte 0xA756C
+.4byte 0x203A7325
+.4byte 0x69797274
+.4byte 0x7420676E
+.4byte 0x7277206F
+.4byte 0x20657469
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x72662073
+.4byte 0x62206D6F
+.4byte 0x65666675
+.4byte 0x74612072
+.4byte 0x72697620
+.4byte 0x6C617574
+.4byte 0x64646120
+.4byte 0x73736572
+.4byte 0x25783020
+.4byte 0x586C3830
+.4byte 0x746E6920
+.4byte 0x6966206F
+.4byte 0x7720656C
+.4byte 0x20687469
+.4byte 0x63736564
+.4byte 0x74706972
+.4byte 0x2520726F
+.4byte 0xA756C
+.4byte 0x69727728
+.4byte 0x3A296574
+.4byte 0x20
+.4byte 0x74697277
+.4byte 0x65
+.4byte 0x203E2D20
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x75746361
+.4byte 0x796C6C61
+.4byte 0x61657220
+.4byte 0x6C252064
+.4byte 0x79622075
+.4byte 0x20736574
+.4byte 0x6D6F7266
+.4byte 0x6C696620
+.4byte 0x69772065
+.4byte 0x64206874
+.4byte 0x72637365
+.4byte 0x6F747069
+.4byte 0x6C252072
+.4byte 0xA75
+.4byte 0x203A7325
+.4byte 0x69797274
+.4byte 0x7420676E
+.4byte 0x6572206F
+.4byte 0x25206461
+.4byte 0x6220756C
+.4byte 0x73657479
+.4byte 0x6F726620
+.4byte 0x6966206D
+.4byte 0x7720656C
+.4byte 0x20687469
+.4byte 0x63736564
+.4byte 0x74706972
+.4byte 0x2520726F
+.4byte 0x6920756C
+.4byte 0x206F746E
+.4byte 0x66667562
+.4byte 0x61207265
+.4byte 0x69762074
+.4byte 0x61757472
+.4byte 0x6461206C
+.4byte 0x73657264
+.4byte 0x78302073
+.4byte 0x6C383025
+.4byte 0xA58
+.4byte 0x202D7C20
+.4byte 0x0
+.4byte 0x61657228
+.4byte 0x203A2964
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x69727473
+.4byte 0x6920676E
+.4byte 0x6F742073
+.4byte 0x6F6C206F
+.4byte 0x6120676E
+.4byte 0x69762074
+.4byte 0x61757472
+.4byte 0x6461206C
+.4byte 0x73657264
+.4byte 0x78302073
+.4byte 0x6C383025
+.4byte 0xA58
+.4byte 0x203A7325
+.4byte 0x74726976
+.4byte 0x206C6175
+.4byte 0x72646461
+.4byte 0x20737365
+.4byte 0x30257830
+.4byte 0x20586C38
+.4byte 0x69207369
+.4byte 0x6C61766E
+.4byte 0xA6469
+.4byte 0x203A7325
+.4byte 0x74726976
+.4byte 0x206C6175
+.4byte 0x72646461
+.4byte 0x20737365
+.4byte 0x30257830
+.4byte 0x20586C38
+.4byte 0x69207369
+.4byte 0x6E61206E
+.4byte 0x766E6920
+.4byte 0x64696C61
+.4byte 0x67657320
+.4byte 0x746E656D
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x74726976
+.4byte 0x206C6175
+.4byte 0x72646461
+.4byte 0x20737365
+.4byte 0x30257830
+.4byte 0x20586C38
+.4byte 0x75207369
+.4byte 0x70616D6E
+.4byte 0xA646570
+.4byte 0x0
+.4byte 0x64616572
+.4byte 0x0
+.4byte 0x202D7C20
+.4byte 0xA3E2D
+.4byte 0x69786528
+.4byte 0x203A2974
+.4byte 0x0
+.4byte 0x74697865
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C696166
+.4byte 0x74206465
+.4byte 0x6F6C206F
+.4byte 0x61206461
+.4byte 0x6420646E
+.4byte 0x646F6365
+.4byte 0x69622065
+.4byte 0x7972616E
+.4byte 0x6F726620
+.4byte 0x6E69206D
+.4byte 0x20747570
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x69772073
+.4byte 0x25206874
+.4byte 0x2520756C
+.4byte 0x622D756C
+.4byte 0x52207469
+.4byte 0x2D435349
+.4byte 0x6E692055
+.4byte 0x75727473
+.4byte 0x6F697463
+.4byte 0x6120736E
+.4byte 0x2520646E
+.4byte 0x6220756C
+.4byte 0x73657479
+.4byte 0x20666F20
+.4byte 0x61746164
+.4byte 0x616F6C20
+.4byte 0x20646564
+.4byte 0x6D6F7266
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x69772073
+.4byte 0x25206874
+.4byte 0x2520756C
+.4byte 0x622D756C
+.4byte 0x52207469
+.4byte 0x2D435349
+.4byte 0x6E692055
+.4byte 0x75727473
+.4byte 0x6F697463
+.4byte 0x6120736E
+.4byte 0x2520646E
+.4byte 0x6220756C
+.4byte 0x73657479
+.4byte 0x20666F20
+.4byte 0x61746164
+.4byte 0x69727720
+.4byte 0x6E657474
+.4byte 0x746E6920
+.4byte 0x7325206F
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72772074
+.4byte 0x20657469
+.4byte 0x61746164
+.4byte 0x746E6920
+.4byte 0x6962206F
+.4byte 0x7972616E
+.4byte 0x74756F20
+.4byte 0x20747570
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72772074
+.4byte 0x20657469
+.4byte 0x65646F63
+.4byte 0x746E6920
+.4byte 0x6962206F
+.4byte 0x7972616E
+.4byte 0x74756F20
+.4byte 0x20747570
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72772074
+.4byte 0x20657469
+.4byte 0x20464C45
+.4byte 0x64616568
+.4byte 0x6F207265
+.4byte 0x69622066
+.4byte 0x7972616E
+.4byte 0x74756F20
+.4byte 0x20747570
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72632074
+.4byte 0x65746165
+.4byte 0x6E696220
+.4byte 0x20797261
+.4byte 0x7074756F
+.4byte 0x66207475
+.4byte 0x20656C69
+.4byte 0xA7325
+.4byte 0x203A7325
+.4byte 0x68746F6E
+.4byte 0x20676E69
+.4byte 0x65206F74
+.4byte 0x2074696D
+.4byte 0x6F206F74
+.4byte 0x75707475
+.4byte 0x69662074
+.4byte 0x2520656C
+.4byte 0xA73
+.4byte 0x6978616D
+.4byte 0x206D756D
+.4byte 0x61746164
+.4byte 0x7A697320
+.4byte 0x78652065
+.4byte 0x64656563
+.4byte 0x6465
+.4byte 0x6978616D
+.4byte 0x206D756D
+.4byte 0x65646F63
+.4byte 0x7A697320
+.4byte 0x78652065
+.4byte 0x64656563
+.4byte 0x6465
+.4byte 0x203A7325
+.4byte 0x74737973
+.4byte 0x203A6D65
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x746E6F63
+.4byte 0x3A6C6F72
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x706D6F63
+.4byte 0x3A657261
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x706D6F63
+.4byte 0x3A657475
+.4byte 0x20
+.4byte 0x203A7325
+.4byte 0x6F6D656D
+.4byte 0x203A7972
+.4byte 0x20
+.4byte 0x202C
+.4byte 0x203A7325
+.4byte 0x74696E69
+.4byte 0x2020203A
+.4byte 0x20
+.4byte 0x706F6E5B
+.4byte 0x5D252573
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x666F7270
+.4byte 0x3A656C69
+.4byte 0x736E6920
+.4byte 0x63757274
+.4byte 0x6E6F6974
+.4byte 0x6F74203A
+.4byte 0x286C6174
+.4byte 0x69746172
+.4byte 0x2925256F
+.4byte 0x0
+.4byte 0x756C255B
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x5D
+.4byte 0x203A7325
+.4byte 0x28756C25
+.4byte 0x2E756C25
+.4byte 0x6C322E25
+.4byte 0x29252575
+.4byte 0x0
+.4byte 0x20646C25
+.4byte 0x65707865
+.4byte 0x64657463
+.4byte 0x74656220
+.4byte 0x6E656577
+.4byte 0x646C2520
+.4byte 0x646E6120
+.4byte 0x646C2520
+.4byte 0xA
+.4byte 0x6F636E65
+.4byte 0x676E6964
+.4byte 0x72726520
+.4byte 0x726F
+.4byte 0x6572203A
+.4byte 0x6E696461
+.4byte 0x72662067
+.4byte 0x75206D6F
+.4byte 0x696E696E
+.4byte 0x6C616974
+.4byte 0x64657A69
+.4byte 0x67657220
+.4byte 0x65747369
+.4byte 0x2072
+.4byte 0x6572203A
+.4byte 0x6E696461
+.4byte 0x6E752067
+.4byte 0x70617277
+.4byte 0x20646570
+.4byte 0x756C6176
+.4byte 0x72662065
+.4byte 0x72206D6F
+.4byte 0x73696765
+.4byte 0x20726574
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x71696E75
+.4byte 0x62206575
+.4byte 0x69206769
+.4byte 0x6765746E
+.4byte 0x3A737265
+.4byte 0x20202020
+.4byte 0x28756C25
+.4byte 0x29756C25
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x71696E75
+.4byte 0x73206575
+.4byte 0x6E697274
+.4byte 0x696C2067
+.4byte 0x61726574
+.4byte 0x203A736C
+.4byte 0x28756C25
+.4byte 0x29756C25
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x626F6C67
+.4byte 0x76206C61
+.4byte 0x61697261
+.4byte 0x73656C62
+.4byte 0x2020203A
+.4byte 0x20202020
+.4byte 0x28756C25
+.4byte 0x29756C25
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x666F7270
+.4byte 0x3A656C69
+.4byte 0x74616420
+.4byte 0x74203A61
+.4byte 0x6C61746F
+.4byte 0x74796228
+.4byte 0xA297365
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x65747962
+.4byte 0x65672073
+.4byte 0x6172656E
+.4byte 0x20646574
+.4byte 0x68746977
+.4byte 0x756C2520
+.4byte 0x736E6920
+.4byte 0x63757274
+.4byte 0x6E6F6974
+.4byte 0x6E612073
+.4byte 0x6C252064
+.4byte 0x79622075
+.4byte 0x20736574
+.4byte 0x6420666F
+.4byte 0xA617461
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0x76767676
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x626D7973
+.4byte 0x74206C6F
+.4byte 0x656C6261
+.4byte 0x6F6F6C20
+.4byte 0x7370756B
+.4byte 0x206E6920
+.4byte 0x20756C25
+.4byte 0x72657469
+.4byte 0x6F697461
+.4byte 0x6F20736E
+.4byte 0x7661206E
+.4byte 0x67617265
+.4byte 0xA65
+.4byte 0x203A7325
+.4byte 0x68746F6E
+.4byte 0x20676E69
+.4byte 0x63206F74
+.4byte 0x69706D6F
+.4byte 0x202C656C
+.4byte 0x796C6E6F
+.4byte 0x20732520
+.4byte 0x656E6567
+.4byte 0x65746172
+.4byte 0xA64
+.4byte 0x203A7325
+.4byte 0x6F636E65
+.4byte 0x65746E75
+.4byte 0x20646572
+.4byte 0x20756C25
+.4byte 0x746E7973
+.4byte 0x65207861
+.4byte 0x726F7272
+.4byte 0x68772073
+.4byte 0x20656C69
+.4byte 0x706D6F63
+.4byte 0x6E696C69
+.4byte 0x73252067
+.4byte 0x6F202D20
+.4byte 0x7474696D
+.4byte 0x20676E69
+.4byte 0x7074756F
+.4byte 0xA7475
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x69737361
+.4byte 0x656D6E67
+.4byte 0x2C73746E
+.4byte 0x756C2520
+.4byte 0x69687720
+.4byte 0x202C656C
+.4byte 0x20756C25
+.4byte 0x202C6669
+.4byte 0x20756C25
+.4byte 0x6C6C6163
+.4byte 0x25202C73
+.4byte 0x7220756C
+.4byte 0x72757465
+.4byte 0xA6E
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x626F6C67
+.4byte 0x76206C61
+.4byte 0x61697261
+.4byte 0x73656C62
+.4byte 0x6C25202C
+.4byte 0x72702075
+.4byte 0x6465636F
+.4byte 0x73657275
+.4byte 0x6C25202C
+.4byte 0x74732075
+.4byte 0x676E6972
+.4byte 0x74696C20
+.4byte 0x6C617265
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x68746977
+.4byte 0x756C2520
+.4byte 0x756C2528
+.4byte 0x322E252E
+.4byte 0x2525756C
+.4byte 0x68632029
+.4byte 0x63617261
+.4byte 0x73726574
+.4byte 0x206E6920
+.4byte 0x20756C25
+.4byte 0x75746361
+.4byte 0x73206C61
+.4byte 0x6F626D79
+.4byte 0xA736C
+.4byte 0x203A7325
+.4byte 0x20756C25
+.4byte 0x72616863
+.4byte 0x65746361
+.4byte 0x72207372
+.4byte 0x20646165
+.4byte 0x25206E69
+.4byte 0x6C20756C
+.4byte 0x73656E69
+.4byte 0x646E6120
+.4byte 0x756C2520
+.4byte 0x6D6F6320
+.4byte 0x746E656D
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0x2D2D2D2D
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x706F2074
+.4byte 0x69206E65
+.4byte 0x7475706E
+.4byte 0x6C696620
+.4byte 0x73252065
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x666C6573
+.4byte 0x63206569
+.4byte 0x69706D6F
+.4byte 0x676E696C
+.4byte 0x20732520
+.4byte 0x25206F74
+.4byte 0x622D756C
+.4byte 0x52207469
+.4byte 0x2D435349
+.4byte 0x69772055
+.4byte 0x25206874
+.4byte 0x622D756C
+.4byte 0x73207469
+.4byte 0x63726174
+.4byte 0xA
+.4byte 0x203A7325
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0x2B2B2B2B
+.4byte 0xA
+.4byte 0x6C697562
+.4byte 0x736E6974
+.4byte 0x0
+.4byte 0x6978616D
+.4byte 0x206D756D
+.4byte 0x676F7270
+.4byte 0x206D6172
+.4byte 0x61657262
+.4byte 0x7865206B
+.4byte 0x64656563
+.4byte 0x6465
+.4byte 0x72617627
+.4byte 0x646E655F
+.4byte 0x73752027
+.4byte 0x69206465
+.4byte 0x6F6E206E
+.4byte 0x61762D6E
+.4byte 0x64616972
+.4byte 0x70206369
+.4byte 0x65636F72
+.4byte 0x65727564
+.4byte 0x0
+.4byte 0x72617627
+.4byte 0x6174735F
+.4byte 0x20277472
+.4byte 0x64657375
+.4byte 0x206E6920
+.4byte 0x2D6E6F6E
+.4byte 0x69726176
+.4byte 0x63696461
+.4byte 0x6F727020
+.4byte 0x75646563
+.4byte 0x6572
+.4byte 0x66666964
+.4byte 0x6E657265
+.4byte 0x756E2074
+.4byte 0x7265626D
+.4byte 0x20666F20
+.4byte 0x75746361
+.4byte 0x61206C61
+.4byte 0x6620646E
+.4byte 0x616D726F
+.4byte 0x6170206C
+.4byte 0x656D6172
+.4byte 0x73726574
+.4byte 0x0
+.4byte 0x65776566
+.4byte 0x63612072
+.4byte 0x6C617574
+.4byte 0x61687420
+.4byte 0x6F66206E
+.4byte 0x6C616D72
+.4byte 0x72617020
+.4byte 0x74656D61
+.4byte 0x737265
+.4byte 0x5F726176
+.4byte 0x646E65
+.4byte 0x5F726176
+.4byte 0x677261
+.4byte 0x5F726176
+.4byte 0x72617473
+.4byte 0x74
+.4byte 0x65646572
+.4byte 0x696E6966
+.4byte 0x6E6F6974
+.4byte 0x20666F20
+.4byte 0x636F7270
+.4byte 0x72756465
+.4byte 0x73252065
+.4byte 0x6E676920
+.4byte 0x6465726F
+.4byte 0xA
+.4byte 0x206F6F74
+.4byte 0x796E616D
+.4byte 0x726F6620
+.4byte 0x206C616D
+.4byte 0x61726170
+.4byte 0x6574656D
+.4byte 0x7372
+.4byte 0x206F6F74
+.4byte 0x796E616D
+.4byte 0x636F6C20
+.4byte 0x76206C61
+.4byte 0x61697261
+.4byte 0x73656C62
+.4byte 0x0
+.4byte 0x63746566
+.4byte 0x61645F68
+.4byte 0x735F6174
+.4byte 0x656D6765
+.4byte 0x735F746E
+.4byte 0x657A69
+.4byte 0x63746566
+.4byte 0x6C675F68
+.4byte 0x6C61626F
+.4byte 0x696F705F
+.4byte 0x7265746E
+.4byte 0x0
+.4byte 0x63746566
+.4byte 0x74735F68
+.4byte 0x5F6B6361
+.4byte 0x6E696F70
+.4byte 0x726574
+.4byte 0x73707968
+.4byte 0x5F726574
+.4byte 0x74697773
+.4byte 0x6863
+.4byte 0x6C6C617A
+.4byte 0x636F
+.4byte 0x69727064
+.4byte 0x66746E
+.4byte 0x5F6E6F6E
+.4byte 0x6F625F30
+.4byte 0x6C5F746F
+.4byte 0x6C657665
+.4byte 0x7270645F
+.4byte 0x66746E69
+.4byte 0x0
+.4byte 0x69727073
+.4byte 0x66746E
+.4byte 0x5F6E6F6E
+.4byte 0x6F625F30
+.4byte 0x6C5F746F
+.4byte 0x6C657665
+.4byte 0x7270735F
+.4byte 0x66746E69
+.4byte 0x0
+.4byte 0x6E697270
+.4byte 0x6674
+.4byte 0x5F6E6F6E
+.4byte 0x6F625F30
+.4byte 0x6C5F746F
+.4byte 0x6C657665
+.4byte 0x6972705F
+.4byte 0x66746E
+.4byte 0x6E697528
+.4byte 0x5F343674
+.4byte 0x2D202974
+.4byte 0x69752820
+.4byte 0x3436746E
+.4byte 0x292A745F
+.4byte 0x20736920
+.4byte 0x65646E75
+.4byte 0x656E6966
+.4byte 0x64
+.4byte 0x6E697528
+.4byte 0x5F343674
+.4byte 0x20292A74
+.4byte 0x7528202B
+.4byte 0x36746E69
+.4byte 0x2A745F34
+.4byte 0x73692029
+.4byte 0x646E7520
+.4byte 0x6E696665
+.4byte 0x6465
+.4byte 0x6E5F6F6E
+.4byte 0x656D61
+.4byte 0x65646572
+.4byte 0x696E6966
+.4byte 0x6E6F6974
+.4byte 0x20666F20
+.4byte 0x626F6C67
+.4byte 0x76206C61
+.4byte 0x61697261
+.4byte 0x20656C62
+.4byte 0x69207325
+.4byte 0x726F6E67
+.4byte 0xA6465
+.4byte 0x65707974
+.4byte 0x73696D20
+.4byte 0x6374616D
+.4byte 0x202C68
+.4byte 0x6E726177
+.4byte 0x676E69
+.4byte 0x6E6B6E75
+.4byte 0x6E776F
+.4byte 0x65646E75
+.4byte 0x72616C63
+.4byte 0x6465
+.4byte 0x746E6975
+.4byte 0x745F3436
+.4byte 0x2A
+.4byte 0x65207325
+.4byte 0x63657078
+.4byte 0x20646574
+.4byte 0x20747562
+.4byte 0x66207325
+.4byte 0x646E756F
+.4byte 0xA
+.4byte 0x75207325
+.4byte 0x6365646E
+.4byte 0x6572616C
+.4byte 0xA64
+.4byte 0x78656E75
+.4byte 0x74636570
+.4byte 0x73206465
+.4byte 0x6F626D79
+.4byte 0x206C
+.4byte 0x656C6C69
+.4byte 0x206C6167
+.4byte 0x69676572
+.4byte 0x72657473
+.4byte 0x61656420
+.4byte 0x636F6C6C
+.4byte 0x6F697461
+.4byte 0x6E
+.4byte 0x656C6C69
+.4byte 0x206C6167
+.4byte 0x69676572
+.4byte 0x72657473
+.4byte 0x63636120
+.4byte 0x737365
+.4byte 0x2074756F
+.4byte 0x7220666F
+.4byte 0x73696765
+.4byte 0x73726574
+.4byte 0x0
+.4byte 0x636F7270
+.4byte 0x72756465
+.4byte 0x73252065
+.4byte 0x646E7520
+.4byte 0x6E696665
+.4byte 0xA6465
+.4byte 0x6E6B6E75
+.4byte 0x206E776F
+.4byte 0x61637365
+.4byte 0x73206570
+.4byte 0x65757165
+.4byte 0x2065636E
+.4byte 0x6E756F66
+.4byte 0x64
+.4byte 0x6E756F66
+.4byte 0x6E752064
+.4byte 0x776F6E6B
+.4byte 0x6863206E
+.4byte 0x63617261
+.4byte 0x20726574
+.4byte 0x0
+.4byte 0x69727473
+.4byte 0x7420676E
+.4byte 0x6C206F6F
+.4byte 0x676E6F
+.4byte 0x63616572
+.4byte 0x20646568
+.4byte 0x20646E65
+.4byte 0x6620666F
+.4byte 0x20656C69
+.4byte 0x6B6F6F6C
+.4byte 0x20676E69
+.4byte 0x20726F66
+.4byte 0x68632061
+.4byte 0x63617261
+.4byte 0x20726574
+.4byte 0x6574696C
+.4byte 0x6C6172
+.4byte 0x69736E75
+.4byte 0x64656E67
+.4byte 0x746E6920
+.4byte 0x72656765
+.4byte 0x74756F20
+.4byte 0x20666F20
+.4byte 0x67726174
+.4byte 0x62207465
+.4byte 0x646E756F
+.4byte 0x0
+.4byte 0x6E676973
+.4byte 0x69206465
+.4byte 0x6765746E
+.4byte 0x6F207265
+.4byte 0x6F207475
+.4byte 0x61742066
+.4byte 0x74656772
+.4byte 0x756F6220
+.4byte 0x646E
+.4byte 0x69736E75
+.4byte 0x64656E67
+.4byte 0x746E6920
+.4byte 0x72656765
+.4byte 0x74756F20
+.4byte 0x20666F20
+.4byte 0x6E756F62
+.4byte 0x64
+.4byte 0x6E676973
+.4byte 0x69206465
+.4byte 0x6765746E
+.4byte 0x6F207265
+.4byte 0x6F207475
+.4byte 0x6F622066
+.4byte 0x646E75
+.4byte 0x6E656469
+.4byte 0x69666974
+.4byte 0x74207265
+.4byte 0x6C206F6F
+.4byte 0x676E6F
+.4byte 0x616E7572
+.4byte 0x20796177
+.4byte 0x746C756D
+.4byte 0x696C2D69
+.4byte 0x6320656E
+.4byte 0x656D6D6F
+.4byte 0x746E
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x65722074
+.4byte 0x63206461
+.4byte 0x61726168
+.4byte 0x72657463
+.4byte 0x6F726620
+.4byte 0x6E69206D
+.4byte 0x20747570
+.4byte 0x656C6966
+.4byte 0xA732520
+.4byte 0x0
+.4byte 0x756F6620
+.4byte 0xA646E
+.4byte 0x70786520
+.4byte 0x65746365
+.4byte 0x75622064
+.4byte 0x2074
+.4byte 0xA7325
+.4byte 0x746E7973
+.4byte 0x65207861
+.4byte 0x726F7272
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x69207325
+.4byte 0x7325206E
+.4byte 0x206E6920
+.4byte 0x656E696C
+.4byte 0x756C2520
+.4byte 0x203A
+.4byte 0x20646E65
+.4byte 0x6620666F
+.4byte 0x656C69
+.4byte 0x203A7325
+.4byte 0x6C6C616D
+.4byte 0x6F20636F
+.4byte 0x6F207475
+.4byte 0x656D2066
+.4byte 0x79726F6D
+.4byte 0xA
+.4byte 0x6230
+.4byte 0x6F30
+.4byte 0x7830
+.4byte 0x22732522
+.4byte 0x0
+.4byte 0x27632527
+.4byte 0x0
+.4byte 0x72616327
+.4byte 0x67616972
+.4byte 0x65722065
+.4byte 0x6E727574
+.4byte 0x27
+.4byte 0x6E696C27
+.4byte 0x65662065
+.4byte 0x276465
+.4byte 0x62617427
+.4byte 0x74616C75
+.4byte 0x27726F
+.4byte 0x646E6527
+.4byte 0x20666F20
+.4byte 0x656C6966
+.4byte 0x27
+.4byte 0xA
+.4byte 0x4C4C554E
+.4byte 0x0
+.4byte 0x203A7325
+.4byte 0x6C756F63
+.4byte 0x6F6E2064
+.4byte 0x72772074
+.4byte 0x20657469
+.4byte 0x72616863
+.4byte 0x65746361
+.4byte 0x6E692072
+.4byte 0x6F206F74
+.4byte 0x75707475
+.4byte 0x69662074
+.4byte 0x2520656C
+.4byte 0xA73
+.4byte 0x7325
+.4byte 0x203A7325
+.4byte 0x6E6E6163
+.4byte 0x6320746F
+.4byte 0x65766E6F
+.4byte 0x6F207472
+.4byte 0x6F2D7475
+.4byte 0x6F622D66
+.4byte 0x20646E75
+.4byte 0x626D756E
+.4byte 0x25207265
+.4byte 0xA73
+.4byte 0x203A7325
+.4byte 0x6E6E6163
+.4byte 0x6320746F
+.4byte 0x65766E6F
+.4byte 0x6E207472
+.4byte 0x642D6E6F
+.4byte 0x6D696365
+.4byte 0x6E206C61
+.4byte 0x65626D75
+.4byte 0x73252072
+.4byte 0xA
+.4byte 0x0
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x7478696D
+.4byte 0x7265
+.4byte 0x73626F6D
+.4byte 0x726574
+.4byte 0x736E696D
+.4byte 0x726574
+.4byte 0x73707968
+.4byte 0x726574
+.4byte 0x7370696D
+.4byte 0x726574
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x504B4353
+.4byte 0x8
+.4byte 0x7
+.4byte 0x6
+.4byte 0x5
+.4byte 0x0
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x20
+.4byte 0x1B
+.4byte 0x1A
+.4byte 0x19
+.4byte 0x18
+.4byte 0x17
+.4byte 0x16
+.4byte 0x15
+.4byte 0x14
+.4byte 0x13
+.4byte 0x12
+.4byte 0x11
+.4byte 0x10
+.4byte 0xF
+.4byte 0xE
+.4byte 0xD
+.4byte 0xC
+.4byte 0xB
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x400
+.4byte 0x8
+.4byte 0x40
+.4byte 0x10000
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x10
+.4byte 0x400
+.4byte 0x4
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x8
+.4byte 0x20
+.4byte 0x1
+.4byte 0x3E8
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x2A
+.4byte 0x65746E69
+.4byte 0x20726567
+.4byte 0x7265766F
+.4byte 0x776F6C66
+.4byte 0x0
+.4byte 0x6E696E75
+.4byte 0x61697469
+.4byte 0x657A696C
+.4byte 0x65722064
+.4byte 0x74736967
+.4byte 0x7265
+.4byte 0x6E6B6E75
+.4byte 0x206E776F
+.4byte 0x74736E69
+.4byte 0x74637572
+.4byte 0x6E6F69
+.4byte 0x61766E69
+.4byte 0x2064696C
+.4byte 0x72646461
+.4byte 0x737365
+.4byte 0x69766964
+.4byte 0x6E6F6973
+.4byte 0x20796220
+.4byte 0x6F72657A
+.4byte 0x0
+.4byte 0x656D6974
+.4byte 0x6E692072
+.4byte 0x72726574
+.4byte 0x747075
+.4byte 0x63737973
+.4byte 0x6C6C61
+.4byte 0x6D676573
+.4byte 0x61746E65
+.4byte 0x6E6F6974
+.4byte 0x75616620
+.4byte 0x746C
+.4byte 0x65676170
+.4byte 0x75616620
+.4byte 0x746C
+.4byte 0x65206F6E
+.4byte 0x70656378
+.4byte 0x6E6F6974
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x5
+.4byte 0x4
+.4byte 0x5
+.4byte 0x13
+.4byte 0x12
+.4byte 0x11
+.4byte 0x10
+.4byte 0xF
+.4byte 0x7
+.4byte 0x0
+.4byte 0x186A0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x9
+.4byte 0x8
+.4byte 0x7
+.4byte 0x6
+.4byte 0x5
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x20
+.4byte 0x4
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x64
+.4byte 0x6C616365
+.4byte 0x6C
+.4byte 0x726C616A
+.4byte 0x0
+.4byte 0x6C616A
+.4byte 0x716562
+.4byte 0x75746C73
+.4byte 0x0
+.4byte 0x756D6572
+.4byte 0x0
+.4byte 0x75766964
+.4byte 0x0
+.4byte 0x6C756D
+.4byte 0x627573
+.4byte 0x646461
+.4byte 0x69646461
+.4byte 0x0
+.4byte 0x69756C
+.4byte 0x7773
+.4byte 0x776C
+.4byte 0x6473
+.4byte 0x646C
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0xE
+.4byte 0xD
+.4byte 0xC
+.4byte 0xB
+.4byte 0xA
+.4byte 0x9
+.4byte 0x8
+.4byte 0x7
+.4byte 0x6
+.4byte 0x5
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x40
+.4byte 0x4
+.4byte 0x0
+.4byte 0x100
+.4byte 0x3
+.4byte 0x2
+.4byte 0x0
+.4byte 0x1
+.4byte 0x200
+.4byte 0x100000
+.4byte 0x1000
+.4byte 0x1000
+.4byte 0xFFFFFFFF
+.4byte 0x4
+.4byte 0x40000000
+.4byte 0x100000
+.4byte 0x400
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x10000
+.4byte 0x4
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x43525453
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x40
+.4byte 0x10
+.4byte 0x10
+.4byte 0x0
+.4byte 0x0
+.4byte 0xC8
+.4byte 0x28
+.4byte 0xC
+.4byte 0x4
+.4byte 0x1
+.4byte 0x0
+.4byte 0x40
+.4byte 0x40
+.4byte 0x10
+.4byte 0x8
+.4byte 0x200000
+.4byte 0x40000
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x10
+.4byte 0x10
+.4byte 0x4
+.4byte 0x8
+.4byte 0x4000
+.4byte 0x8000
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x191
+.4byte 0x0
+.4byte 0x0
+.4byte 0xFFFFFF9C
+.4byte 0xD6
+.4byte 0x38
+.4byte 0x40
+.4byte 0x3F
+.4byte 0x5D
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1000
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x2
+.4byte 0x38
+.4byte 0x40
+.4byte 0x0
+.4byte 0x0
+.4byte 0x40
+.4byte 0x10000
+.4byte 0x1
+.4byte 0xF3
+.4byte 0x2
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x1
+.4byte 0x2
+.4byte 0xCF
+.4byte 0x46
+.4byte 0x4C
+.4byte 0x45
+.4byte 0x7F
+.4byte 0x6
+.4byte 0x5
+.4byte 0x1
+.4byte 0x10000
+.4byte 0x10000
+.4byte 0x80000
+.4byte 0x100000
+.4byte 0x1
+.4byte 0x2
+.4byte 0x1000
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x1
+.4byte 0x20
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x2
+.4byte 0x2
+.4byte 0x3
+.4byte 0x3
+.4byte 0x3
+.4byte 0x7
+.4byte 0x5
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x73
+.4byte 0x6F
+.4byte 0x67
+.4byte 0x63
+.4byte 0x37
+.4byte 0x33
+.4byte 0x23
+.4byte 0x13
+.4byte 0x3
+.4byte 0x3674
+.4byte 0x3574
+.4byte 0x3474
+.4byte 0x3374
+.4byte 0x313173
+.4byte 0x303173
+.4byte 0x3973
+.4byte 0x3873
+.4byte 0x3773
+.4byte 0x3673
+.4byte 0x3573
+.4byte 0x3473
+.4byte 0x3373
+.4byte 0x3273
+.4byte 0x3761
+.4byte 0x3661
+.4byte 0x3561
+.4byte 0x3461
+.4byte 0x3361
+.4byte 0x3261
+.4byte 0x3161
+.4byte 0x3061
+.4byte 0x3173
+.4byte 0x3073
+.4byte 0x3274
+.4byte 0x3174
+.4byte 0x3074
+.4byte 0x7074
+.4byte 0x7067
+.4byte 0x7073
+.4byte 0x6172
+.4byte 0x6F72657A
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1F
+.4byte 0x1E
+.4byte 0x1D
+.4byte 0x1C
+.4byte 0x1B
+.4byte 0x1A
+.4byte 0x19
+.4byte 0x18
+.4byte 0x17
+.4byte 0x16
+.4byte 0x15
+.4byte 0x14
+.4byte 0x13
+.4byte 0x12
+.4byte 0x11
+.4byte 0x10
+.4byte 0xF
+.4byte 0xE
+.4byte 0xD
+.4byte 0xC
+.4byte 0xB
+.4byte 0xA
+.4byte 0x9
+.4byte 0x8
+.4byte 0x7
+.4byte 0x6
+.4byte 0x5
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0x7
+.4byte 0x20
+.4byte 0x6D75625F
+.4byte 0x70
+.4byte 0x6E69616D
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x400
+.4byte 0x2
+.4byte 0x1
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x5
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x736E6F63
+.4byte 0x74
+.4byte 0x69736E75
+.4byte 0x64656E67
+.4byte 0x0
+.4byte 0x72616863
+.4byte 0x0
+.4byte 0x746E69
+.4byte 0x2E2E2E
+.4byte 0x3D3E
+.4byte 0x3E
+.4byte 0x3D3C
+.4byte 0x3C
+.4byte 0x3D21
+.4byte 0x3D3D
+.4byte 0x3D
+.4byte 0x25
+.4byte 0x2F
+.4byte 0x2A
+.4byte 0x2D
+.4byte 0x2B
+.4byte 0x7D
+.4byte 0x7B
+.4byte 0x29
+.4byte 0x28
+.4byte 0x3B
+.4byte 0x2C
+.4byte 0x657A6973
+.4byte 0x666F
+.4byte 0x6C696877
+.4byte 0x65
+.4byte 0x75746572
+.4byte 0x6E72
+.4byte 0x64696F76
+.4byte 0x0
+.4byte 0x65736C65
+.4byte 0x0
+.4byte 0x6669
+.4byte 0x746E6975
+.4byte 0x745F3436
+.4byte 0x0
+.4byte 0x6E656469
+.4byte 0x69666974
+.4byte 0x7265
+.4byte 0x69727473
+.4byte 0x676E
+.4byte 0x72616863
+.4byte 0x65746361
+.4byte 0x72
+.4byte 0x65746E69
+.4byte 0x726567
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x80
+.4byte 0x14
+.4byte 0x40
+.4byte 0x0
+.4byte 0x21
+.4byte 0x20
+.4byte 0x1F
+.4byte 0x1E
+.4byte 0x1D
+.4byte 0x1C
+.4byte 0x1B
+.4byte 0x1A
+.4byte 0x19
+.4byte 0x18
+.4byte 0x17
+.4byte 0x16
+.4byte 0x15
+.4byte 0x14
+.4byte 0x13
+.4byte 0x12
+.4byte 0x11
+.4byte 0x10
+.4byte 0xF
+.4byte 0xE
+.4byte 0xD
+.4byte 0xC
+.4byte 0xB
+.4byte 0xA
+.4byte 0x9
+.4byte 0x8
+.4byte 0x7
+.4byte 0x6
+.4byte 0x5
+.4byte 0x4
+.4byte 0x3
+.4byte 0x2
+.4byte 0x1
+.4byte 0x0
+.4byte 0xFFFFFFFF
+.4byte 0x2E
+.4byte 0x5C
+.4byte 0x3E
+.4byte 0x3C
+.4byte 0x21
+.4byte 0x3D
+.4byte 0x25
+.4byte 0x2F
+.4byte 0x2A
+.4byte 0x2D
+.4byte 0x2B
+.4byte 0x7D
+.4byte 0x7B
+.4byte 0x29
+.4byte 0x28
+.4byte 0x3B
+.4byte 0x2C
+.4byte 0x22
+.4byte 0x27
+.4byte 0x5F
+.4byte 0x20
+.4byte 0xD
+.4byte 0xA
+.4byte 0x9
+.4byte 0x8
+.4byte 0xFFFFFFFF
+.4byte 0x666C6573
+.4byte 0x632E6569
+.4byte 0x6E752E73
+.4byte 0x61732D69
+.4byte 0x75627A6C
+.4byte 0x612E6772
+.4byte 0x74
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x1ED
+.4byte 0x1A4
+.4byte 0x241
+.4byte 0x8301
+.4byte 0x601
+.4byte 0x241
+.4byte 0x8000
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x80
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x40
+.4byte 0x8
+.4byte 0x0
+.4byte 0x0
+.4byte 0x8
+.4byte 0x8
+.4byte 0x20
+.4byte 0x4
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x0
+.4byte 0x40
+.4byte 0x40
+.4byte 0x1
+.4byte 0x1
+.4byte 0x0
+.4byte 0x0
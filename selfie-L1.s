@@ -0,0 +1,61020 @@
+lui t0,0x4E
+addi t0,t0,752
+addi gp,t0,0
+addi a0,zero,0
+addi a7,zero,214
+ecall
+addi a0,a0,7
+addi t0,zero,8
+remu t0,a0,t0
+sub a0,a0,t0
+addi a7,zero,214
+ecall
+sd a0,-8(gp)
+ld t0,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,sp,16
+sd t0,8(sp)
+jal ra,58819
+addi sp,sp,-8
+sd a0,0(sp)
+ld a0,0(sp)
+addi sp,sp,8
+addi a7,zero,93
+ecall
+ld a0,0(sp)
+addi sp,sp,8
+ld a1,0(sp)
+addi sp,sp,8
+ld a2,0(sp)
+addi sp,sp,8
+addi a7,zero,63
+ecall
+jalr zero,0(ra)
+ld a0,0(sp)
+addi sp,sp,8
+ld a1,0(sp)
+addi sp,sp,8
+ld a2,0(sp)
+addi sp,sp,8
+addi a7,zero,64
+ecall
+jalr zero,0(ra)
+ld a1,0(sp)
+addi sp,sp,8
+ld a2,0(sp)
+addi sp,sp,8
+ld a3,0(sp)
+addi sp,sp,8
+addi a0,zero,-100
+addi a7,zero,56
+ecall
+jalr zero,0(ra)
+ld t0,0(sp)
+addi sp,sp,8
+addi t0,t0,7
+addi t1,zero,8
+remu t1,t0,t1
+sub t0,t0,t1
+ld t1,-8(gp)
+add a0,t1,t0
+addi a7,zero,214
+ecall
+beq a0,t1,2
+beq zero,zero,4
+beq zero,t0,3
+addi a0,zero,0
+beq zero,zero,3
+sd a0,-8(gp)
+addi a0,t1,0
+jalr zero,0(ra)
+ld a0,0(sp)
+addi sp,sp,8
+ld a1,0(sp)
+addi sp,sp,8
+addi a7,zero,401
+ecall
+addi a0,a6,0
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-16(gp)
+beq t0,zero,2
+jal zero,121
+addi t0,zero,-336
+add t0,gp,t0
+sd t0,-16(gp)
+addi t0,zero,8
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-40(gp)
+addi t0,zero,8
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-48(gp)
+ld t0,-40(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9833
+addi t0,a0,0
+sd t0,-56(gp)
+ld t0,-56(gp)
+addi t1,zero,1
+sd t1,0(t0)
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-40(gp)
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-56(gp)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-56(gp)
+ld t2,-8(s0)
+addi t3,zero,1
+sub t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,2
+mul t1,t1,t2
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-24
+addi t0,zero,1
+sub t0,zero,t0
+sd t0,-64(gp)
+ld t0,-40(gp)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6839
+addi t0,a0,0
+sd t0,-80(gp)
+ld t0,-80(gp)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-72(gp)
+addi t0,zero,8
+sd t0,-104(gp)
+addi t0,zero,8
+sd t0,-112(gp)
+ld t0,-64(gp)
+sd t0,-120(gp)
+ld t0,-80(gp)
+sd t0,-128(gp)
+addi t0,zero,8
+sd t0,-136(gp)
+ld t0,-136(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-144(gp)
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9768
+addi t0,a0,0
+sd t0,-152(gp)
+ld t0,-152(gp)
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,-40(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7581
+addi t0,a0,0
+sd t0,-160(gp)
+addi t0,zero,80
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7575
+addi t0,a0,0
+sd t0,-168(gp)
+ld t0,-176(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7569
+addi t0,a0,0
+sd t0,-184(gp)
+addi t0,zero,255
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7563
+addi t0,a0,0
+sd t0,-192(gp)
+addi t0,zero,8
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9735
+addi t0,a0,0
+sd t0,-200(gp)
+ld t0,-200(gp)
+addi t1,zero,0
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,-272(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-824(gp)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9699
+addi t0,a0,0
+sd t0,-832(gp)
+ld t0,-832(gp)
+ld t1,-560(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-984
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-568(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1000
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-576(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1008
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1024
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1040
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-600(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1048
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1056
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1064
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-624(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1072
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1080
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-640(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1088
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1096
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1104
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1112
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1120
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1128
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1136
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1144
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1152
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-712(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1160
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-720(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1168
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-728(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1176
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-736(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1184
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-744(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1192
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-752(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1200
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-760(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1208
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-768(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1216
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-776(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1224
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-784(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1232
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-792(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1240
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-800(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1248
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-808(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1256
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-816(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1272
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-832(gp)
+ld t1,-824(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1280
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-344(gp)
+sd t0,-864(gp)
+ld t0,-552(gp)
+sd t0,-960(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,-872(gp)
+addi t0,zero,1
+sd t0,-880(gp)
+jal ra,9776
+addi t0,zero,0
+sd t0,-888(gp)
+addi t0,zero,0
+sd t0,-896(gp)
+addi t0,zero,0
+sd t0,-904(gp)
+addi t0,zero,0
+sd t0,-912(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,2
+addi t1,zero,8
+mul t0,t0,t1
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9378
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1376(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,9258
+addi t0,a0,0
+sd t0,-1384(gp)
+addi t0,zero,0
+sd t0,-1392(gp)
+addi t0,zero,0
+sd t0,-1400(gp)
+addi t0,zero,0
+sd t0,-1408(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+sd t0,-1448(gp)
+addi t0,zero,0
+sd t0,-1456(gp)
+addi t0,zero,0
+sd t0,-1464(gp)
+addi t0,zero,0
+sd t0,-1472(gp)
+addi t0,zero,0
+sd t0,-1480(gp)
+addi t0,zero,0
+sd t0,-1488(gp)
+addi t0,zero,0
+sd t0,-1496(gp)
+addi t0,zero,0
+sd t0,-1504(gp)
+addi t0,zero,0
+sd t0,-912(gp)
+jal ra,9952
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,16(s0)
+ld t1,0(t1)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,16(s0)
+ld t1,0(t1)
+sd t1,0(t0)
+addi t0,zero,-1512
+add t0,gp,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,16(s0)
+ld t1,0(t1)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,-1536
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6855
+addi t0,a0,0
+sd t0,-1520(gp)
+addi t0,zero,-1544
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6848
+addi t0,a0,0
+sd t0,-1528(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1552(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8954
+addi t0,a0,0
+sd t0,-1824(gp)
+ld t0,-1824(gp)
+ld t1,-1568(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1832
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1576(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1840
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1848
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1592(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1856
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1600(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1864
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1608(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1872
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1616(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1880
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1624(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1888
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1896
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1640(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1904
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1912
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1920
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1928
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1936
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1680(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1944
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1688(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1952
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1960
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1968
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1712(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1976
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1720(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1984
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1728(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-1992
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1736(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2000
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1744(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2008
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1752(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2016
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1760(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2024
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1768(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2032
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1776(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2040
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1784(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,-2048
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1792(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2040
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1800(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2032
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1808(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2024
+add t1,gp,t1
+sd t1,0(t0)
+ld t0,-1824(gp)
+ld t1,-1816(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,2016
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1192(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1176(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1168(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1160(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1368(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1360(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1352(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1336(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1328(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1320(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1312(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1304(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1296(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1288(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1272(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1264(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1240(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1232(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,5
+addi t1,zero,8
+mul t0,t0,t1
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8548
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,4
+addi t1,zero,8
+mul t0,t0,t1
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8100
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,512(t1)
+addi t2,zero,8
+ld t3,-136(gp)
+divu t2,t2,t3
+mul t1,t1,t2
+sd t1,504(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,512(t1)
+addi t2,zero,8
+divu t1,t1,t2
+sd t1,488(t0)
+ld t0,16(s0)
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sd t0,16(s0)
+jal zero,9
+ld t0,16(s0)
+lui t1,0x1
+addi t1,t1,0
+sltu t0,t1,t0
+beq t0,zero,4
+lui t0,0x1
+addi t0,t0,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,544(t2)
+mul t1,t1,t2
+sd t1,472(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,504(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,512(t3)
+divu t2,t2,t3
+mul t1,t1,t2
+sd t1,464(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,448(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,456(t1)
+mul t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7345
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,440(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,424(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,432(t1)
+mul t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7317
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,384(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,376(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,224
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,216
+add t1,gp,t1
+sd t1,0(t0)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,208
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,200
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7032
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,192
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,184
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,176
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,336(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,168
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,160
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,152
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,144
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,136
+add t1,gp,t1
+sd t1,0(t0)
+jal ra,-192
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,128
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,120
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,264(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,112
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,256(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,104
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,96(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7029
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,80(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,96(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,7013
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,72(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6561
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-32(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,48(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-568
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,40(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-584
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,32(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-608
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,24(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-616
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,16(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-632
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,8(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-656
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,0(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-672
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-8(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-696
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-16(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-720
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-24(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-744
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-224(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-232(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-240(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+sd t1,-248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-264(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-288(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-296(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-304(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-312(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-320(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-328(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-336(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-352(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-360(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-368(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-376(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-384(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-392(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6453
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6429
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-424(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6409
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-432(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6389
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-440(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-1552(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6365
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-448(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-1552(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6351
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-456(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+ld t1,-1568(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+ld t1,-1584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+ld t1,-1632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-464(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-472(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-480(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-488(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-496(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-504(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-512(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-520(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-528(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-536(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-544(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-552(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-2573
+jal ra,-307
+jal ra,-246
+jal ra,-229
+jal ra,-132
+jal ra,-44
+jal ra,23075
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-752(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6047
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,17
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,18
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,19
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,20
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,22
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,23
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,24
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,25
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,27
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,28
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,29
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,30
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,31
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,39
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,40
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,17
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,18
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,19
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,20
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,21
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,22
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,23
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,24
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,25
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,26
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,27
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,28
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,29
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,30
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,31
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,32
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,33
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,34
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,35
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,36
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,37
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,38
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,39
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,40
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,41
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,8
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,9
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,11
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,12
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,13
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,14
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,15
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,16
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,17
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,18
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,19
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,20
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,21
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,22
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,23
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,24
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,25
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,26
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,27
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,28
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,29
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,30
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,31
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,32
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,33
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,34
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,35
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,36
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,37
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,38
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,39
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,40
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,41
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,41255
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-896(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-904(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-912(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-920(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-928(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-936(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-944(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-952(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-960(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-968(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1056(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1040(t0)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,3801
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1064(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1032(t0)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,3789
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1072(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1032(t0)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,3777
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1080(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1088(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1144(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,46414
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+sd t0,8(sp)
+jal ra,42888
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1152(t0)
+jal zero,-31
+jal ra,-195
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,41839
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1520(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3357
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1528(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1528(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1488(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-1632
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1528(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1496(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-1640
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1528(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1504(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-1648
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1528(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1512(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-1656
+add t1,gp,t1
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1528(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1520(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+addi t1,t1,-1664
+add t1,gp,t1
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-1672(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-1680(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,51099
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1696(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,8
+addi t1,zero,8
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1368(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6677
+ld t0,-40(gp)
+addi t1,zero,64
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,-40(gp)
+addi t1,zero,32
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,zero,0
+sd t0,-24(gp)
+addi t0,zero,0
+sd t0,-32(gp)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1368(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6699
+jal ra,19766
+addi t0,a0,0
+beq t0,zero,71
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,10775
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,535
+addi t0,a0,0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1728(t1)
+sd t1,-1744(t0)
+jal zero,47
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-200(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-6729
+ld t0,-200(gp)
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1712(t1)
+sd t1,-1744(t0)
+jal zero,23
+ld t0,-200(gp)
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1592(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1720(t1)
+sd t1,-1744(t0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1728(t1)
+sd t1,-1744(t0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1704(t1)
+sd t1,-1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1720(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-232(gp)
+sd t0,-248(gp)
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1728(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-240(gp)
+sd t0,-248(gp)
+jal zero,3
+ld t0,-224(gp)
+sd t0,-248(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+beq t0,zero,45
+ld t0,-24(gp)
+beq t0,zero,36
+addi t0,zero,8
+sd t0,-104(gp)
+addi t0,zero,8
+sd t0,-112(gp)
+ld t0,-64(gp)
+sd t0,-120(gp)
+ld t0,-80(gp)
+sd t0,-128(gp)
+addi t0,zero,8
+sd t0,-136(gp)
+ld t0,-136(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-144(gp)
+addi t0,zero,20
+sd t0,-848(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+sd t1,1584(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,64
+sd t1,1504(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,64
+sd t1,1480(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,56
+sd t1,1472(t0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1368(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6862
+jal zero,60
+ld t0,-24(gp)
+beq t0,zero,24
+ld t0,-88(gp)
+sd t0,-104(gp)
+ld t0,-88(gp)
+sd t0,-112(gp)
+ld t0,-96(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,90
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-120(gp)
+ld t0,-96(gp)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,80
+addi t0,a0,0
+sd t0,-128(gp)
+ld t0,-88(gp)
+sd t0,-136(gp)
+jal zero,11
+addi t0,zero,8
+sd t0,-104(gp)
+addi t0,zero,8
+sd t0,-112(gp)
+ld t0,-64(gp)
+sd t0,-120(gp)
+ld t0,-80(gp)
+sd t0,-128(gp)
+addi t0,zero,8
+sd t0,-136(gp)
+ld t0,-136(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,-144(gp)
+addi t0,zero,10
+sd t0,-848(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sd t1,1584(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,52
+sd t1,1504(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,52
+sd t1,1480(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,32
+sd t1,1472(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-978
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,39836
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-792(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-1696(t0)
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-760(t1)
+sd t1,-784(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-56(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+ld t0,16(s0)
+addi t1,zero,2
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,18
+jal zero,16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-71
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,14
+jal zero,12
+ld t0,16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20
+addi t0,a0,0
+addi t1,zero,10
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,10
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+ld t0,16(s0)
+addi t1,zero,10
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-158
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-182
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+ld t1,-40(gp)
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-38
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-216
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,12
+jal zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-58
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,39
+addi t0,a0,0
+beq t0,zero,6
+ld t0,16(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t1,t0
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-80(gp)
+add t0,t0,t1
+ld t1,24(s0)
+ld t2,-80(gp)
+add t1,t1,t2
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-80(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,40
+ld t0,24(s0)
+ld t1,-80(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,115
+jal zero,29
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-46
+addi t0,a0,0
+beq t0,zero,15
+ld t0,-80(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-104
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,93
+jal zero,7
+ld t0,-80(gp)
+ld t1,24(s0)
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,86
+jal zero,84
+ld t0,24(s0)
+ld t1,-80(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,76
+jal zero,74
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-85
+addi t0,a0,0
+beq t0,zero,38
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-93
+addi t0,a0,0
+beq t0,zero,19
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-148
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-155
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,42
+jal zero,11
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-166
+addi t0,a0,0
+ld t1,24(s0)
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,31
+jal zero,29
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-130
+addi t0,a0,0
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-188
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,8
+jal zero,6
+ld t0,16(s0)
+ld t1,24(s0)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-460
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,27
+jal zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-478
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t1,zero,t1
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-513
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,24
+jal zero,22
+ld t0,24(s0)
+ld t1,-40(gp)
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-533
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-367
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+addi t1,zero,8
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-403
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+addi t1,zero,8
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-67
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-502
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+sub t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-522
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,97
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,16(s0)
+addi t1,zero,122
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,16(s0)
+addi t1,zero,65
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,16(s0)
+addi t1,zero,90
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,48
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,15
+ld t0,16(s0)
+addi t1,zero,57
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2348
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-236
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-15
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-69
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-291
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-257
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-22
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-270
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-106
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,40
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-343
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-356
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-322
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-330
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,-42
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,64
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-398
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-410
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,38
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,34
+jal zero,31
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-430
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-439
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,3
+jal zero,-64
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-478
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,45
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+addi t0,zero,1
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-498
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,116
+ld t0,-24(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,9
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+addi t0,t0,-1792
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1681
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8070
+ld t0,-16(s0)
+ld t1,-64(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-16(s0)
+addi t1,zero,10
+mul t0,t0,t1
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,63
+ld t0,-16(s0)
+ld t1,-64(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+ld t0,-24(s0)
+ld t1,-64(gp)
+addi t2,zero,10
+remu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+ld t0,-16(s0)
+addi t1,zero,10
+mul t0,t0,t1
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,-1840
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1626
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8125
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,-1840
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1606
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8145
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-620
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,-119
+ld t0,-32(s0)
+beq t0,zero,32
+ld t0,-16(s0)
+ld t1,-80(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,6
+ld t0,-16(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,26
+jal zero,20
+lui t0,0xFFFFF
+addi t0,t0,-1840
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,1561
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8190
+jal zero,4
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,48
+sd t0,16(sp)
+jal ra,-653
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,22
+ld t0,40(s0)
+beq t0,zero,20
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-985
+addi t0,a0,0
+beq t0,zero,12
+ld t0,32(s0)
+addi t1,zero,10
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+sub t0,zero,t0
+sd t0,16(s0)
+addi t0,zero,1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,43
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi t1,zero,9
+sltu t0,t1,t0
+beq t0,zero,16
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi t1,zero,10
+sub t0,t0,t1
+addi t1,zero,65
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-702
+jal zero,13
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+ld t1,32(s0)
+remu t0,t0,t1
+addi t1,zero,48
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-715
+ld t0,16(s0)
+ld t1,32(s0)
+divu t0,t0,t1
+sd t0,16(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-46
+ld t0,32(s0)
+addi t1,zero,10
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,-16(s0)
+beq t0,zero,13
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,45
+sd t0,16(sp)
+jal ra,-740
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,32
+sd t0,16(sp)
+jal ra,-756
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-16
+jal zero,18
+ld t0,-8(s0)
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,48
+sd t0,16(sp)
+jal ra,-774
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-16
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-787
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-510
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1339
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+ld t1,16(s0)
+ld t2,24(s0)
+remu t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1354
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+mul t1,t1,t2
+ld t2,24(s0)
+divu t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,79
+jal zero,77
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t1,t0
+beq t0,zero,29
+ld t0,32(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi t1,zero,4
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1398
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-85
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,47
+jal zero,45
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+addi t0,zero,4
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1427
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-114
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1452
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1480
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1504
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+jal ra,-203
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-66
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+jal ra,-231
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-70
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+jal ra,-213
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-122
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+jal ra,-241
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-126
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1704(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1848
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,1040
+addi sp,sp,8
+addi t0,a0,0
+addi a0,t0,0
+jal zero,21
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-8703
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+sd t0,8(sp)
+jal ra,-1261
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-296(gp)
+beq t0,zero,14
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-304(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-1176
+ld t0,-304(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-304(gp)
+jal zero,52
+ld t0,-152(gp)
+beq t0,zero,44
+ld t0,-152(gp)
+ld t1,16(s0)
+sd t1,0(t0)
+ld t0,-288(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-152(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-89
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,27
+ld t0,-288(gp)
+ld t1,-208(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,-208(gp)
+sd t0,-288(gp)
+lui t0,0xFFFFF
+addi t0,t0,-1904
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-280(gp)
+sd t0,16(sp)
+jal ra,954
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8797
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8804
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1912
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17
+jal zero,29
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1301
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1312
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-117
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-25
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1920
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,871
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1936
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,849
+jal zero,49
+ld t0,16(s0)
+ld t1,-360(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1952
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,836
+jal zero,36
+ld t0,16(s0)
+ld t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1968
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,823
+jal zero,23
+ld t0,16(s0)
+ld t1,-376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+addi t0,t0,-1992
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,810
+jal zero,10
+lui t0,0xFFFFF
+addi t0,t0,-2000
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,801
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-2008
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,782
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-160(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-783
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-179
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-160(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-809
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-205
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1950
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+sltu t0,t1,t0
+beq t0,zero,10
+addi t0,zero,48
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-308
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,24(s0)
+jal zero,-12
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-160(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-857
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-253
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-160(gp)
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-884
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1332
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,10
+ld t0,-352(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-366
+ld t0,16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,16(s0)
+jal zero,-12
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-160(gp)
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-925
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-321
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-2016
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,597
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-42
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-160(gp)
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-973
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-369
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-2024
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,549
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-42
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-160(gp)
+sd t0,8(sp)
+addi t0,zero,2
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-1021
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-417
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-2032
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,501
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-42
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1731
+addi t0,a0,0
+addi t1,zero,115
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-466
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,303
+jal zero,298
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1753
+addi t0,a0,0
+addi t1,zero,99
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-564
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,281
+jal zero,276
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1775
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,101
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1789
+addi t0,a0,0
+addi t1,zero,117
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-365
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,245
+jal zero,76
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1813
+addi t0,a0,0
+addi t1,zero,100
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-363
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,221
+jal zero,52
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1837
+addi t0,a0,0
+addi t1,zero,88
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-273
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,195
+jal zero,26
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1863
+addi t0,a0,0
+addi t1,zero,111
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-251
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,169
+jal zero,164
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1887
+addi t0,a0,0
+addi t1,zero,98
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-227
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,145
+jal zero,140
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1911
+addi t0,a0,0
+addi t1,zero,46
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,59
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1925
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1762
+addi t0,a0,0
+beq t0,zero,42
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1941
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,3
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1955
+addi t0,a0,0
+addi t1,zero,117
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-483
+ld t0,24(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,75
+jal zero,70
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1981
+addi t0,a0,0
+addi t1,zero,48
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,58
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-1995
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1832
+addi t0,a0,0
+beq t0,zero,42
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-2011
+addi t0,a0,0
+addi t1,zero,108
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi t1,zero,3
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-2025
+addi t0,a0,0
+addi t1,zero,88
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,48
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-463
+ld t0,24(s0)
+addi t1,zero,4
+add t0,t0,t1
+addi a0,t0,0
+jal zero,5
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,132
+ld t0,24(s0)
+beq t0,zero,4
+ld t0,24(s0)
+sd t0,-296(gp)
+jal zero,3
+ld t0,-192(gp)
+sd t0,-296(gp)
+addi t0,zero,0
+sd t0,-304(gp)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2084
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,78
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2095
+addi t0,a0,0
+addi t1,zero,37
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2111
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,35
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2122
+addi t0,a0,0
+addi t1,zero,37
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,40(s0)
+ld a0,0(t0)
+addi t0,t0,8
+sd t0,40(s0)
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-419
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,9
+addi t0,zero,37
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-947
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,15
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-2157
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-962
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-87
+ld t0,-296(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-304(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2137
+ld t0,-304(gp)
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-304(gp)
+ld t0,24(s0)
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-296(gp)
+jal zero,16
+ld t0,-296(gp)
+sd t0,24(s0)
+addi t0,zero,0
+sd t0,-296(gp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-1053
+addi t0,a0,0
+addi a0,t0,0
+jal zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,24
+add t0,s0,t0
+sd t0,-8(s0)
+addi t0,zero,1
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-174
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,32
+add t0,s0,t0
+sd t0,-8(s0)
+addi t0,zero,0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-207
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,32
+add t0,s0,t0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-240
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-288(gp)
+ld t1,-208(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+addi t0,t0,-1848
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+jal ra,-117
+addi sp,sp,8
+addi t0,a0,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+ld t0,-288(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-168(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-9861
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,12
+jal zero,10
+ld t0,16(s0)
+ld t1,16(s0)
+ld t2,24(s0)
+remu t1,t1,t2
+sub t0,t0,t1
+ld t1,24(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-784(t0)
+beq t0,zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3796
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9904
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,31
+jal zero,29
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,22
+jal zero,20
+ld t0,-152(gp)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,2032
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-225
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1416(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9976
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-784(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-760(t1)
+sd t1,-784(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-87
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-784(t0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-147
+addi t0,a0,0
+addi t1,zero,8
+divu t0,t0,t1
+sd t0,24(s0)
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-15
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-187
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-161
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-65
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-784(t0)
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3975
+addi t0,a0,0
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10084
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1704(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,2016
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1220
+jal zero,10
+ld t0,-832(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1230
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1984
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,-968(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+jal ra,-462
+addi sp,sp,32
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1968
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+sd t0,8(sp)
+jal ra,-39
+lui t0,0xFFFFE
+addi t0,t0,1960
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-489
+addi sp,sp,8
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1968
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+sd t0,8(sp)
+jal ra,-70
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1381
+lui t0,0xFFFFE
+addi t0,t0,1944
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-522
+ld t0,-864(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1391
+lui t0,0xFFFFE
+addi t0,t0,1936
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-532
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-976(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-152(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-10295
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,-152(gp)
+ld t0,0(t0)
+sd t0,-864(gp)
+ld t0,-872(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-872(gp)
+jal zero,29
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-344(gp)
+sd t0,-864(gp)
+jal zero,20
+lui t0,0xFFFFE
+addi t0,t0,1880
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-968(gp)
+sd t0,16(sp)
+jal ra,-592
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10343
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-864(gp)
+ld t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-864(gp)
+ld t1,-376(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-864(gp)
+ld t1,-384(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,17
+jal zero,15
+ld t0,-864(gp)
+ld t1,-360(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,7
+jal zero,5
+jal ra,-59
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+addi t0,zero,1
+beq t0,zero,156
+ld t0,-8(s0)
+beq t0,zero,23
+jal ra,-83
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-8(s0)
+jal zero,16
+ld t0,-864(gp)
+ld t1,-344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-864(gp)
+addi a0,t0,0
+jal zero,140
+jal zero,6
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal ra,-167
+jal zero,131
+ld t0,-16(s0)
+beq t0,zero,58
+ld t0,-864(gp)
+ld t1,-480(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal ra,-181
+ld t0,-864(gp)
+ld t1,-488(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+sd t0,-16(s0)
+jal zero,-19
+ld t0,-16(s0)
+beq t0,zero,30
+ld t0,-864(gp)
+ld t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-880(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-880(gp)
+jal zero,19
+ld t0,-864(gp)
+ld t1,-344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1848
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-288
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10507
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal ra,-226
+jal zero,72
+jal ra,-130
+addi t0,a0,0
+beq t0,zero,17
+ld t0,-864(gp)
+ld t1,-368(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-880(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-880(gp)
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal ra,-245
+jal zero,53
+ld t0,-864(gp)
+ld t1,-488(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+jal ra,-253
+ld t0,-864(gp)
+ld t1,-488(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-888(gp)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,-888(gp)
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-270
+jal zero,24
+ld t0,-864(gp)
+ld t1,-480(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+addi t0,zero,1
+sd t0,-16(s0)
+ld t0,-888(gp)
+addi t1,zero,2
+add t0,t0,t1
+sd t0,-888(gp)
+ld t0,-896(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-896(gp)
+jal ra,-288
+jal zero,6
+ld t0,-720(gp)
+sd t0,-960(gp)
+ld t0,-864(gp)
+addi a0,t0,0
+jal zero,7
+jal zero,4
+ld t0,-864(gp)
+addi a0,t0,0
+jal zero,3
+jal zero,-156
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-864(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2951
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-864(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2907
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-864(gp)
+ld t1,-392(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-864(gp)
+ld t1,-408(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,23
+jal zero,21
+jal ra,-302
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-864(gp)
+ld t1,-344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-920(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-832(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-2775
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-592(gp)
+addi a0,t0,0
+jal zero,106
+jal zero,104
+ld t0,-600(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-600(gp)
+addi a0,t0,0
+jal zero,96
+jal zero,94
+ld t0,-608(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-53
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-608(gp)
+addi a0,t0,0
+jal zero,86
+jal zero,84
+ld t0,-616(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-63
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-616(gp)
+addi a0,t0,0
+jal zero,76
+jal zero,74
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-73
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-624(gp)
+addi a0,t0,0
+jal zero,66
+jal zero,64
+ld t0,-632(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-83
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-632(gp)
+addi a0,t0,0
+jal zero,56
+jal zero,54
+ld t0,-640(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-93
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-640(gp)
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,-800(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-103
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-592(gp)
+addi a0,t0,0
+jal zero,36
+jal zero,34
+ld t0,-808(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-113
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-592(gp)
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-816(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-123
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-592(gp)
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-824(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-133
+addi t0,a0,0
+beq t0,zero,5
+ld t0,-592(gp)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-584(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-552(gp)
+sd t0,-960(gp)
+addi t0,zero,0
+sd t0,-920(gp)
+addi t0,zero,0
+sd t0,-928(gp)
+addi t0,zero,0
+sd t0,-944(gp)
+addi t0,zero,0
+sd t0,-936(gp)
+jal ra,-424
+addi t0,a0,0
+ld t1,-344(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,586
+ld t0,-960(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,577
+ld t0,-864(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3207
+addi t0,a0,0
+beq t0,zero,56
+ld t0,-840(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3125
+addi t0,a0,0
+sd t0,-920(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+jal ra,-275
+addi t0,a0,0
+beq t0,zero,33
+ld t0,-8(s0)
+ld t1,-840(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1824
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-669
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10888
+ld t0,-920(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-864(gp)
+sd t0,16(sp)
+jal ra,-3324
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal ra,-615
+jal zero,-34
+ld t0,-920(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3338
+jal ra,-208
+addi t0,a0,0
+sd t0,-960(gp)
+jal zero,516
+ld t0,-864(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3214
+addi t0,a0,0
+beq t0,zero,118
+ld t0,-864(gp)
+addi t1,zero,48
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-641
+addi t0,zero,0
+sd t0,-944(gp)
+jal zero,105
+ld t0,-848(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3196
+addi t0,a0,0
+sd t0,-928(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-864(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3238
+addi t0,a0,0
+beq t0,zero,42
+ld t0,-8(s0)
+ld t1,-848(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,22
+ld t0,-952(gp)
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,1792
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-745
+jal zero,7
+lui t0,0xFFFFE
+addi t0,t0,1760
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-752
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10971
+ld t0,-928(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-864(gp)
+sd t0,16(sp)
+jal ra,-3407
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal ra,-698
+jal zero,-46
+ld t0,-928(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3421
+ld t0,-928(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2999
+addi t0,a0,0
+sd t0,-944(gp)
+ld t0,-952(gp)
+beq t0,zero,18
+ld t0,-944(gp)
+ld t1,-128(gp)
+sltu t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1720
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-798
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11017
+jal zero,17
+ld t0,-944(gp)
+ld t1,-120(gp)
+sltu t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1680
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-815
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11034
+ld t0,-560(gp)
+sd t0,-960(gp)
+jal zero,393
+ld t0,-864(gp)
+ld t1,-400(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,56
+jal ra,-758
+ld t0,-864(gp)
+ld t1,-344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,1624
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-843
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11062
+jal zero,3
+ld t0,-864(gp)
+sd t0,-944(gp)
+jal ra,-780
+ld t0,-864(gp)
+ld t1,-400(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-787
+jal zero,22
+ld t0,-864(gp)
+ld t1,-344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,-400(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-840
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11090
+jal zero,5
+ld t0,-400(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-851
+ld t0,-568(gp)
+sd t0,-960(gp)
+jal zero,332
+ld t0,-864(gp)
+ld t1,-408(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,81
+jal ra,-819
+ld t0,-856(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3371
+addi t0,a0,0
+sd t0,-936(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+jal ra,-477
+addi t0,a0,0
+beq t0,zero,40
+ld t0,-8(s0)
+ld t1,-856(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,1608
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-915
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11134
+ld t0,-864(gp)
+ld t1,-536(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,299
+ld t0,-936(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-864(gp)
+sd t0,16(sp)
+jal ra,-3577
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal ra,-868
+jal zero,-41
+ld t0,-864(gp)
+ld t1,-408(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-876
+jal zero,11
+ld t0,-408(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-923
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11173
+ld t0,-936(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3609
+ld t0,-576(gp)
+sd t0,-960(gp)
+jal zero,246
+ld t0,-864(gp)
+ld t1,-416(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-905
+ld t0,-648(gp)
+sd t0,-960(gp)
+jal zero,236
+ld t0,-864(gp)
+ld t1,-424(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-915
+ld t0,-656(gp)
+sd t0,-960(gp)
+jal zero,226
+ld t0,-864(gp)
+ld t1,-432(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-925
+ld t0,-664(gp)
+sd t0,-960(gp)
+jal zero,216
+ld t0,-864(gp)
+ld t1,-440(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-935
+ld t0,-672(gp)
+sd t0,-960(gp)
+jal zero,206
+ld t0,-864(gp)
+ld t1,-448(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-945
+ld t0,-680(gp)
+sd t0,-960(gp)
+jal zero,196
+ld t0,-864(gp)
+ld t1,-456(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-955
+ld t0,-688(gp)
+sd t0,-960(gp)
+jal zero,186
+ld t0,-864(gp)
+ld t1,-464(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-965
+ld t0,-696(gp)
+sd t0,-960(gp)
+jal zero,176
+ld t0,-864(gp)
+ld t1,-472(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-975
+ld t0,-704(gp)
+sd t0,-960(gp)
+jal zero,166
+ld t0,-864(gp)
+ld t1,-480(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-985
+ld t0,-712(gp)
+sd t0,-960(gp)
+jal zero,156
+ld t0,-864(gp)
+ld t1,-496(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-995
+ld t0,-728(gp)
+sd t0,-960(gp)
+jal zero,146
+ld t0,-864(gp)
+ld t1,-504(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1005
+ld t0,-864(gp)
+ld t1,-504(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1012
+ld t0,-744(gp)
+sd t0,-960(gp)
+jal zero,3
+ld t0,-736(gp)
+sd t0,-960(gp)
+jal zero,126
+ld t0,-864(gp)
+ld t1,-512(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-1025
+ld t0,-864(gp)
+ld t1,-504(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1032
+jal zero,5
+ld t0,-504(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1079
+ld t0,-752(gp)
+sd t0,-960(gp)
+jal zero,104
+ld t0,-864(gp)
+ld t1,-520(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1047
+ld t0,-864(gp)
+ld t1,-504(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1054
+ld t0,-768(gp)
+sd t0,-960(gp)
+jal zero,3
+ld t0,-760(gp)
+sd t0,-960(gp)
+jal zero,84
+ld t0,-864(gp)
+ld t1,-528(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1067
+ld t0,-864(gp)
+ld t1,-504(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1074
+ld t0,-784(gp)
+sd t0,-960(gp)
+jal zero,3
+ld t0,-776(gp)
+sd t0,-960(gp)
+jal zero,64
+ld t0,-864(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+jal ra,-1087
+ld t0,-864(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-1094
+ld t0,-864(gp)
+ld t1,-544(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-1101
+jal zero,5
+ld t0,-544(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1148
+jal zero,5
+ld t0,-544(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1153
+ld t0,-792(gp)
+sd t0,-960(gp)
+jal zero,30
+lui t0,0xFFFFE
+addi t0,t0,1968
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+sd t0,8(sp)
+jal ra,-1222
+lui t0,0xFFFFE
+addi t0,t0,1576
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1670
+ld t0,-864(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2539
+jal ra,-2556
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11429
+ld t0,-904(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-904(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-888(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-888(gp)
+jal ra,-1163
+ld t0,-864(gp)
+addi t1,zero,110
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-368(gp)
+sd t0,-864(gp)
+jal zero,67
+ld t0,-864(gp)
+addi t1,zero,116
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-360(gp)
+sd t0,-864(gp)
+jal zero,58
+ld t0,-864(gp)
+addi t1,zero,98
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-352(gp)
+sd t0,-864(gp)
+jal zero,49
+ld t0,-864(gp)
+ld t1,-400(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-400(gp)
+sd t0,-864(gp)
+jal zero,40
+ld t0,-864(gp)
+ld t1,-408(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-408(gp)
+sd t0,-864(gp)
+jal zero,31
+ld t0,-864(gp)
+ld t1,-496(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-496(gp)
+sd t0,-864(gp)
+jal zero,22
+ld t0,-864(gp)
+ld t1,-536(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-536(gp)
+sd t0,-864(gp)
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,1544
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1305
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1384(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11524
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+ld t1,16(s0)
+ld t1,0(t1)
+ld t2,16(s0)
+ld t2,0(t2)
+ld t3,16(s0)
+ld t3,0(t3)
+ld t4,16(s0)
+ld t4,0(t4)
+ld t5,16(s0)
+ld t5,0(t5)
+ld t6,-1376(gp)
+divu t5,t5,t6
+add t4,t4,t5
+ld t5,-1376(gp)
+divu t4,t4,t5
+add t3,t3,t4
+ld t4,-1376(gp)
+divu t3,t3,t4
+add t2,t2,t3
+ld t3,-1376(gp)
+divu t2,t2,t3
+add t1,t1,t2
+ld t2,-1376(gp)
+divu t1,t1,t2
+add t0,t0,t1
+ld t1,-1376(gp)
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+jal ra,-11054
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-10877
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-10866
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-10855
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,48(s0)
+sd t0,8(sp)
+jal ra,-10844
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,56(s0)
+sd t0,8(sp)
+jal ra,-10833
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,64(s0)
+sd t0,8(sp)
+jal ra,-10822
+ld t0,16(s0)
+ld t1,-1360(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1592(gp)
+sd t0,8(sp)
+jal ra,-10817
+ld t0,-1384(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-105
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-10953
+ld t0,-16(s0)
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,15
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1632(gp)
+sd t0,8(sp)
+jal ra,-10848
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1392(gp)
+sd t0,8(sp)
+jal ra,-10969
+ld t0,-8(s0)
+sd t0,-1392(gp)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,64
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1400(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1400(gp)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,41
+ld t0,-1408(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1408(gp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11101
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11153
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-3801
+addi t0,a0,0
+beq t0,zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11180
+addi t0,a0,0
+sd t0,16(s0)
+jal zero,-44
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1384(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-222
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-88
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1392(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-1288(gp)
+sd t0,16(sp)
+jal ra,-110
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1288(gp)
+sd t0,8(sp)
+jal ra,-80
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11241
+addi t0,a0,0
+ld t1,-1312(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,43
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11196
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11210
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8863
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6876
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1952(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-1376(gp)
+sltu t0,t0,t1
+beq t0,zero,62
+ld t0,-1384(gp)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,45
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-93
+addi t0,a0,0
+beq t0,zero,32
+addi t0,zero,1
+sd t0,-8(s0)
+lui t0,0xFFFFE
+addi t0,t0,1968
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11358
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1757
+lui t0,0xFFFFE
+addi t0,t0,1520
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11389
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2211
+addi sp,sp,8
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11416
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,-48
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-64
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1416(gp)
+ld t1,-1560(gp)
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-1416(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1416(gp)
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,1496
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1789
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12008
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1416(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,19
+ld t0,-1416(gp)
+addi t1,zero,4
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,-1600(gp)
+ld t1,-1416(gp)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,23
+jal zero,8
+ld t0,-1784(gp)
+ld t1,-1416(gp)
+add t0,t0,t1
+addi t1,zero,3
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,1472
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1833
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12052
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1416(gp)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,18
+ld t0,-1416(gp)
+addi t1,zero,4
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1624(gp)
+addi a0,t0,0
+jal zero,22
+jal zero,7
+jal ra,-64
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,1472
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1877
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12096
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1416(gp)
+ld t1,-1560(gp)
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,-1416(gp)
+addi t1,zero,3
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1792(gp)
+addi a0,t0,0
+jal zero,22
+jal zero,7
+jal ra,-108
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,15
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,1496
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1921
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12140
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1416(gp)
+ld t1,16(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,6
+ld t0,-1416(gp)
+ld t1,16(s0)
+sub t0,t0,t1
+sd t0,-1416(gp)
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,1440
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1955
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12174
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-960(gp)
+ld t1,-592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-960(gp)
+ld t1,-560(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-960(gp)
+ld t1,-568(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,162
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-960(gp)
+ld t1,-744(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,56
+jal zero,54
+ld t0,-960(gp)
+ld t1,-752(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,-960(gp)
+ld t1,-760(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,36
+jal zero,34
+ld t0,-960(gp)
+ld t1,-776(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-960(gp)
+ld t1,-768(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-960(gp)
+ld t1,-784(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-960(gp)
+ld t1,-696(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-960(gp)
+ld t1,-704(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-960(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-960(gp)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-960(gp)
+ld t1,-728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-960(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,53
+jal zero,51
+ld t0,-960(gp)
+ld t1,-704(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,43
+jal zero,41
+ld t0,-960(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,33
+jal zero,31
+ld t0,-960(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,23
+jal zero,21
+jal ra,26
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-960(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-277
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-960(gp)
+ld t1,-576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-960(gp)
+ld t1,-688(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-960(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-960(gp)
+ld t1,-648(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-389
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-960(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-960(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-960(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,56
+jal zero,54
+ld t0,-960(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,-960(gp)
+ld t1,-600(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,36
+jal zero,34
+ld t0,-960(gp)
+ld t1,-632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,-960(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-960(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-285
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,-960(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1968
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+sd t0,8(sp)
+jal ra,-2536
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2572
+lui t0,0xFFFFE
+addi t0,t0,1944
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2988
+ld t0,-960(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2582
+lui t0,0xFFFFE
+addi t0,t0,1936
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2998
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1968
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+sd t0,8(sp)
+jal ra,-2578
+lui t0,0xFFFFE
+addi t0,t0,1416
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3026
+ld t0,-960(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2620
+lui t0,0xFFFFE
+addi t0,t0,1936
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3036
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-960(gp)
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-1974
+addi t0,zero,1
+addi a0,t0,0
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-98
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1392(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12838
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1968
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+sd t0,8(sp)
+jal ra,-2670
+lui t0,0xFFFFE
+addi t0,t0,1400
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-3120
+addi sp,sp,8
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1968
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+sd t0,8(sp)
+jal ra,-2701
+lui t0,0xFFFFE
+addi t0,t0,1368
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-920(gp)
+sd t0,16(sp)
+jal ra,-3153
+addi sp,sp,16
+ld t0,-912(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-912(gp)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1328(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,zero,-1040
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3179
+jal zero,45
+ld t0,16(s0)
+ld t1,-1336(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,1352
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3192
+jal zero,32
+ld t0,16(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,zero,-1064
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3204
+jal zero,20
+ld t0,16(s0)
+ld t1,-1352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,1336
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3217
+jal zero,7
+lui t0,0xFFFFE
+addi t0,t0,1328
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3224
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,1320
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+sd t0,8(sp)
+jal ra,-2800
+lui t0,0xFFFFE
+addi t0,t0,1304
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3248
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-88
+lui t0,0xFFFFE
+addi t0,t0,1944
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3258
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-98
+lui t0,0xFFFFE
+addi t0,t0,1936
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3268
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,-960(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,147
+jal ra,-465
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-280
+ld t0,-960(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1392(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13044
+jal zero,2
+jal ra,-2219
+jal zero,-18
+jal ra,-868
+addi t0,a0,0
+beq t0,zero,83
+jal ra,267
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-960(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,69
+ld t0,-920(gp)
+sd t0,-16(s0)
+jal ra,-2235
+ld t0,-960(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,54
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,106
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,276
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-12310
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12452
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12440
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-12522
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,8684
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1256(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1256(t0)
+ld t0,-656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-329
+jal zero,7
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2661
+jal zero,5
+ld t0,-584(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-421
+jal zero,42
+ld t0,-960(gp)
+ld t1,-616(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+jal ra,-2312
+ld t0,-960(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-2319
+ld t0,-1336(gp)
+sd t0,-8(s0)
+jal zero,3
+ld t0,-1344(gp)
+sd t0,-8(s0)
+ld t0,-960(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,-920(gp)
+sd t0,-16(s0)
+jal ra,-2333
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2621
+jal zero,5
+ld t0,-584(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-461
+jal zero,2
+jal ra,-421
+jal zero,-150
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,67
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1288(gp)
+sd t0,8(sp)
+jal ra,-1456
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+ld t2,-136(gp)
+add t1,t1,t2
+sd t1,1176(t0)
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-880(gp)
+sd t0,16(sp)
+ld t0,-1288(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-1660
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-1448(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1448(gp)
+jal zero,18
+lui t0,0xFFFFE
+addi t0,t0,1320
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+sd t0,8(sp)
+jal ra,-3061
+lui t0,0xFFFFE
+addi t0,t0,1256
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-3511
+addi sp,sp,8
+jal zero,51
+ld t0,-960(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-920(gp)
+sd t0,8(sp)
+ld t0,-880(gp)
+sd t0,16(sp)
+ld t0,-1288(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+ld t0,32(s0)
+sd t0,48(sp)
+jal ra,-1707
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-2455
+jal zero,25
+ld t0,-584(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-577
+ld t0,-1368(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1248
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-880(gp)
+sd t0,16(sp)
+ld t0,-1288(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+ld t0,32(s0)
+sd t0,48(sp)
+jal ra,-1733
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-1328(gp)
+sd t0,-8(s0)
+jal ra,-1146
+addi t0,a0,0
+beq t0,zero,18
+jal ra,-2502
+jal ra,-1150
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-2506
+jal zero,-4
+ld t0,-960(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1336(gp)
+sd t0,-8(s0)
+jal ra,-2516
+jal zero,-9
+jal zero,5
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-639
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-960(gp)
+ld t1,-736(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+jal ra,-2545
+ld t0,-960(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-2552
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,48
+jal zero,12
+ld t0,16(s0)
+ld t1,-1328(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1328(gp)
+sd t0,8(sp)
+jal ra,-421
+ld t0,-960(gp)
+ld t1,-704(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sd t0,-952(gp)
+jal ra,-2577
+jal ra,65
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-952(gp)
+beq t0,zero,8
+addi t0,zero,0
+sd t0,-952(gp)
+ld t0,-8(s0)
+sub t0,zero,t0
+addi a0,t0,0
+jal zero,10
+jal zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-119
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+ld t1,-1352(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,16(s0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-481
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-669
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-1278
+addi t0,a0,0
+beq t0,zero,8
+ld t0,-944(gp)
+sd t0,-8(s0)
+jal ra,-2654
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,7
+jal zero,5
+jal ra,-734
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-898
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-754
+ld t0,-960(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1392(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13518
+jal zero,2
+jal ra,-2693
+jal zero,-18
+ld t0,-960(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,357
+ld t0,-656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-745
+jal zero,56
+ld t0,-960(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+ld t0,-920(gp)
+sd t0,-8(s0)
+jal ra,-2718
+ld t0,-960(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,334
+jal zero,5
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2945
+ld t0,-656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-773
+jal zero,28
+ld t0,-960(gp)
+ld t1,-600(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,1636
+jal zero,20
+ld t0,-960(gp)
+ld t1,-632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,1768
+jal zero,12
+ld t0,-960(gp)
+ld t1,-624(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,3129
+ld t0,-656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-801
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,12
+sd t0,16(sp)
+jal ra,-6453
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,20
+sd t0,16(sp)
+jal ra,-6463
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,11
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6667
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,40
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-6187
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,7360
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,19
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6697
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,7450
+jal zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-6222
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,7325
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-6231
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13056
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-6312
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+jal ra,-1746
+jal ra,-1716
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-138
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-1725
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13069
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1735
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7331
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-67
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13123
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+jal ra,-1806
+jal ra,-1776
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13120
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,7533
+jal zero,11
+jal ra,-1790
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-1794
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,7522
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13197
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2039
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1005
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1392(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13855
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-115
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,44
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-76
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13233
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-211
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13267
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+jal ra,-1918
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13318
+addi t0,a0,0
+sd t0,-40(s0)
+jal zero,56
+ld t0,-712(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1127
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-960(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,-920(gp)
+sd t0,16(s0)
+jal ra,-3129
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-94
+addi t0,a0,0
+sd t0,-40(s0)
+jal zero,29
+ld t0,-960(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-3143
+jal ra,115
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1187
+jal zero,14
+jal ra,-1227
+jal ra,-1997
+jal ra,-1967
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,7056
+ld t0,-1336(gp)
+sd t0,-40(s0)
+jal ra,-1978
+addi t0,a0,0
+sd t0,-24(s0)
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-960(gp)
+ld t1,-736(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,50
+jal ra,-3176
+ld t0,-8(s0)
+beq t0,zero,15
+ld t0,-40(s0)
+ld t1,-1336(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-1336(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+sd t0,8(sp)
+jal ra,-1042
+jal zero,3
+ld t0,-1328(gp)
+sd t0,-40(s0)
+jal ra,66
+addi t0,a0,0
+sd t0,-48(s0)
+ld t0,-40(s0)
+ld t1,-48(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-48(s0)
+sd t0,8(sp)
+jal ra,-1059
+ld t0,-24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+jal ra,-2025
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7354
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1899
+ld t0,-1472(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1472(gp)
+jal zero,5
+ld t0,-736(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1345
+ld t0,-8(s0)
+beq t0,zero,6
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1914
+jal zero,18
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-13411
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1932
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,236
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-1848
+addi t0,a0,0
+beq t0,zero,221
+ld t0,-960(gp)
+sd t0,-16(s0)
+jal ra,-3273
+jal ra,227
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-1140
+ld t0,-1328(gp)
+sd t0,-8(s0)
+ld t0,-16(s0)
+ld t1,-744(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+jal ra,-2064
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2113
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2071
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6992
+jal ra,-2120
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,6903
+jal ra,-2084
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2088
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2136
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7140
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2010
+jal zero,160
+ld t0,-16(s0)
+ld t1,-752(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+jal ra,-2106
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2155
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2113
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6950
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2032
+jal ra,-2166
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+jal ra,-2172
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7104
+jal zero,128
+ld t0,-16(s0)
+ld t1,-760(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-2138
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2142
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2190
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7086
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2064
+jal zero,106
+ld t0,-16(s0)
+ld t1,-776(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+jal ra,-2160
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2209
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2167
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7064
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2086
+jal zero,84
+ld t0,-16(s0)
+ld t1,-768(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,37
+jal ra,-2182
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2231
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2189
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7042
+jal ra,-2238
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,6785
+jal ra,-2202
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2251
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2209
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6854
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2128
+jal zero,42
+ld t0,-16(s0)
+ld t1,-784(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+jal ra,-2224
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2228
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2276
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,7000
+jal ra,-2280
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,6743
+jal ra,-2244
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2293
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2251
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6812
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2170
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,182
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-2016
+addi t0,a0,0
+beq t0,zero,167
+ld t0,-960(gp)
+sd t0,-16(s0)
+jal ra,-3515
+jal ra,173
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+ld t1,-696(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,55
+ld t0,-8(s0)
+ld t1,-1336(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-24(s0)
+ld t1,-1328(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-2350
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-104(gp)
+sd t0,8(sp)
+jal ra,2760
+jal zero,7
+lui t0,0xFFFFE
+addi t0,t0,1208
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4164
+jal zero,16
+ld t0,-24(s0)
+ld t1,-1336(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-2326
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-104(gp)
+sd t0,8(sp)
+jal ra,2739
+ld t0,-1336(gp)
+sd t0,-8(s0)
+jal ra,-2335
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2339
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2387
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6679
+jal zero,96
+ld t0,-16(s0)
+ld t1,-704(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,90
+ld t0,-8(s0)
+ld t1,-1336(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,60
+ld t0,-24(s0)
+ld t1,-1328(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-2410
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-104(gp)
+sd t0,8(sp)
+jal ra,2700
+jal ra,-2372
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2376
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2424
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6684
+jal zero,34
+jal ra,-2384
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2388
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2436
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6672
+jal ra,-2440
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+ld t0,-104(gp)
+sd t0,16(sp)
+jal ra,6583
+jal ra,-2404
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2408
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2456
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6736
+ld t0,-1328(gp)
+sd t0,-8(s0)
+jal zero,25
+ld t0,-24(s0)
+ld t1,-1336(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFE
+addi t0,t0,1168
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4275
+jal zero,12
+jal ra,-2431
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2435
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2483
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6625
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2357
+jal zero,-168
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+jal ra,91
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-2170
+addi t0,a0,0
+beq t0,zero,76
+ld t0,-960(gp)
+sd t0,-16(s0)
+jal ra,-3703
+jal ra,82
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-1570
+ld t0,-16(s0)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-2492
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2496
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2544
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6606
+jal zero,36
+ld t0,-16(s0)
+ld t1,-720(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+jal ra,-2510
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2514
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2562
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6630
+jal zero,18
+ld t0,-16(s0)
+ld t1,-728(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-2528
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2532
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2580
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6654
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2454
+jal zero,-77
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+jal ra,-1940
+addi t0,a0,0
+beq t0,zero,17
+jal ra,-1870
+ld t0,-960(gp)
+ld t1,-552(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1392(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14634
+jal zero,2
+jal ra,-3809
+jal zero,-18
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-960(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+jal ra,-3819
+jal ra,-2467
+addi t0,a0,0
+beq t0,zero,8
+ld t0,-1352(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1222
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,11
+jal ra,-571
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1873
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,221
+ld t0,-960(gp)
+ld t1,-704(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+addi t0,zero,1
+sd t0,-24(s0)
+addi t0,zero,1
+sd t0,-952(gp)
+jal ra,-3850
+addi t0,zero,0
+sd t0,-952(gp)
+jal zero,3
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-960(gp)
+ld t1,-712(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+sd t0,-32(s0)
+jal ra,-3864
+jal zero,3
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-960(gp)
+ld t1,-640(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+jal ra,-3874
+ld t0,-664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1915
+jal ra,-1388
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1922
+jal ra,-2730
+ld t0,-16(s0)
+ld t1,-1328(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+jal ra,-2706
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+ld t0,-104(gp)
+sd t0,16(sp)
+jal ra,6317
+jal zero,10
+jal ra,-2716
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+ld t0,-112(gp)
+sd t0,16(sp)
+jal ra,6307
+ld t0,-1328(gp)
+sd t0,-16(s0)
+jal zero,83
+jal ra,-2272
+addi t0,a0,0
+beq t0,zero,5
+jal ra,419
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,76
+ld t0,-960(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+ld t0,-920(gp)
+sd t0,-40(s0)
+jal ra,-3930
+ld t0,-960(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-900
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,32
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1731
+addi t0,a0,0
+sd t0,-16(s0)
+jal ra,-2793
+ld t0,-16(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+jal ra,-2768
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1648(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6255
+jal zero,10
+jal ra,-2778
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6245
+jal zero,23
+ld t0,-960(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+jal ra,-3981
+jal ra,-723
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2025
+jal zero,8
+jal ra,-2065
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,193
+ld t0,-1328(gp)
+sd t0,-16(s0)
+ld t0,-32(s0)
+beq t0,zero,24
+ld t0,-16(s0)
+ld t1,-1336(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-1336(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-1862
+jal ra,-2823
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2827
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6489
+ld t0,-1328(gp)
+sd t0,-16(s0)
+ld t0,-24(s0)
+beq t0,zero,24
+ld t0,-16(s0)
+ld t1,-1328(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,-1328(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-1887
+ld t0,-1328(gp)
+sd t0,-16(s0)
+jal ra,-2850
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+jal ra,-2856
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6252
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-7493
+addi t0,a0,0
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,6132
+jal zero,17
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1322
+addi t0,a0,0
+sd t0,24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,6115
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-928(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1296(gp)
+sd t0,8(sp)
+jal ra,-3206
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,49
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+ld t2,-136(gp)
+add t1,t1,t2
+sd t1,1176(t0)
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-928(gp)
+sd t0,8(sp)
+ld t0,-880(gp)
+sd t0,16(sp)
+ld t0,-1296(gp)
+sd t0,24(sp)
+ld t0,-1328(gp)
+sd t0,32(sp)
+ld t0,16(s0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-3410
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sub t0,zero,t0
+sd t0,8(sp)
+ld t0,-880(gp)
+sd t0,16(sp)
+jal ra,6796
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1232(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1232(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1244
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-7614
+addi t0,a0,0
+beq t0,zero,10
+jal ra,-3044
+jal ra,-3014
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-141
+jal zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-103
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14395
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43
+jal ra,-3044
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14388
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-3054
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,6012
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-936(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1304(gp)
+sd t0,8(sp)
+jal ra,-3347
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-936(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7351
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-5233
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,1176(t0)
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-936(gp)
+sd t0,8(sp)
+ld t0,-880(gp)
+sd t0,16(sp)
+ld t0,-1304(gp)
+sd t0,24(sp)
+ld t0,-1336(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-3571
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6684
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-108
+ld t0,-1464(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1464(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-2971
+addi t0,a0,0
+beq t0,zero,10
+ld t0,-944(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-161
+jal ra,-1706
+ld t0,-1328(gp)
+addi a0,t0,0
+jal zero,23
+jal zero,21
+ld t0,-960(gp)
+ld t1,-576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-110
+jal ra,-4361
+ld t0,-1336(gp)
+addi a0,t0,0
+jal zero,11
+jal zero,9
+jal ra,-2441
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-183
+ld t0,-1328(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,-960(gp)
+ld t1,-600(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,115
+jal ra,-4392
+ld t0,-960(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,103
+jal ra,-4399
+jal ra,-1141
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,-8(s0)
+jal ra,-3218
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6217
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3097
+ld t0,-960(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,73
+jal ra,-4424
+ld t0,-960(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-4431
+jal ra,-2758
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-1765
+jal zero,-4
+ld t0,-688(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2449
+jal zero,2
+jal ra,-1772
+ld t0,-960(gp)
+ld t1,-608(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,43
+jal ra,-4449
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,-16(s0)
+ld t0,-1568(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,6209
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6315
+ld t0,-960(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-4470
+jal ra,-2797
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-1804
+jal zero,-4
+ld t0,-688(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2488
+jal zero,2
+jal ra,-1811
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,8(sp)
+jal ra,6345
+jal zero,5
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6284
+jal zero,5
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2616
+jal zero,5
+ld t0,-664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2621
+jal zero,5
+ld t0,-600(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2626
+ld t0,-1488(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1488(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-960(gp)
+ld t1,-632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,63
+jal ra,-4538
+ld t0,-960(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+jal ra,-4545
+jal ra,-1287
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,-16(s0)
+jal ra,-3364
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,6071
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3243
+ld t0,-960(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+jal ra,-4570
+ld t0,-960(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+jal ra,-4577
+jal ra,-2904
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-1911
+jal zero,-4
+ld t0,-688(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2595
+jal zero,2
+jal ra,-1918
+jal zero,5
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2710
+jal zero,5
+ld t0,-664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2715
+jal zero,5
+ld t0,-632(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2720
+ld t0,-1568(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,6055
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6156
+ld t0,-1480(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1480(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1144
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7554
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,1136
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7688
+addi t0,a0,0
+addi a0,t0,0
+jal zero,46
+jal zero,44
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1104
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7574
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7708
+addi t0,a0,0
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1064
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7594
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,1056
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7728
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1048
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7628
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,65
+jal zero,60
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1032
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7642
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,51
+jal zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+beq t0,zero,42
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1008
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7660
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,33
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,984
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7674
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,19
+jal zero,14
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,960
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-7688
+addi t0,a0,0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,5411
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-1576(gp)
+sd t0,16(sp)
+jal ra,5754
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,5394
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-1632(gp)
+sd t0,16(sp)
+jal ra,5737
+ld t0,-1632(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5378
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,32
+ld t0,16(s0)
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-8268
+addi t0,a0,0
+beq t0,zero,11
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,16(s0)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,5356
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,928
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5483
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15702
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,9
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1632(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5321
+ld t0,-1632(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5603
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,5305
+ld t0,-1576(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5587
+ld t0,-136(gp)
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-8346
+addi t0,a0,0
+beq t0,zero,12
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,5277
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,896
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5562
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15781
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+addi t0,zero,0
+sd t0,-1392(gp)
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-960(gp)
+ld t1,-664(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,104
+jal ra,-4978
+ld t0,-960(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,96
+jal ra,-3631
+addi t0,a0,0
+beq t0,zero,88
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2499
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2641
+addi t0,a0,0
+sd t0,-24(s0)
+addi t0,zero,1
+sd t0,-16(s0)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+ld t1,-136(gp)
+mul t0,t0,t1
+ld t1,-16(s0)
+addi t2,zero,1
+sub t1,t1,t2
+ld t2,-136(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-15046
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3309
+addi t0,a0,0
+beq t0,zero,50
+jal ra,-5020
+ld t0,-960(gp)
+ld t1,-792(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-5027
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,38
+jal ra,-3678
+addi t0,a0,0
+beq t0,zero,31
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2546
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2688
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+ld t1,-136(gp)
+mul t0,t0,t1
+ld t1,-16(s0)
+addi t2,zero,1
+sub t1,t1,t2
+ld t2,-136(gp)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-15095
+jal zero,5
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3184
+jal zero,-54
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3109
+jal zero,5
+ld t0,-592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3194
+jal zero,2
+jal ra,-5079
+jal zero,5
+ld t0,-664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3201
+ld t0,-8(s0)
+beq t0,zero,4
+ld t0,-16(s0)
+sub t0,zero,t0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-460
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1312(gp)
+sd t0,8(sp)
+jal ra,-4187
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-880(gp)
+sd t0,16(sp)
+ld t0,-1312(gp)
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+ld t0,-16(s0)
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-4380
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,17
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15339
+addi t0,a0,0
+ld t1,-1352(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-15211
+ld t0,-960(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15361
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15370
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-3022
+jal ra,-5170
+jal zero,216
+ld t0,-960(gp)
+ld t1,-680(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,209
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4174
+addi t0,a0,0
+beq t0,zero,78
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+sd t0,8(sp)
+jal ra,-15290
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15400
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15409
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-3061
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-15281
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15387
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15396
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,8(sp)
+jal ra,5641
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,8(sp)
+jal ra,-15276
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1520(gp)
+sd t0,8(sp)
+jal ra,-8158
+addi t0,a0,0
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-968(gp)
+sd t1,1224(t0)
+ld t0,-1456(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1456(gp)
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-557
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFE
+addi t0,t0,1320
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+sd t0,8(sp)
+jal ra,-5919
+lui t0,0xFFFFE
+addi t0,t0,856
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-6369
+addi sp,sp,8
+jal ra,-5288
+addi t0,zero,0
+sd t0,-32(s0)
+jal ra,-3938
+addi t0,a0,0
+beq t0,zero,20
+ld t0,-32(s0)
+ld t1,-136(gp)
+add t0,t0,t1
+sd t0,-32(s0)
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-2810
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-32(s0)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,-2953
+ld t0,-656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3348
+jal zero,-21
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-522
+ld t0,-24(s0)
+sd t0,-1424(gp)
+addi t0,zero,0
+sd t0,-1432(gp)
+ld t0,24(s0)
+sd t0,-1440(gp)
+jal ra,-3649
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-2656
+jal zero,-4
+addi t0,zero,0
+sd t0,-1440(gp)
+ld t0,24(s0)
+ld t1,-1344(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4876
+ld t0,-1432(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,8(sp)
+jal ra,5526
+addi t0,zero,0
+sd t0,-1432(gp)
+ld t0,-8(s0)
+beq t0,zero,11
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sub t0,zero,t0
+ld t1,-136(gp)
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-482
+jal zero,9
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,-136(gp)
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-491
+ld t0,-1568(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5320
+ld t0,-688(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3421
+jal zero,2
+jal ra,-3461
+addi t0,zero,0
+sd t0,-1424(gp)
+addi t0,zero,0
+sd t0,-1392(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-1416(gp)
+sd t0,-8(s0)
+ld t0,-1416(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,24
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,4801
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-4236
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,5143
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4110
+jal zero,-26
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1416(gp)
+ld t1,16(s0)
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,-4295
+jal ra,-4265
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,5048
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,4750
+jal zero,-22
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15748
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,840
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-8403
+addi t0,a0,0
+beq t0,zero,3
+jal ra,483
+jal zero,24
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,832
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-8415
+addi t0,a0,0
+beq t0,zero,3
+jal ra,588
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,824
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-8427
+addi t0,a0,0
+beq t0,zero,2
+jal ra,681
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15732
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3534
+ld t0,-1352(gp)
+sd t0,-8(s0)
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,-880(gp)
+sd t0,16(sp)
+ld t0,-1312(gp)
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+ld t0,32(s0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,48(sp)
+jal ra,-4826
+ld t0,-1576(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,5091
+jal zero,89
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15789
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15757
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,8(sp)
+jal ra,-15635
+ld t0,-1576(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,5060
+jal zero,58
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15782
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4291
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2304
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1952(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,-1576(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15805
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,5029
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-15684
+jal zero,15
+ld t0,-1576(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15828
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,5002
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+jal ra,-5683
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1320(gp)
+sd t0,8(sp)
+jal ra,-4775
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-225
+addi t0,a0,0
+addi a0,t0,0
+jal zero,180
+jal ra,-307
+addi t0,a0,0
+sd t0,-16(s0)
+jal ra,-4302
+addi t0,a0,0
+beq t0,zero,67
+jal ra,-2451
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,-24(s0)
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4496
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-4541
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4838
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4415
+addi t0,zero,1
+sd t0,-32(s0)
+ld t0,-960(gp)
+ld t1,-648(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,23
+jal ra,-5744
+jal ra,-2486
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-32(s0)
+ld t1,-136(gp)
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-4566
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4813
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4440
+ld t0,-32(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,-27
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+ld t1,-136(gp)
+mul t0,t0,t1
+sub t0,zero,t0
+sd t0,8(sp)
+jal ra,5138
+jal zero,3
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-960(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,82
+jal ra,-5784
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1312(gp)
+sd t0,8(sp)
+jal ra,-4876
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-32(s0)
+sd t0,16(sp)
+jal ra,-264
+addi t0,a0,0
+sd t0,-48(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,57
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15999
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-9395
+addi t0,a0,0
+beq t0,zero,32
+ld t0,-40(s0)
+sub t0,zero,t0
+sd t0,-40(s0)
+ld t0,-32(s0)
+ld t1,-40(s0)
+sltu t0,t1,t0
+beq t0,zero,14
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-32(s0)
+ld t1,-40(s0)
+sub t0,t0,t1
+ld t1,-136(gp)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,4378
+jal zero,11
+ld t0,-32(s0)
+ld t1,-40(s0)
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,784
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6465
+jal zero,12
+ld t0,-32(s0)
+ld t1,-40(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,728
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6477
+jal zero,7
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3985
+ld t0,-1328(gp)
+sd t0,-48(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-432
+ld t0,-1496(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1496(gp)
+ld t0,-48(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-624(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3935
+ld t0,-960(gp)
+ld t1,-656(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,34
+jal ra,-2645
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1440(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-1440(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-3770
+ld t0,-1440(gp)
+ld t1,-1344(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-4739
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4287
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4615
+jal zero,20
+ld t0,-1440(gp)
+ld t1,-1344(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,-1440(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1344(gp)
+sd t0,8(sp)
+jal ra,-3800
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4263
+ld t0,-1568(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1432(gp)
+sd t0,8(sp)
+jal ra,4707
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+sub t0,t0,t1
+sd t0,-1432(gp)
+ld t0,-1504(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-1504(gp)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-1424(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16179
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-9573
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,680
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6623
+ld t0,-960(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,72
+ld t0,-920(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5070
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,55
+jal ra,-6027
+ld t0,-960(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+jal ra,-6034
+addi t0,zero,2
+ld t1,-136(gp)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-1424(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16231
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-136(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1865
+jal ra,-4866
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1632(gp)
+sd t0,8(sp)
+jal ra,-4872
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4194
+ld t0,-1632(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16238
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-4885
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4494
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4759
+jal zero,6
+ld t0,-920(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4067
+jal ra,-6085
+jal zero,5
+ld t0,-584(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4207
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-960(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,80
+ld t0,-920(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5167
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,63
+jal ra,-6124
+ld t0,-960(gp)
+ld t1,-672(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+jal ra,-6131
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16304
+addi t0,a0,0
+sd t0,-16(s0)
+jal ra,-4982
+jal ra,-4952
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1632(gp)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,4361
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-4964
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,4352
+jal ra,-4970
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-4974
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,4052
+ld t0,-1632(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-4985
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4394
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4859
+jal zero,5
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4301
+jal zero,6
+ld t0,-920(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4172
+jal ra,-6190
+jal zero,5
+ld t0,-584(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4312
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1424(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16398
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-9792
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,632
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6842
+ld t0,-960(gp)
+ld t1,-584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,-6235
+ld t0,-672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4276
+jal zero,5
+ld t0,-584(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4361
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-5099
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,16(sp)
+jal ra,3953
+jal ra,-5079
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,3944
+jal ra,-5088
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-5094
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4140
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-5103
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4005
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4977
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-5032
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,3902
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-5046
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,4015
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,21
+sltu t0,t0,t1
+beq t0,zero,7
+jal ra,3820
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-9
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sd t1,1208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+ld t1,-136(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,3787
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,512(t0)
+sd t0,8(sp)
+jal ra,-7337
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1200(t0)
+jal ra,-5344
+addi t0,a0,0
+beq t0,zero,10
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3793
+jal zero,189
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,31
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10297
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,11
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10308
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+sub t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2269
+jal zero,13
+lui t0,0xFFFFE
+addi t0,t0,600
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7077
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17296
+ld t0,-1592(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-5286
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3740
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5162
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3728
+ld t0,-1704(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+sd t0,16(sp)
+jal ra,3718
+jal ra,4237
+ld t0,-1648(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-257
+ld t0,-1704(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+sd t0,16(sp)
+jal ra,3701
+jal ra,4220
+ld t0,-1528(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1288(gp)
+sd t0,8(sp)
+jal ra,-5610
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16680
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16706
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-1648(gp)
+sd t0,16(sp)
+jal ra,4027
+jal ra,-5387
+jal ra,-5357
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,3956
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,3657
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-5380
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,3999
+jal ra,-5384
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,2
+ld t1,-136(gp)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,3637
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-5400
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,3979
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5274
+ld t0,-1520(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1312(gp)
+sd t0,8(sp)
+jal ra,-5686
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1520(gp)
+sd t0,8(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16799
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-1078
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sub t0,zero,t0
+sd t0,16(sp)
+jal ra,3595
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-1648(gp)
+sd t0,16(sp)
+jal ra,3938
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1200(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,64(t3)
+divu t2,t2,t3
+sub t1,t1,t2
+sd t1,1360(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+sd t1,1200(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-216(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-17473
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+sd t0,8(sp)
+jal ra,-10040
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-24(s0)
+addi t0,zero,1
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+lui t0,0xFFFFE
+addi t0,t0,584
+add t0,gp,t0
+sd t0,-968(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-968(gp)
+sd t1,1224(t0)
+jal ra,-16303
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1672(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7447
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1664(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7461
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1192(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1672(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7481
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1168(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1664(t0)
+ld t1,-136(gp)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7499
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1160(t0)
+jal ra,-16772
+jal ra,-16329
+jal ra,-444
+jal ra,6745
+jal ra,6862
+jal ra,7584
+jal ra,7988
+jal ra,8355
+jal ra,8903
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+beq t0,zero,8
+jal ra,28264
+jal ra,28313
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,-24(s0)
+jal ra,28358
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,840
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9836
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6069
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,832
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9858
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-1328(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6091
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,824
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9880
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1320(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6113
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-1520(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1312(gp)
+sd t0,24(sp)
+ld t0,-1328(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+addi t0,zero,0
+sd t0,48(sp)
+jal ra,-6129
+ld t0,-8(s0)
+beq t0,zero,235
+jal ra,39984
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-8(s0)
+jal zero,224
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,40003
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-10188
+addi t0,a0,0
+addi t1,zero,45
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-8(s0)
+jal zero,205
+jal ra,40017
+addi t0,a0,0
+sd t0,-968(gp)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,496
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-8009
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,432
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-968(gp)
+sd t0,16(sp)
+ld t0,-144(gp)
+sd t0,24(sp)
+ld t0,-40(gp)
+sd t0,32(sp)
+jal ra,-8026
+addi sp,sp,32
+ld t0,-968(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-292
+addi t0,a0,0
+sd t0,-976(gp)
+ld t0,-976(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-10532
+addi t0,a0,0
+beq t0,zero,20
+lui t0,0xFFFFE
+addi t0,t0,392
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-968(gp)
+sd t0,16(sp)
+jal ra,-8053
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17804
+jal ra,-17304
+jal ra,-16954
+jal ra,-4789
+lui t0,0xFFFFE
+addi t0,t0,304
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-8073
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,248
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-872(gp)
+sd t0,16(sp)
+ld t0,-880(gp)
+sd t0,24(sp)
+ld t0,-896(gp)
+sd t0,32(sp)
+jal ra,-8090
+addi sp,sp,32
+lui t0,0xFFFFE
+addi t0,t0,184
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-872(gp)
+ld t1,-888(gp)
+sub t0,t0,t1
+sd t0,16(sp)
+ld t0,-872(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-872(gp)
+ld t1,-888(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-9235
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-872(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-872(gp)
+ld t1,-888(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-9217
+addi t0,a0,0
+sd t0,32(sp)
+ld t0,-904(gp)
+sd t0,40(sp)
+jal ra,-8127
+addi sp,sp,40
+lui t0,0xFFFFE
+addi t0,t0,120
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-1448(gp)
+sd t0,16(sp)
+ld t0,-1456(gp)
+sd t0,24(sp)
+ld t0,-1464(gp)
+sd t0,32(sp)
+jal ra,-8144
+addi sp,sp,32
+lui t0,0xFFFFE
+addi t0,t0,56
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-1472(gp)
+sd t0,16(sp)
+ld t0,-1480(gp)
+sd t0,24(sp)
+ld t0,-1488(gp)
+sd t0,32(sp)
+ld t0,-1496(gp)
+sd t0,40(sp)
+ld t0,-1504(gp)
+sd t0,48(sp)
+jal ra,-8165
+addi sp,sp,48
+ld t0,-912(gp)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-16
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-912(gp)
+sd t0,16(sp)
+ld t0,-968(gp)
+sd t0,24(sp)
+jal ra,-8185
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1408(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17936
+jal zero,-235
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFE
+addi t0,t0,-64
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-968(gp)
+sd t0,16(sp)
+jal ra,-8211
+addi sp,sp,16
+jal ra,3961
+jal ra,-776
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+beq t0,zero,5
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,28056
+ld t0,-1400(gp)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,29
+lui t0,0xFFFFE
+addi t0,t0,304
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-8236
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,-128
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-1400(gp)
+sd t0,16(sp)
+ld t0,-1408(gp)
+ld t1,-1400(gp)
+divu t0,t0,t1
+sd t0,24(sp)
+jal ra,-8253
+addi sp,sp,24
+lui t0,0xFFFFE
+addi t0,t0,-216
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-8264
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,-288
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+add t0,t0,t1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,32(sp)
+jal ra,-8295
+addi sp,sp,32
+jal ra,2085
+lui t0,0xFFFFE
+addi t0,t0,304
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-8307
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,-328
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-8318
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,-368
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1256(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1256(t0)
+ld t1,-136(gp)
+mul t0,t0,t1
+sd t0,24(sp)
+jal ra,-8339
+addi sp,sp,24
+lui t0,0xFFFFE
+addi t0,t0,-408
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1248(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1240(t0)
+sd t0,24(sp)
+jal ra,-8358
+addi sp,sp,24
+lui t0,0xFFFFE
+addi t0,t0,-448
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1232(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1232(t0)
+ld t1,-136(gp)
+mul t0,t0,t1
+sd t0,24(sp)
+jal ra,-8379
+addi sp,sp,24
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1824(gp)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1848
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-8422
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,26
+jal zero,24
+ld t0,16(s0)
+ld t1,-1632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,16
+jal zero,14
+ld t0,16(s0)
+ld t1,-1576(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1592(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-62
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1648(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+ld t0,16(s0)
+ld t1,-1704(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1608(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,25
+ld t0,16(s0)
+ld t1,-1624(gp)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,20
+jal zero,14
+ld t0,16(s0)
+ld t1,-1792(gp)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,10
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,64
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-64(gp)
+sltu t0,t0,t1
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-448(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,24(s0)
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-120(gp)
+sltu t0,t1,t0
+beq t0,zero,21
+jal ra,19110
+lui t0,0xFFFFE
+addi t0,t0,-496
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8638
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-236
+jal ra,-9524
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-24(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,20155
+jal zero,21
+jal ra,19089
+lui t0,0xFFFFE
+addi t0,t0,-536
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8659
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-257
+jal ra,-9545
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-16(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,20134
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-114
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-10953
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-64(gp)
+sltu t0,t0,t1
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-456(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(gp)
+ld t1,-144(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+sd t0,8(sp)
+jal ra,-80
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-11124
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,43
+lui t0,0xFFFFE
+addi t0,t0,-552
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-880(gp)
+sd t0,8(sp)
+jal ra,-8362
+lui t0,0xFFFFE
+addi t0,t0,-592
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11598
+addi t0,a0,0
+sub t0,zero,t0
+sd t0,16(sp)
+ld t0,24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11607
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,24(sp)
+jal ra,-8831
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18582
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11488
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11496
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-11504
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11512
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-11520
+addi t0,a0,0
+ld t1,56(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,56
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,25
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-11496
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-11518
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,15
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-11540
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,3
+sd t0,16(sp)
+jal ra,-11562
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-11584
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-11606
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-146
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-138
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-130
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1752(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-122
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-114
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1728(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-344
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-11361
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11772
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-11780
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11788
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-11796
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,12
+sd t0,16(sp)
+jal ra,-11772
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-11473
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1568(gp)
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-282
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1752(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-274
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-266
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-92
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-507
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-11524
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-11889
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-11899
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11955
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11963
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-11971
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-11979
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-11987
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,25
+sd t0,8(sp)
+addi t0,zero,7
+sd t0,16(sp)
+jal ra,-11965
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+addi t0,zero,5
+sd t0,16(sp)
+jal ra,-11975
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12031
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-11686
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-514
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-506
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1752(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-498
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1568(gp)
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-114
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,13
+sd t0,8(sp)
+jal ra,-721
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,13
+sd t0,8(sp)
+jal ra,-11738
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12103
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+addi t0,zero,6
+sd t0,16(sp)
+jal ra,-12113
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+addi t0,zero,4
+sd t0,16(sp)
+jal ra,-12123
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,11
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12133
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,6
+sd t0,8(sp)
+jal ra,-12189
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12197
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12205
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,3
+sd t0,8(sp)
+jal ra,-12213
+addi t0,a0,0
+ld t1,40(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+jal ra,-12221
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12229
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-12237
+addi t0,a0,0
+ld t1,48(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,31
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12215
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,25
+sd t0,8(sp)
+addi t0,zero,6
+sd t0,16(sp)
+jal ra,-12225
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,4
+sd t0,16(sp)
+jal ra,-12235
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12245
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12301
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,6
+sd t0,8(sp)
+jal ra,-12309
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+jal ra,-12317
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12325
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,13
+sd t0,8(sp)
+jal ra,-11978
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-806
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-798
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1752(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-790
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1568(gp)
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-156
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+jal ra,-1013
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+jal ra,-12030
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12395
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+jal ra,-12405
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,11
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12415
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-12425
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,10
+sd t0,8(sp)
+jal ra,-12481
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12489
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-12497
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12505
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-12513
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,31
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12491
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+addi t0,zero,10
+sd t0,16(sp)
+jal ra,-12501
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-12511
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-12521
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-12577
+addi t0,a0,0
+ld t1,-32(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12585
+addi t0,a0,0
+ld t1,-24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,10
+sd t0,8(sp)
+jal ra,-12593
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-12601
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,21
+sd t0,8(sp)
+jal ra,-12254
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1568(gp)
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1568(gp)
+sd t1,1752(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1028
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-136
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-1268
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-12285
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,5
+sd t0,8(sp)
+jal ra,-12696
+addi t0,a0,0
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,7
+sd t0,8(sp)
+jal ra,-12704
+addi t0,a0,0
+ld t1,32(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,20
+sd t0,16(sp)
+jal ra,-12680
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-12381
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1568(gp)
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-1568(gp)
+sd t1,1752(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,1720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1154
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-72
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1368(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1352(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1344(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1336(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1328(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1320(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1304(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1296(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1280(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1272(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1264(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-280(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-288(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-296(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-304(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-312(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-320(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-328(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-336(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-344(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-352(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-360(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-368(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-376(t1)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-616
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,17412
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-150
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-11443
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-159
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-11424
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-10332
+addi sp,sp,32
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-53
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-48(t0)
+beq t0,zero,24
+lui t0,0xFFFFE
+addi t0,t0,-632
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-11487
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-11467
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-10375
+addi sp,sp,16
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,304
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-10396
+addi sp,sp,8
+lui t0,0xFFFFE
+addi t0,t0,-680
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-10407
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-48(t0)
+beq t0,zero,7
+lui t0,0xFFFFE
+addi t0,t0,-696
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10418
+jal ra,-11300
+lui t0,0xFFFFE
+addi t0,t0,-712
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-10429
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1368(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-280(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,360(t0)
+sd t0,16(sp)
+jal ra,-105
+lui t0,0xFFFFE
+addi t0,t0,-720
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10450
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1360(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-288(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,352(t0)
+sd t0,16(sp)
+jal ra,-125
+jal ra,-11346
+lui t0,0xFFFFE
+addi t0,t0,-736
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-10475
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1304(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-344(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+sd t0,16(sp)
+jal ra,-151
+lui t0,0xFFFFE
+addi t0,t0,-720
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10496
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1296(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-352(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+sd t0,16(sp)
+jal ra,-171
+jal ra,-11392
+lui t0,0xFFFFE
+addi t0,t0,-752
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-10521
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1352(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-296(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,344(t0)
+sd t0,16(sp)
+jal ra,-197
+lui t0,0xFFFFE
+addi t0,t0,-720
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10542
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1344(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-304(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,336(t0)
+sd t0,16(sp)
+jal ra,-217
+lui t0,0xFFFFE
+addi t0,t0,-720
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10562
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1336(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-312(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,328(t0)
+sd t0,16(sp)
+jal ra,-237
+jal ra,-11458
+lui t0,0xFFFFE
+addi t0,t0,-752
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-10587
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1328(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-320(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,320(t0)
+sd t0,16(sp)
+jal ra,-263
+lui t0,0xFFFFE
+addi t0,t0,-720
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10608
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1320(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-328(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,312(t0)
+sd t0,16(sp)
+jal ra,-283
+jal ra,-11504
+lui t0,0xFFFFE
+addi t0,t0,-768
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-10633
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1312(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-336(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,304(t0)
+sd t0,16(sp)
+jal ra,-309
+jal ra,-11530
+lui t0,0xFFFFE
+addi t0,t0,-784
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-10659
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1288(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-360(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,280(t0)
+sd t0,16(sp)
+jal ra,-335
+lui t0,0xFFFFE
+addi t0,t0,-720
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10680
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1280(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-368(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,272(t0)
+sd t0,16(sp)
+jal ra,-355
+lui t0,0xFFFFE
+addi t0,t0,-720
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10700
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1272(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-376(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,264(t0)
+sd t0,16(sp)
+jal ra,-375
+jal ra,-11596
+lui t0,0xFFFFE
+addi t0,t0,-800
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-10725
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1264(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,256(t0)
+sd t0,8(sp)
+jal ra,-440
+jal ra,-11618
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+ld t0,-96(gp)
+sd t0,16(sp)
+jal ra,-13341
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-96(gp)
+sd t0,8(sp)
+ld t0,-96(gp)
+sd t0,16(sp)
+jal ra,-13363
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-24(gp)
+beq t0,zero,53
+ld t0,-32(gp)
+beq t0,zero,13
+ld t0,32(s0)
+beq t0,zero,11
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,50
+ld t0,24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-83
+addi t0,a0,0
+addi a0,t0,0
+jal zero,28
+jal zero,15
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-76
+addi t0,a0,0
+addi a0,t0,0
+jal zero,13
+jal zero,11
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-24(gp)
+beq t0,zero,109
+ld t0,-32(gp)
+beq t0,zero,13
+ld t0,32(s0)
+beq t0,zero,11
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,40(s0)
+sd t1,0(t0)
+jal zero,104
+ld t0,24(s0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-88(gp)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-122
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-96(gp)
+sd t0,8(sp)
+jal ra,-13549
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-96(gp)
+sd t0,8(sp)
+jal ra,-13159
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,40
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,40(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-96(gp)
+sd t0,8(sp)
+jal ra,-13585
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-88(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-181
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,10
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,40(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-218
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1672(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,-832
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10564
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20783
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-189
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-284
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-308
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,13
+lui t0,0xFFFFE
+addi t0,t0,-864
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10654
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1400(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20873
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-279
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-144
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-880(gp)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,1200(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1936(t0)
+sd t0,16(sp)
+ld t0,-1568(gp)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2000(t0)
+sd t0,32(sp)
+jal ra,-2122
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-35
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-108
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1360(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1976(t0)
+sd t0,16(sp)
+jal ra,-1245
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-140
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1368(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1368(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1928(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2000(t0)
+sd t0,32(sp)
+jal ra,-2207
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-178
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1360(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1816(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1920(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1984(t0)
+sd t0,40(sp)
+jal ra,-2519
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-220
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1352(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1352(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1800(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1912(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1984(t0)
+sd t0,40(sp)
+jal ra,-2561
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-262
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1344(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1344(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1808(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1904(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1984(t0)
+sd t0,40(sp)
+jal ra,-2603
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-304
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1336(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1336(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1792(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1896(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1984(t0)
+sd t0,40(sp)
+jal ra,-2645
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-346
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1328(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1328(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1784(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1888(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1984(t0)
+sd t0,40(sp)
+jal ra,-2687
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-388
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1320(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1320(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1776(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1880(t0)
+sd t0,24(sp)
+ld t0,16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1984(t0)
+sd t0,40(sp)
+jal ra,-2729
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-430
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1312(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+beq t0,zero,22
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1872(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2008(t0)
+sd t0,32(sp)
+jal ra,-2499
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-470
+jal zero,21
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1856(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,2008(t0)
+sd t0,32(sp)
+jal ra,-2520
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-491
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1304(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1304(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-32(gp)
+beq t0,zero,22
+ld t0,24(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1864(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1992(t0)
+sd t0,32(sp)
+jal ra,-2398
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-531
+jal zero,21
+ld t0,24(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1848(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1992(t0)
+sd t0,32(sp)
+jal ra,-2419
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-552
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1296(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1296(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1840(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1968(t0)
+sd t0,32(sp)
+jal ra,-2243
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-590
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1288(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1952(t0)
+sd t0,16(sp)
+jal ra,-1983
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-622
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1280(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1280(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1832(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1960(t0)
+sd t0,32(sp)
+jal ra,-2689
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-660
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1272(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1272(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1768(t0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1824(t0)
+sd t0,16(sp)
+ld t0,-1568(gp)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1944(t0)
+sd t0,32(sp)
+jal ra,-2729
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-700
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1264(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1264(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-879
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+ld t1,16(s0)
+sub t0,t0,t1
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2966
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2950
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2934
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2896
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-2417
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-895
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-935
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,16(s0)
+sub t0,t0,t1
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2954
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2938
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-2167
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-937
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-982
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2085
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-68
+ld t0,-8(s0)
+sd t0,16(s0)
+jal zero,-23
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1013
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3074
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3058
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3042
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3026
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-2923
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1025
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1664(t0)
+ld t1,24(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-956
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1664(t1)
+ld t2,24(s0)
+add t1,t1,t2
+ld t2,-136(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21279
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14092
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-11974
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+sltu t0,t0,t1
+beq t0,zero,32
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-1341
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21221
+addi t0,a0,0
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21305
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-99
+ld t0,-16(s0)
+ld t1,-136(gp)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-34
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1248(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1240(t1)
+ld t2,-24(s0)
+add t1,t1,t2
+sd t1,1240(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sltu t0,t0,t1
+beq t0,zero,59
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1664(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sub t0,t0,t1
+ld t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1121
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1100
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+ld t1,-8(s0)
+ld t2,-136(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1160(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1664(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,1176(t3)
+sub t2,t2,t3
+ld t3,-8(s0)
+add t2,t2,t3
+ld t3,-136(gp)
+divu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+ld t0,-8(s0)
+ld t1,-136(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-63
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+sd t0,-8(s0)
+ld t0,24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,4
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,512(t1)
+sltu t0,t1,t0
+beq t0,zero,21
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,512(t1)
+sub t0,t0,t1
+sd t0,24(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,512(t1)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+jal zero,-25
+ld t0,24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,14
+ld t0,-8(s0)
+ld t1,24(s0)
+addi t2,zero,1
+sub t1,t1,t2
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-11982
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-88
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1464(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1472(t2)
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1656(t1)
+sd t1,1512(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,2
+sd t1,1464(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-69
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1624(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1616(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15051
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1608(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15065
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1600(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+jal ra,-15079
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1589
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1584(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1576(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15105
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1568(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15119
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1560(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+jal ra,-15133
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1643
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1552(t0)
+sd t0,24(sp)
+jal ra,-1655
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1544(t0)
+sd t0,24(sp)
+jal ra,-1667
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1528(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15183
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1693
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1520(t0)
+sd t0,24(sp)
+jal ra,-1705
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1584(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,132
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1512(t0)
+sd t0,24(sp)
+jal ra,-1727
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1504(t0)
+sd t0,24(sp)
+jal ra,-1739
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1496(t0)
+sd t0,24(sp)
+jal ra,-1751
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1488(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-15267
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1472(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+jal ra,-15281
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1791
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,56
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15307
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1448(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-15321
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1440(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+jal ra,-15335
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1845
+jal zero,127
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1512(t0)
+sd t0,24(sp)
+jal ra,-1858
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,28
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1504(t0)
+sd t0,24(sp)
+jal ra,-1870
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1496(t0)
+sd t0,24(sp)
+jal ra,-1882
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,36
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1488(t0)
+sd t0,24(sp)
+jal ra,-1894
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1472(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15410
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1920
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,44
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1456(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15436
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1946
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1448(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1440(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+jal ra,-15462
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-1972
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+sd t1,1432(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sd t1,1424(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+sd t1,1416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1208(t1)
+sd t1,1408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1208(t1)
+sd t1,1400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sd t1,1392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sd t1,1384(t0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,73
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1632(t1)
+sd t1,1424(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,512(t0)
+sd t0,8(sp)
+jal ra,-12767
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,1416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1184(t1)
+sd t1,1408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1184(t1)
+sd t1,1400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sd t1,1392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sd t1,1384(t0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,11
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1472(t1)
+ld t2,24(s0)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1584(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,114
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,0
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1432(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1424(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+jal ra,-15636
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,24(sp)
+jal ra,-2146
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,8
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1416(t0)
+sd t0,24(sp)
+jal ra,-2160
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,16
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1408(t0)
+sd t0,24(sp)
+jal ra,-2174
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,24
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1400(t0)
+sd t0,24(sp)
+jal ra,-2188
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,32
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+sd t0,24(sp)
+jal ra,-2202
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,40
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+sd t0,24(sp)
+jal ra,-2216
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,48
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+sd t0,24(sp)
+jal ra,-2230
+jal zero,113
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,0
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1432(t0)
+sd t0,24(sp)
+jal ra,-2245
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,4
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1416(t0)
+sd t0,24(sp)
+jal ra,-2259
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,8
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1408(t0)
+sd t0,24(sp)
+jal ra,-2273
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,12
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1400(t0)
+sd t0,24(sp)
+jal ra,-2287
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,16
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+sd t0,24(sp)
+jal ra,-2301
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,20
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1384(t0)
+sd t0,24(sp)
+jal ra,-2315
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,24
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1424(t0)
+sd t0,24(sp)
+jal ra,-2329
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,28
+add t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1376(t0)
+sd t0,24(sp)
+jal ra,-2343
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2438
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-15821
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1624(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,94
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-15837
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1616(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,78
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-15853
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1608(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,62
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-15869
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1600(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,46
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2512
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-15893
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+addi t0,zero,1
+sd t0,-32(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,19
+jal zero,14
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+addi t0,zero,0
+sd t0,-32(gp)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1584(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,93
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2582
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-15963
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,68
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2606
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,48
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-15987
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1472(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2634
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1512(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,56
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2650
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-16031
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1464(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,107
+jal zero,102
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1584(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,92
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2684
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-16065
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,68
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2708
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-16089
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1472(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2736
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1512(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,44
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2752
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,16
+sd t0,16(sp)
+jal ra,-16133
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1464(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1584(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1696(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,135
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2800
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2810
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,40
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2820
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2833
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,86
+ld t0,-16(s0)
+ld t1,-24(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,80
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2858
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,32
+sd t0,16(sp)
+jal ra,-16239
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1432(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2882
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,32
+sd t0,8(sp)
+addi t0,zero,32
+sd t0,16(sp)
+jal ra,-16263
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1424(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-2906
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,1408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+sd t1,1392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-24(s0)
+sd t1,1384(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,133
+jal zero,128
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1584(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1688(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,118
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2944
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,16
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2954
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2964
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-2977
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,70
+ld t0,-16(s0)
+ld t1,-24(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,64
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3002
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1432(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,4
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3018
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,1408(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+sd t1,1392(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-24(s0)
+sd t1,1384(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+addi t0,zero,24
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3046
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1424(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-248(gp)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-23585
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+sd t0,8(sp)
+jal ra,-16152
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,1224(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+add t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,-904
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,16(sp)
+jal ra,-13916
+addi sp,sp,16
+jal zero,216
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-264(gp)
+sd t0,8(sp)
+jal ra,-75
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-16427
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-952
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,16(sp)
+jal ra,-13950
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23701
+jal ra,-1584
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+sd t0,16(sp)
+jal ra,-23701
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1704(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-1016
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,16(sp)
+jal ra,-13991
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23742
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,512(t0)
+sd t0,8(sp)
+jal ra,-13868
+addi t0,a0,0
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-1766
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-23759
+addi t0,a0,0
+ld t1,-24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-1072
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,16(sp)
+jal ra,-14047
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23798
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,16(sp)
+jal ra,-23797
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-1128
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,16(sp)
+jal ra,-14087
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23838
+lui t0,0xFFFFE
+addi t0,t0,-1224
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1704(t0)
+ld t1,-24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+add t0,t0,t1
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+ld t0,-144(gp)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,48(sp)
+jal ra,-14132
+addi sp,sp,48
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-88
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,1224(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-6416
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-16656
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,392
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,16(sp)
+jal ra,-14179
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23930
+jal ra,-22701
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1680(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14021
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-1952
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-23949
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,8
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,360
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1009
+addi t0,a0,0
+beq t0,zero,354
+jal ra,-17155
+jal ra,-21168
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi t1,zero,8
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+addi t1,zero,8
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-1988
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1480(t0)
+addi t1,zero,8
+sub t0,t0,t1
+sd t0,16(sp)
+jal ra,-23989
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+addi t2,zero,8
+sub t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,316
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-918
+addi t0,a0,0
+beq t0,zero,310
+addi t0,zero,0
+sd t0,-32(s0)
+addi t0,zero,0
+sd t0,-40(s0)
+addi t0,zero,0
+sd t0,-48(s0)
+addi t0,zero,0
+sd t0,-56(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1480(t1)
+add t0,t0,t1
+sd t0,-64(s0)
+addi t0,zero,0
+sd t0,-72(s0)
+ld t0,-72(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1464(t1)
+sltu t0,t0,t1
+beq t0,zero,117
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-64(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1472(t0)
+sd t0,8(sp)
+jal ra,-2048
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1472(t0)
+sd t0,16(sp)
+jal ra,-24047
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1472(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,78
+ld t0,-64(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-757
+addi t0,a0,0
+beq t0,zero,72
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1432(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1648(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,62
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1424(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1640(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1416(t0)
+sd t0,-32(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+sd t0,-40(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1408(t1)
+sd t1,1208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1384(t1)
+sd t1,1200(t0)
+jal zero,31
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1424(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1632(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1416(t0)
+sd t0,-48(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1392(t0)
+sd t0,-56(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1408(t1)
+sd t1,1184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1384(t1)
+sd t1,1176(t0)
+ld t0,-64(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1472(t1)
+add t0,t0,t1
+sd t0,-64(s0)
+ld t0,-72(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-72(s0)
+jal zero,-121
+ld t0,-40(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,168
+ld t0,-40(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,160
+ld t0,-56(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,156
+ld t0,-32(s0)
+ld t1,-40(s0)
+add t0,t0,t1
+ld t1,-48(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,148
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+ld t2,-32(s0)
+add t1,t1,t2
+sd t1,1216(t0)
+jal ra,-2086
+addi t0,a0,0
+sd t0,-80(s0)
+ld t0,-32(s0)
+ld t1,-40(s0)
+add t0,t0,t1
+ld t1,-80(s0)
+sub t0,t0,t1
+sd t0,-88(s0)
+ld t0,-88(s0)
+ld t1,-80(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,123
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,-80(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-88(s0)
+sd t0,8(sp)
+jal ra,-2213
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-88(s0)
+sd t0,16(sp)
+jal ra,-24210
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+sd t0,8(sp)
+jal ra,-16759
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-88(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,91
+ld t0,-80(s0)
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-80(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+ld t2,-48(s0)
+add t1,t1,t2
+sd t1,1192(t0)
+ld t0,-48(s0)
+ld t1,-56(s0)
+add t0,t0,t1
+ld t1,-80(s0)
+sub t0,t0,t1
+sd t0,-88(s0)
+ld t0,-88(s0)
+ld t1,-80(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1680(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,65
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,-80(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-88(s0)
+sd t0,8(sp)
+jal ra,-2271
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-88(s0)
+sd t0,16(sp)
+jal ra,-24268
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+sd t0,8(sp)
+jal ra,-16817
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-88(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,-80(s0)
+ld t1,-24(s0)
+add t0,t0,t1
+sd t0,-80(s0)
+lui t0,0xFFFFE
+addi t0,t0,-1320
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-80(s0)
+sd t0,16(sp)
+ld t0,-40(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+ld t0,-144(gp)
+sd t0,32(sp)
+ld t0,-56(s0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,48(sp)
+jal ra,-14574
+addi sp,sp,48
+jal zero,22
+lui t0,0xFFFFE
+addi t0,t0,-1384
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,16(sp)
+jal ra,-14590
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24341
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1392
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16569
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1312(gp)
+sd t0,24(sp)
+ld t0,-1344(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,48(sp)
+jal ra,-12804
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3049
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,-3347
+ld t0,-1704(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1120(t0)
+sd t0,16(sp)
+jal ra,-3357
+jal ra,-2838
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,-1408
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14680
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,13694
+lui t0,0xFFFFE
+addi t0,t0,-1416
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14690
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19934
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+sd t0,8(sp)
+jal ra,-16943
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-18929
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1424
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16687
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1312(gp)
+sd t0,24(sp)
+ld t0,-1328(gp)
+sd t0,32(sp)
+addi t0,zero,3
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,48(sp)
+jal ra,-12922
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3167
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,-3465
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3183
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,-3481
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3199
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,-3497
+ld t0,-1704(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1112(t0)
+sd t0,16(sp)
+jal ra,-3507
+jal ra,-2988
+ld t0,-1568(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3034
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+ld t0,40(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-176(gp)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,40(s0)
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,24(s0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,24(s0)
+sub t0,t0,t1
+ld t1,40(s0)
+sltu t0,t0,t1
+beq t0,zero,252
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,8223
+addi t0,a0,0
+beq t0,zero,227
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,21196
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,197
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20097
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,8231
+addi t0,a0,0
+beq t0,zero,168
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8153
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8165
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,13
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8138
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8150
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,24(s0)
+sub t0,t0,t1
+ld t1,40(s0)
+sltu t0,t1,t0
+beq t0,zero,5
+ld t0,24(s0)
+ld t1,40(s0)
+add t0,t0,t1
+sd t0,-24(s0)
+ld t0,48(s0)
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1264(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20157
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,8101
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,27743
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20171
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,8181
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+sltu t0,t0,t1
+beq t0,zero,89
+ld t0,48(s0)
+beq t0,zero,28
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,24(s0)
+sub t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-4190
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,6987
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+beq t0,zero,7
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+jal ra,5499
+jal zero,17
+ld t0,32(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,24(s0)
+sub t0,t0,t1
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6948
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-4145
+ld t0,-8(s0)
+beq t0,zero,31
+addi t0,zero,0
+sd t0,-40(s0)
+ld t0,-40(s0)
+ld t1,-136(gp)
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,24(s0)
+sub t0,t0,t1
+ld t1,-40(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-17234
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,91
+ld t0,-40(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-40(s0)
+jal zero,-27
+ld t0,-16(s0)
+ld t1,-136(gp)
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-32(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,-91
+jal zero,17
+lui t0,0xFFFFE
+addi t0,t0,-1472
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15063
+addi sp,sp,16
+addi t0,zero,0
+addi a0,t0,0
+jal zero,58
+jal zero,17
+lui t0,0xFFFFE
+addi t0,t0,-1528
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15080
+addi sp,sp,16
+addi t0,zero,0
+addi a0,t0,0
+jal zero,41
+jal zero,17
+lui t0,0xFFFFE
+addi t0,t0,-1568
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15097
+addi sp,sp,16
+addi t0,zero,0
+addi a0,t0,0
+jal zero,24
+jal zero,-256
+ld t0,-8(s0)
+beq t0,zero,17
+lui t0,0xFFFFE
+addi t0,t0,-1624
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-15116
+addi sp,sp,16
+addi t0,zero,0
+addi a0,t0,0
+jal zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,39
+lui t0,0xFFFFE
+addi t0,t0,-1640
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15146
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,13292
+addi t0,zero,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15155
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,13219
+addi t0,zero,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15164
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,13274
+lui t0,0xFFFFE
+addi t0,t0,-1648
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15174
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,13264
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20422
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20433
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20444
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+beq t0,zero,18
+lui t0,0xFFFFE
+addi t0,t0,-1752
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+ld t0,-16(s0)
+sd t0,32(sp)
+jal ra,-15231
+addi sp,sp,32
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15098
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1064(t1)
+sltu t0,t1,t0
+beq t0,zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15114
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1064(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1064(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15096
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1064(t0)
+sd t0,8(sp)
+jal ra,-3024
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1072(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1072(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15151
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-15018
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20538
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1072(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-25055
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20563
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+sd t0,8(sp)
+jal ra,-17617
+addi t0,a0,0
+sd t0,-24(s0)
+addi t0,zero,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-17837
+addi t0,a0,0
+beq t0,zero,45
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1072(t0)
+sd t0,16(sp)
+ld t0,-24(s0)
+sd t0,24(sp)
+addi t0,zero,1
+sd t0,32(sp)
+jal ra,-537
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20610
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+sd t0,8(sp)
+jal ra,-17617
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20656
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-19873
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1152(t0)
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,-1816
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-15422
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,-1824
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15433
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,13005
+jal ra,-16319
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-1832
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17410
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1312(gp)
+sd t0,24(sp)
+ld t0,-1328(gp)
+sd t0,32(sp)
+addi t0,zero,3
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,48(sp)
+jal ra,-13645
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3890
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,-4188
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3906
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,-4204
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3922
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,-4220
+ld t0,-1704(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1104(t0)
+sd t0,16(sp)
+jal ra,-4230
+jal ra,-3711
+ld t0,-1568(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-3757
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,39
+lui t0,0xFFFFE
+addi t0,t0,-1848
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15561
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12877
+addi t0,zero,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15570
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12804
+addi t0,zero,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15579
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12859
+lui t0,0xFFFFE
+addi t0,t0,-1648
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15589
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12849
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20837
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20848
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20859
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+beq t0,zero,18
+lui t0,0xFFFFE
+addi t0,t0,-1952
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-16(s0)
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+jal ra,-15646
+addi sp,sp,32
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1064(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,8
+sd t0,8(sp)
+jal ra,-15527
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1064(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1064(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15509
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1064(t0)
+sd t0,8(sp)
+jal ra,-3437
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1072(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1072(t0)
+ld t1,-24(s0)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1072(t0)
+sd t0,16(sp)
+ld t0,-24(s0)
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-895
+addi t0,a0,0
+beq t0,zero,35
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20964
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1072(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-16808
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+sd t0,8(sp)
+jal ra,-17980
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+jal zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20998
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+sd t0,8(sp)
+jal ra,-18005
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21044
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-20261
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1144(t0)
+beq t0,zero,33
+lui t0,0xFFFFE
+addi t0,t0,-2016
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21049
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+sd t0,8(sp)
+jal ra,-18103
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-15827
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,-1824
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15838
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12600
+jal ra,-16724
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,-2024
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17815
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1312(gp)
+sd t0,24(sp)
+ld t0,-1328(gp)
+sd t0,32(sp)
+addi t0,zero,3
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,48(sp)
+jal ra,-14050
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4295
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,-4593
+ld t0,-1664(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4311
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,-4609
+ld t0,-1672(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4327
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,-4625
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1080(t0)
+sd t0,16(sp)
+jal ra,-4635
+ld t0,-1704(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1096(t0)
+sd t0,16(sp)
+jal ra,-4645
+jal ra,-4126
+ld t0,-1568(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4172
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+addi t0,zero,0
+sd t0,32(sp)
+jal ra,-1154
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,48
+lui t0,0xFFFFE
+addi t0,t0,-2040
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16002
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12372
+addi t0,zero,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16011
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12363
+addi t0,zero,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16020
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12354
+addi t0,zero,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16029
+ld t0,-1672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12377
+lui t0,0xFFFFE
+addi t0,t0,-1648
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16039
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12399
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21287
+addi t0,a0,0
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21298
+addi t0,a0,0
+ld t1,-1664(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21309
+addi t0,a0,0
+ld t1,-1672(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-184(gp)
+sd t0,16(sp)
+jal ra,-123
+addi t0,a0,0
+beq t0,zero,33
+ld t0,-16(s0)
+ld t1,-224(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld t0,-248(gp)
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21338
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-184(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-25835
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+jal zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21362
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,1
+sub t0,zero,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+sd t0,8(sp)
+jal ra,-18369
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21408
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-20625
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1136(t0)
+beq t0,zero,37
+lui t0,0xFFFFD
+addi t0,t0,1968
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-184(gp)
+sd t0,16(sp)
+ld t0,-16(s0)
+sd t0,24(sp)
+ld t0,-24(s0)
+sd t0,32(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21419
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+sd t0,8(sp)
+jal ra,-18473
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-16195
+addi sp,sp,40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,-1824
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16206
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,12232
+jal ra,-17092
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1960
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18184
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1312(gp)
+sd t0,24(sp)
+ld t0,-1336(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,48(sp)
+jal ra,-14419
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1048
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18208
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1312(gp)
+sd t0,24(sp)
+ld t0,-1336(gp)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,48(sp)
+jal ra,-14443
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+ld t2,-136(gp)
+add t1,t1,t2
+sd t1,1176(t0)
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,-1528(gp)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+ld t0,-1288(gp)
+sd t0,24(sp)
+ld t0,-1328(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sub t0,zero,t0
+sd t0,48(sp)
+jal ra,-14470
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25409
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25397
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25479
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-4273
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1256(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1256(t0)
+jal ra,-14090
+jal ra,-14060
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4747
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,-5045
+jal ra,-14077
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-9020
+jal ra,-14115
+jal ra,-14085
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25429
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25454
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-4780
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-14105
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-14063
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-5042
+ld t0,-1704(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1088(t0)
+sd t0,16(sp)
+jal ra,-5090
+jal ra,-4571
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-14126
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,2
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4692
+ld t0,-1568(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+addi t0,zero,4
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4704
+ld t0,-1568(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-14106
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,3
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4717
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5137
+ld t0,-1568(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+addi t0,zero,3
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-4737
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25521
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25547
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-1648(gp)
+sd t0,16(sp)
+jal ra,-4814
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,-14200
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5174
+addi t0,zero,2
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14076
+ld t0,-1568(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-4704
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21534
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,6569
+addi t0,a0,0
+beq t0,zero,35
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,19444
+addi t0,a0,0
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1128(t0)
+beq t0,zero,14
+lui t0,0xFFFFD
+addi t0,t0,1920
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-16537
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-20809
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1128(t0)
+beq t0,zero,14
+lui t0,0xFFFFD
+addi t0,t0,1872
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-16563
+addi sp,sp,16
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21824
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21626
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-109
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,21
+lui t0,0xFFFFD
+addi t0,t0,1864
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16615
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11759
+lui t0,0xFFFFE
+addi t0,t0,-1648
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16625
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11749
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21876
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-1648(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21892
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21548
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-20803
+jal zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21919
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21952
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-21169
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,-1824
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16710
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11664
+jal ra,-17596
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26443
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26449
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,13
+ld t0,-8(s0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1032
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18732
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1312(gp)
+sd t0,24(sp)
+ld t0,-1336(gp)
+sd t0,32(sp)
+addi t0,zero,2
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,48(sp)
+jal ra,-14967
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5212
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,-5510
+ld t0,-1656(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5228
+ld t0,-1584(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,-5526
+ld t0,-1704(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1056(t0)
+sd t0,16(sp)
+jal ra,-5536
+jal ra,-5017
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1696(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5545
+ld t0,-1568(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-5071
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21825
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1312(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21828
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1696(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1144(t1)
+sd t1,0(t0)
+ld t0,-1696(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8151
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1048(t0)
+beq t0,zero,43
+lui t0,0xFFFFD
+addi t0,t0,1816
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21848
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21854
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-16940
+addi sp,sp,24
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,10
+lui t0,0xFFFFD
+addi t0,t0,1784
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-16956
+addi sp,sp,8
+jal ra,-17839
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,22162
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-1144(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-248(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,30
+lui t0,0xFFFFD
+addi t0,t0,1768
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16991
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11383
+addi t0,zero,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17000
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11438
+lui t0,0xFFFFE
+addi t0,t0,-1648
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17010
+ld t0,-1696(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11428
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-88(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8348
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8352
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1656(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,23387
+jal ra,872
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,23105
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,24073
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-211
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-264(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,-1824
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17089
+ld t0,-1696(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,11285
+jal ra,-17975
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,24029
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-255
+jal ra,16304
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,23319
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-43
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-25147
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-25136
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-25091
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+beq t0,zero,61
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,904(t0)
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-59
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,896(t0)
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-69
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,696(t0)
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,704(t1)
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-92
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-21
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25618
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25587
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17113
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-25340
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25635
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25645
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,1
+add t1,t1,t2
+mul t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16972
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-25140
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16984
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-25135
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,88
+jal ra,-25108
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-32(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25520
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25685
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17204
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-24901
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25721
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+sd t0,8(sp)
+jal ra,-24849
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25737
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+remu t0,t0,t1
+sd t0,8(sp)
+jal ra,-24916
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25046
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,830
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+jal ra,1226
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-90
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17269
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-25342
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-25331
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-25501
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-25490
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-25479
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,48(s0)
+sd t0,8(sp)
+jal ra,-25417
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,56(s0)
+sd t0,8(sp)
+jal ra,-25355
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-25344
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,824(t0)
+sd t0,8(sp)
+jal ra,-25335
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,736(t0)
+sd t0,8(sp)
+jal ra,-25462
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-25298
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-265
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-373
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,56
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25933
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,912(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1008(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,992(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,976(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,928(t0)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+jal ra,-114
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25966
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,920(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1000(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,984(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,968(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+sd t0,32(sp)
+addi t0,zero,1
+sd t0,40(sp)
+jal ra,-147
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,904(t0)
+beq t0,zero,136
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,976(t0)
+sd t0,-8(s0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,856(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26022
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,792(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,888(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,872(t0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+sd t0,32(sp)
+addi t0,zero,2
+sd t0,40(sp)
+jal ra,-201
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,816(t0)
+sd t0,8(sp)
+jal ra,-25498
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+sd t0,8(sp)
+jal ra,-25525
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+sd t0,8(sp)
+jal ra,-25535
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,896(t0)
+beq t0,zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26087
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,784(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,880(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,864(t0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+sd t0,32(sp)
+addi t0,zero,3
+sd t0,40(sp)
+jal ra,-266
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,808(t0)
+sd t0,8(sp)
+jal ra,-25563
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+sd t0,8(sp)
+jal ra,-25590
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,2
+jal ra,3449
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26117
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26086
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26148
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,37
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-32(s0)
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25448
+addi t0,a0,0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+jal ra,2192
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25551
+addi t0,a0,0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+jal ra,1222
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-39
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-25713
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-96
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-102
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26073
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26065
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,-8(s0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25548
+addi t0,a0,0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,2092
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-35
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-25801
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26178
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1016(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-90
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26320
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26308
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-37
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-76
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26363
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26387
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26397
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-47
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26497
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-127
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26483
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25900
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-223
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25822
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26518
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26390
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,752(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26363
+addi t0,a0,0
+ld t1,24(s0)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26601
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi t3,zero,1
+add t2,t2,t3
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26382
+addi t0,a0,0
+ld t1,24(s0)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-346
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi sp,sp,-8
+sd t2,0(sp)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26635
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+ld t2,0(sp)
+addi sp,sp,8
+addi t3,a0,0
+divu t2,t2,t3
+mul t1,t1,t2
+ld t2,32(s0)
+add t1,t1,t2
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26692
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+addi sp,sp,-8
+sd t2,0(sp)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26669
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+ld t2,0(sp)
+addi sp,sp,8
+addi t3,a0,0
+divu t2,t2,t3
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26112
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26023
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-109
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-25844
+ld t0,-8(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26152
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26063
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-149
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t0,0(t0)
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26063
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+jal zero,30
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26075
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26084
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,-15
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26094
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-25925
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-25931
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-225
+addi t0,a0,0
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26249
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26164
+addi t0,a0,0
+ld t1,32(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26158
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-34
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26161
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26170
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26158
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-25993
+jal zero,11
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26169
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-25935
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26176
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26185
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26211
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-26044
+jal zero,11
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26222
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-25956
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26061
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26050
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26047
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26260
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-118
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26074
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-26094
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26081
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26090
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26130
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26038
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26057
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26108
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,33
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-185
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26126
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-26178
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26133
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26171
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-26095
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26420
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-544
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26151
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27137
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26499
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,35
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi t1,zero,2
+divu t0,t0,t1
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi t1,zero,2
+ld t2,-24(s0)
+mul t1,t1,t2
+addi t2,zero,1
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,-8(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+jal zero,8
+ld t0,-8(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,-24(s0)
+sd t0,-16(s0)
+jal zero,-37
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26225
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27216
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,1
+sub t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,-8(s0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+addi t0,zero,2
+ld t1,-16(s0)
+mul t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,7
+addi t0,zero,2
+ld t1,-16(s0)
+mul t0,t0,t1
+addi t1,zero,2
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-38
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27255
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,1
+sub t1,t1,t2
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27014
+addi t0,a0,0
+lui t1,0x41C65
+addi t1,t1,-403
+mul t0,t0,t1
+lui t1,0x3
+addi t1,t1,57
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-26741
+ld t0,-8(s0)
+lui t1,0x10
+addi t1,t1,0
+divu t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27304
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27250
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26637
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-761
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-365
+jal zero,19
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27279
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,952(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-257
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-636
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-26611
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26694
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-818
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-346
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-1106
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1090
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-605
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,75
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26783
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-903
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,40(s0)
+beq t0,zero,19
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27434
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-27128
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-165
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,38
+jal zero,33
+ld t0,40(s0)
+beq t0,zero,28
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26808
+addi t0,a0,0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,832
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-132
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,680(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,680(t0)
+jal zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26839
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-963
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26591
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26964
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,66
+jal zero,64
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27496
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,952(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-393
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,35
+jal zero,33
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27527
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,936(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-347
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27629
+addi t0,a0,0
+addi t1,zero,8
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27028
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-1269
+addi t0,a0,0
+sd t0,32(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2597
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-27
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-1395
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-26926
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1173
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-26885
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-26955
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1032
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27044
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1168
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-772
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27685
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,952(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-663
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27105
+addi t0,a0,0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,535
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27208
+addi t0,a0,0
+beq t0,zero,96
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1309
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-443
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27642
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27651
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,127
+jal zero,52
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27681
+addi t0,a0,0
+addi t1,zero,2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,38
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,28
+jal zero,21
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27712
+addi t0,a0,0
+addi t1,zero,3
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,7
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,32(s0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,32(s0)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27904
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,37
+ld t0,24(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+jal ra,-528
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-173
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27942
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-53
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+jal ra,-576
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1549
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-477
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-234
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-320
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27849
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,696(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,696(t0)
+jal zero,84
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+jal ra,-653
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-714
+jal zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28050
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-27746
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-88
+jal zero,21
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1676
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-604
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,7
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28100
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-27796
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-138
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-393
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28007
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-553
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-497
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+ld t0,40(s0)
+sd t0,24(sp)
+jal ra,-812
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,32
+jal zero,30
+ld t0,40(s0)
+beq t0,zero,25
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1795
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-723
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-112
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28263
+addi t0,a0,0
+addi t1,zero,8
+divu t0,t0,t1
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27662
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-1903
+addi t0,a0,0
+sd t0,32(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,21
+ld t0,32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,1978
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-23
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1847
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-78
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-27496
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28250
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-27952
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-2068
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-2052
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-1567
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1038
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+jal ra,-225
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27813
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-2023
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+jal ra,-276
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27864
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-2074
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,40(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28422
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1016(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,85
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27844
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,74
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28387
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28565
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28538
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+divu t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2374
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28442
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28430
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28445
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-28151
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-27747
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-344
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-218
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,987
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-252
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,952
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,32(s0)
+sd t0,24(sp)
+jal ra,-238
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+jal ra,-515
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1365
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,688(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,688(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+jal ra,-562
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28155
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-2365
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1474
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-461
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-471
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,704(t1)
+sltu t0,t0,t1
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-494
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-25
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,1752
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+jal ra,-20572
+addi sp,sp,24
+lui t0,0xFFFFD
+addi t0,t0,1712
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-21709
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-21689
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,24(s0)
+sd t0,32(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-21727
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-21707
+addi t0,a0,0
+sd t0,48(sp)
+jal ra,-20615
+addi sp,sp,48
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28925
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28913
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28771
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+addi t0,zero,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,904(t0)
+beq t0,zero,100
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFD
+addi t0,t0,1656
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-20694
+addi sp,sp,8
+jal zero,12
+lui t0,0xFFFFD
+addi t0,t0,1600
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-20706
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29007
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28997
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFD
+addi t0,t0,1584
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-180
+jal ra,-21611
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,792(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-113
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,896(t0)
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29042
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29032
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFD
+addi t0,t0,1568
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-215
+jal ra,-21646
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,784(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-148
+addi t0,a0,0
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29073
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29063
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29094
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29087
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-200
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-209
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+ld t1,-16(s0)
+add t0,t0,t1
+ld t1,-24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,696(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,800(t2)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-32(s0)
+lui t0,0xFFFFD
+addi t0,t0,1504
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-20859
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,1464
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,824(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,816(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,808(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,800(t0)
+sd t0,40(sp)
+jal ra,-20886
+addi sp,sp,40
+lui t0,0xFFFFD
+addi t0,t0,1416
+add t0,gp,t0
+addi sp,sp,-64
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-279
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-288
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,16(sp)
+ld t0,-16(s0)
+sd t0,24(sp)
+ld t0,-24(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,696(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,800(t1)
+mul t0,t0,t1
+sd t0,40(sp)
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-22113
+addi t0,a0,0
+sd t0,48(sp)
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-22093
+addi t0,a0,0
+sd t0,56(sp)
+jal ra,-20945
+addi sp,sp,56
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1408
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-22791
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,960(t0)
+addi a0,t0,0
+jal zero,54
+jal zero,52
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1400
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-22807
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,952(t0)
+addi a0,t0,0
+jal zero,38
+jal zero,36
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1392
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-22823
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,944(t0)
+addi a0,t0,0
+jal zero,22
+jal zero,20
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1384
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-22839
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,936(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-64(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,960(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFD
+addi t0,t0,1408
+add t0,gp,t0
+addi a0,t0,0
+jal zero,36
+jal zero,34
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,952(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFD
+addi t0,t0,1400
+add t0,gp,t0
+addi a0,t0,0
+jal zero,22
+jal zero,20
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,944(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFD
+addi t0,t0,1392
+add t0,gp,t0
+addi a0,t0,0
+jal zero,8
+jal zero,6
+lui t0,0xFFFFD
+addi t0,t0,1384
+add t0,gp,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+addi t0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,720(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,81
+addi t0,zero,1
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,776(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,66
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,768(t0)
+sd t0,-32(s0)
+ld t0,-32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,760(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,49
+ld t0,-24(s0)
+ld t1,-32(s0)
+mul t0,t0,t1
+ld t1,-16(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,36
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,27
+jal ra,-29534
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi sp,sp,-48
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-32(s0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1024(t0)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+jal ra,-3705
+ld t0,16(s0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-40(s0)
+sd t1,0(t0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-32(s0)
+addi t1,zero,2
+mul t0,t0,t1
+sd t0,-32(s0)
+jal zero,-55
+ld t0,-24(s0)
+addi t1,zero,2
+mul t0,t0,t1
+sd t0,-24(s0)
+jal zero,-72
+ld t0,-16(s0)
+addi t1,zero,2
+mul t0,t0,t1
+sd t0,-16(s0)
+jal zero,-87
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-122
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,704(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21055
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,712(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-148
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+addi t0,zero,1
+sd t0,24(sp)
+jal ra,-2177
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29546
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-29242
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-3162
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2090
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29032
+addi t0,a0,0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2259
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-1939
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,704(t1)
+sltu t0,t0,t1
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-100
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-23
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFD
+addi t0,t0,1304
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-344
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-21378
+addi sp,sp,16
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,704(t1)
+sltu t0,t0,t1
+beq t0,zero,59
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,712(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,-168(gp)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1288
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29758
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29745
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29732
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-21389
+addi sp,sp,24
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29721
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29709
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-168(gp)
+sd t0,16(sp)
+jal ra,-890
+jal ra,-22321
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-63
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,624(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-256(gp)
+sd t0,8(sp)
+jal ra,-7617
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,608(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,608(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-23973
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,1248
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,624(t0)
+sd t0,16(sp)
+jal ra,-21496
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31247
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,600(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,632(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21349
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,600(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21185
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,576(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,640(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21201
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,568(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,592(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,584(t0)
+ld t0,-200(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,672(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,608(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-200(gp)
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-31311
+addi t0,a0,0
+addi t1,zero,8
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,1208
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,624(t0)
+sd t0,16(sp)
+jal ra,-21599
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31350
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,8
+sd t1,584(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,616(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,608(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,600(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,592(t0)
+sd t0,16(sp)
+jal ra,-31369
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,592(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,1208
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,624(t0)
+sd t0,16(sp)
+jal ra,-21659
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31410
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,584(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,592(t2)
+add t1,t1,t2
+sd t1,584(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,592(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-71
+lui t0,0xFFFFD
+addi t0,t0,1136
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,664(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,656(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,648(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,584(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,624(t0)
+sd t0,48(sp)
+jal ra,-21742
+addi sp,sp,48
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,616(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,592(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,632(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-148
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,592(t0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,600(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,592(t1)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+sd t1,0(t0)
+jal zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,600(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,592(t1)
+addi t2,zero,8
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,600(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,592(t2)
+addi t3,zero,8
+divu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,592(t0)
+addi t1,zero,8
+remu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-24465
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,592(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,592(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,576(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+ld t0,24(s0)
+ld t1,-8(s0)
+sub t0,t0,t1
+addi t1,zero,2
+mul t0,t0,t1
+sd t0,-16(s0)
+jal zero,9
+ld t0,-8(s0)
+ld t1,24(s0)
+sub t0,t0,t1
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,640(t1)
+mul t0,t0,t1
+ld t1,16(s0)
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,128
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,14
+ld t0,-16(s0)
+addi t1,zero,128
+remu t0,t0,t1
+addi t1,zero,128
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-156
+ld t0,-16(s0)
+addi t1,zero,128
+divu t0,t0,t1
+sd t0,-16(s0)
+jal zero,-18
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-165
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,576(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,568(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,568(t1)
+ld t2,16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,488(t1)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,488(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,24(s0)
+ld t1,32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,80
+jal zero,78
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-80
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+jal zero,21
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-99
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,1121
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,28
+jal zero,26
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,29
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,18
+jal zero,16
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-118
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,2
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,73
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-197
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+jal zero,21
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-216
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,1004
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-78
+addi t0,a0,0
+beq t0,zero,21
+ld t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-223
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,504(t2)
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-230
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+addi t0,zero,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-124
+addi t0,a0,0
+addi a0,t0,0
+jal zero,7
+jal zero,5
+ld t0,-8(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+beq t0,zero,33
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-323
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-339
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,488(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,7
+ld t0,24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,440(t0)
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,448(t2)
+remu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,456(t2)
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29687
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29682
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-29656
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,416(t0)
+ld t1,16(s0)
+addi t2,zero,8
+divu t1,t1,t2
+ld t2,24(s0)
+add t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,424(t2)
+remu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,432(t2)
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,392(t0)
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,416(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,424(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,432(t1)
+mul t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-22192
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,392(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-510
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-81
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+beq t0,zero,74
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29707
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,56
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29702
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,46
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29693
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-550
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,384(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,384(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29700
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-558
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,103
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,376(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,376(t0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-554
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,76
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,516
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,61
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,525
+addi t0,a0,0
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+beq t0,zero,45
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-29756
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-29749
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-657
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-29742
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-652
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-29743
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,392(t0)
+ld t0,-24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-342
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29992
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29987
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,408(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,408(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29986
+addi t0,a0,0
+addi a0,t0,0
+jal zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,400(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,400(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-490
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,19
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-29997
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-29990
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-29979
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-106
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-830
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-8(s0)
+jal ra,18989
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,488(t1)
+sltu t0,t0,t1
+beq t0,zero,19
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+ld t2,-24(s0)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,504(t3)
+mul t2,t2,t3
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-23
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-876
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,368(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,368(t0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-526
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,32(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-479
+ld t0,16(s0)
+ld t1,24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+jal zero,107
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-958
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+jal ra,18857
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-982
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,52
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-843
+addi t0,a0,0
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-185
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-994
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1012
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,32(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-578
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1031
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,32(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,512(t1)
+divu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,512(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,520(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,16(s0)
+ld t1,24(s0)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-80
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-358
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-102
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-481
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,512(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,504(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,512(t2)
+divu t1,t1,t2
+mul t0,t0,t1
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,560(t0)
+beq t0,zero,20
+lui t0,0xFFFFD
+addi t0,t0,1048
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+ld t0,-16(s0)
+sd t0,32(sp)
+ld t0,-24(s0)
+sd t0,40(sp)
+jal ra,-23196
+addi sp,sp,40
+ld t0,-24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-81
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1270
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1264(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-206
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,19436
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-122
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-1300
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+beq t0,zero,7
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2788
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-164
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2988
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-106
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1264(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-301
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,19341
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-220
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-3012
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-139
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-257
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2974
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-199
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-297
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-3145
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-239
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,33
+ld t0,-168(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1040
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+ld t1,16(s0)
+ld t2,24(s0)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-23458
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23397
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-48(t0)
+beq t0,zero,66
+ld t0,-168(gp)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1024
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,16(sp)
+ld t0,16(s0)
+sd t0,24(sp)
+jal ra,-23500
+addi sp,sp,16
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23439
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+sd t0,8(sp)
+jal ra,-92
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-104(t0)
+beq t0,zero,5
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,125
+jal zero,22
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-168(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1016
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-23540
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23478
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,103
+jal zero,101
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-112(t0)
+beq t0,zero,44
+ld t0,-288(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1008
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-23532
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+sd t0,8(sp)
+jal ra,-153
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-288(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1016
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-23558
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,56
+jal zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-96(t0)
+beq t0,zero,47
+ld t0,-288(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1008
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-23579
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-198
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-288(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,992
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+sd t0,16(sp)
+jal ra,-23607
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-192
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-168(gp)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,976
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4003
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15339
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,20
+sd t0,8(sp)
+jal ra,-25967
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-23706
+addi sp,sp,24
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23645
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,968
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23767
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4605
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1824
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23789
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4583
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4404
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-26478
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-280(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-280(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-280(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-280(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15134
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1368(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1368(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,88(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,96(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-455
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,22
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-168(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,960
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-23969
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23907
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,52
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-168(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,944
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3693
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15649
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15657
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+sd t0,40(sp)
+jal ra,-24018
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23957
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1016
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24080
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4356
+lui t0,0xFFFFE
+addi t0,t0,-1648
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24092
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4344
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFE
+addi t0,t0,-1824
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24114
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4322
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+sd t0,8(sp)
+jal ra,-15567
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,51
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-288(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-288(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-288(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-288(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15451
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1360(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-737
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-168(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,928
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3458
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15884
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15892
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15900
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-24257
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24196
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1016
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24318
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4118
+addi t0,zero,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24329
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4107
+lui t0,0xFFFFE
+addi t0,t0,-1648
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24341
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4095
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15686
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15692
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-296(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-296(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-296(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-296(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15687
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1352(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1352(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15806
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15812
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-304(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-304(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-304(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-304(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15807
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1344(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1344(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15926
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15932
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+mul t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-312(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-312(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-312(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-312(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-15927
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1336(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1336(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,102
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16060
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16066
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-320(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-320(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-320(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-320(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16061
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,8(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,3963
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1328(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1328(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,102
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16205
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16211
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+remu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-328(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-328(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-328(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-328(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16206
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,8(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,3818
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1320(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1320(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16336
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16342
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,63
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-8(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-336(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-336(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-336(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-336(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16342
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1312(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1628
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-168(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,912
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2567
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16775
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16787
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-25144
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25083
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,1016
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25221
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3151
+addi t0,zero,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25232
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-2158
+addi t0,a0,0
+beq t0,zero,91
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3250
+addi t0,a0,0
+beq t0,zero,75
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2141
+addi t0,a0,0
+beq t0,zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16789
+addi t0,a0,0
+beq t0,zero,21
+lui t0,0xFFFFD
+addi t0,t0,888
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2071
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-25282
+addi sp,sp,16
+jal zero,20
+lui t0,0xFFFFD
+addi t0,t0,864
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2091
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-25302
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3133
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,832
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-25318
+addi sp,sp,8
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,784
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-25328
+addi sp,sp,8
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,760
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-25338
+addi sp,sp,8
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-2276
+addi t0,a0,0
+beq t0,zero,38
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3132
+addi t0,a0,0
+beq t0,zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-2259
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFE
+addi t0,t0,-1824
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25380
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3056
+lui t0,0xFFFFD
+addi t0,t0,744
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-25394
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-2347
+addi t0,a0,0
+beq t0,zero,30
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3061
+addi t0,a0,0
+beq t0,zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2330
+addi t0,a0,0
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2764
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16798
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-2417
+addi t0,a0,0
+beq t0,zero,176
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2991
+addi t0,a0,0
+beq t0,zero,161
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2400
+addi t0,a0,0
+beq t0,zero,138
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,616(t0)
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,656(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2395
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-3683
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2266
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+ld t1,-16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+sd t1,0(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-344(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-344(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-344(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-344(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-16909
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1208(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+divu t0,t0,t1
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1304(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1304(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-432(t1)
+ld t2,-24(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,40(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2617
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,3142
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,32(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,3133
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,3124
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2193
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-168(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,912
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2002
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17340
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17352
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-25709
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25648
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFD
+addi t0,t0,1016
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25786
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2586
+addi t0,zero,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25797
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2639
+lui t0,0xFFFFE
+addi t0,t0,-1648
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25809
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-2735
+addi t0,a0,0
+beq t0,zero,85
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2753
+addi t0,a0,0
+beq t0,zero,69
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2718
+addi t0,a0,0
+beq t0,zero,49
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17366
+addi t0,a0,0
+beq t0,zero,21
+lui t0,0xFFFFD
+addi t0,t0,720
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2648
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-25859
+addi sp,sp,16
+jal zero,20
+lui t0,0xFFFFD
+addi t0,t0,704
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2668
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-25879
+addi sp,sp,16
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,832
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-25889
+addi sp,sp,8
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,784
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-25899
+addi sp,sp,8
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,760
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-25909
+addi sp,sp,8
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-2847
+addi t0,a0,0
+beq t0,zero,32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2641
+addi t0,a0,0
+beq t0,zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-2830
+addi t0,a0,0
+beq t0,zero,16
+lui t0,0xFFFFD
+addi t0,t0,680
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-25953
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2482
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-2912
+addi t0,a0,0
+beq t0,zero,29
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2576
+addi t0,a0,0
+beq t0,zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2895
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2810
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2200
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17362
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-2981
+addi t0,a0,0
+beq t0,zero,189
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2507
+addi t0,a0,0
+beq t0,zero,174
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2964
+addi t0,a0,0
+beq t0,zero,151
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-17513
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,616(t0)
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,648(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2967
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-4255
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2738
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-2824
+jal zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-352(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-352(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-2856
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1208(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+divu t0,t0,t1
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1296(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1296(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-440(t0)
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-440(t1)
+ld t2,-16(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,40(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3194
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,2565
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,32(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2556
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,2547
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,72(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,88(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,96(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-3081
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2821
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-168(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,944
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1374
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17968
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17976
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,64(t0)
+sd t0,8(sp)
+jal ra,-28848
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-26345
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26284
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-96(t0)
+beq t0,zero,28
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-288(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,672
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-26345
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1016
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26440
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1996
+addi t0,zero,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26451
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1985
+lui t0,0xFFFFD
+addi t0,t0,656
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,-26467
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,640
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,-26488
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1719
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17841
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17847
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1728(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-360(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-360(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1288(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3093
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-168(gp)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,624
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1102
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18240
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,64(t0)
+sd t0,8(sp)
+jal ra,-29112
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-26609
+addi sp,sp,24
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26548
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-96(t0)
+beq t0,zero,28
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-288(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,672
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-26609
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,968
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26704
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1661
+addi t0,zero,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26722
+lui t0,0xFFFFD
+addi t0,t0,608
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,-26732
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-270
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+addi t0,zero,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26756
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1616
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,67
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1728(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1208(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-400(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-400(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-408(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-408(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,88
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-29347
+addi t0,a0,0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1728(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1208(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+divu t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-416(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-416(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-424(t1)
+ld t2,-8(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+jal zero,29
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1728(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-368(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-368(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18178
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1280(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1280(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3454
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-168(gp)
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,912
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,741
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18601
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,64(t0)
+sd t0,8(sp)
+jal ra,-29473
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18621
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-26978
+addi sp,sp,32
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-26917
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,1016
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27039
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1333
+lui t0,0xFFFFE
+addi t0,t0,-1648
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27051
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,1314
+addi t0,zero,-1096
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27069
+lui t0,0xFFFFD
+addi t0,t0,608
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,-27079
+addi sp,sp,8
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18419
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-29726
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-29756
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-376(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-376(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-208(t0)
+jal zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18423
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1272(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1272(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3699
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-168(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-1848
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,496
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-27195
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27134
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,961
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1704(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18597
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1264(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1264(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-80(t0)
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,88(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,96(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+jal ra,-28191
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+jal zero,150
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1056(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,57
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-72(t0)
+beq t0,zero,19
+lui t0,0xFFFFD
+addi t0,t0,552
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-27350
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37101
+jal zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-104(t0)
+beq t0,zero,19
+lui t0,0xFFFFD
+addi t0,t0,488
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-27372
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1456(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37123
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+jal ra,-10415
+jal zero,79
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18718
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1120(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1088(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+ld t0,-1656(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18750
+ld t0,-1664(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18754
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1096(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-1672(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18773
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18694
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,24(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,1336
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,72(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,88(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,96(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,72(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,88(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,96(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+ld t0,-288(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1040
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1160(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1200(t2)
+sub t1,t1,t2
+ld t2,-136(gp)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-27504
+addi sp,sp,8
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-288(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1008
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,16(sp)
+jal ra,-27535
+addi sp,sp,8
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-72
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-288(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1016
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-27554
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-96(t0)
+beq t0,zero,5
+jal ra,-58
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-32(gp)
+beq t0,zero,18
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-288(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,480
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-27595
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,17
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-288(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,472
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-27612
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-288(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,1008
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16622
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-27640
+addi sp,sp,8
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,248(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3803
+addi t0,a0,0
+addi a0,t0,0
+jal zero,201
+jal zero,199
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-2644
+addi t0,a0,0
+addi a0,t0,0
+jal zero,186
+jal zero,184
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-2094
+addi t0,a0,0
+addi a0,t0,0
+jal zero,171
+jal zero,169
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3565
+addi t0,a0,0
+addi a0,t0,0
+jal zero,156
+jal zero,154
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,336(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3580
+addi t0,a0,0
+addi a0,t0,0
+jal zero,141
+jal zero,139
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3595
+addi t0,a0,0
+addi a0,t0,0
+jal zero,126
+jal zero,124
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3610
+addi t0,a0,0
+addi a0,t0,0
+jal zero,111
+jal zero,109
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3625
+addi t0,a0,0
+addi a0,t0,0
+jal zero,96
+jal zero,94
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-3640
+addi t0,a0,0
+addi a0,t0,0
+jal zero,81
+jal zero,79
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1572
+addi t0,a0,0
+addi a0,t0,0
+jal zero,66
+jal zero,64
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-1315
+addi t0,a0,0
+addi a0,t0,0
+jal zero,51
+jal zero,49
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,264(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-968
+addi t0,a0,0
+addi a0,t0,0
+jal zero,36
+jal zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-4245
+addi t0,a0,0
+addi a0,t0,0
+jal zero,21
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,256(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+jal ra,-753
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,20030
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,240(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+add t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFD
+addi t0,t0,424
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+sd t0,16(sp)
+jal ra,-28006
+addi sp,sp,16
+jal zero,208
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-256(gp)
+sd t0,8(sp)
+jal ra,-14169
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,232(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,232(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-30525
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFD
+addi t0,t0,376
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+sd t0,16(sp)
+jal ra,-28048
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37799
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+sd t0,-280(gp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,232(t0)
+sd t0,-288(gp)
+jal ra,-37615
+jal ra,-34314
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-48(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-96(t0)
+addi t0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sltu t0,t0,t1
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17102
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-216(t0)
+jal ra,1007
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-360
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-288(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-1920
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-28050
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+jal zero,-56
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-515
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-288(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+addi t0,t0,-1920
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-28096
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+ld t2,-136(gp)
+add t1,t1,t2
+sd t1,-208(t0)
+jal zero,-43
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-96(t0)
+addi t0,zero,0
+sd t0,-280(gp)
+ld t0,-208(gp)
+sd t0,-288(gp)
+lui t0,0xFFFFD
+addi t0,t0,264
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+ld t0,-144(gp)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,240(t0)
+sd t0,48(sp)
+jal ra,-28214
+addi sp,sp,48
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,80(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,88(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,96(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,72(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,88(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,96(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,88(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,88(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,88(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,96(t1)
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,88(t0)
+sd t0,-8(s0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,96(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-72(t0)
+ld t0,-8(s0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,88(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,88(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,80(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,88(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,96(t3)
+remu t2,t2,t3
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,-208(t0)
+jal ra,628
+jal ra,774
+jal ra,2860
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,-36
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-80(t0)
+ld t0,-8(s0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,17
+jal ra,610
+jal ra,756
+jal ra,2889
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,88(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,88(t0)
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,-19
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-80(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-72(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,248
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20004
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-28403
+addi sp,sp,16
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,232
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20036
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-28435
+addi sp,sp,16
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19977
+addi t0,a0,0
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-78
+jal zero,32
+lui t0,0xFFFFD
+addi t0,t0,216
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20079
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+jal ra,-28487
+addi sp,sp,24
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,7313
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-512(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-512(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,50
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,7348
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-528(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-528(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,7370
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-544(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-544(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,7233
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-520(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-520(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,50
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,7268
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-536(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-536(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,7290
+addi t0,a0,0
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-552(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-552(t0)
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+addi t0,t0,-1848
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-32(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-28673
+addi sp,sp,8
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,40(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,192
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-28690
+addi sp,sp,8
+jal zero,109
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,32(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,168
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-28708
+addi sp,sp,8
+jal zero,91
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,24(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,160
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-28726
+addi sp,sp,8
+jal zero,73
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,8(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,168
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-28744
+addi sp,sp,8
+jal zero,55
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,144
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-28762
+addi sp,sp,8
+jal zero,37
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-8(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,168
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-28780
+addi sp,sp,8
+jal zero,19
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-16(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,136
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28796
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20394
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33828
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,48(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,68
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33841
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,57
+lui t0,0xFFFFD
+addi t0,t0,96
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33766
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-28852
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-205
+lui t0,0xFFFFD
+addi t0,t0,56
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-28865
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33883
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33873
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-229
+jal ra,-29765
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1464(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38634
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-33146
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-33137
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-40(t0)
+beq t0,zero,39
+lui t0,0xFFFFD
+addi t0,t0,96
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33846
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-28932
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-285
+lui t0,0xFFFFD
+addi t0,t0,0
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-28949
+addi sp,sp,8
+jal ra,-1209
+jal ra,-29833
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,64(t0)
+sd t0,8(sp)
+jal ra,-5892
+addi t0,a0,0
+beq t0,zero,107
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,6778
+addi t0,a0,0
+beq t0,zero,84
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,616(t0)
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,664(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,-5868
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-7156
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+ld t1,-136(gp)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,-5615
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18293
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-216(t0)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-5642
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18298
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-216(t0)
+jal zero,32
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,32(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,-273
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,-284
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17879
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-216(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20111
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1760(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-224(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2000(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,-19936
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1928(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sd t1,-224(t0)
+jal zero,367
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,2008(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+jal ra,-19964
+ld t0,-32(gp)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1872(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sd t1,-224(t0)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1856(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sd t1,-224(t0)
+jal zero,320
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1992(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+jal ra,-19797
+ld t0,-32(gp)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1864(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sd t1,-224(t0)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1848(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sd t1,-224(t0)
+jal zero,273
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1984(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,144
+jal ra,-20230
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1920(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1816(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+sd t1,-224(t0)
+jal zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1800(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,336(t1)
+sd t1,-224(t0)
+jal zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1808(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+sd t1,-224(t0)
+jal zero,81
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1896(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1792(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+sd t1,-224(t0)
+jal zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1888(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1784(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+sd t1,-224(t0)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1880(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1712(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1776(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+sd t1,-224(t0)
+jal zero,120
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1968(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,-19705
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1840(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+sd t1,-224(t0)
+jal zero,92
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1952(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-19457
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sd t1,-224(t0)
+jal zero,74
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1960(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,19
+jal ra,-20257
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1832(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,264(t1)
+sd t1,-224(t0)
+jal zero,46
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1976(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-19377
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sd t1,-224(t0)
+jal zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1944(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,18
+jal ra,-20303
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1720(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1824(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,256(t1)
+sd t1,-224(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-48(t0)
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-8(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,-737
+jal zero,32
+ld t0,-208(gp)
+sd t0,-288(gp)
+lui t0,0xFFFFD
+addi t0,t0,-80
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1760(t0)
+sd t0,32(sp)
+jal ra,-29568
+addi sp,sp,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1440(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39319
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34716
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34708
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,66
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,56
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34309
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34740
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+divu t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-136(t1)
+mul t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29295
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-33609
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34343
+addi t0,a0,0
+ld t1,24(s0)
+ld t2,-8(s0)
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-136(t2)
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34380
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,93
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-272(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-272(t0)
+ld t0,24(s0)
+sd t0,-16(s0)
+ld t0,32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,33
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-139
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-36242
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+add t0,t0,t1
+sd t0,24(s0)
+ld t0,32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+sub t0,t0,t1
+sd t0,32(s0)
+jal zero,-39
+addi t0,zero,1
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-200(t1)
+sltu t0,t0,t1
+beq t0,zero,35
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t1,-24(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-185
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36416
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36207
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-39
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-216(t0)
+sd t0,8(sp)
+jal ra,-36329
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+sd t0,8(sp)
+jal ra,-36324
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+sd t0,8(sp)
+jal ra,-36315
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1752(t0)
+sd t0,8(sp)
+jal ra,-36306
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1744(t0)
+sd t0,8(sp)
+jal ra,-36297
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+sd t0,8(sp)
+jal ra,-36288
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+sd t0,8(sp)
+jal ra,-36279
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,-295
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,94
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36523
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,85
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+beq t0,zero,3
+jal ra,-939
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,616(t0)
+beq t0,zero,2
+jal ra,-945
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36562
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36559
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-224(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36552
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36545
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1752(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36538
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36531
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+jal zero,25
+jal ra,-1019
+jal ra,-873
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,11
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-199
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,614
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36651
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,34
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36644
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36635
+addi t0,a0,0
+ld t1,32(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36607
+addi t0,a0,0
+ld t1,40(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36710
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,52
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36682
+addi t0,a0,0
+ld t1,-1584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36654
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,32
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36729
+addi t0,a0,0
+ld t1,32(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,17
+jal zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36703
+addi t0,a0,0
+ld t1,32(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,-40(gp)
+ld t1,-144(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,412
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-581
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-595
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,381
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-136(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-1584(gp)
+sd t0,16(sp)
+ld t0,-136(gp)
+sub t0,zero,t0
+sd t0,24(sp)
+jal ra,-197
+addi t0,a0,0
+beq t0,zero,141
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-184(t1)
+addi t2,zero,1
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-643
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,77
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+sd t0,8(sp)
+ld t0,-1576(gp)
+sd t0,16(sp)
+jal ra,-173
+addi t0,a0,0
+beq t0,zero,65
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-136(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-1584(gp)
+sd t0,16(sp)
+ld t0,-136(gp)
+sub t0,zero,t0
+sd t0,24(sp)
+jal ra,-251
+addi t0,a0,0
+beq t0,zero,46
+ld t0,-16(s0)
+addi t1,zero,2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-136(t2)
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+sd t0,8(sp)
+ld t0,-1632(gp)
+sd t0,16(sp)
+jal ra,-212
+addi t0,a0,0
+beq t0,zero,26
+ld t0,-16(s0)
+addi t1,zero,3
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-136(t2)
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-1632(gp)
+sd t0,8(sp)
+ld t0,-1584(gp)
+sd t0,16(sp)
+addi t0,zero,0
+sd t0,24(sp)
+jal ra,-291
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-160(t0)
+addi a0,t0,0
+jal zero,261
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36945
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,29
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36900
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,288(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-272
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-144(t0)
+addi a0,t0,0
+jal zero,221
+jal zero,216
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36986
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,155
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36979
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,143
+ld t0,-24(s0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,138
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-318
+addi t0,a0,0
+beq t0,zero,126
+ld t0,-16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-1584(gp)
+sd t0,8(sp)
+ld t0,-1584(gp)
+sd t0,16(sp)
+ld t0,-136(gp)
+sd t0,24(sp)
+jal ra,-389
+addi t0,a0,0
+beq t0,zero,114
+ld t0,-24(s0)
+ld t1,-1632(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,103
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-192(t1)
+addi t2,zero,1
+sub t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-841
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,80
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-136(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,296(t0)
+sd t0,8(sp)
+ld t0,-1576(gp)
+sd t0,16(sp)
+jal ra,-377
+addi t0,a0,0
+beq t0,zero,62
+ld t0,-16(s0)
+addi t1,zero,2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-136(t2)
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37093
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,42
+ld t0,-16(s0)
+addi t1,zero,2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-136(t2)
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37094
+addi t0,a0,0
+ld t1,-1584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,-16(s0)
+addi t1,zero,2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-136(t2)
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37093
+addi t0,a0,0
+ld t1,-1584(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-168(t0)
+addi a0,t0,0
+jal zero,60
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-152(t0)
+addi a0,t0,0
+jal zero,55
+jal zero,50
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37152
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37145
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,27
+ld t0,-24(s0)
+ld t1,-1584(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+ld t0,-16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37111
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-547
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-176(t0)
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-160(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-184(t0)
+addi a0,t0,0
+jal zero,20
+jal zero,18
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-168(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-192(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,2
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-200(t1)
+sltu t0,t0,t1
+beq t0,zero,67
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+ld t1,-16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-1060
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,41
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37288
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,32
+ld t0,16(s0)
+ld t1,-16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-526
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-106
+addi t0,a0,0
+ld t1,-16(s0)
+sltu t0,t1,t0
+beq t0,zero,7
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-37112
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-71
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,-1134
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,83
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37362
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,74
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37390
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37292
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-224(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37380
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37373
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1752(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37366
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37359
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+jal zero,2
+jal ra,-944
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-72(t0)
+beq t0,zero,3
+jal ra,176
+jal zero,2
+jal ra,412
+jal zero,168
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6713
+jal zero,156
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5386
+jal zero,144
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4834
+jal zero,132
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6522
+jal zero,120
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,336(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6414
+jal zero,108
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6306
+jal zero,96
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6198
+jal zero,84
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-6065
+jal zero,72
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-5932
+jal zero,60
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4438
+jal zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4191
+jal zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,264(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3885
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-7159
+jal zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,256(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal ra,-3728
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7215
+jal ra,-6891
+jal zero,169
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5628
+jal ra,-5565
+jal zero,156
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-5076
+jal ra,-5014
+jal zero,143
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7254
+jal ra,-6703
+jal zero,130
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,336(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7267
+jal ra,-6596
+jal zero,117
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7280
+jal ra,-6489
+jal zero,104
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7293
+jal ra,-6382
+jal zero,91
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7306
+jal ra,-6250
+jal zero,78
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7319
+jal ra,-6118
+jal zero,65
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-4638
+jal ra,-4625
+jal zero,52
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7345
+jal ra,-4379
+jal zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,264(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7358
+jal ra,-4074
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+jal ra,-7371
+jal ra,-7349
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,256(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3939
+jal ra,-3919
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4937
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,15
+jal zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,256(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-3755
+jal zero,2
+jal ra,-7313
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-3502
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-7185
+jal ra,-7130
+jal ra,-7153
+jal zero,187
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-6074
+jal ra,-5805
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5928
+jal zero,170
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+jal ra,-5526
+jal ra,-5258
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-5374
+jal zero,153
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-6995
+jal ra,-6951
+jal ra,-7201
+jal zero,139
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,336(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-7009
+jal ra,-6845
+jal ra,-7215
+jal zero,125
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-7023
+jal ra,-6739
+jal ra,-7229
+jal zero,111
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-7037
+jal ra,-6633
+jal ra,-7243
+jal zero,97
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-7051
+jal ra,-6502
+jal ra,-7257
+jal zero,83
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-7065
+jal ra,-6371
+jal ra,-7271
+jal zero,69
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4957
+jal ra,-4879
+jal ra,-4915
+jal zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4707
+jal ra,-4634
+jal ra,-4664
+jal zero,41
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,264(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-4386
+jal ra,-4330
+jal ra,-4678
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-7672
+jal ra,-7606
+jal ra,-7652
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,256(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-4176
+jal zero,2
+jal ra,-32326
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+ld t0,-40(gp)
+ld t1,-144(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-144(gp)
+sd t0,8(sp)
+jal ra,-33702
+addi t0,a0,0
+sd t0,24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-8434
+addi t0,a0,0
+beq t0,zero,92
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,4487
+addi t0,a0,0
+beq t0,zero,73
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-8421
+addi t0,a0,0
+beq t0,zero,50
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+ld t1,-1568(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-8354
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1304(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1304(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,40(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8550
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2791
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,32(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2800
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2809
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-8572
+addi t0,a0,0
+beq t0,zero,81
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,4349
+addi t0,a0,0
+beq t0,zero,62
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-8559
+addi t0,a0,0
+beq t0,zero,39
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-8461
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1296(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1296(t0)
+jal zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,40(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8677
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2918
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,32(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2927
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-2936
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,352(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,41
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-338
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1360(t0)
+jal zero,704
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,296(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-331
+jal zero,692
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,288(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal ra,-205
+jal zero,680
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,344(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-419
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1352(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1352(t0)
+jal zero,623
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,336(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-476
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1344(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1344(t0)
+jal zero,566
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,328(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+mul t0,t0,t1
+sd t0,8(sp)
+jal ra,-533
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1336(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1336(t0)
+jal zero,509
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,320(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,73
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+divu t0,t0,t1
+sd t0,8(sp)
+jal ra,-604
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,8(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,-3270
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1328(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1328(t0)
+jal zero,427
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,312(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,73
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1744(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+remu t0,t0,t1
+sd t0,8(sp)
+jal ra,-686
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,8(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,-3352
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1320(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1320(t0)
+jal zero,345
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,304(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,59
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-756
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-765
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1312(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1312(t0)
+jal zero,277
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,280(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-232(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1744(t2)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1728(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+jal zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1288(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1288(t0)
+jal zero,213
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,272(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,34
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-872
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1728(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1280(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1280(t0)
+jal zero,170
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,264(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,55
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1752(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1728(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-34981
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-35011
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-942
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1272(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1272(t0)
+jal zero,106
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1736(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-35063
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-981
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1368(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1368(t0)
+jal zero,61
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,256(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,51
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1264(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1264(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1056(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+add t1,t1,t2
+sd t1,-208(t0)
+jal ra,-15519
+jal zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,24(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-3705
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-9448
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,3473
+addi t0,a0,0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-9435
+addi t0,a0,0
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,94
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39231
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-216(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39228
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-224(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39221
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39214
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1752(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39207
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1744(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39200
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1728(t0)
+jal ra,-892
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-256(t0)
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,18
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-136(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,16(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-96
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,-3110
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2127
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,16(s0)
+sltu t0,t1,t0
+beq t0,zero,10
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,1
+sd t0,8(sp)
+jal ra,-150
+addi t0,a0,0
+addi a0,t0,0
+jal zero,537
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-144(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,74
+ld t0,-24(s0)
+ld t1,-136(gp)
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-221
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-190
+addi t0,a0,0
+addi a0,t0,0
+jal zero,497
+ld t0,-24(s0)
+ld t1,-136(gp)
+sub t0,t0,t1
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-136(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39359
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-9557
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1360(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1296(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1296(t0)
+jal zero,404
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-152(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,64
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-302
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-271
+addi t0,a0,0
+addi a0,t0,0
+jal zero,416
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-9646
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-24(s0)
+ld t1,-136(gp)
+add t0,t0,t1
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1304(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1304(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1360(t0)
+jal zero,331
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-160(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,118
+ld t0,-24(s0)
+ld t1,-136(gp)
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-377
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-346
+addi t0,a0,0
+addi a0,t0,0
+jal zero,341
+jal zero,24
+ld t0,-24(s0)
+addi t1,zero,2
+ld t2,-136(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-401
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-370
+addi t0,a0,0
+addi a0,t0,0
+jal zero,317
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+ld t1,-136(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1576(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-9721
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+addi t1,zero,2
+ld t2,-136(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-9742
+ld t0,-24(s0)
+addi t1,zero,2
+ld t2,-136(gp)
+mul t1,t1,t2
+sub t0,t0,t1
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-24(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+addi t2,zero,3
+add t1,t1,t2
+sd t1,1360(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1296(t1)
+addi t2,zero,2
+add t1,t1,t2
+sd t1,1296(t0)
+jal zero,204
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-168(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,125
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-502
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-471
+addi t0,a0,0
+addi a0,t0,0
+jal zero,216
+jal zero,22
+ld t0,-24(s0)
+ld t1,-136(gp)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-524
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-493
+addi t0,a0,0
+addi a0,t0,0
+jal zero,194
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-9866
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1576(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-240(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+ld t1,-136(gp)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-9889
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-24(s0)
+ld t1,-136(gp)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,3
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-136(t2)
+mul t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39678
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1304(t1)
+addi t2,zero,2
+add t1,t1,t2
+sd t1,1304(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+addi t2,zero,2
+add t1,t1,t2
+sd t1,1360(t0)
+jal zero,70
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-176(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,60
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1736(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1728(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,12
+sd t0,8(sp)
+jal ra,-35803
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-136(t1)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39746
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1368(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1368(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,1360(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-232(t0)
+ld t1,-1584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-24(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-208(t1)
+ld t2,-16(s0)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,64(t3)
+mul t2,t2,t3
+add t1,t1,t2
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-384(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-384(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-392(t1)
+ld t2,-16(s0)
+add t1,t1,t2
+sd t1,-392(t0)
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-264(t0)
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-264(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,44
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-248(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,-248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-248(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38316
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,48(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,16(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-4514
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-248(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-88(t0)
+beq t0,zero,50
+ld t0,-8(s0)
+ld t1,16(s0)
+sltu t0,t0,t1
+beq t0,zero,45
+jal ra,-2647
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-224(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,256(t1)
+sltu t0,t1,t0
+beq t0,zero,23
+ld t0,16(s0)
+ld t1,-8(s0)
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-685
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-256(t0)
+beq t0,zero,6
+ld t0,-8(s0)
+ld t1,-16(s0)
+add t0,t0,t1
+addi a0,t0,0
+jal zero,42
+ld t0,-8(s0)
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,13
+jal ra,-1625
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-256(t0)
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,29
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-47
+jal zero,19
+ld t0,-8(s0)
+ld t1,16(s0)
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-3535
+jal ra,-2585
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-256(t0)
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,10
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-17
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-256(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,62
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-248(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-128(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-64(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-120
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-248(t0)
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-131
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-264(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-248(t1)
+ld t2,-8(s0)
+sub t1,t1,t2
+sd t1,-248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-256(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+jal ra,-3628
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-88(t0)
+beq t0,zero,3
+jal ra,-1741
+jal zero,2
+jal ra,-2684
+jal ra,-240
+jal zero,-68
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-256(t0)
+jal ra,-15576
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,-64(gp)
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1200(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-32(s0)
+ld t0,-16(s0)
+ld t1,-32(s0)
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,-32(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-32(s0)
+sd t0,-16(s0)
+ld t0,-24(s0)
+sd t0,-8(s0)
+jal zero,8
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,23
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-41
+ld t0,-8(s0)
+ld t1,-64(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,64(t1)
+mul t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-64(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-88
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-64(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,81
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+lui t0,0xFFFFD
+addi t0,t0,-104
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-34763
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-34743
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+sd t0,32(sp)
+jal ra,-33653
+addi sp,sp,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFD
+addi t0,t0,1040
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+divu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-33680
+addi sp,sp,8
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lui t0,0xFFFFD
+addi t0,t0,-120
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-33691
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFD
+addi t0,t0,-136
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-33720
+addi sp,sp,24
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+ld t0,-64(gp)
+sd t0,16(sp)
+jal ra,-152
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-155
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-158
+jal ra,-34627
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+ld t1,40(s0)
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,48
+ld t0,40(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,1
+sd t0,40(s0)
+lui t0,0xFFFFD
+addi t0,t0,-168
+add t0,gp,t0
+addi sp,sp,-72
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+ld t0,32(s0)
+ld t1,40(s0)
+add t0,t0,t1
+sd t0,32(sp)
+ld t0,32(s0)
+sd t0,40(sp)
+ld t0,40(s0)
+sd t0,48(sp)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-34976
+addi t0,a0,0
+sd t0,56(sp)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+jal ra,-34956
+addi t0,a0,0
+sd t0,64(sp)
+jal ra,-33808
+addi sp,sp,64
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25436
+addi t0,a0,0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFD
+addi t0,t0,-184
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-448(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+jal ra,-97
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFD
+addi t0,t0,-248
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-33870
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,-264
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1512
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-544(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-552(t0)
+sd t0,24(sp)
+jal ra,-136
+ld t0,-1592(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-77
+lui t0,0xFFFFD
+addi t0,t0,-280
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1512
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-512(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-520(t0)
+sd t0,24(sp)
+jal ra,-157
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1552(gp)
+sltu t0,t0,t1
+beq t0,zero,46
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25490
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-464(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-448(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,-464(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-472(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-456(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,-472(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-140
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-48
+lui t0,0xFFFFD
+addi t0,t0,-296
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1512
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-464(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-472(t0)
+sd t0,24(sp)
+jal ra,-225
+lui t0,0xFFFFD
+addi t0,t0,-312
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1512
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-528(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-536(t0)
+sd t0,24(sp)
+jal ra,-242
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1552(gp)
+sltu t0,t0,t1
+beq t0,zero,46
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25503
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-480(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-448(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,-480(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-488(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-456(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,-488(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-225
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-48
+lui t0,0xFFFFD
+addi t0,t0,-328
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1512
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-480(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-488(t0)
+sd t0,24(sp)
+jal ra,-310
+addi t0,zero,1
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-1552(gp)
+sltu t0,t0,t1
+beq t0,zero,46
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-25542
+addi t0,a0,0
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-496(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-448(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,-496(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-504(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-456(t2)
+ld t3,-8(s0)
+addi t4,zero,8
+mul t3,t3,t4
+add t2,t2,t3
+ld t2,0(t2)
+add t1,t1,t2
+sd t1,-504(t0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-293
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-48
+lui t0,0xFFFFD
+addi t0,t0,-344
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+addi t0,zero,-1512
+add t0,gp,t0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-496(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-504(t0)
+sd t0,24(sp)
+jal ra,-378
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39101
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39371
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39092
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39659
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-10963
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-38303
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39603
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-10979
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-38234
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39673
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-10995
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-38318
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39671
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-11011
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-38317
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39669
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-11027
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-38316
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,34
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39218
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1312(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38906
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1000(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-148
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39582
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-37
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFD
+addi t0,t0,-424
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39215
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-24156
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39225
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35453
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-24169
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39238
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35438
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-24182
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39251
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35535
+addi t0,a0,0
+sd t0,40(sp)
+jal ra,-24195
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39264
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35520
+addi t0,a0,0
+sd t0,48(sp)
+jal ra,-34372
+addi sp,sp,48
+addi t0,zero,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,62
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39345
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,45
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39301
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39275
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39266
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39257
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39737
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,-65
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,76
+lui t0,0xFFFFD
+addi t0,t0,-528
+add t0,gp,t0
+addi sp,sp,-64
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39364
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-35651
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39379
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35607
+addi t0,a0,0
+sd t0,32(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39391
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35591
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39400
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-35687
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,48(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39414
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-35673
+addi t0,a0,0
+sd t0,56(sp)
+jal ra,-34525
+addi sp,sp,56
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFE
+addi t0,t0,304
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-34548
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,-544
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-34559
+addi sp,sp,8
+jal ra,-24397
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,42
+lui t0,0xFFFFD
+addi t0,t0,-600
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+jal ra,-24407
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-24410
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-24346
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35704
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-24420
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-24356
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35686
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-34594
+addi sp,sp,24
+lui t0,0xFFFFD
+addi t0,t0,-616
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-34605
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,-688
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+jal ra,7170
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-35799
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,7159
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-35782
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,7143
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35765
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,7132
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35748
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,544(t1)
+divu t0,t0,t1
+sd t0,40(sp)
+jal ra,-34664
+addi sp,sp,40
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1216(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFD
+addi t0,t0,-744
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1216(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1224(t0)
+sd t0,24(sp)
+jal ra,-34689
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1272(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFD
+addi t0,t0,-800
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1272(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,368(t0)
+sd t0,24(sp)
+jal ra,-34714
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1280(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+lui t0,0xFFFFD
+addi t0,t0,-872
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1280(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1288(t0)
+sd t0,24(sp)
+jal ra,-34739
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1088(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,24
+lui t0,0xFFFFD
+addi t0,t0,-928
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1088(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1024(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,4640
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-34768
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1296(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,40
+lui t0,0xFFFFD
+addi t0,t0,-1024
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1296(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1304(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1296(t0)
+sd t0,8(sp)
+jal ra,-35977
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1304(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1296(t0)
+sd t0,8(sp)
+jal ra,-35961
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-34813
+addi sp,sp,32
+jal ra,-570
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,482
+lui t0,0xFFFFE
+addi t0,t0,496
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-34834
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,-1048
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39765
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-34851
+addi sp,sp,16
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39754
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,252
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-565
+lui t0,0xFFFFD
+addi t0,t0,-1096
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39680
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,552(t0)
+sd t0,8(sp)
+jal ra,-36064
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39694
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,552(t0)
+sd t0,8(sp)
+jal ra,-36050
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-34902
+addi sp,sp,24
+lui t0,0xFFFFD
+addi t0,t0,-1200
+add t0,gp,t0
+addi sp,sp,-72
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39947
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39973
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-36113
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39971
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39997
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-36109
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39843
+addi t0,a0,0
+sd t0,32(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39754
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-36157
+addi t0,a0,0
+sd t0,40(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39768
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-36143
+addi t0,a0,0
+sd t0,48(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40029
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40055
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,512(t0)
+sd t0,8(sp)
+jal ra,-34876
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39807
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36149
+addi t0,a0,0
+sd t0,56(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40063
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40089
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,512(t0)
+sd t0,8(sp)
+jal ra,-34910
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39841
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36155
+addi t0,a0,0
+sd t0,64(sp)
+jal ra,-35063
+addi sp,sp,64
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39662
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,40
+lui t0,0xFFFFD
+addi t0,t0,-1288
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39679
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39989
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39692
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-36280
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39720
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-35110
+addi sp,sp,32
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39975
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39963
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39954
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,160
+lui t0,0xFFFFD
+addi t0,t0,-1328
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40012
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40000
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39991
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,16(sp)
+jal ra,-35175
+addi sp,sp,16
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40135
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1312(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+lui t0,0xFFFFF
+addi t0,t0,-1848
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-35198
+addi sp,sp,8
+jal zero,18
+lui t0,0xFFFFF
+addi t0,t0,-1848
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40164
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40130
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35216
+addi sp,sp,8
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40119
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,44
+lui t0,0xFFFFD
+addi t0,t0,-1368
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40132
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40101
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40089
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40080
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-36443
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35267
+addi sp,sp,8
+jal ra,-36150
+lui t0,0xFFFFD
+addi t0,t0,-1440
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40142
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40129
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40116
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-35297
+addi sp,sp,32
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40595
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-485
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+beq t0,zero,16
+lui t0,0xFFFFE
+addi t0,t0,496
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-35319
+addi sp,sp,8
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,2931
+jal ra,-25161
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,111
+jal ra,-24948
+lui t0,0xFFFFE
+addi t0,t0,304
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-35340
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1168(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+lui t0,0xFFFFD
+addi t0,t0,-1504
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-35358
+addi sp,sp,8
+jal zero,12
+lui t0,0xFFFFD
+addi t0,t0,-1560
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-35370
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,-1576
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-400(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-408(t0)
+sd t0,16(sp)
+jal ra,-1683
+lui t0,0xFFFFD
+addi t0,t0,-1592
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-416(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-424(t0)
+sd t0,16(sp)
+jal ra,-1697
+lui t0,0xFFFFD
+addi t0,t0,-1608
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1304(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-432(t0)
+sd t0,16(sp)
+jal ra,-1711
+lui t0,0xFFFFD
+addi t0,t0,-1624
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1296(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-440(t0)
+sd t0,16(sp)
+jal ra,-1725
+lui t0,0xFFFFE
+addi t0,t0,304
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-35437
+addi sp,sp,8
+jal ra,-1584
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+beq t0,zero,150
+lui t0,0xFFFFE
+addi t0,t0,304
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-35453
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,-1688
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,736(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-14438
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-35472
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43773
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43763
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1704
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-14946
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43738
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1016(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+lui t0,0xFFFFD
+addi t0,t0,-1728
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,912(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43738
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-35523
+addi sp,sp,8
+jal ra,-36406
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43825
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,920(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43815
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1744
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-14998
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1032(t0)
+beq t0,zero,12
+lui t0,0xFFFFD
+addi t0,t0,-1776
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,688(t0)
+sd t0,8(sp)
+jal ra,-35561
+addi sp,sp,8
+jal ra,-36444
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,680(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,16
+lui t0,0xFFFFD
+addi t0,t0,-1848
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,680(t0)
+sd t0,16(sp)
+jal ra,-35583
+addi sp,sp,16
+jal ra,-14924
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,704(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,2
+jal ra,-14237
+lui t0,0xFFFFE
+addi t0,t0,304
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-35602
+addi sp,sp,8
+lui t0,0xFFFFD
+addi t0,t0,-1896
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-35613
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,408(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,400(t0)
+sd t0,8(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1912
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-15079
+jal ra,-36510
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,384(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,376(t1)
+add t0,t0,t1
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,384(t0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,376(t0)
+sd t0,8(sp)
+lui t0,0xFFFFD
+addi t0,t0,-1928
+add t0,gp,t0
+sd t0,16(sp)
+jal ra,-15104
+jal ra,-36535
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1704(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-1936
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35681
+jal zero,75
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1712(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-1944
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35698
+jal zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1720(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-1952
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35715
+jal zero,41
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1728(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-1960
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35732
+jal zero,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1736(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+lui t0,0xFFFFD
+addi t0,t0,-1976
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35749
+jal zero,7
+lui t0,0xFFFFE
+addi t0,t0,1328
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-35756
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40899
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,30
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40913
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40905
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40918
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,30
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40932
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40924
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41127
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-1584(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,520(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40981
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40976
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41005
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,21
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41228
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-1584(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-202
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-157
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,18
+jal zero,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-125
+addi t0,a0,0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-252
+addi t0,a0,0
+beq t0,zero,19
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41165
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41153
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,38
+jal zero,36
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-221
+addi t0,a0,0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,520(t0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,22
+jal zero,20
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-193
+addi t0,a0,0
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41150
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,1008
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38098
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1312(gp)
+sd t0,24(sp)
+ld t0,-1328(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,48(sp)
+jal ra,-34333
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+ld t0,-1584(gp)
+sd t0,16(sp)
+jal ra,-24830
+ld t0,-1568(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-24394
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,984
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38148
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1312(gp)
+sd t0,24(sp)
+ld t0,-1328(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,48(sp)
+jal ra,-34383
+ld t0,-1648(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1568(gp)
+sd t0,8(sp)
+ld t0,-1592(gp)
+sd t0,16(sp)
+jal ra,-24880
+ld t0,-1568(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-24444
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-1360(gp)
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFE
+addi t0,t0,960
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38198
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+ld t0,-1312(gp)
+sd t0,24(sp)
+ld t0,-1328(gp)
+sd t0,32(sp)
+addi t0,zero,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,48(sp)
+jal ra,-34433
+jal ra,-25016
+jal ra,-25017
+jal ra,-25018
+ld t0,-1568(gp)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-1576(gp)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-24489
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,1200(t0)
+ld t0,-1648(gp)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,8(sp)
+jal ra,-31150
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1360(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,1200(t2)
+ld t3,16(s0)
+sub t2,t2,t3
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,64(t3)
+divu t2,t2,t3
+sub t1,t1,t2
+sd t1,1360(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,1200(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41575
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41380
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,128
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,11
+lui t0,0xFFFFD
+addi t0,t0,-1992
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36364
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7990
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41406
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,11
+lui t0,0xFFFFE
+addi t0,t0,-1648
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36390
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8016
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41638
+addi t0,a0,0
+ld t1,-1648(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,1243
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-64(t0)
+beq t0,zero,12
+lui t0,0xFFFFE
+addi t0,t0,-1824
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36425
+ld t0,-1648(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8051
+jal ra,-37311
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41655
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,177
+addi t0,a0,0
+ld t1,-136(gp)
+sub t0,t0,t1
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41480
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-13220
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41338
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-40593
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41730
+addi t0,a0,0
+addi t1,zero,8
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,64(t2)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-40949
+jal zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19910
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-32
+addi t0,a0,0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-808(t0)
+sd t0,8(sp)
+jal ra,814
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-808(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36372
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-70
+addi t0,a0,0
+beq t0,zero,6
+jal ra,-40354
+addi t0,a0,0
+addi a0,t0,0
+jal zero,15
+jal zero,13
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41813
+addi t0,a0,0
+ld t1,-1584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-104
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-840(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41696
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-134
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-848(t0)
+addi a0,t0,0
+jal zero,20
+jal zero,18
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41726
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41714
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-174
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-856(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41728
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-204
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-864(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41739
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-234
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-872(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41503
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-264
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-880(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41514
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-294
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-888(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41525
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-324
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-784(t0)
+addi a0,t0,0
+jal zero,10
+jal zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41536
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-354
+addi t0,a0,0
+beq t0,zero,45
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40628
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-848(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-848(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40628
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+sub t1,t1,t2
+sd t1,-840(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-36642
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-856(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-856(t1)
+sd t1,-864(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-414
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-872(t0)
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-40946
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-441
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-880(t0)
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-40956
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-468
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,24(s0)
+sd t1,-888(t0)
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-40966
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-495
+addi t0,a0,0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-768(t1)
+sd t1,-784(t0)
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-768(t0)
+sd t0,8(sp)
+jal ra,-40980
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-210
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-768(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-40644
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+addi t2,zero,2
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+sd t1,-808(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-575
+addi t0,a0,0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,8
+sd t1,-816(t0)
+jal zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-136(gp)
+sd t1,-816(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-244
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-190
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-169
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-148
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-125
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-373
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,66
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40845
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,47
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40898
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-229
+jal zero,11
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40909
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-40840
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-454
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-40850
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-283
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,14
+ld t0,-16(s0)
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-40937
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,-69
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-720
+addi t0,a0,0
+beq t0,zero,6
+ld t0,24(s0)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,32
+jal zero,30
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42444
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-14116
+addi t0,a0,0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42456
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-14033
+addi t0,a0,0
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-771
+addi t0,a0,0
+beq t0,zero,5
+ld t0,24(s0)
+ld t1,32(s0)
+sd t1,0(t0)
+jal zero,25
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42494
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-14166
+addi t0,a0,0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42506
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-14061
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41040
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41030
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t1,-16(s0)
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-79
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-816(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-18
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-865
+addi t0,a0,0
+beq t0,zero,25
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37123
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,24(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-864(t1)
+sltu t0,t1,t0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+ld t2,24(s0)
+add t1,t1,t2
+sd t1,-864(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,33
+jal zero,28
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42418
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+ld t1,24(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-20903
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+ld t2,24(s0)
+add t1,t1,t2
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-322
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-146
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41181
+addi t0,a0,0
+addi a0,t0,0
+jal zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,10
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-896(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-896(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-936(t1)
+ld t2,24(s0)
+add t1,t1,t2
+sd t1,-936(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-89
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-920(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-920(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-960(t1)
+ld t2,24(s0)
+add t1,t1,t2
+sd t1,-960(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,112
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-194
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,87
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1037
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,72
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-849
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-41245
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-678
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-41244
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-41233
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-824(t0)
+sd t0,8(sp)
+jal ra,-41224
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-904(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-904(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-912(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-912(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-944(t1)
+ld t2,24(s0)
+add t1,t1,t2
+sd t1,-944(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-952(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-808(t2)
+add t1,t1,t2
+sd t1,-952(t0)
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,14
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-936(t1)
+ld t2,24(s0)
+sub t1,t1,t2
+sd t1,-936(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-884
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-792(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,555
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-728
+jal zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-910
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-741
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-816(t0)
+sd t0,8(sp)
+jal ra,-37561
+addi t0,a0,0
+sd t0,24(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-246
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1073
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,96
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1058
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,79
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1042
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,64
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1279
+addi t0,a0,0
+beq t0,zero,18
+ld t0,24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,12
+ld t0,24(s0)
+ld t1,-8(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-808(t2)
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,45
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41526
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-16(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,22
+ld t0,24(s0)
+ld t1,-16(s0)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41525
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41574
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-67
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-648
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,7
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1384
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-14808
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,74
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-182
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+jal zero,59
+jal zero,23
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41609
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-824(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-832(t0)
+sd t0,8(sp)
+jal ra,-41559
+jal zero,2
+jal zero,36
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41669
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41659
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+sd t0,-24(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-120
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-816(t1)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-16
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-816(t1)
+sub t0,t0,t1
+sd t0,24(s0)
+ld t0,32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-816(t1)
+sub t0,t0,t1
+sd t0,32(s0)
+ld t0,24(s0)
+ld t1,32(s0)
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-816(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-164
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-816(t1)
+add t0,t0,t1
+sd t0,24(s0)
+jal zero,-20
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1308
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,2
+jal zero,35
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1486
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,528(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-76
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1470
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1446
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-92
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41837
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1195
+jal zero,11
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41848
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-41779
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-800(t0)
+beq t0,zero,17
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1367
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-41793
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1199
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-968(t1)
+addi sp,sp,-8
+sd t1,0(sp)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41850
+ld t0,0(sp)
+addi sp,sp,8
+ld t1,0(sp)
+addi sp,sp,8
+addi t2,a0,0
+add t1,t1,t2
+sd t1,-968(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,6
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1457
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,41
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41933
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41886
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-824(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-135
+jal zero,11
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-824(t0)
+sd t0,8(sp)
+jal ra,-41845
+ld t0,-16(s0)
+sd t0,-8(s0)
+ld t0,-24(s0)
+sd t0,-16(s0)
+jal zero,-44
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-219
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-91
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-928(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-928(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFC
+addi t0,t0,2024
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-936(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-39457
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-936(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-39441
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-896(t0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-904(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-920(t0)
+sd t0,48(sp)
+jal ra,-38305
+addi sp,sp,48
+lui t0,0xFFFFC
+addi t0,t0,1952
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-960(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-39504
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-960(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-39488
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-936(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-960(t0)
+sd t0,8(sp)
+jal ra,-39472
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-936(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-960(t0)
+sd t0,8(sp)
+jal ra,-39456
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-920(t0)
+sd t0,48(sp)
+jal ra,-38368
+addi sp,sp,48
+lui t0,0xFFFFC
+addi t0,t0,1896
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-968(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-39567
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-968(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-39551
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-928(t0)
+sd t0,32(sp)
+jal ra,-38407
+addi sp,sp,32
+lui t0,0xFFFFC
+addi t0,t0,1808
+add t0,gp,t0
+addi sp,sp,-72
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-944(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-952(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-39610
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-944(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-952(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-39598
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-936(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-944(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-952(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-39586
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-936(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-944(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-952(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-39574
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-904(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-912(t1)
+add t0,t0,t1
+sd t0,48(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-904(t0)
+sd t0,56(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-912(t0)
+sd t0,64(sp)
+jal ra,-38498
+addi sp,sp,64
+lui t0,0xFFFFC
+addi t0,t0,1736
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-944(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-39697
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-944(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-39681
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-936(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-944(t0)
+sd t0,8(sp)
+jal ra,-39665
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-936(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-944(t0)
+sd t0,8(sp)
+jal ra,-39649
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-904(t0)
+sd t0,48(sp)
+jal ra,-38561
+addi sp,sp,48
+lui t0,0xFFFFC
+addi t0,t0,1664
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-952(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-39760
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-952(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,544(t0)
+sd t0,8(sp)
+jal ra,-39744
+addi t0,a0,0
+sd t0,24(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-936(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-952(t0)
+sd t0,8(sp)
+jal ra,-39728
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-936(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-952(t0)
+sd t0,8(sp)
+jal ra,-39712
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-912(t0)
+sd t0,48(sp)
+jal ra,-38624
+addi sp,sp,48
+ld t0,16(s0)
+beq t0,zero,7
+lui t0,0xFFFFC
+addi t0,t0,1648
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38633
+jal ra,-39515
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1040(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38304
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1056(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1032(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38320
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1064(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1032(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-38336
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1072(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1056(t0)
+ld t1,16(s0)
+addi t2,zero,8
+divu t1,t1,t2
+ld t2,24(s0)
+addi t3,zero,8
+divu t2,t2,t3
+add t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1040(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43692
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43680
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-49
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-42698
+ld t0,-8(s0)
+ld t1,16(s0)
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43730
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43718
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-87
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,51
+ld t0,-24(s0)
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,36
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43486
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+jal zero,11
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43498
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-42773
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-42779
+jal zero,10
+ld t0,-24(s0)
+sd t0,-16(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43514
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,-54
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43476
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-42796
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1072(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1064(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+sd t1,0(t0)
+jal zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1072(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-42832
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1072(t0)
+ld t1,-8(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,16(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1080(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1080(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1064(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,54
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1064(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43614
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1064(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1072(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-42920
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1080(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,-1080(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-976(t0)
+sd t0,8(sp)
+jal ra,-42934
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-176
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-992(t0)
+sd t0,8(sp)
+jal ra,-42956
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1000(t0)
+sd t0,8(sp)
+jal ra,-42975
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,37
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44035
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43722
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1000(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4964
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44402
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-40
+jal ra,-21274
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3931
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+ld t1,16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43773
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-984(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-119
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-984(t0)
+sd t0,8(sp)
+jal ra,-43071
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43764
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-43049
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1024(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1016(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,58
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44211
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,16(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,26
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43824
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1032(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43839
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-43122
+jal zero,21
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43849
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43860
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-43143
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1080(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,79
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1088(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1088(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1088(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1048(t1)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1032(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+ld t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-379
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,33
+jal zero,-22
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1032(t1)
+sltu t0,t0,t1
+beq t0,zero,20
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-402
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,10
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-24
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1640
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-41197
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1008(t0)
+addi a0,t0,0
+jal zero,22
+jal zero,20
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1624
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-41213
+addi t0,a0,0
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1016(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,-64(gp)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1008(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFC
+addi t0,t0,1608
+add t0,gp,t0
+addi a0,t0,0
+jal zero,8
+jal zero,6
+lui t0,0xFFFFC
+addi t0,t0,1624
+add t0,gp,t0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1160(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+jal ra,-45336
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1160(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1160(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44759
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1160(t0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+sd t0,8(sp)
+jal ra,-43977
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43970
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-43985
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-8(s0)
+sd t1,-1152(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1160(t0)
+sd t0,8(sp)
+jal ra,-44025
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-1160(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-778
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44841
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44850
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44842
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44053
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44849
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44858
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44880
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44089
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-44082
+jal zero,7
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44894
+addi t0,a0,0
+sd t0,24(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-93
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1552(gp)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39279
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44086
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,496(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39301
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44091
+jal zero,19
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,496(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,488(t1)
+divu t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39320
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44110
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-44099
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44890
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44092
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,520(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-16656
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44087
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44874
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44080
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1120(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39552
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-43567
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43556
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1312(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,152
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1552(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1128(t1)
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-39581
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-43562
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44984
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45477
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-16565
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44126
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45004
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45479
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-16585
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44129
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45024
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45481
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-16605
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44132
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45044
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45483
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-16625
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44135
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45064
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45485
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-16645
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-44138
+ld t0,-176(gp)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41866
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45090
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45385
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-16671
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-23923
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-44053
+jal zero,23
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,48(t0)
+sd t0,8(sp)
+jal ra,-44147
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-44136
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1336(t0)
+sd t0,8(sp)
+jal ra,-44127
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-44116
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-44105
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-44077
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-44066
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-44055
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-44044
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-44033
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-44022
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-44011
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-44000
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43989
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43978
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-760(t0)
+sd t0,8(sp)
+jal ra,-43969
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43958
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43947
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43936
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-976(t0)
+sd t0,8(sp)
+jal ra,-43927
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43916
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43905
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-43894
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+jal ra,-615
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-443
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1336
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1096(t0)
+beq t0,zero,26
+lui t0,0xFFFFC
+addi t0,t0,1560
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44998
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45006
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-40092
+addi sp,sp,24
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-1417
+addi t0,a0,0
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,31
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45082
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45073
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44820
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-34
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-73
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-149
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-17080
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1304(t1)
+ld t2,40(s0)
+add t1,t1,t2
+sd t1,-1304(t0)
+ld t0,40(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,56
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18286
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,32(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,32(s0)
+ld t0,40(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,40(s0)
+ld t0,24(s0)
+ld t1,-136(gp)
+add t0,t0,t1
+sd t0,24(s0)
+ld t0,40(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,26
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,512(t1)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-17139
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,7
+ld t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-58
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,48(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,96
+ld t0,32(s0)
+ld t0,0(t0)
+ld t1,40(s0)
+ld t1,0(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,44
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-17186
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-18365
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+beq t0,zero,7
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-19853
+ld t0,40(s0)
+ld t1,32(s0)
+ld t1,0(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1304(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1304(t0)
+ld t0,32(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,32(s0)
+ld t0,40(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,40(s0)
+ld t0,48(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,48(s0)
+ld t0,24(s0)
+ld t1,-136(gp)
+add t0,t0,t1
+sd t0,24(s0)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,512(t1)
+remu t0,t0,t1
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+sd t0,-8(s0)
+jal zero,12
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,7
+ld t0,-8(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-98
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,40(s0)
+ld t1,32(s0)
+ld t1,0(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,20
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,40(s0)
+sd t0,16(sp)
+jal ra,-17192
+ld t0,32(s0)
+ld t1,40(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1304(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1304(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-208(t0)
+sd t0,8(sp)
+jal ra,-44923
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45413
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1312(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,243
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45424
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45694
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45415
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46321
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45753
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-17265
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45019
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46328
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-17308
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45762
+addi t0,a0,0
+sd t0,16(sp)
+ld t0,-32(s0)
+sd t0,24(sp)
+ld t0,-1552(gp)
+sd t0,32(sp)
+jal ra,-236
+ld t0,-32(s0)
+ld t1,-1552(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46159
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-32(s0)
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45581
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-147
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46159
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-32(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45584
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-169
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46163
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-32(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45587
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-191
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46167
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-32(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45590
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-213
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46027
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-32(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45403
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-235
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46031
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-32(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45406
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-257
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46035
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-32(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45409
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-279
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46039
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-32(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,16(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45412
+addi t0,a0,0
+sd t0,24(sp)
+jal ra,-301
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-30547
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45616
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-44870
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,528(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45977
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-1584(gp)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sub t0,t0,t1
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45557
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t1,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-44826
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,7
+ld t0,16(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,24(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46050
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-17956
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17784
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-5087
+addi t0,a0,0
+beq t0,zero,15
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17796
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,512(t0)
+sd t0,16(sp)
+jal ra,-11183
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45903
+addi t0,a0,0
+ld t1,-136(gp)
+sub t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-17834
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,34
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46097
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-126
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-45319
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46094
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-120
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-45318
+jal zero,33
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46092
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-159
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-45318
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46089
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-153
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-45317
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45491
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1120(t1)
+sltu t0,t0,t1
+beq t0,zero,12
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45522
+addi t0,a0,0
+ld t1,-16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,24(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-44804
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1104(t0)
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,1504
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,32(s0)
+sd t0,24(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45919
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-41005
+addi sp,sp,32
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,40(s0)
+ld t1,48(s0)
+sltu t0,t0,t1
+beq t0,zero,63
+ld t0,32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,40(s0)
+sd t0,16(sp)
+jal ra,-18552
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-19089
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,11
+ld t0,32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,40(s0)
+sd t0,16(sp)
+jal ra,-18904
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-18022
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-18396
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,40(s0)
+sd t0,8(sp)
+ld t0,-16(s0)
+sd t0,16(sp)
+jal ra,-259
+ld t0,40(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,40(s0)
+jal zero,-65
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,48(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,32
+ld t0,48(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,48(s0)
+ld t0,32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,40(s0)
+ld t1,48(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-17906
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+sd t0,24(sp)
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,32(sp)
+jal ra,-117
+jal zero,-34
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,48
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-72
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46102
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1312(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,392
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46113
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46383
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46104
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1296(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1296(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47021
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-17983
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-45663
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45716
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47025
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-18005
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-40(s0)
+sd t0,16(sp)
+ld t0,-1552(gp)
+sd t0,24(sp)
+jal ra,-1014
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46466
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-24(s0)
+ld t1,-1552(gp)
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,-32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-40(s0)
+ld t2,-24(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-20
+ld t0,-40(s0)
+ld t1,-1552(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-40(s0)
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46879
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-40(s0)
+sd t0,16(sp)
+addi t0,zero,4
+sd t0,24(sp)
+jal ra,-1063
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-45541
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-45535
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-45529
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+addi t1,zero,3
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-45523
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47113
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-18111
+addi t0,a0,0
+sd t0,-48(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46639
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-18123
+addi t0,a0,0
+sd t0,-56(s0)
+ld t0,-56(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1120(t1)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,23
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-48(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46684
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-18150
+addi t0,a0,0
+sd t0,24(sp)
+ld t0,-56(s0)
+sd t0,32(sp)
+jal ra,-272
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47149
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-18165
+addi t0,a0,0
+sd t0,-64(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47143
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-18177
+addi t0,a0,0
+sd t0,-72(s0)
+ld t0,-56(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1120(t1)
+sltu t0,t1,t0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-48(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+ld t0,-64(s0)
+sd t0,24(sp)
+ld t0,-72(s0)
+sd t0,32(sp)
+jal ra,-392
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47191
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-72(s0)
+sd t0,16(sp)
+jal ra,-18185
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47167
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-18219
+addi t0,a0,0
+sd t0,-64(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47161
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-18231
+addi t0,a0,0
+sd t0,-72(s0)
+ld t0,-56(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1120(t1)
+sltu t0,t1,t0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+ld t0,-48(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+ld t0,-64(s0)
+sd t0,24(sp)
+ld t0,-72(s0)
+sd t0,32(sp)
+jal ra,-446
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47191
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-64(s0)
+sd t0,16(sp)
+jal ra,-18239
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46789
+addi t0,a0,0
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-18251
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46891
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-40(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,16(sp)
+addi t0,zero,4
+sd t0,24(sp)
+jal ra,-1295
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+addi t1,zero,4
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-45539
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+addi t1,zero,5
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-45533
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+addi t1,zero,6
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-45527
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-40(s0)
+addi t1,zero,7
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-45521
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46812
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46805
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-232(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46798
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-240(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,28
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,752(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-31433
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46502
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-45756
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46200
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1112(t1)
+divu t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1232(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1240(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1112(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1232(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1232(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1240(t0)
+jal ra,-23820
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1232(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1112(t1)
+mul t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1240(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-45532
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1240(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1240(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46262
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1112(t1)
+remu t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1176(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,39
+jal zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1208(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,28
+jal zero,26
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,544(t1)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+mul t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1168(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1176(t1)
+sub t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1184(t1)
+sub t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-29
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1192(t1)
+sltu t0,t1,t0
+beq t0,zero,6
+jal ra,-36
+addi t0,a0,0
+addi a0,t0,0
+jal zero,8
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1192(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1208(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,41
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1208(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1208(t1)
+ld t1,0(t1)
+sd t1,-1208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1184(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,504(t2)
+sub t1,t1,t2
+sd t1,-1184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1224(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1224(t0)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-41583
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,145
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1176(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,86
+jal ra,-170
+addi t0,a0,0
+beq t0,zero,66
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,544(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,504(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,512(t3)
+divu t2,t2,t3
+mul t1,t1,t2
+sd t1,-1176(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1176(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41653
+addi t0,a0,0
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1168(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1176(t2)
+add t1,t1,t2
+sd t1,-1168(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-41777
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+ld t1,-8(s0)
+sltu t0,t1,t0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1176(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,504(t2)
+sub t1,t1,t2
+sd t1,-1176(t0)
+jal zero,18
+lui t0,0xFFFFC
+addi t0,t0,1464
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-41948
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1424(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51699
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1200(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1200(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,504(t2)
+add t1,t1,t2
+sd t1,-1200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1176(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,504(t2)
+sub t1,t1,t2
+sd t1,-1176(t0)
+jal ra,-41598
+addi t0,a0,0
+beq t0,zero,13
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-29738
+addi t0,a0,0
+addi a0,t0,0
+jal zero,14
+jal zero,12
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-41726
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-240
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1192(t0)
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1208(t1)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-1208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1184(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,504(t2)
+add t1,t1,t2
+sd t1,-1184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1216(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1216(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,488(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,504(t1)
+mul t0,t0,t1
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1168(t0)
+ld t1,-8(s0)
+add t0,t0,t1
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,472(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,464(t2)
+mul t1,t1,t2
+sltu t0,t1,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,52
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,504(t1)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-41857
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1168(t1)
+ld t2,-8(s0)
+add t1,t1,t2
+sd t1,-1168(t0)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-41975
+addi t0,a0,0
+sd t0,-16(s0)
+jal ra,-41736
+addi t0,a0,0
+beq t0,zero,11
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-29874
+addi t0,a0,0
+addi a0,t0,0
+jal zero,12
+jal zero,10
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-41860
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,0
+addi a0,t0,0
+jal zero,159
+jal zero,13
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20170
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,146
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47401
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20209
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,119
+jal ra,-145
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,107
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20242
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-16(s0)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47444
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1473
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-46666
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,488(t1)
+add t0,t0,t1
+addi t1,zero,1
+sub t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47447
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1473
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-46671
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46814
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,488(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-46107
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1272(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1272(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1104(t0)
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,1392
+add t0,gp,t0
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+ld t0,-16(s0)
+sd t0,24(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47230
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-42316
+addi sp,sp,32
+addi t0,zero,1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1248(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1136(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42000
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1248(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1248(t0)
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,504(t2)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1136(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-61
+addi t0,a0,0
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45873
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45901
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-24
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-57
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,73
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1256(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+addi t0,zero,3
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42287
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1256(t0)
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1256(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45963
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1256(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-156
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-45927
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-45920
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,2
+sd t0,8(sp)
+jal ra,-45909
+ld t0,-8(s0)
+ld t1,-16(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1264(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1264(t0)
+jal zero,13
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45977
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-45933
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46001
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-45957
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46010
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,79
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46039
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-243
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t0,0(t0)
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,13
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46074
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+jal zero,30
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46086
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,8
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46095
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,-15
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46105
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-46055
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1256(t0)
+sd t0,8(sp)
+jal ra,-46063
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-1256(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1264(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,-1264(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1264(t0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-283
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,6
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-141
+jal zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-669
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-20027
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,62
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-331
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,51
+jal ra,-909
+addi t0,a0,0
+sd t0,-24(s0)
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,504(t1)
+addi t2,zero,8
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,18
+ld t0,-24(s0)
+ld t1,-32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+ld t2,-32(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+ld t0,-32(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,-24
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-216
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+jal ra,-19877
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1288(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1288(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47739
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47727
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-2750
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48062
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-47275
+addi t0,zero,0
+sd t0,-40(s0)
+ld t0,-40(s0)
+ld t1,-1552(gp)
+sltu t0,t0,t1
+beq t0,zero,30
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48056
+addi t0,a0,0
+ld t1,-40(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48067
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+ld t2,-40(s0)
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+ld t1,0(t1)
+sd t1,0(t0)
+ld t0,-40(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-40(s0)
+jal zero,-32
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47974
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-47201
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47965
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-47194
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47956
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-47187
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47947
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-47180
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47938
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-47173
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47929
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-47166
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47920
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-47159
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47911
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-47152
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47902
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-47145
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47855
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-47104
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47713
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-46978
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47704
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-46971
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47695
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-46964
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47686
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-46957
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48206
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,496(t1)
+sltu t0,t0,t1
+beq t0,zero,35
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-20758
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,13
+ld t0,-32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-584
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+ld t0,-32(s0)
+sd t0,16(sp)
+jal ra,-2200
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-20738
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,-39
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1280(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1280(t0)
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-64
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48278
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48018
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1312(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,1
+sd t0,-16(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,480(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+ld t0,-16(s0)
+beq t0,zero,41
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,496(t1)
+sltu t0,t0,t1
+beq t0,zero,33
+ld t0,-8(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,-8(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-465
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-20238
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-37
+jal zero,110
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,496(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,488(t2)
+divu t1,t1,t2
+sltu t0,t0,t1
+beq t0,zero,98
+ld t0,-8(s0)
+ld t1,-32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,81
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-21023
+addi t0,a0,0
+sd t0,-48(s0)
+addi t0,zero,0
+sd t0,-56(s0)
+ld t0,-56(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,488(t1)
+sltu t0,t0,t1
+beq t0,zero,49
+ld t0,-48(s0)
+beq t0,zero,12
+ld t0,-40(s0)
+addi t1,zero,1
+sub t0,t0,t1
+ld t1,-56(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,504(t2)
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-64(s0)
+jal zero,8
+ld t0,-40(s0)
+ld t1,-56(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-64(s0)
+ld t0,-64(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,19
+ld t0,-16(s0)
+beq t0,zero,5
+ld t0,-64(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-548
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,488(t1)
+mul t0,t0,t1
+ld t1,-56(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-20840
+ld t0,-56(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-56(s0)
+jal zero,-53
+ld t0,-8(s0)
+ld t1,-32(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+jal ra,-20777
+ld t0,-48(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1218
+ld t0,-32(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,-106
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48472
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-20144
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20226
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1463
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-2456
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48501
+addi t0,a0,0
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-20056
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-7532
+addi t0,a0,0
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,-136(gp)
+sd t0,16(sp)
+jal ra,-13622
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48521
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48546
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-20562
+addi t0,a0,0
+beq t0,zero,6
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-16
+jal ra,-1638
+addi t0,a0,0
+beq t0,zero,30
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1200
+addi t0,a0,0
+beq t0,zero,8
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,488(t1)
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,14
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-1552
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-2545
+ld t0,-8(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-8(s0)
+jal zero,-31
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,464(t1)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,504(t2)
+lui t3,0xFFFFF
+add t3,gp,t3
+ld t3,512(t3)
+divu t2,t2,t3
+add t1,t1,t2
+sd t1,464(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+addi t0,zero,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,40(s0)
+sltu t0,t0,t1
+beq t0,zero,136
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48627
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-8(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-20301
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,16
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20385
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-1622
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-2615
+ld t0,-8(s0)
+sd t0,-16(s0)
+ld t0,24(s0)
+ld t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20399
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20387
+addi t0,a0,0
+ld t1,24(s0)
+sub t0,t0,t1
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,40(s0)
+sltu t0,t1,t0
+beq t0,zero,3
+ld t0,40(s0)
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48684
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-8(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-20334
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+ld t1,-24(s0)
+sltu t0,t0,t1
+beq t0,zero,38
+ld t0,-32(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-32701
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-21524
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1040(t0)
+beq t0,zero,9
+ld t0,24(s0)
+ld t1,-8(s0)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+jal ra,-23014
+ld t0,-8(s0)
+ld t1,-136(gp)
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-32(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-32(s0)
+jal zero,-40
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-7760
+addi t0,a0,0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,-8(s0)
+ld t1,-16(s0)
+sub t0,t0,t1
+sd t0,16(sp)
+jal ra,-13854
+jal zero,-138
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1512(t0)
+sd t0,8(sp)
+jal ra,-48025
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20521
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-47986
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48777
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-47979
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+sd t0,8(sp)
+jal ra,-47936
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,8(sp)
+jal ra,-47927
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+sd t0,8(sp)
+jal ra,-47918
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,8(sp)
+jal ra,-47909
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1176(t1)
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,512(t0)
+sd t0,8(sp)
+jal ra,-43487
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-47912
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48687
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-47905
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48773
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1216(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,24(sp)
+jal ra,-267
+ld t0,16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48753
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1192(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,24(sp)
+jal ra,-285
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45677
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-43559
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,32(s0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sd t0,32(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,24
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+ld t1,-16(s0)
+add t0,t0,t1
+sd t0,8(sp)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+addi t0,zero,1
+sd t0,16(sp)
+jal ra,-32939
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-486
+ld t0,-16(s0)
+ld t1,-136(gp)
+add t0,t0,t1
+sd t0,-16(s0)
+jal zero,-26
+ld t0,32(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,528(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,536(t1)
+mul t0,t0,t1
+sd t0,-8(s0)
+ld t0,24(s0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-43592
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,24(s0)
+sltu t0,t0,t1
+beq t0,zero,28
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-103
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,-30
+ld t0,-8(s0)
+ld t1,-136(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-568
+ld t0,-8(s0)
+ld t1,-136(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-580
+ld t0,-24(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,23
+ld t0,-8(s0)
+ld t1,-136(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,-24(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-24(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,-16(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-605
+jal zero,-25
+ld t0,-8(s0)
+ld t1,-136(gp)
+sub t0,t0,t1
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+ld t0,24(s0)
+sd t0,16(sp)
+jal ra,-618
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49105
+addi t0,a0,0
+ld t1,-1584(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-8(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49116
+addi t0,a0,0
+ld t1,-1632(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,0
+sd t1,0(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45885
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45892
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,32(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45904
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45931
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45917
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,46
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,29
+ld t0,-24(s0)
+addi t1,zero,47
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,14
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-46171
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,3
+addi t0,zero,46
+sd t0,-24(s0)
+jal zero,-32
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,16(s0)
+sd t0,-32(s0)
+jal zero,30
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45987
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,20
+ld t0,-16(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-16(s0)
+ld t0,-32(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-46211
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-46177
+jal zero,-22
+ld t0,-8(s0)
+addi sp,sp,-40
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1384
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-32(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+ld t0,32(s0)
+sd t0,32(sp)
+jal ra,-43987
+addi sp,sp,24
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46027
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46053
+addi t0,a0,0
+sd t0,-16(s0)
+addi t0,zero,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+ld t1,-8(s0)
+sltu t0,t0,t1
+beq t0,zero,38
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-46270
+addi t0,a0,0
+addi t1,zero,62
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+addi t0,zero,62
+sd t0,16(sp)
+jal ra,-46247
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+jal zero,12
+ld t0,-16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-46260
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,6
+jal zero,-40
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-80
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46104
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,1
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46115
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-46142
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,1376
+add t0,gp,t0
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+ld t0,24(s0)
+sd t0,24(sp)
+jal ra,-44117
+addi sp,sp,16
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-626
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,8(sp)
+jal ra,-80
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-48349
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49107
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,3863
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+jal ra,3746
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,3759
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-459
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1600(t0)
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,504(t2)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1136(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,21
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47566
+addi t0,a0,0
+ld t1,16(s0)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,12
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47594
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-24
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-67
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,92
+addi t0,zero,2
+addi t1,zero,8
+mul t0,t0,t1
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44123
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1600(t0)
+ld t1,16(s0)
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,504(t2)
+divu t1,t1,t2
+lui t2,0xFFFFF
+add t2,gp,t2
+ld t2,-1136(t2)
+remu t1,t1,t2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-8(s0)
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-47588
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+sd t0,8(sp)
+jal ra,-47581
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1624(t0)
+sd t0,8(sp)
+jal ra,-47572
+ld t0,-16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-47561
+ld t0,-8(s0)
+ld t1,-16(s0)
+sd t1,0(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1608(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+sd t1,-1608(t0)
+jal zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1616(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-47585
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,-16(s0)
+sd t1,-1616(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1624(t1)
+addi t2,zero,1
+add t1,t1,t2
+sd t1,-1624(t0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47686
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-32
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49621
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-32(s0)
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,496(t1)
+sltu t0,t0,t1
+beq t0,zero,31
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-22175
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-161
+ld t0,-32(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-22151
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,-35
+ld t0,-32(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-54196
+addi t0,a0,0
+ld t1,32(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,1328
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1576(t0)
+sd t0,16(sp)
+jal ra,-44484
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54235
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,24(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-32258
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,32(s0)
+sd t0,16(sp)
+jal ra,-54255
+addi t0,a0,0
+ld t1,32(s0)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,1280
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1584(t0)
+sd t0,16(sp)
+jal ra,-44534
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54285
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,-200(gp)
+ld t1,24(s0)
+sd t1,0(t0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-200(gp)
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-109
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-200(gp)
+sd t0,8(sp)
+addi t0,zero,8
+sd t0,16(sp)
+jal ra,-83
+ld t0,-200(gp)
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-40
+ld t0,32(s0)
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44432
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+sd t0,-24(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49833
+addi t0,a0,0
+sd t0,-8(s0)
+addi t0,zero,0
+sd t0,-32(s0)
+ld t0,-32(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,496(t1)
+sltu t0,t0,t1
+beq t0,zero,51
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+jal ra,-22385
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,29
+ld t0,-24(s0)
+ld t1,-32(s0)
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-439
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47959
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-24(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-24(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-32(s0)
+sd t0,8(sp)
+jal ra,-22381
+addi t0,a0,0
+sd t0,-32(s0)
+jal zero,-55
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,32(s0)
+sd t0,8(sp)
+jal ra,-131
+ld t0,32(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,13
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,32(s0)
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-241
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,32
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-142
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,95
+ld t0,-8(s0)
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44552
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-8(s0)
+addi t1,zero,2
+mul t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-241
+ld t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,69
+ld t0,-16(s0)
+addi t1,zero,1
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-24(s0)
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49708
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1312(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+ld t0,40(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+beq t0,zero,11
+ld t0,32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2349
+jal zero,8
+ld t0,40(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+ld t0,24(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+ld t0,0(t0)
+sd t0,8(sp)
+ld t0,32(s0)
+ld t1,-24(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,16(sp)
+jal ra,-3979
+ld t0,-16(s0)
+addi t1,zero,2
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-8(s0)
+jal zero,-71
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,40
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1312(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,25
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,12
+ld t0,-16(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-16(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50143
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,-15
+ld t0,-16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1576(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-256(gp)
+sd t0,8(sp)
+jal ra,-31026
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-47378
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,1232
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1576(t0)
+sd t0,16(sp)
+jal ra,-44901
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54652
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1136(t0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-44568
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1600(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1608(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1616(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1624(t0)
+addi t0,zero,0
+sd t0,-24(s0)
+addi t0,zero,0
+sd t0,-32(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1152(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,28
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-562
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-24(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50254
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,3
+ld t0,-16(s0)
+sd t0,-32(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50266
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,-31
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1568(t0)
+sd t0,8(sp)
+jal ra,-437
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-136(gp)
+sd t0,8(sp)
+jal ra,-443
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,8(sp)
+jal ra,-451
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+jal ra,-34838
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-458
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1088(t0)
+sd t0,8(sp)
+jal ra,-466
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1208(t0)
+sd t0,8(sp)
+jal ra,-474
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+sd t0,8(sp)
+jal ra,-482
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1184(t0)
+sd t0,8(sp)
+jal ra,-490
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1176(t0)
+sd t0,8(sp)
+jal ra,-498
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-24(s0)
+sd t0,8(sp)
+jal ra,-504
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1624(t0)
+sd t0,8(sp)
+jal ra,-512
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-249
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-522
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47064
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-534
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47080
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-644
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1608(t0)
+sd t0,-40(s0)
+ld t0,-40(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48438
+addi t0,a0,0
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,16(sp)
+jal ra,-667
+ld t0,-40(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48411
+addi t0,a0,0
+sd t0,-40(s0)
+jal zero,-25
+ld t0,-32(s0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,262
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50096
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-328
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-601
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50091
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-611
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50424
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-621
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50415
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-1552(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-729
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50315
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-645
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50306
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-655
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50297
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-665
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50288
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-675
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50279
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-685
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50270
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-695
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50261
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-705
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50252
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-715
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50243
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-725
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50044
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-735
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50035
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-745
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50026
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-755
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50017
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-765
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49951
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-775
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49942
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-785
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49933
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-795
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50266
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47339
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-809
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50280
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50286
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47359
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-923
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-994
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-797
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50670
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,-265
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1080(t0)
+sd t0,8(sp)
+jal ra,-856
+addi t0,zero,0
+sd t0,-48(s0)
+ld t0,-48(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1032(t1)
+sltu t0,t0,t1
+beq t0,zero,37
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1064(t0)
+ld t1,-48(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,18
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-615
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-888
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50090
+addi t0,a0,0
+sd t0,-16(s0)
+jal zero,-21
+ld t0,-48(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-48(s0)
+jal zero,-41
+lui t0,0xFFFFC
+addi t0,t0,1136
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1624(t0)
+sd t0,24(sp)
+jal ra,-35299
+addi t0,a0,0
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1576(t0)
+sd t0,40(sp)
+jal ra,-45470
+addi sp,sp,40
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1576(t0)
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-96
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t1,16(s0)
+sd t1,-1584(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1584(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-37758
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-47998
+addi t0,a0,0
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,1096
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1584(t0)
+sd t0,16(sp)
+jal ra,-45521
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55272
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-964
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1568(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+lui t0,0xFFFFC
+addi t0,t0,1056
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1584(t0)
+sd t0,16(sp)
+jal ra,-45553
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55304
+jal zero,64
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-997
+addi t0,a0,0
+ld t1,-136(gp)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,23
+lui t0,0xFFFFC
+addi t0,t0,1000
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1584(t0)
+sd t0,16(sp)
+jal ra,-45584
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55335
+jal zero,33
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1028
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,504(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,952
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1584(t0)
+sd t0,16(sp)
+jal ra,-45617
+addi sp,sp,16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1376(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55368
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1060
+addi t0,a0,0
+sd t0,-16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1070
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1088(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1082
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1208(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1094
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1200(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1106
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1184(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1118
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1176(t0)
+jal ra,-51816
+addi t0,zero,0
+sd t0,-96(s0)
+ld t0,-96(s0)
+ld t1,-1552(gp)
+sltu t0,t0,t1
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+ld t1,-96(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-456(t0)
+ld t1,-96(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi t1,zero,1
+sd t1,0(t0)
+ld t0,-96(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-96(s0)
+jal zero,-30
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1160
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1166
+addi t0,a0,0
+sd t0,-32(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1172
+addi t0,a0,0
+sd t0,-40(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1178
+addi t0,a0,0
+sd t0,-48(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-48(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47762
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,1224(t0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,8(sp)
+ld t0,-48(s0)
+sd t0,16(sp)
+jal ra,-1273
+ld t0,-32(s0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45604
+addi t0,a0,0
+sd t0,-56(s0)
+ld t0,-32(s0)
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45432
+addi t0,a0,0
+sd t0,-64(s0)
+addi t0,zero,0
+sd t0,-96(s0)
+ld t0,-96(s0)
+ld t1,-32(s0)
+sltu t0,t0,t1
+beq t0,zero,69
+jal ra,-4092
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,30
+lui t0,0xFFFFC
+addi t0,t0,888
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1584(t0)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,544(t1)
+divu t0,t0,t1
+sd t0,24(sp)
+jal ra,-45821
+addi sp,sp,24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1424(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-55572
+ld t0,-56(s0)
+ld t1,-96(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4026
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,0(t0)
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-56(s0)
+ld t1,-96(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,504(t0)
+sd t0,16(sp)
+jal ra,-1358
+ld t0,-96(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-96(s0)
+jal zero,-71
+ld t0,-24(s0)
+addi t1,zero,1
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45696
+addi t0,a0,0
+sd t0,-72(s0)
+ld t0,-72(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1312(t1)
+sd t1,0(t0)
+addi t0,zero,1
+sd t0,-96(s0)
+ld t0,-96(s0)
+ld t1,-24(s0)
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,300
+jal ra,-6449
+addi t0,a0,0
+sd t0,-80(s0)
+ld t0,-80(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1312(t0)
+sd t0,8(sp)
+addi t0,zero,0
+sd t0,16(sp)
+jal ra,-6279
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1332
+addi t0,a0,0
+sd t0,-88(s0)
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-72(s0)
+ld t1,-88(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,8(sp)
+jal ra,-50110
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1352
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50103
+ld t0,-88(s0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-1552(gp)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1128(t1)
+add t0,t0,t1
+addi t1,zero,8
+mul t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-45769
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-49750
+ld t0,-80(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7220
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1387
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50427
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-80(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51205
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-1552(gp)
+addi t1,zero,8
+mul t0,t0,t1
+sd t0,16(sp)
+jal ra,-1475
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1411
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50332
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1421
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50325
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1431
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50318
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1441
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50311
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1451
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50304
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1461
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50297
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1471
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50290
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1481
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50283
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1491
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50276
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1501
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50099
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1511
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50092
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1521
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50085
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1531
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50078
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1541
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50020
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1551
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50013
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1561
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50006
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1568
+addi t0,a0,0
+sd t0,-48(s0)
+ld t0,-80(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-48(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-48151
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-50311
+ld t0,-8(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-80(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51072
+addi t0,a0,0
+sd t0,8(sp)
+ld t0,-48(s0)
+sd t0,16(sp)
+jal ra,-1663
+ld t0,-8(s0)
+addi sp,sp,-32
+sd t0,0(sp)
+ld t0,-80(s0)
+sd t0,8(sp)
+ld t0,-56(s0)
+sd t0,16(sp)
+ld t0,-64(s0)
+sd t0,24(sp)
+jal ra,-1469
+ld t0,-72(s0)
+ld t1,-96(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t1,-80(s0)
+sd t1,0(t0)
+ld t0,-96(s0)
+addi t1,zero,1
+add t0,t0,t1
+sd t0,-96(s0)
+jal zero,-304
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1618
+addi t0,a0,0
+sd t0,-96(s0)
+ld t0,-96(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,23
+ld t0,-72(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1631
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7355
+ld t0,-96(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,-96(s0)
+jal zero,-25
+lui t0,0xFFFFC
+addi t0,t0,800
+add t0,gp,t0
+addi sp,sp,-48
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-24(s0)
+sd t0,16(sp)
+ld t0,-32(s0)
+sd t0,24(sp)
+ld t0,-16(s0)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1584(t0)
+sd t0,40(sp)
+jal ra,-46234
+addi sp,sp,40
+ld t0,-72(s0)
+ld t1,-40(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,48(t0)
+sd t0,8(sp)
+jal ra,-50512
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51131
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-50388
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51520
+addi t0,a0,0
+ld t1,-1704(gp)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1088(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9289
+addi t0,a0,0
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9979
+jal zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-29735
+jal zero,84
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1112(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31192
+jal zero,71
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1104(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30790
+jal zero,58
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1096(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-30362
+jal zero,45
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,1120(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-31697
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1328(t0)
+addi a0,t0,0
+jal zero,34
+jal zero,27
+lui t0,0xFFFFC
+addi t0,t0,768
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-46380
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1448(t0)
+sd t0,8(sp)
+jal ra,-50603
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1328(t0)
+addi a0,t0,0
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1320(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,48(t0)
+sd t0,8(sp)
+jal ra,-50668
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51268
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-50527
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51429
+addi t0,a0,0
+sd t0,-8(s0)
+jal ra,-4738
+addi t0,a0,0
+beq t0,zero,103
+addi t0,zero,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23388
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-10533
+addi t0,a0,0
+beq t0,zero,68
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-24461
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,44
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51690
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-24234
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,27
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,488(t1)
+add t0,t0,t1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-23431
+addi t0,a0,0
+addi t1,zero,1
+sub t0,t0,t1
+sd t0,8(sp)
+jal ra,-10578
+addi t0,a0,0
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-4359
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51299
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,512(t1)
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-50566
+ld t0,-16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-24
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-4724
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-5717
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1320(t0)
+addi a0,t0,0
+jal zero,29
+jal zero,27
+lui t0,0xFFFFC
+addi t0,t0,720
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-8(s0)
+sd t0,16(sp)
+jal ra,-46555
+addi sp,sp,16
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1424(t0)
+sd t0,8(sp)
+jal ra,-50778
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1328(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,48(t0)
+sd t0,8(sp)
+jal ra,-50837
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-72(t0)
+beq t0,zero,22
+lui t0,0xFFFFC
+addi t0,t0,680
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-46603
+addi sp,sp,8
+jal ra,-18333
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1336(t0)
+sd t0,8(sp)
+jal ra,-50827
+jal zero,20
+lui t0,0xFFFFC
+addi t0,t0,656
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-46624
+addi sp,sp,8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1432(t0)
+sd t0,8(sp)
+jal ra,-50847
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1328(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,48(t0)
+sd t0,8(sp)
+jal ra,-50905
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51486
+addi t0,a0,0
+addi t1,zero,1
+add t0,t0,t1
+sd t0,8(sp)
+jal ra,-50747
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1320(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51702
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,24(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-453
+addi t0,a0,0
+addi a0,t0,0
+jal zero,92
+jal zero,90
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,40(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-313
+addi t0,a0,0
+addi a0,t0,0
+jal zero,76
+jal zero,74
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,8(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-159
+addi t0,a0,0
+addi a0,t0,0
+jal zero,60
+jal zero,58
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,16(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,9
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-107
+addi t0,a0,0
+addi a0,t0,0
+jal zero,44
+jal zero,42
+lui t0,0xFFFFC
+addi t0,t0,608
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51686
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-46772
+addi sp,sp,16
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51773
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-18129
+jal ra,-47665
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1472(t0)
+sd t0,8(sp)
+jal ra,-51006
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1328(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-120(t0)
+sd t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,101
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-29721
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51783
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1312(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7803
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51798
+addi t0,a0,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,-8(s0)
+jal zero,66
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7673
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-177
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1328(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7816
+jal zero,5
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7861
+jal ra,-7618
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51862
+addi t0,a0,0
+addi a0,t0,0
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-120(t0)
+sd t0,-8(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1576(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,14
+jal ra,-36739
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1592(t1)
+sltu t0,t0,t1
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,5
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2051
+jal zero,-101
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+addi t0,zero,1
+beq t0,zero,53
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-120(t0)
+sd t0,8(sp)
+jal ra,-56633
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7764
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-268
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1328(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7907
+jal zero,5
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7952
+jal ra,-7709
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-8(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51953
+addi t0,a0,0
+addi a0,t0,0
+jal zero,3
+jal zero,-53
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-24
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-120(t0)
+sd t0,-8(s0)
+ld t0,-8(s0)
+ld t1,-64(gp)
+addi t2,zero,100
+divu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,8
+ld t0,-8(s0)
+ld t1,24(s0)
+mul t0,t0,t1
+addi t1,zero,100
+divu t0,t0,t1
+sd t0,-8(s0)
+jal zero,24
+ld t0,-8(s0)
+ld t1,-64(gp)
+addi t2,zero,10
+divu t1,t1,t2
+sltu t0,t1,t0
+addi t1,zero,1
+sub t0,t1,t0
+beq t0,zero,10
+ld t0,-8(s0)
+addi t1,zero,10
+divu t0,t0,t1
+ld t1,24(s0)
+addi t2,zero,10
+divu t1,t1,t2
+mul t0,t0,t1
+sd t0,-8(s0)
+jal zero,7
+ld t0,-8(s0)
+addi t1,zero,100
+divu t0,t0,t1
+ld t1,24(s0)
+mul t0,t0,t1
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,6
+addi t0,zero,1
+sd t0,24(s0)
+ld t0,-8(s0)
+sd t0,-16(s0)
+jal zero,7
+addi t0,zero,0
+sd t0,24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-120(t0)
+sd t0,-16(s0)
+addi t0,zero,1
+beq t0,zero,114
+ld t0,24(s0)
+beq t0,zero,10
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-29962
+addi t0,a0,0
+sd t0,-24(s0)
+jal zero,9
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+sd t0,8(sp)
+jal ra,-56766
+addi t0,a0,0
+sd t0,-24(s0)
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52033
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1312(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8053
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52048
+addi t0,a0,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,-16(s0)
+jal zero,68
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-7923
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-427
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1328(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8066
+jal zero,5
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8111
+jal ra,-7868
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52112
+addi t0,a0,0
+addi a0,t0,0
+jal zero,29
+ld t0,24(s0)
+beq t0,zero,17
+ld t0,-8(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-120(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,9
+addi t0,zero,0
+sd t0,24(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-120(t0)
+ld t1,-8(s0)
+sub t0,t0,t1
+sd t0,-16(s0)
+jal zero,9
+ld t0,-8(s0)
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,5
+addi t0,zero,1
+sd t0,24(s0)
+ld t0,-8(s0)
+sd t0,-16(s0)
+jal zero,-114
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-16
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-120(t0)
+sd t0,-8(s0)
+addi t0,zero,1
+beq t0,zero,130
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-8(s0)
+sd t0,8(sp)
+jal ra,-30092
+addi t0,a0,0
+sd t0,-16(s0)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52154
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1312(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8174
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52169
+addi t0,a0,0
+sd t0,16(s0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-128(t0)
+sd t0,-8(s0)
+jal zero,95
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52237
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,40(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,38
+lui t0,0xFFFFC
+addi t0,t0,608
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52163
+addi t0,a0,0
+sd t0,16(sp)
+jal ra,-47249
+addi sp,sp,16
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52266
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52254
+addi t0,a0,0
+sd t0,8(sp)
+jal ra,-18610
+jal ra,-48146
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1472(t0)
+addi a0,t0,0
+jal zero,48
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8093
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-597
+addi t0,a0,0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1328(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8236
+jal zero,5
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-8281
+jal ra,-8038
+addi t0,a0,0
+sd t0,16(s0)
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,8
+ld t0,-16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-52282
+addi t0,a0,0
+addi a0,t0,0
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-120(t0)
+sd t0,-8(s0)
+jal zero,-130
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-4022
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-160
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-178
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1200(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,25
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1584(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFC
+addi t0,t0,568
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-47395
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1352(t0)
+addi a0,t0,0
+jal zero,537
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1496(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1744(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1704(t1)
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,17
+lui t0,0xFFFFC
+addi t0,t0,528
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-47428
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1352(t0)
+addi a0,t0,0
+jal zero,504
+jal zero,86
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1536(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-56(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-64(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1488(t0)
+sd t0,16(s0)
+jal zero,65
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1544(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,15
+jal ra,-54158
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-56(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-72(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1488(t0)
+sd t0,16(s0)
+jal zero,43
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1552(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,11
+jal ra,-29954
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,1040(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1488(t0)
+sd t0,16(s0)
+jal zero,25
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1560(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,17
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,624(t0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-88(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1488(t0)
+sd t0,16(s0)
+jal ra,-53770
+jal ra,-53426
+jal ra,-50910
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,449
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-49277
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-54603
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1584(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,16
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1584(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-2070
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1144(t0)
+jal zero,23
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1312(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-7525
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1144(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-3417
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,624(t0)
+addi t1,zero,0
+sub t0,t1,t0
+sltu t0,zero,t0
+beq t0,zero,2
+jal ra,-26135
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,-48(t0)
+lui t0,0xFFFFC
+addi t0,t0,448
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-40(gp)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1528(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+ld t0,-144(gp)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,472(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,544(t1)
+divu t0,t0,t1
+sd t0,48(sp)
+jal ra,-47626
+addi sp,sp,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-776(t0)
+beq t0,zero,35
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-10603
+lui t0,0xFFFFC
+addi t0,t0,416
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-792(t0)
+sd t0,8(sp)
+jal ra,-47647
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-800(t0)
+beq t0,zero,8
+lui t0,0xFFFFC
+addi t0,t0,400
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47658
+jal zero,7
+lui t0,0xFFFFC
+addi t0,t0,376
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47665
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-56(t0)
+beq t0,zero,18
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-72(t0)
+beq t0,zero,8
+lui t0,0xFFFFC
+addi t0,t0,360
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47679
+jal zero,7
+lui t0,0xFFFFC
+addi t0,t0,344
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-47686
+lui t0,0xFFFFC
+addi t0,t0,256
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-47696
+addi sp,sp,8
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1488(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-906
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,73
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1496(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-804
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,56
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1504(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-421
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,39
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1512(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,10
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-416
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,22
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1520(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1144(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+addi t0,zero,0
+sd t0,8(sp)
+jal ra,-790
+addi t0,a0,0
+sd t0,-8(s0)
+jal zero,3
+addi t0,zero,0
+sd t0,-8(s0)
+lui t0,0xFFFFC
+addi t0,t0,168
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-47796
+addi sp,sp,8
+lui t0,0xFFFFC
+addi t0,t0,96
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-40(gp)
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1528(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+sd t0,24(sp)
+ld t0,-144(gp)
+sd t0,32(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,1224(t0)
+sd t0,40(sp)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1480(t0)
+sd t0,8(sp)
+jal ra,-50112
+addi t0,a0,0
+sd t0,48(sp)
+jal ra,-47834
+addi sp,sp,48
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,616(t0)
+beq t0,zero,2
+jal ra,-26154
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-88(t0)
+beq t0,zero,46
+lui t0,0xFFFFC
+addi t0,t0,-8
+add t0,gp,t0
+addi sp,sp,-56
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-37690
+addi t0,a0,0
+sd t0,16(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+sd t0,24(sp)
+jal ra,-37697
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+sd t0,8(sp)
+jal ra,-48992
+addi t0,a0,0
+sd t0,32(sp)
+jal ra,-37708
+addi t0,a0,0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-392(t0)
+sd t0,8(sp)
+jal ra,-48975
+addi t0,a0,0
+sd t0,40(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-384(t0)
+sd t0,48(sp)
+jal ra,-47887
+addi sp,sp,48
+jal zero,2
+jal ra,-13357
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-48(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-88(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1576(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-1584(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,624(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-72(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-64(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,0
+sd t1,-56(t0)
+lui t0,0xFFFFC
+addi t0,t0,-96
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-47932
+addi sp,sp,8
+ld t0,-8(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1672(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1680(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-37
+addi t0,a0,0
+ld t1,16(s0)
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1680(t0)
+ld t1,16(s0)
+addi t2,zero,8
+mul t1,t1,t2
+add t0,t0,t1
+ld t0,0(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-42
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1688(t0)
+jal ra,-79
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1672(t1)
+addi t2,zero,1
+sub t1,t1,t2
+sd t1,-1672(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1680(t1)
+addi t2,zero,1
+addi t3,zero,8
+mul t2,t2,t3
+add t1,t1,t2
+sd t1,-1680(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1680(t0)
+ld t1,16(s0)
+sd t1,0(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1344(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,30
+jal zero,28
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1352(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,18
+jal zero,16
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,5
+addi t0,zero,1
+addi a0,t0,0
+jal zero,6
+jal zero,4
+addi t0,zero,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFC
+addi t0,t0,-168
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,16(s0)
+sd t0,16(sp)
+jal ra,-48138
+addi sp,sp,16
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+jal ra,-206
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1344(t0)
+addi a0,t0,0
+jal zero,734
+jal zero,732
+lui t0,0xFFFFC
+addi t0,t0,-256
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-48172
+addi sp,sp,8
+lui t0,0xFFFFC
+addi t0,t0,-304
+add t0,gp,t0
+addi sp,sp,-24
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-16(gp)
+sd t0,16(sp)
+jal ra,-48185
+addi sp,sp,16
+lui t0,0xFFFFC
+addi t0,t0,-368
+add t0,gp,t0
+addi sp,sp,-32
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+ld t0,-40(gp)
+sd t0,16(sp)
+ld t0,-48(gp)
+sd t0,24(sp)
+jal ra,-48200
+addi sp,sp,24
+jal ra,-12541
+jal ra,-49084
+lui t0,0xFFFFC
+addi t0,t0,-256
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-48213
+addi sp,sp,8
+jal ra,-57754
+jal ra,-57032
+jal ra,-57009
+jal ra,-54625
+jal ra,-55097
+jal ra,-276
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,654
+jal ra,-219
+jal ra,674
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-376
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50062
+addi t0,a0,0
+beq t0,zero,3
+jal ra,-40470
+jal zero,621
+jal ra,-297
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1352(t0)
+addi a0,t0,0
+jal zero,643
+jal zero,608
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-384
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50089
+addi t0,a0,0
+beq t0,zero,7
+jal ra,-260
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34389
+jal zero,590
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-392
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50107
+addi t0,a0,0
+beq t0,zero,6
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20321
+jal zero,573
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-400
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50124
+addi t0,a0,0
+beq t0,zero,6
+addi t0,zero,1
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-20338
+jal zero,556
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-408
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50141
+addi t0,a0,0
+beq t0,zero,7
+jal ra,-312
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-34182
+jal zero,538
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-424
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50159
+addi t0,a0,0
+beq t0,zero,36
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-334
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1576(t0)
+jal ra,-401
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1352(t0)
+addi a0,t0,0
+jal zero,539
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-355
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50111
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1592(t0)
+jal zero,491
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-440
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50206
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-381
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1584(t0)
+jal zero,469
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-448
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50228
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-403
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,624(t0)
+jal zero,447
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-456
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50250
+addi t0,a0,0
+beq t0,zero,89
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-425
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50181
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,728(t0)
+jal ra,-496
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1352(t0)
+addi a0,t0,0
+jal zero,444
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-450
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-50206
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,720(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51202
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1352(t0)
+addi a0,t0,0
+jal zero,414
+jal zero,32
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,720(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-51220
+addi t0,a0,0
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1352(t0)
+addi a0,t0,0
+jal zero,396
+jal zero,14
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,728(t0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,720(t1)
+sltu t0,t1,t0
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1352(t0)
+addi a0,t0,0
+jal zero,382
+jal zero,347
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-472
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50350
+addi t0,a0,0
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-525
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-27582
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,736(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,736(t0)
+ld t1,-64(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1352(t0)
+addi a0,t0,0
+jal zero,343
+jal zero,308
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-488
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50389
+addi t0,a0,0
+beq t0,zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-564
+addi t0,a0,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-9215
+ld t0,0(sp)
+addi sp,sp,8
+addi t1,a0,0
+sd t1,-1024(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1024(t0)
+ld t1,-64(gp)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1352(t0)
+addi a0,t0,0
+jal zero,304
+jal zero,269
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-504
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50428
+addi t0,a0,0
+beq t0,zero,8
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,832(t1)
+sd t1,744(t0)
+jal zero,250
+ld t0,16(s0)
+addi t1,zero,0
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,239
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-512
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50453
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1488(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1271
+addi t0,a0,0
+addi a0,t0,0
+jal zero,257
+jal zero,216
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-520
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50475
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1536(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1293
+addi t0,a0,0
+addi a0,t0,0
+jal zero,235
+jal zero,194
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-528
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50497
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1544(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1315
+addi t0,a0,0
+addi a0,t0,0
+jal zero,213
+jal zero,172
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-536
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50519
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1496(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1337
+addi t0,a0,0
+addi a0,t0,0
+jal zero,191
+jal zero,150
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-544
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50541
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1504(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1359
+addi t0,a0,0
+addi a0,t0,0
+jal zero,169
+jal zero,128
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-552
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50563
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1512(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1381
+addi t0,a0,0
+addi a0,t0,0
+jal zero,147
+jal zero,106
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-560
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50585
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1552(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1403
+addi t0,a0,0
+addi a0,t0,0
+jal zero,125
+jal zero,84
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-568
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50607
+addi t0,a0,0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,904(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1552(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1429
+addi t0,a0,0
+addi a0,t0,0
+jal zero,99
+jal zero,58
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-576
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50633
+addi t0,a0,0
+beq t0,zero,19
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,904(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+addi t1,zero,1
+sd t1,896(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1552(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1459
+addi t0,a0,0
+addi a0,t0,0
+jal zero,69
+jal zero,28
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-584
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50663
+addi t0,a0,0
+beq t0,zero,11
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1560(t0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-1481
+addi t0,a0,0
+addi a0,t0,0
+jal zero,47
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1352(t0)
+addi a0,t0,0
+jal zero,41
+jal zero,6
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1360(t0)
+addi a0,t0,0
+jal zero,35
+jal ra,-917
+addi t0,a0,0
+addi t1,zero,0
+sltu t0,t1,t0
+beq t0,zero,12
+lui t0,0xFFFFC
+addi t0,t0,-672
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-48875
+addi sp,sp,8
+jal zero,-657
+lui t0,0xFFFFC
+addi t0,t0,-96
+add t0,gp,t0
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1696(t0)
+sd t0,8(sp)
+jal ra,-48887
+addi sp,sp,8
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1336(t0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,16
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-680
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50740
+addi t0,a0,0
+beq t0,zero,8
+addi t0,zero,0
+sd t0,-32(gp)
+jal ra,-51850
+jal ra,-55863
+jal ra,-57435
+jal ra,-916
+jal zero,92
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-688
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50759
+addi t0,a0,0
+beq t0,zero,8
+addi t0,zero,1
+sd t0,-32(gp)
+jal ra,-51869
+jal ra,-55882
+jal ra,-57454
+jal ra,-935
+jal zero,73
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-696
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50778
+addi t0,a0,0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-768(t1)
+sd t1,-776(t0)
+jal ra,-955
+jal zero,53
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-704
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50798
+addi t0,a0,0
+beq t0,zero,15
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-768(t1)
+sd t1,-776(t0)
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-760(t1)
+sd t1,-800(t0)
+jal ra,-981
+jal zero,27
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1688(t0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-712
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-50824
+addi t0,a0,0
+beq t0,zero,9
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-760(t1)
+sd t1,-800(t0)
+jal ra,-1001
+jal zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-760(t1)
+sd t1,-776(t0)
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,8
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+ld t0,16(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-956
+addi t0,a0,0
+beq t0,zero,5
+ld t0,24(s0)
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-912
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1360(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1352(t0)
+addi a0,t0,0
+jal zero,20
+jal zero,18
+ld t0,16(s0)
+lui t1,0xFFFFF
+add t1,gp,t1
+ld t1,-1344(t1)
+sub t0,t1,t0
+addi t1,zero,1
+sltu t0,t0,t1
+beq t0,zero,7
+lui t0,0xFFFFF
+add t0,gp,t0
+ld t0,-1336(t0)
+addi a0,t0,0
+jal zero,6
+jal zero,4
+ld t0,16(s0)
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+addi sp,sp,-8
+sd ra,0(sp)
+addi sp,sp,-8
+sd s0,0(sp)
+addi s0,sp,0
+addi sp,sp,-8
+ld t0,16(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+ld t0,24(s0)
+sd t0,8(sp)
+jal ra,-52193
+jal ra,-58770
+jal ra,-52168
+jal ra,-52017
+jal ra,-52291
+addi t0,zero,0
+addi sp,sp,-8
+sd t0,0(sp)
+jal ra,-946
+addi t0,a0,0
+sd t0,-8(s0)
+ld t0,-8(s0)
+addi sp,sp,-16
+sd t0,0(sp)
+lui t0,0xFFFFC
+addi t0,t0,-752
+add t0,gp,t0
+sd t0,8(sp)
+jal ra,-81
+addi t0,a0,0
+addi a0,t0,0
+jal zero,2
+addi a0,zero,0
+addi sp,s0,0
+ld s0,0(sp)
+addi sp,sp,8
+ld ra,0(sp)
+addi sp,sp,24
+jalr zero,0(ra)
+nop
+.8byte 0x206D2D2028205B20
+.8byte 0x2D207C20642D207C
+.8byte 0x2920792D207C2072
+.8byte 0x20363930342D3020
+.8byte 0x5D202E2E2E
+.8byte 0x726E2D
+.8byte 0x6367726E2D
+.8byte 0x63672D
+.8byte 0x34366D2D
+.8byte 0x32336D2D
+.8byte 0x2A2A2A2A203A7325
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0x2A2A2A2A2A2A2A2A
+.8byte 0xA2A2A2A2A
+.8byte 0x747361666D2D
+.8byte 0x334C2D
+.8byte 0x324C2D
+.8byte 0x314C2D
+.8byte 0x626F6D2D
+.8byte 0x6E696D2D
+.8byte 0x792D
+.8byte 0x722D
+.8byte 0x642D
+.8byte 0x6D2D
+.8byte 0x6973756C6378652D
+.8byte 0x6576
+.8byte 0x6C7564656863732D
+.8byte 0x7265
+.8byte 0x6563616C7065722D
+.8byte 0x746E656D
+.8byte 0x70656577732D
+.8byte 0x65636172742D
+.8byte 0x65726F747365722D
+.8byte 0x0
+.8byte 0x6F706B636568632D
+.8byte 0x746E69
+.8byte 0x6C2D
+.8byte 0x532D
+.8byte 0x732D
+.8byte 0x6F2D
+.8byte 0x632D
+.8byte 0x2D756C25203A7325
+.8byte 0x69736E7520746962
+.8byte 0x746E692064656E67
+.8byte 0x6E61207372656765
+.8byte 0x69622D756C252064
+.8byte 0x65746E696F702074
+.8byte 0x6574736F68207372
+.8byte 0x206E6F2064
+.8byte 0x73696874203A7325
+.8byte 0x2065687420736920
+.8byte 0x73206569666C6573
+.8byte 0x7266206D65747379
+.8byte 0x6977207325206D6F
+.8byte 0xA6874
+.8byte 0x3D3D3D3D203A7325
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0x3D3D3D3D3D3D3D3D
+.8byte 0xA3D3D3D3D
+.8byte 0x20632D207B207325
+.8byte 0x656372756F73207B
+.8byte 0x206F2D207C207D20
+.8byte 0x7C207972616E6962
+.8byte 0x207C20732D202820
+.8byte 0x737361202920532D
+.8byte 0x207C20796C626D65
+.8byte 0x72616E6962206C2D
+.8byte 0xA73257D2079
+.8byte 0x23232323203A7325
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0x2323232323232323
+.8byte 0xA23232323
+.8byte 0x6D6D7573203A7325
+.8byte 0x756C25203A797261
+.8byte 0x6574756365786520
+.8byte 0x757274736E692064
+.8byte 0x6920736E6F697463
+.8byte 0x2C6C61746F74206E
+.8byte 0x756C2528756C2520
+.8byte 0x2525756C322E252E
+.8byte 0x2064657375662029
+.8byte 0x756C25206F746E69
+.8byte 0x6E69726570757320
+.8byte 0x6F69746375727473
+.8byte 0xA736E
+.8byte 0x2D756C25203A7325
+.8byte 0x7420732520746962
+.8byte 0x6974616E696D7265
+.8byte 0x622D756C2520676E
+.8byte 0x2D43534952207469
+.8byte 0x7972616E69622055
+.8byte 0x6874697720732520
+.8byte 0x6F63207469786520
+.8byte 0xA646C25206564
+.8byte 0x3C3C3C203A73250A
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0x3C3C3C3C3C3C3C3C
+.8byte 0xA3C3C3C3C3C
+.8byte 0x3E3E3E203A73250A
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0x3E3E3E3E3E3E3E3E
+.8byte 0xA0A3E3E3E3E3E
+.8byte 0x656420646E61202C
+.8byte 0x726567677562
+.8byte 0x657220646E61202C
+.8byte 0x79616C70
+.8byte 0x7375657220746F6E
+.8byte 0x6F6D656D20676E69
+.8byte 0x7972
+.8byte 0x20676E6973756572
+.8byte 0x79726F6D656D
+.8byte 0x20676E696367202C
+.8byte 0x6C25207972657665
+.8byte 0x636F6C6C616D2075
+.8byte 0x202C73
+.8byte 0x2D756C25203A7325
+.8byte 0x6520732520746962
+.8byte 0x676E697475636578
+.8byte 0x7469622D756C2520
+.8byte 0x20552D4353495220
+.8byte 0x25207972616E6962
+.8byte 0x2520687469772073
+.8byte 0x79687020424D756C
+.8byte 0x656D206C61636973
+.8byte 0x79726F6D
+.8byte 0x73707968203A7325
+.8byte 0x796C6E6F20726574
+.8byte 0x6E6F20736E757220
+.8byte 0x7265747370696D20
+.8byte 0xA
+.8byte 0x68746F6E203A7325
+.8byte 0x72206F7420676E69
+.8byte 0x75626564202C6E75
+.8byte 0x6F6820726F202C67
+.8byte 0xA7473
+.8byte 0x746E6F63203A7325
+.8byte 0x7420732520747865
+.8byte 0x636E752077657268
+.8byte 0x7865207468677561
+.8byte 0x3A6E6F6974706563
+.8byte 0x20
+.8byte 0x69766964203A7325
+.8byte 0x207962206E6F6973
+.8byte 0xA6F72657A
+.8byte 0x69766964203A7325
+.8byte 0x207962206E6F6973
+.8byte 0x6572202C6F72657A
+.8byte 0x2E676E6979616C70
+.8byte 0xA2E2E
+.8byte 0x65676170203A7325
+.8byte 0x6120746C75616620
+.8byte 0x20586C2578302074
+.8byte 0x7020666F2074756F
+.8byte 0x206C616369737968
+.8byte 0xA79726F6D656D
+.8byte 0x6E6B6E75203A7325
+.8byte 0x74737973206E776F
+.8byte 0x206C6C6163206D65
+.8byte 0xA756C25
+.8byte 0x74736572203A7325
+.8byte 0x756C25206465726F
+.8byte 0x747865746E6F6320
+.8byte 0x2520687469772073
+.8byte 0x206567617020756C
+.8byte 0x612073656D617266
+.8byte 0x756C252072657466
+.8byte 0x6574756365786520
+.8byte 0x757274736E692064
+.8byte 0x6620736E6F697463
+.8byte 0xA7325206D6F72
+.8byte 0x63656863203A7325
+.8byte 0x6620746E696F706B
+.8byte 0x6420732520656C69
+.8byte 0x20746F6E2073656F
+.8byte 0x6F746E6920746966
+.8byte 0x7020424D756C2520
+.8byte 0x206C616369737968
+.8byte 0xA79726F6D656D
+.8byte 0x63656863203A7325
+.8byte 0x6620746E696F706B
+.8byte 0x6920732520656C69
+.8byte 0x206120726F662073
+.8byte 0x6E65726566666964
+.8byte 0xA74736F682074
+.8byte 0x63656863203A7325
+.8byte 0x6620746E696F706B
+.8byte 0x6920732520656C69
+.8byte 0x206120726F662073
+.8byte 0x6E65726566666964
+.8byte 0x7465677261742074
+.8byte 0xA
+.8byte 0x69207325203A7325
+.8byte 0x206120746F6E2073
+.8byte 0x696F706B63656863
+.8byte 0xA656C696620746E
+.8byte 0x0
+.8byte 0x6C756F63203A7325
+.8byte 0x706F20746F6E2064
+.8byte 0x6B63656863206E65
+.8byte 0x696620746E696F70
+.8byte 0xA732520656C
+.8byte 0x63656863203A7325
+.8byte 0x6465746E696F706B
+.8byte 0x6E6F6320756C2520
+.8byte 0x6977207374786574
+.8byte 0x7020756C25206874
+.8byte 0x6D61726620656761
+.8byte 0x7265746661207365
+.8byte 0x65786520756C2520
+.8byte 0x6E69206465747563
+.8byte 0x6F69746375727473
+.8byte 0x206F746E6920736E
+.8byte 0xA7325
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6568632065746165
+.8byte 0x20746E696F706B63
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0x6C756F63203A7325
+.8byte 0x657220746F6E2064
+.8byte 0x206D6F7266206461
+.8byte 0x696F706B63656863
+.8byte 0x20656C696620746E
+.8byte 0xA7325
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6F746E6920657469
+.8byte 0x6F706B6365686320
+.8byte 0x656C696620746E69
+.8byte 0xA732520
+.8byte 0x7325203E7325
+.8byte 0x73252E73257325
+.8byte 0x65707573203A7325
+.8byte 0x7830206567617072
+.8byte 0x616D20586C343025
+.8byte 0x206F742064657070
+.8byte 0x6172667265707573
+.8byte 0x383025783020656D
+.8byte 0x6F63206E6920586C
+.8byte 0x732520747865746E
+.8byte 0xA
+.8byte 0x6C6C6170203A7325
+.8byte 0x6F2074756F20636F
+.8byte 0x6369737968702066
+.8byte 0x726F6D656D206C61
+.8byte 0xA79
+.8byte 0x65676170203A7325
+.8byte 0x586C343025783020
+.8byte 0x2064657070616D20
+.8byte 0x656D617266206F74
+.8byte 0x586C383025783020
+.8byte 0x746E6F63206E6920
+.8byte 0xA732520747865
+.8byte 0x65726170203A7325
+.8byte 0x65746E6F6320746E
+.8byte 0x7263207325207478
+.8byte 0x6863206465746165
+.8byte 0x746E6F6320646C69
+.8byte 0xA732520747865
+.8byte 0x6F722D646E756F72
+.8byte 0x6E6962
+.8byte 0x797469726F697270
+.8byte 0x0
+.8byte 0x7272
+.8byte 0x6E72657478652820
+.8byte 0x296C61
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x7520756C25206E69
+.8byte 0x616D20646563676E
+.8byte 0x73636F6C6C
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x6720756C25206E69
+.8byte 0x6C6C616D20646563
+.8byte 0xA73636F
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x6C6120292525756C
+.8byte 0x2064657461636F6C
+.8byte 0x6D20756C25206E69
+.8byte 0x282073636F6C6C61
+.8byte 0x6465636720756C25
+.8byte 0x6E7520756C25202C
+.8byte 0xA2964656367
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7463656C6C6F6320
+.8byte 0x6C25206E69206465
+.8byte 0x6E75722063672075
+.8byte 0xA73
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x322E252E756C2528
+.8byte 0x657220292525756C
+.8byte 0x206E692064657375
+.8byte 0x7375657220756C25
+.8byte 0x6F6C6C616D206465
+.8byte 0xA7363
+.8byte 0x203A6367203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7473657571657220
+.8byte 0x6C25206E69206465
+.8byte 0x636F6C6C616D2075
+.8byte 0x6720756C25282073
+.8byte 0x756C25202C646563
+.8byte 0x2973657375657220
+.8byte 0xA
+.8byte 0x296B72625F636728
+.8byte 0x203A
+.8byte 0x74656D2065726162
+.8byte 0x6C61
+.8byte 0x73776F646E6957
+.8byte 0x534F63616D
+.8byte 0x78756E694C
+.8byte 0x6569666C6573
+.8byte 0x772064657473656E
+.8byte 0x20203A736B6C61
+.8byte 0x74616C736E617274
+.8byte 0x20203A736E6F69
+.8byte 0x3A424C54203A7325
+.8byte 0x2020202020202020
+.8byte 0x7365636361202020
+.8byte 0x737469682C736573
+.8byte 0xA73657373696D2C
+.8byte 0x0
+.8byte 0x6F6E7973203A7325
+.8byte 0x2020203A736D796E
+.8byte 0x6220756C25202020
+.8byte 0x6E6920736B636F6C
+.8byte 0x65746164696C6176
+.8byte 0x73736F7263612064
+.8byte 0x7373657264646120
+.8byte 0xA73656361707320
+.8byte 0x0
+.8byte 0x657265686F632820
+.8byte 0x61766E692079636E
+.8byte 0x6E6F69746164696C
+.8byte 0x29756C25203A73
+.8byte 0x7463757274736E69
+.8byte 0x2020203A6E6F69
+.8byte 0x2D65746972772820
+.8byte 0x25203A736B636162
+.8byte 0x29756C
+.8byte 0x2020203A61746164
+.8byte 0x20202020202020
+.8byte 0x6320314C203A7325
+.8byte 0x20203A7365686361
+.8byte 0x7365636361202020
+.8byte 0x737469682C736573
+.8byte 0x2073657373696D2C
+.8byte 0x6C70657220732528
+.8byte 0x29746E656D656361
+.8byte 0xA
+.8byte 0x203A7365726F7473
+.8byte 0x20
+.8byte 0x20203A7364616F6C
+.8byte 0x20
+.8byte 0x20203A73706F6F6C
+.8byte 0x20
+.8byte 0x20203A736C6C6163
+.8byte 0x20
+.8byte 0x666F7270203A7325
+.8byte 0x746F74203A656C69
+.8byte 0x722878616D2C6C61
+.8byte 0x402925256F697461
+.8byte 0x2C73736572646461
+.8byte 0x332C78616D646E32
+.8byte 0xA78616D6472
+.8byte 0x666F7270203A7325
+.8byte 0x746F74203A656C69
+.8byte 0x722878616D2C6C61
+.8byte 0x402925256F697461
+.8byte 0x2873736572646461
+.8byte 0x322C2923656E696C
+.8byte 0x72332C78616D646E
+.8byte 0xA78616D64
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6C6C616373797320
+.8byte 0x7020756C25202C73
+.8byte 0x6C75616620656761
+.8byte 0x20756C25202C7374
+.8byte 0x6E692072656D6974
+.8byte 0x7374707572726574
+.8byte 0xA
+.8byte 0x766520656E6F202C
+.8byte 0x20756C2520797265
+.8byte 0x6465747563657865
+.8byte 0x63757274736E6920
+.8byte 0x736E6F6974
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6974706563786520
+.8byte 0x646E616820736E6F
+.8byte 0x2079622064656C
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6C7320656D697420
+.8byte 0x20666F2073656369
+.8byte 0x6365786520756C25
+.8byte 0x736E692064657475
+.8byte 0x6E6F697463757274
+.8byte 0x657661206E6F2073
+.8byte 0x2074612065676172
+.8byte 0x797469726F697270
+.8byte 0xA756C2520
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x424D756C322E252E
+.8byte 0x7461636F6C6C6120
+.8byte 0x6C25206E69206465
+.8byte 0x636F6C6C616D2075
+.8byte 0x252E756C25282073
+.8byte 0x6F20424D756C322E
+.8byte 0x2E252E756C252072
+.8byte 0x6361202525756C32
+.8byte 0x6120796C6C617574
+.8byte 0x2964657373656363
+.8byte 0xA
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x424B756C322E252E
+.8byte 0x7473206B61657020
+.8byte 0x657A6973206B6361
+.8byte 0xA
+.8byte 0x746E6F63203A7325
+.8byte 0xA7325203A747865
+.8byte 0x0
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x2064657473656E20
+.8byte 0x20747865746E6F63
+.8byte 0x7365686374697773
+.8byte 0x676E69636E797320
+.8byte 0x322E252E756C2520
+.8byte 0x736967657220756C
+.8byte 0x20646E6120726574
+.8byte 0x6F77206574617473
+.8byte 0x6863616520736472
+.8byte 0xA
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6C75646568637320
+.8byte 0x6963656420676E69
+.8byte 0x796220736E6F6973
+.8byte 0x6568637320732520
+.8byte 0xA72656C7564
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x747865746E6F6320
+.8byte 0x64656B726F662073
+.8byte 0x617020756C25202C
+.8byte 0x656D617266206567
+.8byte 0x646569706F632073
+.8byte 0x74697277206E6F20
+.8byte 0xA65
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6170726570757320
+.8byte 0x7070616D20736567
+.8byte 0x20756C25202C6465
+.8byte 0xA6465746F6D6564
+.8byte 0x0
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x7266206567617020
+.8byte 0x6365722073656D61
+.8byte 0x202C64656D69616C
+.8byte 0x7375657220756C25
+.8byte 0xA6465
+.8byte 0x6C322E252E756C25
+.8byte 0x7070616D20424D75
+.8byte 0x726F6D656D206465
+.8byte 0x252E756C255B2079
+.8byte 0x6F202525756C322E
+.8byte 0x20424D756C252066
+.8byte 0x6C61636973796870
+.8byte 0x5D79726F6D656D20
+.8byte 0xA
+.8byte 0x20202020203A7325
+.8byte 0x2020202020
+.8byte 0x6365786520756C25
+.8byte 0x736E692064657475
+.8byte 0x6E6F697463757274
+.8byte 0x746F74206E692073
+.8byte 0x2E756C255B206C61
+.8byte 0x202525756C322E25
+.8byte 0xA5D73706F6E
+.8byte 0x6D6D7573203A7325
+.8byte 0x203A797261
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6974706563786520
+.8byte 0x646E616820736E6F
+.8byte 0x252079622064656C
+.8byte 0x7274736E6920756C
+.8byte 0x20736E6F69746375
+.8byte 0x6C255B2068636165
+.8byte 0x25756C322E252E75
+.8byte 0x65687265766F2025
+.8byte 0x74636166202C6461
+.8byte 0x252E756C2520726F
+.8byte 0xA5D756C322E
+.8byte 0x20202020203A7325
+.8byte 0x756C252020202020
+.8byte 0x6574756365786520
+.8byte 0x757274736E692064
+.8byte 0x5B20736E6F697463
+.8byte 0x6C322E252E756C25
+.8byte 0x7261687320252575
+.8byte 0x6F74636166202C65
+.8byte 0x2E252E756C252072
+.8byte 0xA5D756C32
+.8byte 0x6F742073706D6574
+.8byte 0x2020203A6C6174
+.8byte 0x746F742073677261
+.8byte 0x202020203A6C61
+.8byte 0x6573206B63617473
+.8byte 0x203A746E656D67
+.8byte 0x6F74206B63617473
+.8byte 0x2020203A6C6174
+.8byte 0x6765732061746164
+.8byte 0x20203A746E656D
+.8byte 0x6765732070616568
+.8byte 0x20203A746E656D
+.8byte 0x2B555043203A7325
+.8byte 0x203A79726F6D656D
+.8byte 0x7364616572202020
+.8byte 0x2C7365746972772B
+.8byte 0x72772C7364616572
+.8byte 0x6165725B73657469
+.8byte 0x65746972772F7364
+.8byte 0xA5D73
+.8byte 0x6574736967657220
+.8byte 0x2020203A72
+.8byte 0x73257325203A7325
+.8byte 0x2C756C252C756C25
+.8byte 0x2E756C255B756C25
+.8byte 0xA5D756C322E25
+.8byte 0x6C257325203A7325
+.8byte 0x75
+.8byte 0x2530302E3028302C
+.8byte 0x2925
+.8byte 0x756C2528756C252C
+.8byte 0x2525756C322E252E
+.8byte 0x586C2578304029
+.8byte 0x61207461203A7325
+.8byte 0x3020737365726464
+.8byte 0x7520586C38302578
+.8byte 0x69206E776F6E6B6E
+.8byte 0x697463757274736E
+.8byte 0x586C257830206E6F
+.8byte 0x706F206874697720
+.8byte 0x2578302065646F63
+.8byte 0x636574656420586C
+.8byte 0xA646574
+.8byte 0x637865203A73250A
+.8byte 0x74206E6F69747065
+.8byte 0x6465726567676972
+.8byte 0x74736E6920796220
+.8byte 0x206E6F6974637572
+.8byte 0x72616E6962206E69
+.8byte 0x2079
+.8byte 0x73657270206E6920
+.8byte 0x20666F2065636E65
+.8byte 0x676E697473697865
+.8byte 0x6974706563786520
+.8byte 0x203A6E6F
+.8byte 0x746E6F63203A7325
+.8byte 0x7420732520747865
+.8byte 0x78652073776F7268
+.8byte 0x3A6E6F6974706563
+.8byte 0x20
+.8byte 0x20
+.8byte 0x586C383025783020
+.8byte 0x0
+.8byte 0x756C2520444920
+.8byte 0x7264646120746120
+.8byte 0x3025783020737365
+.8byte 0x586C38
+.8byte 0x6567617020746120
+.8byte 0x586C343025783020
+.8byte 0x0
+.8byte 0x28646C253D3D7325
+.8byte 0x29586C257830
+.8byte 0x6C256F303D3D7325
+.8byte 0x6F
+.8byte 0x6C2578303D3D7325
+.8byte 0x58
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x736120666F207372
+.8byte 0x7720796C626D6573
+.8byte 0x20756C2520687469
+.8byte 0x207469622D756C25
+.8byte 0x6920552D43534952
+.8byte 0x697463757274736E
+.8byte 0x20646E6120736E6F
+.8byte 0x6574796220756C25
+.8byte 0x74616420666F2073
+.8byte 0x6574746972772061
+.8byte 0x25206F746E69206E
+.8byte 0xA73
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x7373612065746165
+.8byte 0x756F20796C626D65
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x68746F6E203A7325
+.8byte 0x64206F7420676E69
+.8byte 0x626D657373617369
+.8byte 0x756F206F7420656C
+.8byte 0x6C69662074757074
+.8byte 0xA73252065
+.8byte 0x2065747962342E
+.8byte 0x2065747962382E
+.8byte 0x746E6F63203A7325
+.8byte 0x7469777320747865
+.8byte 0x756420676E696863
+.8byte 0x6D797320676E6972
+.8byte 0x78652063696C6F62
+.8byte 0x206E6F6974756365
+.8byte 0x7075736E75207369
+.8byte 0xA646574726F70
+.8byte 0x746E6F63203A7325
+.8byte 0x7469777320747865
+.8byte 0x756420676E696863
+.8byte 0x63657220676E6972
+.8byte 0x6920676E6964726F
+.8byte 0x707075736E752073
+.8byte 0xA646574726F
+.8byte 0x6C2578303D3D6370
+.8byte 0x58
+.8byte 0x6C252C7325207325
+.8byte 0x64
+.8byte 0x3D3D6370203E2D20
+.8byte 0x586C257830
+.8byte 0x3D3D6370202D7C20
+.8byte 0x586C257830
+.8byte 0x5D586C2578305B
+.8byte 0x5B6D656D203E2D20
+.8byte 0x3D3D5D586C257830
+.8byte 0x0
+.8byte 0x6C2578305B6D656D
+.8byte 0x646C253D3D5D58
+.8byte 0x6C2578305B6D656D
+.8byte 0x6C2578303D3D5D58
+.8byte 0x58
+.8byte 0x78305B6D656D3D3D
+.8byte 0x5D586C25
+.8byte 0x736920586C257830
+.8byte 0x64696C61766E6920
+.8byte 0x0
+.8byte 0x736920586C257830
+.8byte 0x6765732D6C6C6920
+.8byte 0x28206465746E656D
+.8byte 0x61746E656D676573
+.8byte 0x756166206E6F6974
+.8byte 0x29746C
+.8byte 0x736920586C257830
+.8byte 0x657070616D6E7520
+.8byte 0x2065676170282064
+.8byte 0x29746C756166
+.8byte 0x6C2578305B6D656D
+.8byte 0x20646C253D3D5D58
+.8byte 0x202D7C
+.8byte 0x6C2578305B6D656D
+.8byte 0x6C2578303D3D5D58
+.8byte 0x202D7C2058
+.8byte 0x6C252C7325207325
+.8byte 0x2973252864
+.8byte 0x73252C7325207325
+.8byte 0x73252C
+.8byte 0x73252C7325207325
+.8byte 0x646C252C
+.8byte 0x706F6E
+.8byte 0x202D7C203A
+.8byte 0x78302C7325207325
+.8byte 0x586C25
+.8byte 0x6C3830257830203A
+.8byte 0x203A58
+.8byte 0x586C257830
+.8byte 0x203A
+.8byte 0x3D3D6370203A7325
+.8byte 0x586C257830
+.8byte 0x29756C257E28
+.8byte 0x6E617274203A7325
+.8byte 0x3A676E6974616C73
+.8byte 0x3A7264646176200A
+.8byte 0x586C383025783020
+.8byte 0x203A65676170200A
+.8byte 0xA586C3430257830
+.8byte 0x203A656D61726620
+.8byte 0xA586C3830257830
+.8byte 0x203A726464617020
+.8byte 0xA586C3830257830
+.8byte 0x0
+.8byte 0x63617274203A7325
+.8byte 0x6620756C25206465
+.8byte 0x202C736568637465
+.8byte 0x64616F6C20756C25
+.8byte 0x2520646E61202C73
+.8byte 0x65726F747320756C
+.8byte 0x756C25206E692073
+.8byte 0x6920736574796220
+.8byte 0xA7325206F746E
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6F746E6920657469
+.8byte 0x6620656361727420
+.8byte 0xA732520656C69
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6172742065746165
+.8byte 0x20656C6966206563
+.8byte 0xA7325
+.8byte 0x2C756C252C756C25
+.8byte 0x203A756C25
+.8byte 0x6420314C203A7325
+.8byte 0x686361632D617461
+.8byte 0x3A70656577732065
+.8byte 0x61772C657A697320
+.8byte 0x6B636F6C622C7379
+.8byte 0x657373656363613A
+.8byte 0x6D2C737469682C73
+.8byte 0x2528207365737369
+.8byte 0x63616C7065722073
+.8byte 0xA29746E656D65
+.8byte 0x6D6F646E6172
+.8byte 0x6F666966
+.8byte 0x75726C70
+.8byte 0x75726C
+.8byte 0x61746F74203A7325
+.8byte 0x2020202020203A6C
+.8byte 0x252C756C25202020
+.8byte 0x252C756C252C756C
+.8byte 0x252E756C255B756C
+.8byte 0xA5D756C322E
+.8byte 0x6574616C203A7325
+.8byte 0x20203A736569636E
+.8byte 0x252C756C25202020
+.8byte 0x252C756C252C756C
+.8byte 0xA756C
+.8byte 0x6C637963203A7325
+.8byte 0x20202020203A7365
+.8byte 0x324C2C314C202020
+.8byte 0x6F6D656D2C334C2C
+.8byte 0x61726576615B7972
+.8byte 0x726F6D656D206567
+.8byte 0x7373656363612079
+.8byte 0xA5D656D697420
+.8byte 0x2064656966696E75
+.8byte 0x202020203A334C
+.8byte 0x2064656966696E75
+.8byte 0x202020203A324C
+.8byte 0x4C2B324C203A7325
+.8byte 0x7365686361632033
+.8byte 0x736563636120203A
+.8byte 0x737469682C736573
+.8byte 0x2073657373696D2C
+.8byte 0x6973756C636E6928
+.8byte 0xA296576
+.8byte 0x4C2B324C203A7325
+.8byte 0x7365686361632033
+.8byte 0x736563636120203A
+.8byte 0x737469682C736573
+.8byte 0x2073657373696D2C
+.8byte 0x6973756C63786528
+.8byte 0xA296576
+.8byte 0x2E756C2528756C25
+.8byte 0x292525756C322E25
+.8byte 0x756C2528756C252C
+.8byte 0x2525756C322E252E
+.8byte 0x29
+.8byte 0x6C257325203A7325
+.8byte 0x2C75
+.8byte 0x2968637469777328
+.8byte 0x203A
+.8byte 0x63657865206F7420
+.8byte 0x20756C2520657475
+.8byte 0x7463757274736E69
+.8byte 0x736E6F69
+.8byte 0x74697773203A7325
+.8byte 0x726620676E696863
+.8byte 0x65746E6F63206D6F
+.8byte 0x6F74207325207478
+.8byte 0x747865746E6F6320
+.8byte 0x732520
+.8byte 0x203A296B726228
+.8byte 0x72746572203A7325
+.8byte 0x6320676E69766569
+.8byte 0x7020746E65727275
+.8byte 0x62206D6172676F72
+.8byte 0x257830206B616572
+.8byte 0xA586C3830
+.8byte 0x74746573203A7325
+.8byte 0x676F727020676E69
+.8byte 0x61657262206D6172
+.8byte 0x257830206F74206B
+.8byte 0xA586C3830
+.8byte 0x636F6C6C616D
+.8byte 0x6E65706F203A7325
+.8byte 0x20656C6966206465
+.8byte 0x2068746977207325
+.8byte 0x7830207367616C66
+.8byte 0x20646E6120586C25
+.8byte 0x256F302065646F6D
+.8byte 0x7275746572206F6C
+.8byte 0x6C696620676E696E
+.8byte 0x6972637365642065
+.8byte 0x756C2520726F7470
+.8byte 0xA
+.8byte 0x2974616E65706F28
+.8byte 0x203A
+.8byte 0x6E65706F
+.8byte 0x75746361203A7325
+.8byte 0x6F727720796C6C61
+.8byte 0x6220756C25206574
+.8byte 0x746E692073657479
+.8byte 0x7720656C6966206F
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0xA756C
+.8byte 0x69797274203A7325
+.8byte 0x7277206F7420676E
+.8byte 0x20756C2520657469
+.8byte 0x7266207365747962
+.8byte 0x6566667562206D6F
+.8byte 0x7269762074612072
+.8byte 0x646461206C617574
+.8byte 0x2578302073736572
+.8byte 0x746E6920586C3830
+.8byte 0x7720656C6966206F
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0xA756C
+.8byte 0x3A29657469727728
+.8byte 0x20
+.8byte 0x6574697277
+.8byte 0x203E2D20
+.8byte 0x75746361203A7325
+.8byte 0x61657220796C6C61
+.8byte 0x796220756C252064
+.8byte 0x6D6F726620736574
+.8byte 0x697720656C696620
+.8byte 0x7263736564206874
+.8byte 0x6C2520726F747069
+.8byte 0xA75
+.8byte 0x69797274203A7325
+.8byte 0x6572206F7420676E
+.8byte 0x6220756C25206461
+.8byte 0x6F72662073657479
+.8byte 0x7720656C6966206D
+.8byte 0x6373656420687469
+.8byte 0x2520726F74706972
+.8byte 0x206F746E6920756C
+.8byte 0x6120726566667562
+.8byte 0x6175747269762074
+.8byte 0x736572646461206C
+.8byte 0x6C38302578302073
+.8byte 0xA58
+.8byte 0x202D7C20
+.8byte 0x203A296461657228
+.8byte 0x0
+.8byte 0x69727473203A7325
+.8byte 0x6F7420736920676E
+.8byte 0x6120676E6F6C206F
+.8byte 0x6175747269762074
+.8byte 0x736572646461206C
+.8byte 0x6C38302578302073
+.8byte 0xA58
+.8byte 0x74726976203A7325
+.8byte 0x72646461206C6175
+.8byte 0x3025783020737365
+.8byte 0x6920736920586C38
+.8byte 0xA64696C61766E
+.8byte 0x74726976203A7325
+.8byte 0x72646461206C6175
+.8byte 0x3025783020737365
+.8byte 0x6920736920586C38
+.8byte 0x766E69206E61206E
+.8byte 0x6765732064696C61
+.8byte 0xA746E656D
+.8byte 0x74726976203A7325
+.8byte 0x72646461206C6175
+.8byte 0x3025783020737365
+.8byte 0x7520736920586C38
+.8byte 0xA64657070616D6E
+.8byte 0x0
+.8byte 0x64616572
+.8byte 0xA3E2D202D7C20
+.8byte 0x203A297469786528
+.8byte 0x0
+.8byte 0x74697865
+.8byte 0x6C696166203A7325
+.8byte 0x6F6C206F74206465
+.8byte 0x6420646E61206461
+.8byte 0x69622065646F6365
+.8byte 0x6F7266207972616E
+.8byte 0x207475706E69206D
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0x20756C25203A7325
+.8byte 0x6977207365747962
+.8byte 0x2520756C25206874
+.8byte 0x52207469622D756C
+.8byte 0x6E6920552D435349
+.8byte 0x6F69746375727473
+.8byte 0x2520646E6120736E
+.8byte 0x736574796220756C
+.8byte 0x6174616420666F20
+.8byte 0x20646564616F6C20
+.8byte 0xA7325206D6F7266
+.8byte 0x0
+.8byte 0x20756C25203A7325
+.8byte 0x6977207365747962
+.8byte 0x2520756C25206874
+.8byte 0x52207469622D756C
+.8byte 0x6E6920552D435349
+.8byte 0x6F69746375727473
+.8byte 0x2520646E6120736E
+.8byte 0x736574796220756C
+.8byte 0x6174616420666F20
+.8byte 0x6E65747469727720
+.8byte 0x7325206F746E6920
+.8byte 0xA
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x6174616420657469
+.8byte 0x6962206F746E6920
+.8byte 0x74756F207972616E
+.8byte 0x656C696620747570
+.8byte 0xA732520
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x65646F6320657469
+.8byte 0x6962206F746E6920
+.8byte 0x74756F207972616E
+.8byte 0x656C696620747570
+.8byte 0xA732520
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x20464C4520657469
+.8byte 0x6F20726564616568
+.8byte 0x7972616E69622066
+.8byte 0x2074757074756F20
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0x6C756F63203A7325
+.8byte 0x726320746F6E2064
+.8byte 0x6E69622065746165
+.8byte 0x7074756F20797261
+.8byte 0x20656C6966207475
+.8byte 0xA7325
+.8byte 0x68746F6E203A7325
+.8byte 0x65206F7420676E69
+.8byte 0x6F206F742074696D
+.8byte 0x6966207475707475
+.8byte 0xA732520656C
+.8byte 0x206D756D6978616D
+.8byte 0x7A69732061746164
+.8byte 0x6465656378652065
+.8byte 0x6465
+.8byte 0x206D756D6978616D
+.8byte 0x7A69732065646F63
+.8byte 0x6465656378652065
+.8byte 0x6465
+.8byte 0x74737973203A7325
+.8byte 0x20203A6D65
+.8byte 0x746E6F63203A7325
+.8byte 0x203A6C6F72
+.8byte 0x706D6F63203A7325
+.8byte 0x203A657261
+.8byte 0x706D6F63203A7325
+.8byte 0x203A657475
+.8byte 0x6F6D656D203A7325
+.8byte 0x20203A7972
+.8byte 0x202C
+.8byte 0x74696E69203A7325
+.8byte 0x202020203A
+.8byte 0x5D252573706F6E5B
+.8byte 0x0
+.8byte 0x666F7270203A7325
+.8byte 0x736E69203A656C69
+.8byte 0x6E6F697463757274
+.8byte 0x286C61746F74203A
+.8byte 0x2925256F69746172
+.8byte 0x0
+.8byte 0x322E252E756C255B
+.8byte 0x5D2525756C
+.8byte 0x28756C25203A7325
+.8byte 0x6C322E252E756C25
+.8byte 0x29252575
+.8byte 0x6570786520646C25
+.8byte 0x7465622064657463
+.8byte 0x646C25206E656577
+.8byte 0x646C2520646E6120
+.8byte 0xA
+.8byte 0x676E69646F636E65
+.8byte 0x726F72726520
+.8byte 0x6E6964616572203A
+.8byte 0x75206D6F72662067
+.8byte 0x6C616974696E696E
+.8byte 0x6765722064657A69
+.8byte 0x207265747369
+.8byte 0x6E6964616572203A
+.8byte 0x706172776E752067
+.8byte 0x756C617620646570
+.8byte 0x72206D6F72662065
+.8byte 0x2072657473696765
+.8byte 0x0
+.8byte 0x71696E75203A7325
+.8byte 0x6920676962206575
+.8byte 0x3A7372656765746E
+.8byte 0x28756C2520202020
+.8byte 0xA29756C25
+.8byte 0x71696E75203A7325
+.8byte 0x6E69727473206575
+.8byte 0x61726574696C2067
+.8byte 0x28756C25203A736C
+.8byte 0xA29756C25
+.8byte 0x626F6C67203A7325
+.8byte 0x6169726176206C61
+.8byte 0x2020203A73656C62
+.8byte 0x28756C2520202020
+.8byte 0xA29756C25
+.8byte 0x666F7270203A7325
+.8byte 0x746164203A656C69
+.8byte 0x6C61746F74203A61
+.8byte 0xA29736574796228
+.8byte 0x0
+.8byte 0x20756C25203A7325
+.8byte 0x6567207365747962
+.8byte 0x206465746172656E
+.8byte 0x756C252068746977
+.8byte 0x63757274736E6920
+.8byte 0x6E6120736E6F6974
+.8byte 0x796220756C252064
+.8byte 0x6420666F20736574
+.8byte 0xA617461
+.8byte 0x76767676203A7325
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0x7676767676767676
+.8byte 0xA76767676
+.8byte 0x20756C25203A7325
+.8byte 0x74206C6F626D7973
+.8byte 0x6F6F6C20656C6261
+.8byte 0x206E69207370756B
+.8byte 0x7265746920756C25
+.8byte 0x6F20736E6F697461
+.8byte 0x676172657661206E
+.8byte 0xA65
+.8byte 0x68746F6E203A7325
+.8byte 0x63206F7420676E69
+.8byte 0x202C656C69706D6F
+.8byte 0x20732520796C6E6F
+.8byte 0x65746172656E6567
+.8byte 0xA64
+.8byte 0x6F636E65203A7325
+.8byte 0x2064657265746E75
+.8byte 0x746E797320756C25
+.8byte 0x726F727265207861
+.8byte 0x20656C6968772073
+.8byte 0x6E696C69706D6F63
+.8byte 0x6F202D2073252067
+.8byte 0x20676E697474696D
+.8byte 0xA74757074756F
+.8byte 0x20756C25203A7325
+.8byte 0x656D6E6769737361
+.8byte 0x756C25202C73746E
+.8byte 0x202C656C69687720
+.8byte 0x202C666920756C25
+.8byte 0x6C6C616320756C25
+.8byte 0x7220756C25202C73
+.8byte 0xA6E72757465
+.8byte 0x20756C25203A7325
+.8byte 0x76206C61626F6C67
+.8byte 0x73656C6261697261
+.8byte 0x727020756C25202C
+.8byte 0x736572756465636F
+.8byte 0x747320756C25202C
+.8byte 0x74696C20676E6972
+.8byte 0xA736C617265
+.8byte 0x68746977203A7325
+.8byte 0x756C2528756C2520
+.8byte 0x2525756C322E252E
+.8byte 0x6361726168632029
+.8byte 0x206E692073726574
+.8byte 0x7574636120756C25
+.8byte 0x6F626D7973206C61
+.8byte 0xA736C
+.8byte 0x20756C25203A7325
+.8byte 0x6574636172616863
+.8byte 0x2064616572207372
+.8byte 0x6C20756C25206E69
+.8byte 0x646E612073656E69
+.8byte 0x6D6F6320756C2520
+.8byte 0xA73746E656D
+.8byte 0x2D2D2D2D203A7325
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0x2D2D2D2D2D2D2D2D
+.8byte 0xA2D2D2D2D
+.8byte 0x6C756F63203A7325
+.8byte 0x706F20746F6E2064
+.8byte 0x7475706E69206E65
+.8byte 0x732520656C696620
+.8byte 0xA
+.8byte 0x666C6573203A7325
+.8byte 0x69706D6F63206569
+.8byte 0x20732520676E696C
+.8byte 0x622D756C25206F74
+.8byte 0x2D43534952207469
+.8byte 0x2520687469772055
+.8byte 0x73207469622D756C
+.8byte 0xA63726174
+.8byte 0x2B2B2B2B203A7325
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0x2B2B2B2B2B2B2B2B
+.8byte 0xA2B2B2B2B
+.8byte 0x736E69746C697562
+.8byte 0x0
+.8byte 0x206D756D6978616D
+.8byte 0x206D6172676F7270
+.8byte 0x7865206B61657262
+.8byte 0x646564656563
+.8byte 0x646E655F72617627
+.8byte 0x6920646573752027
+.8byte 0x61762D6E6F6E206E
+.8byte 0x7020636964616972
+.8byte 0x6572756465636F72
+.8byte 0x0
+.8byte 0x6174735F72617627
+.8byte 0x6465737520277472
+.8byte 0x2D6E6F6E206E6920
+.8byte 0x6369646169726176
+.8byte 0x756465636F727020
+.8byte 0x6572
+.8byte 0x6E65726566666964
+.8byte 0x7265626D756E2074
+.8byte 0x7574636120666F20
+.8byte 0x6620646E61206C61
+.8byte 0x6170206C616D726F
+.8byte 0x73726574656D6172
+.8byte 0x0
+.8byte 0x6361207265776566
+.8byte 0x616874206C617574
+.8byte 0x6C616D726F66206E
+.8byte 0x74656D6172617020
+.8byte 0x737265
+.8byte 0x646E655F726176
+.8byte 0x6772615F726176
+.8byte 0x726174735F726176
+.8byte 0x74
+.8byte 0x696E696665646572
+.8byte 0x20666F206E6F6974
+.8byte 0x72756465636F7270
+.8byte 0x6E67692073252065
+.8byte 0xA6465726F
+.8byte 0x796E616D206F6F74
+.8byte 0x206C616D726F6620
+.8byte 0x6574656D61726170
+.8byte 0x7372
+.8byte 0x796E616D206F6F74
+.8byte 0x76206C61636F6C20
+.8byte 0x73656C6261697261
+.8byte 0x0
+.8byte 0x61645F6863746566
+.8byte 0x656D6765735F6174
+.8byte 0x657A69735F746E
+.8byte 0x6C675F6863746566
+.8byte 0x696F705F6C61626F
+.8byte 0x7265746E
+.8byte 0x74735F6863746566
+.8byte 0x6E696F705F6B6361
+.8byte 0x726574
+.8byte 0x5F72657473707968
+.8byte 0x686374697773
+.8byte 0x636F6C6C617A
+.8byte 0x66746E69727064
+.8byte 0x6F625F305F6E6F6E
+.8byte 0x6C6576656C5F746F
+.8byte 0x66746E697270645F
+.8byte 0x0
+.8byte 0x66746E69727073
+.8byte 0x6F625F305F6E6F6E
+.8byte 0x6C6576656C5F746F
+.8byte 0x66746E697270735F
+.8byte 0x0
+.8byte 0x66746E697270
+.8byte 0x6F625F305F6E6F6E
+.8byte 0x6C6576656C5F746F
+.8byte 0x66746E6972705F
+.8byte 0x5F3436746E697528
+.8byte 0x697528202D202974
+.8byte 0x292A745F3436746E
+.8byte 0x65646E7520736920
+.8byte 0x64656E6966
+.8byte 0x5F3436746E697528
+.8byte 0x7528202B20292A74
+.8byte 0x2A745F3436746E69
+.8byte 0x646E752073692029
+.8byte 0x64656E696665
+.8byte 0x656D616E5F6F6E
+.8byte 0x696E696665646572
+.8byte 0x20666F206E6F6974
+.8byte 0x76206C61626F6C67
+.8byte 0x20656C6261697261
+.8byte 0x726F6E6769207325
+.8byte 0xA6465
+.8byte 0x73696D2065707974
+.8byte 0x202C686374616D
+.8byte 0x676E696E726177
+.8byte 0x6E776F6E6B6E75
+.8byte 0x72616C6365646E75
+.8byte 0x6465
+.8byte 0x745F3436746E6975
+.8byte 0x2A
+.8byte 0x6365707865207325
+.8byte 0x2074756220646574
+.8byte 0x646E756F66207325
+.8byte 0xA
+.8byte 0x6365646E75207325
+.8byte 0xA646572616C
+.8byte 0x7463657078656E75
+.8byte 0x6F626D7973206465
+.8byte 0x206C
+.8byte 0x206C6167656C6C69
+.8byte 0x7265747369676572
+.8byte 0x636F6C6C61656420
+.8byte 0x6E6F697461
+.8byte 0x206C6167656C6C69
+.8byte 0x7265747369676572
+.8byte 0x73736563636120
+.8byte 0x7220666F2074756F
+.8byte 0x7372657473696765
+.8byte 0x0
+.8byte 0x72756465636F7270
+.8byte 0x646E752073252065
+.8byte 0xA64656E696665
+.8byte 0x206E776F6E6B6E75
+.8byte 0x7320657061637365
+.8byte 0x2065636E65757165
+.8byte 0x646E756F66
+.8byte 0x6E7520646E756F66
+.8byte 0x6863206E776F6E6B
+.8byte 0x2072657463617261
+.8byte 0x0
+.8byte 0x7420676E69727473
+.8byte 0x676E6F6C206F6F
+.8byte 0x2064656863616572
+.8byte 0x6620666F20646E65
+.8byte 0x6B6F6F6C20656C69
+.8byte 0x20726F6620676E69
+.8byte 0x6361726168632061
+.8byte 0x6574696C20726574
+.8byte 0x6C6172
+.8byte 0x64656E6769736E75
+.8byte 0x72656765746E6920
+.8byte 0x20666F2074756F20
+.8byte 0x6220746567726174
+.8byte 0x646E756F
+.8byte 0x692064656E676973
+.8byte 0x6F2072656765746E
+.8byte 0x617420666F207475
+.8byte 0x756F622074656772
+.8byte 0x646E
+.8byte 0x64656E6769736E75
+.8byte 0x72656765746E6920
+.8byte 0x20666F2074756F20
+.8byte 0x646E756F62
+.8byte 0x692064656E676973
+.8byte 0x6F2072656765746E
+.8byte 0x6F6220666F207475
+.8byte 0x646E75
+.8byte 0x696669746E656469
+.8byte 0x6C206F6F74207265
+.8byte 0x676E6F
+.8byte 0x20796177616E7572
+.8byte 0x696C2D69746C756D
+.8byte 0x656D6D6F6320656E
+.8byte 0x746E
+.8byte 0x6C756F63203A7325
+.8byte 0x657220746F6E2064
+.8byte 0x6172616863206461
+.8byte 0x6F72662072657463
+.8byte 0x207475706E69206D
+.8byte 0xA732520656C6966
+.8byte 0x0
+.8byte 0xA646E756F6620
+.8byte 0x6574636570786520
+.8byte 0x207475622064
+.8byte 0xA7325
+.8byte 0x65207861746E7973
+.8byte 0x726F7272
+.8byte 0x69207325203A7325
+.8byte 0x206E69207325206E
+.8byte 0x756C2520656E696C
+.8byte 0x203A
+.8byte 0x6620666F20646E65
+.8byte 0x656C69
+.8byte 0x6C6C616D203A7325
+.8byte 0x6F2074756F20636F
+.8byte 0x79726F6D656D2066
+.8byte 0xA
+.8byte 0x6230
+.8byte 0x6F30
+.8byte 0x7830
+.8byte 0x22732522
+.8byte 0x27632527
+.8byte 0x6761697272616327
+.8byte 0x6E72757465722065
+.8byte 0x27
+.8byte 0x656620656E696C27
+.8byte 0x276465
+.8byte 0x74616C7562617427
+.8byte 0x27726F
+.8byte 0x20666F20646E6527
+.8byte 0x27656C6966
+.8byte 0xA
+.8byte 0x4C4C554E
+.8byte 0x6C756F63203A7325
+.8byte 0x727720746F6E2064
+.8byte 0x7261686320657469
+.8byte 0x6E69207265746361
+.8byte 0x757074756F206F74
+.8byte 0x2520656C69662074
+.8byte 0xA73
+.8byte 0x7325
+.8byte 0x6E6E6163203A7325
+.8byte 0x65766E6F6320746F
+.8byte 0x6F2D74756F207472
+.8byte 0x20646E756F622D66
+.8byte 0x25207265626D756E
+.8byte 0xA73
+.8byte 0x6E6E6163203A7325
+.8byte 0x65766E6F6320746F
+.8byte 0x642D6E6F6E207472
+.8byte 0x6E206C616D696365
+.8byte 0x7325207265626D75
+.8byte 0xA
+.8byte 0x0
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x72657478696D
+.8byte 0x72657473626F6D
+.8byte 0x726574736E696D
+.8byte 0x72657473707968
+.8byte 0x7265747370696D
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x504B4353
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x0
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x20
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x400
+.8byte 0x8
+.8byte 0x40
+.8byte 0x10000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x10
+.8byte 0x400
+.8byte 0x4
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x8
+.8byte 0x20
+.8byte 0x1
+.8byte 0x3E8
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x2A
+.8byte 0x2072656765746E69
+.8byte 0x776F6C667265766F
+.8byte 0x0
+.8byte 0x616974696E696E75
+.8byte 0x65722064657A696C
+.8byte 0x726574736967
+.8byte 0x206E776F6E6B6E75
+.8byte 0x7463757274736E69
+.8byte 0x6E6F69
+.8byte 0x2064696C61766E69
+.8byte 0x73736572646461
+.8byte 0x6E6F697369766964
+.8byte 0x6F72657A20796220
+.8byte 0x0
+.8byte 0x6E692072656D6974
+.8byte 0x74707572726574
+.8byte 0x6C6C6163737973
+.8byte 0x61746E656D676573
+.8byte 0x756166206E6F6974
+.8byte 0x746C
+.8byte 0x7561662065676170
+.8byte 0x746C
+.8byte 0x7065637865206F6E
+.8byte 0x6E6F6974
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x5
+.8byte 0x4
+.8byte 0x5
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0x7
+.8byte 0x0
+.8byte 0x186A0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x20
+.8byte 0x4
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x64
+.8byte 0x6C6C616365
+.8byte 0x726C616A
+.8byte 0x6C616A
+.8byte 0x716562
+.8byte 0x75746C73
+.8byte 0x756D6572
+.8byte 0x75766964
+.8byte 0x6C756D
+.8byte 0x627573
+.8byte 0x646461
+.8byte 0x69646461
+.8byte 0x69756C
+.8byte 0x7773
+.8byte 0x776C
+.8byte 0x6473
+.8byte 0x646C
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x40
+.8byte 0x4
+.8byte 0x0
+.8byte 0x100
+.8byte 0x3
+.8byte 0x2
+.8byte 0x0
+.8byte 0x1
+.8byte 0x200
+.8byte 0x100000
+.8byte 0x1000
+.8byte 0x1000
+.8byte 0xFFFFFFFF
+.8byte 0x4
+.8byte 0x40000000
+.8byte 0x100000
+.8byte 0x400
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x10000
+.8byte 0x4
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x43525453
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x40
+.8byte 0x10
+.8byte 0x10
+.8byte 0x0
+.8byte 0x0
+.8byte 0xC8
+.8byte 0x28
+.8byte 0xC
+.8byte 0x4
+.8byte 0x1
+.8byte 0x0
+.8byte 0x40
+.8byte 0x40
+.8byte 0x10
+.8byte 0x8
+.8byte 0x200000
+.8byte 0x40000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x10
+.8byte 0x10
+.8byte 0x4
+.8byte 0x8
+.8byte 0x4000
+.8byte 0x8000
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x191
+.8byte 0x0
+.8byte 0x0
+.8byte 0xFFFFFFFFFFFFFF9C
+.8byte 0xD6
+.8byte 0x38
+.8byte 0x40
+.8byte 0x3F
+.8byte 0x5D
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x2
+.8byte 0x38
+.8byte 0x40
+.8byte 0x0
+.8byte 0x0
+.8byte 0x40
+.8byte 0x10000
+.8byte 0x1
+.8byte 0xF3
+.8byte 0x2
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x1
+.8byte 0x2
+.8byte 0xCF
+.8byte 0x46
+.8byte 0x4C
+.8byte 0x45
+.8byte 0x7F
+.8byte 0x6
+.8byte 0x5
+.8byte 0x1
+.8byte 0x10000
+.8byte 0x10000
+.8byte 0x80000
+.8byte 0x100000
+.8byte 0x1
+.8byte 0x2
+.8byte 0x1000
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x1
+.8byte 0x20
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x2
+.8byte 0x2
+.8byte 0x3
+.8byte 0x3
+.8byte 0x3
+.8byte 0x7
+.8byte 0x5
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x73
+.8byte 0x6F
+.8byte 0x67
+.8byte 0x63
+.8byte 0x37
+.8byte 0x33
+.8byte 0x23
+.8byte 0x13
+.8byte 0x3
+.8byte 0x3674
+.8byte 0x3574
+.8byte 0x3474
+.8byte 0x3374
+.8byte 0x313173
+.8byte 0x303173
+.8byte 0x3973
+.8byte 0x3873
+.8byte 0x3773
+.8byte 0x3673
+.8byte 0x3573
+.8byte 0x3473
+.8byte 0x3373
+.8byte 0x3273
+.8byte 0x3761
+.8byte 0x3661
+.8byte 0x3561
+.8byte 0x3461
+.8byte 0x3361
+.8byte 0x3261
+.8byte 0x3161
+.8byte 0x3061
+.8byte 0x3173
+.8byte 0x3073
+.8byte 0x3274
+.8byte 0x3174
+.8byte 0x3074
+.8byte 0x7074
+.8byte 0x7067
+.8byte 0x7073
+.8byte 0x6172
+.8byte 0x6F72657A
+.8byte 0x0
+.8byte 0x1F
+.8byte 0x1E
+.8byte 0x1D
+.8byte 0x1C
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0x7
+.8byte 0x20
+.8byte 0x706D75625F
+.8byte 0x6E69616D
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x400
+.8byte 0x2
+.8byte 0x1
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x74736E6F63
+.8byte 0x64656E6769736E75
+.8byte 0x0
+.8byte 0x72616863
+.8byte 0x746E69
+.8byte 0x2E2E2E
+.8byte 0x3D3E
+.8byte 0x3E
+.8byte 0x3D3C
+.8byte 0x3C
+.8byte 0x3D21
+.8byte 0x3D3D
+.8byte 0x3D
+.8byte 0x25
+.8byte 0x2F
+.8byte 0x2A
+.8byte 0x2D
+.8byte 0x2B
+.8byte 0x7D
+.8byte 0x7B
+.8byte 0x29
+.8byte 0x28
+.8byte 0x3B
+.8byte 0x2C
+.8byte 0x666F657A6973
+.8byte 0x656C696877
+.8byte 0x6E7275746572
+.8byte 0x64696F76
+.8byte 0x65736C65
+.8byte 0x6669
+.8byte 0x745F3436746E6975
+.8byte 0x0
+.8byte 0x696669746E656469
+.8byte 0x7265
+.8byte 0x676E69727473
+.8byte 0x6574636172616863
+.8byte 0x72
+.8byte 0x72656765746E69
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x80
+.8byte 0x14
+.8byte 0x40
+.8byte 0x0
+.8byte 0x21
+.8byte 0x20
+.8byte 0x1F
+.8byte 0x1E
+.8byte 0x1D
+.8byte 0x1C
+.8byte 0x1B
+.8byte 0x1A
+.8byte 0x19
+.8byte 0x18
+.8byte 0x17
+.8byte 0x16
+.8byte 0x15
+.8byte 0x14
+.8byte 0x13
+.8byte 0x12
+.8byte 0x11
+.8byte 0x10
+.8byte 0xF
+.8byte 0xE
+.8byte 0xD
+.8byte 0xC
+.8byte 0xB
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0x7
+.8byte 0x6
+.8byte 0x5
+.8byte 0x4
+.8byte 0x3
+.8byte 0x2
+.8byte 0x1
+.8byte 0x0
+.8byte 0xFFFFFFFFFFFFFFFF
+.8byte 0x2E
+.8byte 0x5C
+.8byte 0x3E
+.8byte 0x3C
+.8byte 0x21
+.8byte 0x3D
+.8byte 0x25
+.8byte 0x2F
+.8byte 0x2A
+.8byte 0x2D
+.8byte 0x2B
+.8byte 0x7D
+.8byte 0x7B
+.8byte 0x29
+.8byte 0x28
+.8byte 0x3B
+.8byte 0x2C
+.8byte 0x22
+.8byte 0x27
+.8byte 0x5F
+.8byte 0x20
+.8byte 0xD
+.8byte 0xA
+.8byte 0x9
+.8byte 0x8
+.8byte 0xFFFFFFFFFFFFFFFF
+.8byte 0x632E6569666C6573
+.8byte 0x61732D696E752E73
+.8byte 0x612E677275627A6C
+.8byte 0x74
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x1ED
+.8byte 0x1A4
+.8byte 0x241
+.8byte 0x8301
+.8byte 0x601
+.8byte 0x241
+.8byte 0x8000
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x80
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x40
+.8byte 0x8
+.8byte 0x0
+.8byte 0x0
+.8byte 0x8
+.8byte 0x8
+.8byte 0x20
+.8byte 0x4
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x0
+.8byte 0x40
+.8byte 0x40
+.8byte 0x1
+.8byte 0x1
+.8byte 0x0
+.8byte 0x0
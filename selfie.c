@@ -117,6 +117,7 @@ int dprintf(int fd, const char* format, ...);
 
 uint64_t two_to_the_power_of(uint64_t p);
 uint64_t log_two(uint64_t n);
+uint64_t is_power_of_two(uint64_t n);
 
 uint64_t ten_to_the_power_of(uint64_t p);
 uint64_t log_ten(uint64_t n);
@@ -208,6 +209,8 @@ void zero_memory(uint64_t* memory, uint64_t size);
 uint64_t* zalloc(uint64_t size);  // internal use only!
 uint64_t* zmalloc(uint64_t size); // use this to allocate zeroed memory
 
+uint64_t is_fresh_memory_zeroed(); // internal use only!
+
 // ------------------------ GLOBAL CONSTANTS -----------------------
 
 char* SELFIE_URL = (char*) 0;
@@ -1336,11 +1339,21 @@ uint64_t debug_switch = 0;
 // | 3 | cache-block size | cache-block size in bytes
 // | 4 | cache hits       | counter for cache hits
 // | 5 | cache misses     | counter for cache misses
-// | 6 | cache timer      | counter for LRU replacement strategy
+// | 6 | replacement      | replacement policy: LRU, tree-PLRU, FIFO, or random
+// | 7 | write policy     | write-through or write-back
+// | 8 | write-backs      | counter for cache blocks written back
+// | 9 | dirty blocks     | pointer to list of cache blocks made dirty since last write-back
+// |10 | number of dirty  | number of entries in list of dirty cache blocks
+// |11 | level            | level in cache hierarchy, only L1 caches hold data
+// |12 | next level       | pointer to next-level cache, 0 if memory is next
+// |13 | latency          | number of cycles per cache access
+// |14 | set states       | pointer to replacement state of all sets
+// |15 | tag index        | pointer to hash table of valid cache blocks
+// |16 | random state     | state of pseudo-random number generator for random replacement
 // +---+------------------+
 
 uint64_t* allocate_cache() {
-  return smalloc(1 * sizeof(uint64_t*) + 6 * sizeof(uint64_t));
+  return smalloc(5 * sizeof(uint64_t*) + 12 * sizeof(uint64_t));
 }
 
 uint64_t* get_cache_memory(uint64_t* cache)     { return (uint64_t*) *cache; }
@@ -1349,7 +1362,17 @@ uint64_t  get_associativity(uint64_t* cache)    { return             *(cache + 2
 uint64_t  get_cache_block_size(uint64_t* cache) { return             *(cache + 3); }
 uint64_t  get_cache_hits(uint64_t* cache)       { return             *(cache + 4); }
 uint64_t  get_cache_misses(uint64_t* cache)     { return             *(cache + 5); }
-uint64_t  get_cache_timer(uint64_t* cache)      { return             *(cache + 6); }
+uint64_t  get_replacement_policy(uint64_t* cache) { return           *(cache + 6); }
+uint64_t  get_write_policy(uint64_t* cache)     { return             *(cache + 7); }
+uint64_t  get_cache_write_backs(uint64_t* cache) { return            *(cache + 8); }
+uint64_t* get_dirty_blocks(uint64_t* cache)     { return (uint64_t*) *(cache + 9); }
+uint64_t  get_number_of_dirty(uint64_t* cache)  { return             *(cache + 10); }
+uint64_t  get_cache_level(uint64_t* cache)      { return             *(cache + 11); }
+uint64_t* get_next_level(uint64_t* cache)       { return (uint64_t*) *(cache + 12); }
+uint64_t  get_cache_latency(uint64_t* cache)    { return             *(cache + 13); }
+uint64_t* get_set_states(uint64_t* cache)       { return (uint64_t*) *(cache + 14); }
+uint64_t* get_tag_index(uint64_t* cache)        { return (uint64_t*) *(cache + 15); }
+uint64_t  get_random_state(uint64_t* cache)     { return             *(cache + 16); }
 
 void set_cache_memory(uint64_t* cache, uint64_t* cache_memory)        { *cache       = (uint64_t) cache_memory; }
 void set_cache_size(uint64_t* cache, uint64_t cache_size)             { *(cache + 1) = cache_size; }
@@ -1357,40 +1380,85 @@ void set_associativity(uint64_t* cache, uint64_t associativity)       { *(cache
 void set_cache_block_size(uint64_t* cache, uint64_t cache_block_size) { *(cache + 3) = cache_block_size; }
 void set_cache_hits(uint64_t* cache, uint64_t cache_hits)             { *(cache + 4) = cache_hits; }
 void set_cache_misses(uint64_t* cache, uint64_t cache_misses)         { *(cache + 5) = cache_misses; }
-void set_cache_timer(uint64_t* cache, uint64_t cache_timer)           { *(cache + 6) = cache_timer; }
+void set_replacement_policy(uint64_t* cache, uint64_t policy)         { *(cache + 6) = policy; }
+void set_write_policy(uint64_t* cache, uint64_t write_policy)         { *(cache + 7) = write_policy; }
+void set_cache_write_backs(uint64_t* cache, uint64_t write_backs)     { *(cache + 8) = write_backs; }
+void set_dirty_blocks(uint64_t* cache, uint64_t* dirty_blocks)        { *(cache + 9) = (uint64_t) dirty_blocks; }
+void set_number_of_dirty(uint64_t* cache, uint64_t number)            { *(cache + 10) = number; }
+void set_cache_level(uint64_t* cache, uint64_t level)                 { *(cache + 11) = level; }
+void set_next_level(uint64_t* cache, uint64_t* next_level)            { *(cache + 12) = (uint64_t) next_level; }
+void set_cache_latency(uint64_t* cache, uint64_t latency)             { *(cache + 13) = latency; }
+void set_set_states(uint64_t* cache, uint64_t* set_states)            { *(cache + 14) = (uint64_t) set_states; }
+void set_tag_index(uint64_t* cache, uint64_t* tag_index)              { *(cache + 15) = (uint64_t) tag_index; }
+void set_random_state(uint64_t* cache, uint64_t state)                { *(cache + 16) = state; }
 
 // cache block
 // +---+------------+
 // | 0 | valid flag | valid block or not
 // | 1 | tag        | unique identifier within a set
 // | 2 | memory     | pointer to cache-block memory
-// | 3 | timestamp  | timestamp for replacement strategy
+// | 3 | way        | position of block within its set
+// | 4 | asid       | address-space ID of context that accessed block
+// | 5 | dirty flag | block modified but not yet written back or not
+// | 6 | index      | index of set containing block
+// | 7 | next       | pointer to next block in same bucket of tag index
+// | 8 | newer      | pointer to more recently used block in same set
+// | 9 | older      | pointer to less recently used block in same set
 // +---+------------+
 
 uint64_t* allocate_cache_block() {
-  return zmalloc(1 * sizeof(uint64_t*) + 3 * sizeof(uint64_t));
+  return zmalloc(4 * sizeof(uint64_t*) + 6 * sizeof(uint64_t));
 }
 
 uint64_t  get_valid_flag(uint64_t* cache_block)   { return             *cache_block; }
 uint64_t  get_tag(uint64_t* cache_block)          { return             *(cache_block + 1); }
 uint64_t* get_block_memory(uint64_t* cache_block) { return (uint64_t*) *(cache_block + 2); }
-uint64_t  get_timestamp(uint64_t* cache_block)    { return             *(cache_block + 3); }
+uint64_t  get_block_way(uint64_t* cache_block)    { return             *(cache_block + 3); }
+uint64_t  get_block_asid(uint64_t* cache_block)   { return             *(cache_block + 4); }
+uint64_t  get_dirty_flag(uint64_t* cache_block)   { return             *(cache_block + 5); }
+uint64_t  get_block_index(uint64_t* cache_block)  { return             *(cache_block + 6); }
+uint64_t* get_next_in_chain(uint64_t* cache_block)  { return (uint64_t*) *(cache_block + 7); }
+uint64_t* get_newer_block(uint64_t* cache_block)  { return (uint64_t*) *(cache_block + 8); }
+uint64_t* get_older_block(uint64_t* cache_block)  { return (uint64_t*) *(cache_block + 9); }
 
 void set_valid_flag(uint64_t* cache_block, uint64_t valid)     { *cache_block       = valid; }
 void set_tag(uint64_t* cache_block, uint64_t tag)              { *(cache_block + 1) = tag; }
 void set_block_memory(uint64_t* cache_block, uint64_t* memory) { *(cache_block + 2) = (uint64_t) memory; }
-void set_timestamp(uint64_t* cache_block, uint64_t timestamp)  { *(cache_block + 3) = timestamp; }
+void set_block_way(uint64_t* cache_block, uint64_t way)        { *(cache_block + 3) = way; }
+void set_block_asid(uint64_t* cache_block, uint64_t asid)      { *(cache_block + 4) = asid; }
+void set_dirty_flag(uint64_t* cache_block, uint64_t dirty)     { *(cache_block + 5) = dirty; }
+void set_block_index(uint64_t* cache_block, uint64_t index)    { *(cache_block + 6) = index; }
+void set_next_in_chain(uint64_t* cache_block, uint64_t* next)  { *(cache_block + 7) = (uint64_t) next; }
+void set_newer_block(uint64_t* cache_block, uint64_t* newer)   { *(cache_block + 8) = (uint64_t) newer; }
+void set_older_block(uint64_t* cache_block, uint64_t* older)   { *(cache_block + 9) = (uint64_t) older; }
+
+// cache-set state
+// +---+------------+
+// | 0 | newest     | pointer to most recently used or installed block in set
+// | 1 | oldest     | pointer to least recently used or installed block in set
+// | 2 | tree bits  | associativity - 1 words, one per node of tree-PLRU
+// +---+------------+
+
+uint64_t* get_newest_block(uint64_t* set_state) { return (uint64_t*) *set_state; }
+uint64_t* get_oldest_block(uint64_t* set_state) { return (uint64_t*) *(set_state + 1); }
+uint64_t* get_plru_tree(uint64_t* set_state)    { return             set_state + 2; }
+
+void set_newest_block(uint64_t* set_state, uint64_t* newest) { *set_state       = (uint64_t) newest; }
+void set_oldest_block(uint64_t* set_state, uint64_t* oldest) { *(set_state + 1) = (uint64_t) oldest; }
 
 void reset_cache_counters(uint64_t* cache);
 void reset_all_cache_counters();
 
 void init_cache_memory(uint64_t* cache);
-void init_cache(uint64_t* cache, uint64_t cache_size, uint64_t associativity, uint64_t cache_block_size);
+void init_cache(uint64_t* cache, uint64_t cache_size, uint64_t associativity, uint64_t cache_block_size, uint64_t write_policy, uint64_t level);
 void init_all_caches();
 
 void flush_cache(uint64_t* cache);
 void flush_all_caches();
 
+void write_back_cache(uint64_t* cache);
+void write_back_all_caches();
+
 uint64_t cache_set_size(uint64_t* cache);
 
 uint64_t cache_tag(uint64_t* cache, uint64_t address);
@@ -1399,24 +1467,64 @@ uint64_t cache_block_address(uint64_t* cache, uint64_t address);
 uint64_t cache_byte_offset(uint64_t* cache, uint64_t address);
 
 uint64_t* cache_set(uint64_t* cache, uint64_t vaddr);
+uint64_t  cache_block_paddr(uint64_t* cache, uint64_t* cache_block);
+uint64_t  cache_asid(uint64_t* cache);
+
+uint64_t* cache_set_state(uint64_t* cache, uint64_t index);
+uint64_t* cache_bucket(uint64_t* cache, uint64_t tag, uint64_t index);
+
+void      hash_cache_block(uint64_t* cache, uint64_t* cache_block);
+void      unhash_cache_block(uint64_t* cache, uint64_t* cache_block);
+uint64_t* find_cache_block(uint64_t* cache, uint64_t tag, uint64_t index);
+
+void      unlink_cache_block(uint64_t* set_state, uint64_t* cache_block);
+void      make_newest_block(uint64_t* set_state, uint64_t* cache_block);
+void      make_oldest_block(uint64_t* set_state, uint64_t* cache_block);
+void      touch_plru_tree(uint64_t* cache, uint64_t* cache_block);
+uint64_t  plru_victim_way(uint64_t* cache, uint64_t* set_state);
+uint64_t  random_victim_way(uint64_t* cache);
+
+void      touch_cache_block(uint64_t* cache, uint64_t* cache_block);
+void      drop_cache_block(uint64_t* cache, uint64_t* cache_block);
 
-uint64_t  get_new_timestamp(uint64_t* cache);
 uint64_t* cache_lookup(uint64_t* cache, uint64_t vaddr, uint64_t paddr, uint64_t is_access);
+uint64_t* cache_victim(uint64_t* cache, uint64_t* set);
 
 void      fill_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr);
-uint64_t* handle_cache_miss(uint64_t* cache, uint64_t* cache_block, uint64_t paddr, uint64_t is_access);
+void      install_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr);
+void      evict_cache_block(uint64_t* cache, uint64_t* cache_block);
+void      evict_inclusive_copies(uint64_t* cache, uint64_t* upper_cache, uint64_t paddr);
+void      insert_cache_block(uint64_t* cache, uint64_t paddr);
+void      fetch_from_next_level(uint64_t* cache, uint64_t paddr);
+uint64_t* handle_cache_miss(uint64_t* cache, uint64_t* cache_block, uint64_t paddr);
 uint64_t* retrieve_cache_block(uint64_t* cache, uint64_t vaddr, uint64_t paddr, uint64_t is_access);
 
 void     flush_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr);
+void     write_back_cache_block(uint64_t* cache, uint64_t* cache_block);
+void     invalidate_cache_block(uint64_t* cache, uint64_t vaddr, uint64_t paddr);
 uint64_t load_from_cache(uint64_t* cache, uint64_t vaddr, uint64_t paddr);
 void     store_in_cache(uint64_t* cache, uint64_t vaddr, uint64_t paddr, uint64_t data);
 
 uint64_t load_instruction_from_cache(uint64_t vaddr, uint64_t paddr);
 uint64_t load_data_from_cache(uint64_t vaddr, uint64_t paddr);
 void     store_data_in_cache(uint64_t vaddr, uint64_t paddr, uint64_t data);
+uint64_t peek_data_in_cache(uint64_t vaddr, uint64_t paddr);
+void     snoop_caches(uint64_t vaddr, uint64_t paddr);
 
 void print_cache_profile(uint64_t hits, uint64_t misses, char* cache_name);
 
+uint64_t cache_cycles(uint64_t* cache);
+void     print_cache_hierarchy_profile();
+
+uint64_t parse_replacement_policy(char* name);
+char*    replacement_policy_name(uint64_t policy);
+
+uint64_t init_sweep_configurations(uint64_t* caches);
+void     init_sweep_caches();
+void     access_sweep_cache(uint64_t* cache, uint64_t paddr);
+void     access_all_sweep_caches(uint64_t paddr);
+void     print_cache_sweep_profile();
+
 // ------------------------ GLOBAL CONSTANTS -----------------------
 
 // indicates whether the machine has a cache or not
@@ -1427,6 +1535,10 @@ uint64_t L1_CACHE_ENABLED = 0;
 // during runtime and stores in the code segment are illegal)
 uint64_t L1_CACHE_COHERENCY = 0;
 
+// write policies
+uint64_t CACHE_WRITE_THROUGH = 0; // stores update cache and memory
+uint64_t CACHE_WRITE_BACK    = 1; // stores update cache, memory on eviction
+
 // example configurations:
 // +-------------------+---------------+-----------------------------+------------+
 // |              name |    cache size |               associativity | block size |
@@ -1458,13 +1570,130 @@ uint64_t L1_ICACHE_ASSOCIATIVITY = 4;
 uint64_t L1_DCACHE_BLOCK_SIZE = 16; // in bytes
 uint64_t L1_ICACHE_BLOCK_SIZE = 16; // in bytes
 
-// pointers to VIPT n-way set-associative write-through L1-caches
+// replacement policies
+uint64_t CACHE_LRU    = 0; // least recently used block in set
+uint64_t CACHE_PLRU   = 1; // block approximately least recently used according to binary tree
+uint64_t CACHE_FIFO   = 2; // least recently installed block in set
+uint64_t CACHE_RANDOM = 3; // pseudo-randomly chosen block in set
+
+// L1 data-cache write policy (instruction cache is never written)
+uint64_t L1_DCACHE_WRITE_POLICY = 1; // CACHE_WRITE_BACK
+
+// pointers to VIPT n-way set-associative L1-caches
+// with cache blocks tagged by address-space ID (ASID)
 uint64_t* L1_ICACHE;
 uint64_t* L1_DCACHE;
 
+// indicates whether the machine has unified L2 and L3 caches or not
+uint64_t L2_CACHE_ENABLED = 0;
+uint64_t L3_CACHE_ENABLED = 0;
+
+// L2 and L3 caches are physically indexed and only track which
+// cache blocks they hold since data comes from L1 caches or memory
+// assert: L2_CACHE_BLOCK_SIZE >= L1_xCACHE_BLOCK_SIZE
+// assert: L3_CACHE_BLOCK_SIZE == L2_CACHE_BLOCK_SIZE
+// assert: L1_DCACHE_BLOCK_SIZE == L1_ICACHE_BLOCK_SIZE
+// (exclusive caches use L1 cache-block size on all levels)
+uint64_t L2_CACHE_SIZE = 262144;  // 256 KB unified cache
+uint64_t L3_CACHE_SIZE = 2097152; // 2 MB unified cache
+
+uint64_t L2_CACHE_ASSOCIATIVITY = 8;
+uint64_t L3_CACHE_ASSOCIATIVITY = 16;
+
+uint64_t L2_CACHE_BLOCK_SIZE = 64; // in bytes
+uint64_t L3_CACHE_BLOCK_SIZE = 64; // in bytes
+
+// inclusion policies of L2 and L3 caches
+uint64_t CACHE_INCLUSIVE = 0; // lower levels hold all blocks of upper levels
+uint64_t CACHE_EXCLUSIVE = 1; // lower levels only hold blocks evicted from upper levels
+
+// cycle-cost model: number of cycles per access of each level
+uint64_t L1_CACHE_LATENCY = 4;
+uint64_t L2_CACHE_LATENCY = 12;
+uint64_t L3_CACHE_LATENCY = 40;
+uint64_t MEMORY_LATENCY   = 200;
+
+// pointers to unified L2 and L3 caches
+uint64_t* L2_CACHE;
+uint64_t* L3_CACHE;
+
+// a cache sweep simulates all L1 data-cache configurations with
+// power-of-2 size, associativity, and cache-block size within bounds
+// side by side, cache-size bounds are given on the console
+uint64_t SWEEP_MAX_ASSOCIATIVITY = 16;
+uint64_t SWEEP_MIN_BLOCK_SIZE    = 16; // in bytes
+uint64_t SWEEP_MAX_BLOCK_SIZE    = 64; // in bytes
+
 // ------------------------ GLOBAL VARIABLES -----------------------
 
+uint64_t L1_asid = 0; // ASID of context whose memory accesses are cached
+
+uint64_t cache_inclusion = 0; // CACHE_INCLUSIVE
+
+uint64_t cache_replacement = 0; // CACHE_LRU
+
+uint64_t sweep_min_size = 0; // smallest cache size in cache sweep, 0 if no sweep
+uint64_t sweep_max_size = 0; // largest cache size in cache sweep
+
+uint64_t* sweep_caches = (uint64_t*) 0; // pointers to caches simulated in cache sweep
+
+uint64_t number_of_sweep_caches = 0;
+
+uint64_t memory_fetches = 0; // number of cache blocks fetched from memory
+
 uint64_t L1_icache_coherency_invalidations = 0;
+uint64_t L1_synonym_invalidations          = 0;
+
+// -----------------------------------------------------------------
+// ---------------------------- TRACER -----------------------------
+// -----------------------------------------------------------------
+
+void open_trace();
+void flush_trace();
+void close_trace();
+
+void trace_byte(uint64_t b);
+void trace_address(uint64_t type, uint64_t paddr);
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+uint64_t TRACEMAGIC = 1129469011; // "STRC" in little endian
+
+// trace file:
+// magic word followed by one record per traced memory access
+// until end of file, each record is a varint (7 bits per byte,
+// least significant bits first, most significant bit set in all
+// but the last byte) encoding (zigzag(delta) * 4 + type) where
+// delta is the difference to the physical address of the previous
+// access of the same type, zigzag(delta) is 2 * delta for delta >= 0
+// and -2 * delta - 1 otherwise, so that sequential instruction fetches
+// and nearby loads and stores take a single byte; physical addresses
+// depend on where the host allocates page frames, so traces of the
+// same execution may differ but replaying a trace is deterministic
+
+uint64_t TRACE_FETCH = 0;
+uint64_t TRACE_LOAD  = 1;
+uint64_t TRACE_STORE = 2;
+
+uint64_t TRACE_TYPES = 4; // leaving one type for future use
+
+uint64_t TRACEBUFFERSIZE = 65536; // in bytes
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+char* trace_name = (char*) 0; // name of trace file written by mipster
+
+uint64_t tracing = 0; // flag for tracing memory accesses
+
+uint64_t trace_fd = 0;
+
+uint64_t* trace_buffer = (uint64_t*) 0;
+
+uint64_t trace_cursor = 0; // number of bytes in trace buffer
+uint64_t trace_size   = 0; // number of bytes written into trace file
+
+uint64_t* traced_addresses = (uint64_t*) 0; // previous physical address of each type
+uint64_t* traced_accesses  = (uint64_t*) 0; // number of traced accesses of each type
 
 // -----------------------------------------------------------------
 // ---------------------------- MEMORY -----------------------------
@@ -1478,9 +1707,25 @@ uint64_t leaf_PTE_offset(uint64_t page);
 
 uint64_t* get_PTE_address(uint64_t* parent_table, uint64_t* table, uint64_t page);
 
+uint64_t is_superpage_PDE(uint64_t PDE);
+uint64_t get_superpage_frame(uint64_t* parent_table, uint64_t* table, uint64_t page);
+
+uint64_t walk_page_table(uint64_t* table, uint64_t page);
+uint64_t next_walked_page(uint64_t* table, uint64_t page);
+
+uint64_t* get_TLB_entry(uint64_t page);
+void      invalidate_TLB_entry(uint64_t* table, uint64_t page);
+
+uint64_t* get_PWC_entry(uint64_t* table, uint64_t root);
+void      flush_PWC();
+
+uint64_t* get_nested_PTE(uint64_t* parent_table, uint64_t* table, uint64_t page);
+
 uint64_t get_page_frame(uint64_t* table, uint64_t page);
 uint64_t is_page_mapped(uint64_t* table, uint64_t page);
-void     set_page_frame(uint64_t* table, uint64_t page, uint64_t frame);
+
+uint64_t* demote_superpage(uint64_t* table, uint64_t page);
+void      set_page_frame(uint64_t* table, uint64_t page, uint64_t frame);
 
 uint64_t page_of_virtual_address(uint64_t vaddr);
 uint64_t virtual_address_of_page(uint64_t page);
@@ -1495,6 +1740,7 @@ void     store_virtual_memory(uint64_t* table, uint64_t vaddr, uint64_t data);
 
 uint64_t load_cached_virtual_memory(uint64_t* table, uint64_t vaddr);
 void     store_cached_virtual_memory(uint64_t* table, uint64_t vaddr, uint64_t data);
+uint64_t peek_cached_virtual_memory(uint64_t* table, uint64_t vaddr);
 
 uint64_t load_cached_instruction_word(uint64_t* table, uint64_t vaddr);
 
@@ -1517,9 +1763,80 @@ uint64_t NUMBEROFLEAFPTES = 512;     // PAGESIZE / sizeof(uint64_t*): host-depen
 
 uint64_t PAGETABLETREE = 1; // two-level page table is default
 
+// with a two-level page table, a root PDE may map all NUMBEROFLEAFPTES
+// pages of its range (2MB with 4KB pages and 64-bit pointers) directly
+// to a superpage, that is, to a superframe of NUMBEROFLEAFPTES page
+// frames contiguous in memory, rather than to a leaf page table;
+// superframes are PAGEFRAMESIZE-aligned, so superpage PDEs are tagged
+// by adding 1 to the address of their superframe
+
 uint64_t PHYSICALMEMORYSIZE   = 0; // total amount of physical memory available for page frames
 uint64_t PHYSICALMEMORYEXCESS = 2; // tolerate more allocation than physically available
 
+// direct-mapped translation lookaside buffer (TLB)
+// entries are tagged with their page table which
+// avoids flushing the TLB when switching contexts
+// +---+------------+
+// | 0 | page table | page table of cached translation, 0 if invalid
+// | 1 | page       | virtual page
+// | 2 | page frame | page frame of virtual page
+// +---+------------+
+
+uint64_t TLBENTRIES = 3;
+
+uint64_t* get_TLB_table(uint64_t* entry) { return (uint64_t*) *entry; }
+uint64_t  get_TLB_page(uint64_t* entry)  { return             *(entry + 1); }
+uint64_t  get_TLB_frame(uint64_t* entry) { return             *(entry + 2); }
+
+void set_TLB_table(uint64_t* entry, uint64_t* table) { *entry       = (uint64_t) table; }
+void set_TLB_page(uint64_t* entry, uint64_t page)    { *(entry + 1) = page; }
+void set_TLB_frame(uint64_t* entry, uint64_t frame)  { *(entry + 2) = frame; }
+
+uint64_t TLB_SIZE = 256; // number of TLB entries
+
+uint64_t* TLB = (uint64_t*) 0;
+
+// direct-mapped two-dimensional page-walk cache (PWC) for
+// page tables in parent address spaces: root PDEs of such
+// page tables are cached as pointers to the page frames of
+// their leaf page tables, saving a walk of the parent page
+// table per PTE lookup; remapping or unmapping any page in
+// any page table flushes the whole PWC
+// +---+-----------------+
+// | 0 | parent table    | page table of parent address space, 0 if invalid
+// | 1 | page table      | page table in parent address space
+// | 2 | root PDE offset | offset of root PDE in page table
+// | 3 | leaf page table | page frame of leaf page table
+// +---+-----------------+
+
+uint64_t PWCENTRIES = 4;
+
+uint64_t* get_PWC_parent_table(uint64_t* entry) { return (uint64_t*) *entry; }
+uint64_t* get_PWC_table(uint64_t* entry)        { return (uint64_t*) *(entry + 1); }
+uint64_t  get_PWC_root(uint64_t* entry)         { return             *(entry + 2); }
+uint64_t* get_PWC_leaf_pt(uint64_t* entry)      { return (uint64_t*) *(entry + 3); }
+
+void set_PWC_parent_table(uint64_t* entry, uint64_t* table) { *entry       = (uint64_t) table; }
+void set_PWC_table(uint64_t* entry, uint64_t* table)        { *(entry + 1) = (uint64_t) table; }
+void set_PWC_root(uint64_t* entry, uint64_t root)           { *(entry + 2) = root; }
+void set_PWC_leaf_pt(uint64_t* entry, uint64_t* leaf_pt)    { *(entry + 3) = (uint64_t) leaf_pt; }
+
+uint64_t PWC_SIZE = 64; // number of PWC entries
+
+uint64_t* PWC = (uint64_t*) 0;
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+uint64_t TLB_hits   = 0;
+uint64_t TLB_misses = 0;
+
+uint64_t PWC_used = 0; // flag indicating if PWC may contain valid entries
+
+uint64_t PWC_hits   = 0;
+uint64_t PWC_misses = 0;
+
+uint64_t demoted_superpages = 0; // number of superpages split into leaf page tables
+
 // ------------------------- INITIALIZATION ------------------------
 
 void init_memory(uint64_t megabytes) {
@@ -1536,6 +1853,20 @@ void init_memory(uint64_t megabytes) {
 
   PHYSICALMEMORYSIZE   = megabytes * MEGABYTE;
   PHYSICALMEMORYEXCESS = PHYSICALMEMORYEXCESS * (PAGEFRAMESIZE / PAGESIZE);
+
+  // all TLB entries are invalid
+  TLB = zmalloc(TLB_SIZE * TLBENTRIES * sizeof(uint64_t));
+
+  TLB_hits   = 0;
+  TLB_misses = 0;
+
+  // all PWC entries are invalid
+  PWC = zmalloc(PWC_SIZE * PWCENTRIES * sizeof(uint64_t));
+
+  PWC_used = 0;
+
+  PWC_hits   = 0;
+  PWC_misses = 0;
 }
 
 // -----------------------------------------------------------------
@@ -1717,12 +2048,38 @@ void fetch();
 void decode();
 void execute();
 
+uint64_t* predecoded_instruction(uint64_t* context, uint64_t vaddr);
+void      invalidate_predecoded_code(uint64_t* context, uint64_t vaddr, uint64_t size);
+
+void predecode(uint64_t* entry);
+void fetch_predecoded();
+
+uint64_t is_predecoded_addi(uint64_t* entry, uint64_t rd, uint64_t rs1, uint64_t imm);
+uint64_t is_predecoded_stack_access(uint64_t* entry, uint64_t is, uint64_t reg);
+
+uint64_t match_superinstruction(uint64_t vaddr);
+uint64_t get_superinstruction_length(uint64_t si);
+void     fuse_predecoded(uint64_t vaddr);
+
+void fetch_fast();
+
 void execute_record();
 void execute_undo();
 void execute_debug();
 
+void     write_register_fast(uint64_t reg, uint64_t value);
+uint64_t do_load_fast();
+uint64_t do_store_fast();
+void     execute_fast();
+
+uint64_t is_accessible_fast(uint64_t vaddr);
+uint64_t execute_stepwise(uint64_t* entry, uint64_t n);
+uint64_t execute_superinstruction(uint64_t remaining);
+
 void interrupt();
 
+uint64_t execute_budget(uint64_t budget);
+
 void run_until_exception();
 
 uint64_t instruction_with_max_counter(uint64_t* counters, uint64_t max);
@@ -1734,6 +2091,7 @@ void print_per_register_profile(uint64_t reg);
 
 void print_register_memory_profile();
 
+void down_load_profile(uint64_t* context);
 void down_load_profiles();
 void print_instruction_versus_exception_profile(uint64_t* parent_context);
 
@@ -1772,6 +2130,8 @@ uint64_t debug_syscalls = 0; // flag for debugging syscalls
 uint64_t record = 0; // flag for recording code execution
 uint64_t redo   = 0; // flag for redoing code execution
 
+uint64_t fast = 0; // flag for executing code without profiling
+
 uint64_t disassemble_verbose = 0; // flag for disassembling code in more detail
 
 uint64_t symbolic = 0; // flag for symbolically executing code
@@ -1784,6 +2144,49 @@ uint64_t TIMESLICE = 100000;
 
 uint64_t TIMEROFF = 0; // must be 0 to turn off timer interrupt
 
+// predecoded instruction
+// +---+----------------+
+// | 0 | instruction    | instruction register
+// | 1 | instruction ID | instruction ID, 0 if not yet predecoded
+// | 2 | rd             | destination register
+// | 3 | rs1            | first source register
+// | 4 | rs2            | second source register
+// | 5 | immediate      | sign-extended immediate value
+// | 6 | fused ID       | superinstruction ID, or instruction ID if not fused
+// +---+----------------+
+
+uint64_t PREDECODEDENTRIES = 7;
+
+uint64_t get_predecoded_ir(uint64_t* entry)  { return *entry; }
+uint64_t get_predecoded_is(uint64_t* entry)  { return *(entry + 1); }
+uint64_t get_predecoded_rd(uint64_t* entry)  { return *(entry + 2); }
+uint64_t get_predecoded_rs1(uint64_t* entry) { return *(entry + 3); }
+uint64_t get_predecoded_rs2(uint64_t* entry) { return *(entry + 4); }
+uint64_t get_predecoded_imm(uint64_t* entry) { return *(entry + 5); }
+uint64_t get_predecoded_si(uint64_t* entry)  { return *(entry + 6); }
+
+void set_predecoded_ir(uint64_t* entry, uint64_t ir)   { *entry       = ir; }
+void set_predecoded_is(uint64_t* entry, uint64_t is)   { *(entry + 1) = is; }
+void set_predecoded_rd(uint64_t* entry, uint64_t rd)   { *(entry + 2) = rd; }
+void set_predecoded_rs1(uint64_t* entry, uint64_t rs1) { *(entry + 3) = rs1; }
+void set_predecoded_rs2(uint64_t* entry, uint64_t rs2) { *(entry + 4) = rs2; }
+void set_predecoded_imm(uint64_t* entry, uint64_t imm) { *(entry + 5) = imm; }
+void set_predecoded_si(uint64_t* entry, uint64_t si)   { *(entry + 6) = si; }
+
+// superinstructions fuse instruction sequences generated by starc
+// for faster execution without profiling, IDs follow RISC-U IDs
+
+uint64_t FUSED_PUSH     = 15; // addi sp,sp,-w; sd rs2,0(sp)
+uint64_t FUSED_POP      = 16; // ld rd,0(sp); addi sp,sp,w
+uint64_t FUSED_PROLOGUE = 17; // addi sp,sp,-w; sd ra,0(sp); addi sp,sp,-w; sd s0,0(sp); addi s0,sp,0
+uint64_t FUSED_EPILOGUE = 18; // ld s0,0(sp); addi sp,sp,w; ld ra,0(sp); addi sp,sp,imm
+uint64_t FUSED_LI       = 19; // lui rd,imm; addi rd,rd,imm
+
+uint64_t FUSEDLENGTH_PROLOGUE = 5;
+uint64_t FUSEDLENGTH_EPILOGUE = 4;
+
+uint64_t MAXFUSEDLENGTH = 5; // length of longest superinstruction
+
 // ------------------------ GLOBAL VARIABLES -----------------------
 
 // hardware thread state
@@ -1802,6 +2205,13 @@ uint64_t* pt = (uint64_t*) 0; // page table
 uint64_t timer = 0; // counter for timer interrupt
 uint64_t trap  = 0; // flag for creating a trap
 
+uint64_t switched = 0; // flag for trapping on context switches that reset the timer
+
+// number of invalidations of predecoded code, also used by tools
+// for discarding any code derived from predecoded instructions
+
+uint64_t predecoded_code_invalidations = 0;
+
 // effective nop counters
 
 uint64_t nopc_lui   = 0;
@@ -1818,6 +2228,11 @@ uint64_t nopc_beq   = 0;
 uint64_t nopc_jal   = 0;
 uint64_t nopc_jalr  = 0;
 
+// superinstruction counters
+
+uint64_t superinstructions  = 0; // number of executed superinstructions
+uint64_t fused_instructions = 0; // number of instructions executed in superinstructions
+
 // source profile
 
 uint64_t  calls               = 0;             // total number of executed procedure calls
@@ -1883,6 +2298,8 @@ void reset_interpreter() {
   trap = 0;
 
   timer = TIMEROFF;
+
+  switched = 0;
 }
 
 void reset_nop_counters() {
@@ -1901,6 +2318,11 @@ void reset_nop_counters() {
   nopc_jalr  = 0;
 }
 
+void reset_fused_counters() {
+  superinstructions  = 0;
+  fused_instructions = 0;
+}
+
 void reset_source_profile() {
   calls               = 0;
   calls_per_procedure = zmalloc(code_size / INSTRUCTIONSIZE * sizeof(uint64_t));
@@ -1943,6 +2365,7 @@ void reset_segments_profile() {
 void reset_profiler() {
   reset_binary_counters();
   reset_nop_counters();
+  reset_fused_counters();
   reset_source_profile();
   reset_registers_profile();
   reset_segments_profile();
@@ -1996,11 +2419,25 @@ void reset_profiler() {
 // | 30 | gcs counter     | number of gc runs in gc period
 // | 31 | gc enabled      | flag indicating whether to use gc or not
 // +----+-----------------+
+// | 32 | predecoded code | pointer to predecoded instructions of code segment
+// +----+-----------------+
+// | 33 | next in bucket  | pointer to next context in same bucket of context table
+// | 34 | next ready      | pointer to next context in same ready queue
+// | 35 | state           | READY, RUNNING, BLOCKED, or EXITED
+// | 36 | priority        | priority level, 0 is highest
+// | 37 | time slices     | number of times context was switched to
+// +----+-----------------+
+// | 38 | asid            | address-space ID, tagged with ASID generation
+// +----+-----------------+
+// | 39 | page log        | pointer to pages mapped since page table was last cached
+// | 40 | logged pages    | number of pages mapped since page table was last cached
+// | 41 | synced state    | pointer to registers and state last synced with virtual context
+// +----+-----------------+
 
 // number of entries of a machine context:
-// 14 uint64_t + 6 uint64_t* + 1 char* + 7 uint64_t + 2 uint64_t* + 2 uint64_t entries
+// 14 uint64_t + 6 uint64_t* + 1 char* + 7 uint64_t + 2 uint64_t* + 2 uint64_t + 1 uint64_t* + 2 uint64_t* + 3 uint64_t + 1 uint64_t + 1 uint64_t* + 1 uint64_t + 1 uint64_t* entries
 // extended in the symbolic execution engine and the Boehm garbage collector
-uint64_t CONTEXTENTRIES = 32;
+uint64_t CONTEXTENTRIES = 42;
 
 uint64_t* allocate_context(); // declaration avoids warning in the Boehm garbage collector
 
@@ -2044,6 +2481,9 @@ uint64_t free_list_head(uint64_t* context) { return (uint64_t) (context + 29); }
 uint64_t gcs_in_period(uint64_t* context)  { return (uint64_t) (context + 30); }
 uint64_t use_gc_kernel(uint64_t* context)  { return (uint64_t) (context + 31); }
 
+uint64_t page_log(uint64_t* context)     { return (uint64_t) (context + 39); }
+uint64_t logged_pages(uint64_t* context) { return (uint64_t) (context + 40); }
+
 uint64_t* get_next_context(uint64_t* context)    { return (uint64_t*) *context; }
 uint64_t* get_prev_context(uint64_t* context)    { return (uint64_t*) *(context + 1); }
 uint64_t  get_pc(uint64_t* context)              { return             *(context + 2); }
@@ -2079,6 +2519,20 @@ uint64_t* get_free_list_head(uint64_t* context) { return (uint64_t*) *(context +
 uint64_t  get_gcs_in_period(uint64_t* context)  { return             *(context + 30); }
 uint64_t  get_use_gc_kernel(uint64_t* context)  { return             *(context + 31); }
 
+uint64_t* get_predecoded_code(uint64_t* context) { return (uint64_t*) *(context + 32); }
+
+uint64_t* get_next_in_bucket(uint64_t* context) { return (uint64_t*) *(context + 33); }
+uint64_t* get_next_ready(uint64_t* context)     { return (uint64_t*) *(context + 34); }
+uint64_t  get_context_state(uint64_t* context)  { return             *(context + 35); }
+uint64_t  get_priority(uint64_t* context)       { return             *(context + 36); }
+uint64_t  get_time_slices(uint64_t* context)    { return             *(context + 37); }
+
+uint64_t get_asid(uint64_t* context) { return *(context + 38); }
+
+uint64_t* get_page_log(uint64_t* context)     { return (uint64_t*) *(context + 39); }
+uint64_t  get_logged_pages(uint64_t* context) { return             *(context + 40); }
+uint64_t* get_synced_state(uint64_t* context) { return (uint64_t*) *(context + 41); }
+
 void set_next_context(uint64_t* context, uint64_t* next)     { *context        = (uint64_t) next; }
 void set_prev_context(uint64_t* context, uint64_t* prev)     { *(context + 1)  = (uint64_t) prev; }
 void set_pc(uint64_t* context, uint64_t pc)                  { *(context + 2)  = pc; }
@@ -2114,6 +2568,20 @@ void set_free_list_head(uint64_t* context, uint64_t* free_list_head) { *(context
 void set_gcs_in_period(uint64_t* context, uint64_t gcs)              { *(context + 30) = gcs; }
 void set_use_gc_kernel(uint64_t* context, uint64_t use)              { *(context + 31) = use; }
 
+void set_predecoded_code(uint64_t* context, uint64_t* code) { *(context + 32) = (uint64_t) code; }
+
+void set_next_in_bucket(uint64_t* context, uint64_t* next)    { *(context + 33) = (uint64_t) next; }
+void set_next_ready(uint64_t* context, uint64_t* next)        { *(context + 34) = (uint64_t) next; }
+void set_context_state(uint64_t* context, uint64_t state)     { *(context + 35) = state; }
+void set_priority(uint64_t* context, uint64_t priority)       { *(context + 36) = priority; }
+void set_time_slices(uint64_t* context, uint64_t time_slices) { *(context + 37) = time_slices; }
+
+void set_asid(uint64_t* context, uint64_t asid) { *(context + 38) = asid; }
+
+void set_page_log(uint64_t* context, uint64_t* log)       { *(context + 39) = (uint64_t) log; }
+void set_logged_pages(uint64_t* context, uint64_t number) { *(context + 40) = number; }
+void set_synced_state(uint64_t* context, uint64_t* state) { *(context + 41) = (uint64_t) state; }
+
 // -----------------------------------------------------------------
 // ---------------------------- MEMORY -----------------------------
 // -----------------------------------------------------------------
@@ -2126,6 +2594,8 @@ uint64_t is_heap_address(uint64_t* context, uint64_t vaddr);
 uint64_t is_address_between_stack_and_heap(uint64_t* context, uint64_t vaddr);
 uint64_t is_data_stack_heap_address(uint64_t* context, uint64_t vaddr);
 
+uint64_t data_stack_heap_segment_end(uint64_t* context, uint64_t vaddr);
+
 // -----------------------------------------------------------------
 // ---------------------- GARBAGE COLLECTOR ------------------------
 // -----------------------------------------------------------------
@@ -2154,6 +2624,7 @@ uint64_t is_gc_library(uint64_t* context);
 // +----+---------+
 
 uint64_t* allocate_metadata(uint64_t* context);
+uint64_t* copy_metadata_list(uint64_t* context, uint64_t* entry);
 
 uint64_t* get_metadata_next(uint64_t* entry)    { return (uint64_t*) *entry; }
 uint64_t* get_metadata_memory(uint64_t* entry)  { return (uint64_t*) *(entry + 1); }
@@ -2298,6 +2769,74 @@ void reset_gc_counters() {
   gc_mem_collected      = 0;
 }
 
+// -----------------------------------------------------------------
+// --------------------------- SCHEDULER ---------------------------
+// -----------------------------------------------------------------
+
+void init_scheduler();
+
+uint64_t* get_bucket(uint64_t* parent, uint64_t* vctxt);
+
+void      hash_context(uint64_t* context);
+void      unhash_context(uint64_t* context);
+
+void      enqueue_context(uint64_t* context);
+uint64_t* dequeue_context(uint64_t priority);
+
+void ready_context(uint64_t* context);
+void block_context(uint64_t* context);
+void exit_context(uint64_t* context);
+void dispatch_context(uint64_t* context);
+
+void account_context(uint64_t* context);
+
+uint64_t* schedule();
+
+uint64_t parse_scheduling_policy(char* name);
+char*    scheduling_policy_name(uint64_t policy);
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+uint64_t CONTEXT_READY   = 0; // in ready queue, or not yet switched to
+uint64_t CONTEXT_RUNNING = 1;
+uint64_t CONTEXT_BLOCKED = 2; // waiting for parent or child context
+uint64_t CONTEXT_EXITED  = 3;
+
+uint64_t ROUNDROBIN = 0; // all contexts share one ready queue
+uint64_t PRIORITY   = 1; // multi-level feedback queues
+
+uint64_t SCHEDULER = 0; // ROUNDROBIN by default, PRIORITY with -scheduler priority
+
+uint64_t NUMBEROFPRIORITIES = 4; // priority levels, 0 is highest
+
+uint64_t CONTEXTBUCKETS = 1024; // number of buckets of context table, power of 2
+
+uint64_t STARVATIONPERIOD = 16; // every so often schedule lowest priority first
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+uint64_t* context_table = (uint64_t*) 0; // hash table of contexts indexed by parent and virtual context
+
+uint64_t* ready_heads = (uint64_t*) 0; // ready queue heads, one per priority level
+uint64_t* ready_tails = (uint64_t*) 0; // ready queue tails, one per priority level
+
+uint64_t number_of_ready_contexts = 0;
+
+uint64_t schedules = 0; // number of scheduling decisions
+
+// ------------------------- INITIALIZATION ------------------------
+
+void reset_scheduler() {
+  zero_memory(context_table, CONTEXTBUCKETS * sizeof(uint64_t*));
+
+  zero_memory(ready_heads, NUMBEROFPRIORITIES * sizeof(uint64_t*));
+  zero_memory(ready_tails, NUMBEROFPRIORITIES * sizeof(uint64_t*));
+
+  number_of_ready_contexts = 0;
+
+  schedules = 0;
+}
+
 // -----------------------------------------------------------------
 // -------------------------- MICROKERNEL --------------------------
 // -----------------------------------------------------------------
@@ -2312,6 +2851,10 @@ uint64_t* create_context(uint64_t* parent, uint64_t* vctxt);
 uint64_t* find_context(uint64_t* parent, uint64_t* vctxt);
 uint64_t* cache_context(uint64_t* vctxt);
 
+void down_load_virtual_words(uint64_t* table, uint64_t vaddr, uint64_t* words, uint64_t n);
+void up_load_changed_words(uint64_t* table, uint64_t vaddr, uint64_t* words, uint64_t* synced, uint64_t n);
+void up_load_changed_word(uint64_t* table, uint64_t vaddr, uint64_t* synced, uint64_t word);
+
 void save_context(uint64_t* context);
 
 uint64_t lowest_page(uint64_t page, uint64_t lo);
@@ -2319,15 +2862,35 @@ uint64_t highest_page(uint64_t page, uint64_t hi);
 void     map_page(uint64_t* context, uint64_t page, uint64_t frame);
 
 void cache_page_table(uint64_t* context, uint64_t* table, uint64_t* parent_table, uint64_t lo, uint64_t hi);
+void cache_logged_pages(uint64_t* context, uint64_t* table, uint64_t* parent_table, uint64_t* log, uint64_t logged);
+void recache_hosted_contexts(uint64_t* parent);
 
 void restore_context(uint64_t* context);
 
+uint64_t activate_asid(uint64_t* context);
+
 uint64_t pavailable();
 uint64_t pused();
+uint64_t ppeak();
 
 uint64_t* palloc();
 void      pfree(uint64_t* frame);
 
+uint64_t* palloc_superframe();
+uint64_t  promote_superpage(uint64_t* context, uint64_t page);
+
+uint64_t* get_frame_bucket(uint64_t frame);
+uint64_t* find_shared_frame(uint64_t frame);
+void      share_page_frame(uint64_t frame);
+void      unshare_page_frame(uint64_t* entry);
+void      release_page_frame(uint64_t frame);
+
+void copy_on_write(uint64_t* table, uint64_t page);
+
+uint64_t* fork_context(uint64_t* context);
+
+void reclaim_context(uint64_t* context);
+
 void map_and_store(uint64_t* context, uint64_t vaddr, uint64_t data);
 
 void map_unmapped_pages(uint64_t* context);
@@ -2337,6 +2900,29 @@ void map_unmapped_pages(uint64_t* context);
 uint64_t debug_create = 0;
 uint64_t debug_map    = 0;
 
+uint64_t NUMBEROFASIDS = 65536; // 16-bit ASIDs as in RISC-V
+
+uint64_t PAGELOGSIZE = 64; // maximum number of logged pages before falling back to caching page ranges
+
+uint64_t SYNCEDFIELDS = 8; // program break, exception, fault, exit code, and four garbage collector fields
+
+// shared page frame
+// +---+---------+
+// | 0 | next    | pointer to next shared page frame in same bucket
+// | 1 | frame   | page frame mapped read-only in more than one page table
+// | 2 | sharers | number of page tables mapping page frame
+// +---+---------+
+
+uint64_t* get_next_shared_frame(uint64_t* entry) { return (uint64_t*) *entry; }
+uint64_t  get_shared_frame(uint64_t* entry)      { return             *(entry + 1); }
+uint64_t  get_frame_sharers(uint64_t* entry)     { return             *(entry + 2); }
+
+void set_next_shared_frame(uint64_t* entry, uint64_t* next) { *entry       = (uint64_t) next; }
+void set_shared_frame(uint64_t* entry, uint64_t frame)      { *(entry + 1) = frame; }
+void set_frame_sharers(uint64_t* entry, uint64_t sharers)   { *(entry + 2) = sharers; }
+
+uint64_t FRAMEBUCKETS = 1024; // number of buckets in hash table of shared page frames
+
 // ------------------------ GLOBAL VARIABLES -----------------------
 
 uint64_t* current_context = (uint64_t*) 0; // context currently running
@@ -2346,22 +2932,52 @@ uint64_t* free_contexts = (uint64_t*) 0; // singly-linked list of free contexts
 
 uint64_t allocated_page_frame_memory = 0;
 uint64_t free_page_frame_memory      = 0;
+uint64_t freed_page_frame_memory     = 0;
+
+uint64_t peak_page_frame_memory = 0; // page frame memory in use before page frames were last freed
 
 uint64_t next_page_frame = 0;
 
+uint64_t* free_page_frames = (uint64_t*) 0; // singly-linked list of freed page frames
+
+uint64_t reclaimed_page_frames = 0; // number of page frames returned by pfree
+uint64_t reused_page_frames    = 0; // number of freed page frames returned by palloc
+
+uint64_t asid_generation = 1; // generation 0 marks contexts without ASID
+uint64_t next_asid       = 0;
+
+uint64_t* shared_frame_table = (uint64_t*) 0; // hash table of shared page frames, allocated when first sharing
+uint64_t* free_shared_frames = (uint64_t*) 0; // singly-linked list of unused shared page frame entries
+
+uint64_t shared_page_frames = 0; // number of page frames currently shared copy-on-write
+
+uint64_t promoted_superpages = 0; // number of superpages promoted by promote_superpage
+
+uint64_t forked_contexts    = 0; // number of contexts created by fork_context
+uint64_t copied_page_frames = 0; // number of shared page frames copied on first write
+
+uint64_t nested_switches = 0; // number of context switches to contexts in parent address spaces
+uint64_t synced_words    = 0; // number of register and state words copied between context and virtual context
+
 // ------------------------- INITIALIZATION ------------------------
 
 void reset_microkernel() {
   current_context = (uint64_t*) 0;
 
-  while (used_contexts != (uint64_t*) 0)
+  while (used_contexts != (uint64_t*) 0) {
+    reclaim_context(used_contexts);
+
     used_contexts = delete_context(used_contexts, used_contexts);
+  }
+
+  reset_scheduler();
 }
 
 // -----------------------------------------------------------------
 // ---------------------------- KERNEL -----------------------------
 // -----------------------------------------------------------------
 
+void up_load_segment(uint64_t* context, uint64_t vaddr, uint64_t* binary, uint64_t size);
 void up_load_binary(uint64_t* context);
 
 uint64_t up_load_string(uint64_t* context, char* s, uint64_t SP);
@@ -2374,6 +2990,23 @@ char* increment_boot_level_prefix(char* s, char* t);
 
 void boot_loader(uint64_t* context);
 
+uint64_t* find_indexed_frame(uint64_t frame);
+uint64_t  index_page_frame(uint64_t frame);
+uint64_t  index_page_table(uint64_t* context);
+
+void     write_checkpoint(uint64_t fd, uint64_t* buffer, uint64_t bytes);
+void     read_checkpoint(uint64_t fd, uint64_t* buffer, uint64_t bytes);
+void     write_checkpoint_word(uint64_t fd, uint64_t word);
+uint64_t read_checkpoint_word(uint64_t fd);
+
+void write_page_table(uint64_t fd, uint64_t* context, uint64_t mapped);
+void read_page_table(uint64_t fd, uint64_t* context, uint64_t* frames, uint64_t* mapped_frames);
+
+uint64_t context_index(uint64_t* context);
+
+void      checkpoint_contexts(uint64_t* to_context);
+uint64_t* restore_contexts(char* filename);
+
 uint64_t handle_system_call(uint64_t* context);
 uint64_t handle_page_fault(uint64_t* context);
 uint64_t handle_division_by_zero(uint64_t* context);
@@ -2430,10 +3063,47 @@ uint64_t* MACHINES; // named machines
 uint64_t DIPSTER = 5;
 uint64_t RIPSTER = 6;
 uint64_t CAPSTER = 7;
+uint64_t FASTER  = 8;
+
+uint64_t CHECKPOINTMAGIC = 1347109715; // "SCKP" in little endian
+
+// indexed page frame
+// +---+--------------+
+// | 0 | next         | pointer to next indexed page frame in same bucket
+// | 1 | frame        | page frame mapped in at least one page table
+// | 2 | index        | position of page frame in checkpoint
+// | 3 | next indexed | pointer to page frame indexed next
+// +---+--------------+
+
+uint64_t* get_next_indexed_frame(uint64_t* entry) { return (uint64_t*) *entry; }
+uint64_t  get_indexed_frame(uint64_t* entry)      { return             *(entry + 1); }
+uint64_t  get_frame_index(uint64_t* entry)        { return             *(entry + 2); }
+uint64_t* get_frame_indexed_next(uint64_t* entry) { return (uint64_t*) *(entry + 3); }
+
+void set_next_indexed_frame(uint64_t* entry, uint64_t* next) { *entry       = (uint64_t) next; }
+void set_indexed_frame(uint64_t* entry, uint64_t frame)      { *(entry + 1) = frame; }
+void set_frame_index(uint64_t* entry, uint64_t index)        { *(entry + 2) = index; }
+void set_frame_indexed_next(uint64_t* entry, uint64_t* next) { *(entry + 3) = (uint64_t) next; }
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+char* checkpoint_name = (char*) 0; // name of checkpoint file written by mipster
+char* restore_name    = (char*) 0; // name of checkpoint file restored instead of booting
+
+uint64_t checkpoint_instructions = 0; // checkpoint at first scheduling after that many instructions
+
+uint64_t* frame_index_table = (uint64_t*) 0; // hash table of page frames indexed in checkpoint
+
+uint64_t* first_indexed_frame = (uint64_t*) 0;
+uint64_t* last_indexed_frame  = (uint64_t*) 0;
+
+uint64_t indexed_frames = 0; // number of page frames indexed in checkpoint
 
 // ------------------------- INITIALIZATION ------------------------
 
 void init_kernel () {
+  init_scheduler();
+
   MACHINES = smalloc((MIXTER + 1) * sizeof(uint64_t*));
 
   *(MACHINES + MIPSTER) = (uint64_t) "mipster";
@@ -2632,6 +3302,13 @@ uint64_t log_two(uint64_t n) {
     return log_two(n / 2) + 1;
 }
 
+uint64_t is_power_of_two(uint64_t n) {
+  if (n == 0)
+    return 0;
+  else
+    return two_to_the_power_of(log_two(n)) == n;
+}
+
 uint64_t ten_to_the_power_of(uint64_t p) {
   // use recursion for simplicity and educational value
   // for p close to 0 performance is not relevant
@@ -3476,6 +4153,19 @@ uint64_t* zmalloc(uint64_t size) {
     return zalloc(size);
 }
 
+uint64_t is_fresh_memory_zeroed() {
+  // internal use only!
+
+  // on boot levels higher than 0, malloc obtains memory from
+  // selfie which zeroes page frames before mapping them; on
+  // boot level 0, the host malloc may return recycled memory
+  // that is not zeroed, even for large allocations
+  if (OS == SELFIE)
+    return 1;
+  else
+    return 0;
+}
+
 // *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
 // -----------------------------------------------------------------
 // ---------------------    C O M P I L E R    ---------------------
@@ -7489,17 +8179,18 @@ void selfie_load(char* filename) {
   // no source line numbers in binaries
   reset_binary();
 
-  // allocate and map (on all boot levels) memory for reading into it
-  ELF_file_header = touch(smalloc(MAX_BINARY_SIZE), MAX_BINARY_SIZE);
+  // allocate memory for reading into it but map (on all boot levels)
+  // only memory that is actually read into rather than all of it
+  ELF_file_header = smalloc(MAX_BINARY_SIZE);
 
-  number_of_read_bytes = read(fd, ELF_file_header, 8);
+  number_of_read_bytes = read(fd, touch(ELF_file_header, 8), 8);
 
   if (number_of_read_bytes == 8) {
     if (validate_elf_file_header_top(ELF_file_header)) {
       init_target();
       reset_disassembler();
 
-      number_of_read_bytes = read(fd, (uint64_t*) ((uint64_t) ELF_file_header + 8), e_ehsize - 8);
+      number_of_read_bytes = read(fd, touch((uint64_t*) ((uint64_t) ELF_file_header + 8), e_ehsize - 8), e_ehsize - 8);
 
       if (number_of_read_bytes == e_ehsize - 8) {
         if (decode_elf_file_header(ELF_file_header)) {
@@ -7513,7 +8204,7 @@ void selfie_load(char* filename) {
           i = 0;
 
           while (i < e_phnum) {
-            number_of_read_bytes = read(fd, ELF_program_header, e_phentsize);
+            number_of_read_bytes = read(fd, touch(ELF_program_header, e_phentsize), e_phentsize);
 
             if (number_of_read_bytes == e_phentsize) {
               if (decode_elf_program_header(ELF_program_header)) {
@@ -7555,7 +8246,7 @@ void selfie_load(char* filename) {
                   if (to_be_read_bytes + number_of_read_bytes_in_total <= MAX_BINARY_SIZE) {
                     number_of_read_bytes = sign_extend(
                       read(fd,
-                        (uint64_t*) ((uint64_t) ELF_file_header + number_of_read_bytes_in_total),
+                        touch((uint64_t*) ((uint64_t) ELF_file_header + number_of_read_bytes_in_total), to_be_read_bytes),
                         to_be_read_bytes),
                       SYSCALL_BITWIDTH);
 
@@ -7569,7 +8260,7 @@ void selfie_load(char* filename) {
                       if (to_be_read_bytes + number_of_read_bytes_in_total <= MAX_BINARY_SIZE) {
                         number_of_read_bytes = sign_extend(
                           read(fd,
-                            (uint64_t*) ((uint64_t) ELF_file_header + number_of_read_bytes_in_total),
+                            touch((uint64_t*) ((uint64_t) ELF_file_header + number_of_read_bytes_in_total), to_be_read_bytes),
                             to_be_read_bytes),
                           SYSCALL_BITWIDTH);
 
@@ -7661,6 +8352,8 @@ void emit_read() {
 uint64_t copy_buffer(uint64_t* context, uint64_t vbuffer, uint64_t* buffer, uint64_t size, uint64_t upload) {
   uint64_t is_string;
   uint64_t vaddr;
+  uint64_t run_end;
+  uint64_t* paddr;
   uint64_t i;
 
   if (size == 0) {
@@ -7675,40 +8368,63 @@ uint64_t copy_buffer(uint64_t* context, uint64_t vbuffer, uint64_t* buffer, uint
 
   // avoid integer overflow with vbuffer + size
   while (vaddr - vbuffer < size) {
-    if (is_virtual_address_valid(vaddr, WORDSIZE))
-      if (is_data_stack_heap_address(context, vaddr)) {
+    if (is_virtual_address_valid(vaddr, WORDSIZE)) {
+      run_end = data_stack_heap_segment_end(context, vaddr);
+
+      if (run_end != 0) {
         if (is_virtual_address_mapped(get_pt(context), vaddr)) {
+          // validate and translate only once for the run of words
+          // up to the end of the page, the segment, or the buffer
+          if (run_end > virtual_address_of_page(page_of_virtual_address(vaddr) + 1))
+            run_end = virtual_address_of_page(page_of_virtual_address(vaddr) + 1);
+
+          if (run_end - vbuffer > size)
+            run_end = vbuffer + size;
+
           if (upload)
-            store_virtual_memory(get_pt(context), vaddr, load_word(buffer, vaddr - vbuffer, 1));
-          else
-            store_word(buffer, vaddr - vbuffer, 1, load_virtual_memory(get_pt(context), vaddr));
-        } else {
-          printf("%s: virtual address 0x%08lX is unmapped\n", selfie_name, vaddr);
+            if (shared_page_frames > 0)
+              copy_on_write(get_pt(context), page_of_virtual_address(vaddr));
 
-          return 0;
-        }
+          // words of a page are contiguous in its page frame
+          paddr = translate_virtual_to_physical(get_pt(context), vaddr);
 
-        if (is_string) {
-          i = 0;
+          while (vaddr < run_end) {
+            if (upload) {
+              store_physical_memory(paddr, load_word(buffer, vaddr - vbuffer, 1));
 
-          // check if string ends in the current word
-          // WORDSIZE may be less than sizeof(uint64_t)
-          while (i < WORDSIZE) {
-            if (load_character((char*) buffer, vaddr - vbuffer + i) == 0)
-              return 1;
+              if (L1_CACHE_ENABLED)
+                snoop_caches(vaddr, (uint64_t) paddr);
+            } else
+              store_word(buffer, vaddr - vbuffer, 1, load_physical_memory(paddr));
 
-            i = i + 1;
+            if (is_string) {
+              i = 0;
+
+              // check if string ends in the current word
+              // WORDSIZE may be less than sizeof(uint64_t)
+              while (i < WORDSIZE) {
+                if (load_character((char*) buffer, vaddr - vbuffer + i) == 0)
+                  return 1;
+
+                i = i + 1;
+              }
+            }
+
+            // advance to the next word in virtual and physical memory
+            vaddr = vaddr + WORDSIZE;
+            paddr = paddr + 1;
           }
-        }
+        } else {
+          printf("%s: virtual address 0x%08lX is unmapped\n", selfie_name, vaddr);
 
-        // advance to the next word in virtual memory
-        vaddr = vaddr + WORDSIZE;
+          return 0;
+        }
       } else {
         printf("%s: virtual address 0x%08lX is in an invalid segment\n", selfie_name, vaddr);
 
         return 0;
       }
-    else {
+    } else {
       printf("%s: virtual address 0x%08lX is invalid\n", selfie_name, vaddr);
 
       return 0;
@@ -8132,6 +8848,8 @@ void do_switch(uint64_t* to_context, uint64_t timeout) {
     println();
   }
 
+  dispatch_context(to_context);
+
   current_context = to_context;
 
   timer = timeout;
@@ -8151,14 +8869,19 @@ void implement_switch() {
     print_register_value(REG_A6);
   }
 
-  read_register(REG_A0);
-  read_register(REG_A1);
+  if (fast == 0) {
+    read_register(REG_A0);
+    read_register(REG_A1);
+  }
 
   to_context = (uint64_t*) *(registers + REG_A0);
   timeout    =             *(registers + REG_A1);
 
   save_context(current_context);
 
+  // context is cached from memory
+  write_back_all_caches();
+
   // cache context on my boot level before switching
   to_context = cache_context(to_context);
 
@@ -8166,6 +8889,10 @@ void implement_switch() {
 
   do_switch(to_context, timeout);
 
+  // end instruction budget which was computed for the previous timer
+  trap     = 1;
+  switched = 1;
+
   if (debug_syscalls) {
     printf(" -> ");
     print_register_hexadecimal(REG_A6);
@@ -8203,12 +8930,30 @@ uint64_t* hypster_switch(uint64_t* to_context, uint64_t timeout) {
 void reset_cache_counters(uint64_t* cache) {
   set_cache_hits(cache, 0);
   set_cache_misses(cache, 0);
+  set_cache_write_backs(cache, 0);
 }
 
 void reset_all_cache_counters() {
+  uint64_t i;
+
   if (L1_CACHE_ENABLED) {
     reset_cache_counters(L1_DCACHE);
     reset_cache_counters(L1_ICACHE);
+
+    if (L2_CACHE_ENABLED)
+      reset_cache_counters(L2_CACHE);
+    if (L3_CACHE_ENABLED)
+      reset_cache_counters(L3_CACHE);
+
+    memory_fetches = 0;
+
+    i = 0;
+
+    while (i < number_of_sweep_caches) {
+      reset_cache_counters((uint64_t*) *(sweep_caches + i));
+
+      i = i + 1;
+    }
   }
 }
 
@@ -8224,25 +8969,52 @@ void init_cache_memory(uint64_t* cache) {
 
   set_cache_memory(cache, cache_memory);
 
+  // all tree-PLRU bits are initially 0
+  set_set_states(cache, zmalloc(number_of_cache_blocks / get_associativity(cache)
+    * (get_associativity(cache) + 1) * sizeof(uint64_t)));
+
+  // one bucket per cache block keeps buckets short
+  set_tag_index(cache, zmalloc(number_of_cache_blocks * sizeof(uint64_t*)));
+
   i = 0;
 
   while (i < number_of_cache_blocks) {
     cache_block = allocate_cache_block();
 
-    // valid bit and timestamp are already initialized to 0
+    // valid bit and dirty bit are already initialized to 0
 
     *(cache_memory + i) = (uint64_t) cache_block;
 
-    set_block_memory(cache_block, smalloc(get_cache_block_size(cache)));
+    if (get_cache_level(cache) == 1)
+      set_block_memory(cache_block, smalloc(get_cache_block_size(cache)));
+
+    // cache blocks are stored set by set
+    set_block_index(cache_block, i / get_associativity(cache));
+    set_block_way(cache_block, i % get_associativity(cache));
+
+    // invalid blocks are oldest, the block in way 0 is replaced first
+    make_newest_block(cache_set_state(cache, get_block_index(cache_block)), cache_block);
 
     i = i + 1;
   }
+
+  set_dirty_blocks(cache, smalloc(number_of_cache_blocks * sizeof(uint64_t*)));
+  set_number_of_dirty(cache, 0);
 }
 
-void init_cache(uint64_t* cache, uint64_t cache_size, uint64_t associativity, uint64_t cache_block_size) {
+void init_cache(uint64_t* cache, uint64_t cache_size, uint64_t associativity, uint64_t cache_block_size, uint64_t write_policy, uint64_t level) {
   set_cache_size(cache, cache_size);
   set_associativity(cache, associativity);
   set_cache_block_size(cache, cache_block_size);
+  set_write_policy(cache, write_policy);
+  set_cache_level(cache, level);
+
+  // memory is next level by default
+  set_next_level(cache, (uint64_t*) 0);
+  set_cache_latency(cache, L1_CACHE_LATENCY);
+
+  set_replacement_policy(cache, cache_replacement);
+  set_random_state(cache, 0);
 
   init_cache_memory(cache);
 
@@ -8250,13 +9022,46 @@ void init_cache(uint64_t* cache, uint64_t cache_size, uint64_t associativity, ui
 }
 
 void init_all_caches() {
+  uint64_t block_size;
+
   L1_DCACHE = allocate_cache();
 
-  init_cache(L1_DCACHE, L1_DCACHE_SIZE, L1_DCACHE_ASSOCIATIVITY, L1_DCACHE_BLOCK_SIZE);
+  init_cache(L1_DCACHE, L1_DCACHE_SIZE, L1_DCACHE_ASSOCIATIVITY, L1_DCACHE_BLOCK_SIZE, L1_DCACHE_WRITE_POLICY, 1);
 
   L1_ICACHE = allocate_cache();
 
-  init_cache(L1_ICACHE, L1_ICACHE_SIZE, L1_ICACHE_ASSOCIATIVITY, L1_ICACHE_BLOCK_SIZE);
+  init_cache(L1_ICACHE, L1_ICACHE_SIZE, L1_ICACHE_ASSOCIATIVITY, L1_ICACHE_BLOCK_SIZE, CACHE_WRITE_THROUGH, 1);
+
+  if (L2_CACHE_ENABLED) {
+    if (cache_inclusion == CACHE_EXCLUSIVE)
+      // blocks move between levels as a whole
+      block_size = L1_DCACHE_BLOCK_SIZE;
+    else
+      block_size = L2_CACHE_BLOCK_SIZE;
+
+    L2_CACHE = allocate_cache();
+
+    // L2 cache holds no data and therefore never writes back
+    init_cache(L2_CACHE, L2_CACHE_SIZE, L2_CACHE_ASSOCIATIVITY, block_size, CACHE_WRITE_THROUGH, 2);
+
+    set_cache_latency(L2_CACHE, L2_CACHE_LATENCY);
+
+    set_next_level(L1_DCACHE, L2_CACHE);
+    set_next_level(L1_ICACHE, L2_CACHE);
+
+    if (L3_CACHE_ENABLED) {
+      L3_CACHE = allocate_cache();
+
+      init_cache(L3_CACHE, L3_CACHE_SIZE, L3_CACHE_ASSOCIATIVITY, block_size, CACHE_WRITE_THROUGH, 3);
+
+      set_cache_latency(L3_CACHE, L3_CACHE_LATENCY);
+
+      set_next_level(L2_CACHE, L3_CACHE);
+    }
+  }
+
+  if (sweep_min_size > 0)
+    init_sweep_caches();
 }
 
 void flush_cache(uint64_t* cache) {
@@ -8274,22 +9079,58 @@ void flush_cache(uint64_t* cache) {
   while (i < number_of_cache_blocks) {
     cache_block = (uint64_t*) *(cache_memory + i);
 
-    set_valid_flag(cache_block, 0);
-    set_timestamp(cache_block, 0);
+    if (get_dirty_flag(cache_block))
+      write_back_cache_block(cache, cache_block);
 
-    i = i + 1;
+    if (get_valid_flag(cache_block))
+      drop_cache_block(cache, cache_block);
+
+    i = i + 1;
   }
 
-  set_cache_timer(cache, 0);
+  set_number_of_dirty(cache, 0);
 }
 
 void flush_all_caches() {
+  // physically tagged L2 and L3 caches are not affected by ASIDs
   if (L1_CACHE_ENABLED) {
     flush_cache(L1_DCACHE);
     flush_cache(L1_ICACHE);
   }
 }
 
+void write_back_cache(uint64_t* cache) {
+  uint64_t* dirty_blocks;
+  uint64_t i;
+  uint64_t* cache_block;
+
+  dirty_blocks = get_dirty_blocks(cache);
+
+  i = 0;
+
+  // only visit cache blocks made dirty since last write-back
+  while (i < get_number_of_dirty(cache)) {
+    cache_block = (uint64_t*) *(dirty_blocks + i);
+
+    // blocks evicted in the meantime are already written back,
+    // written-back cache blocks remain valid
+    if (get_dirty_flag(cache_block))
+      write_back_cache_block(cache, cache_block);
+
+    i = i + 1;
+  }
+
+  set_number_of_dirty(cache, 0);
+}
+
+void write_back_all_caches() {
+  // the kernel accesses memory without going through the caches,
+  // so memory is made coherent whenever the kernel takes over
+  if (L1_CACHE_ENABLED)
+    if (get_write_policy(L1_DCACHE) == CACHE_WRITE_BACK)
+      write_back_cache(L1_DCACHE);
+}
+
 uint64_t cache_set_size(uint64_t* cache) {
   return get_cache_size(cache) / get_associativity(cache);
 }
@@ -8331,57 +9172,253 @@ uint64_t* cache_set(uint64_t* cache, uint64_t vaddr) {
   return get_cache_memory(cache) + cache_index(cache, vaddr) * get_associativity(cache);
 }
 
-uint64_t get_new_timestamp(uint64_t* cache) {
-  uint64_t timestamp;
+uint64_t cache_block_paddr(uint64_t* cache, uint64_t* cache_block) {
+  // physical address of cache block is determined by its tag and the index of
+  // its set since sets of L1 caches are not larger than pages and L2 and L3
+  // caches are physically indexed
+  return get_tag(cache_block) * cache_set_size(cache) + get_block_index(cache_block) * get_cache_block_size(cache);
+}
 
-  timestamp = get_cache_timer(cache);
+uint64_t cache_asid(uint64_t* cache) {
+  // only L1 cache blocks are tagged by ASIDs
+  if (get_cache_level(cache) == 1)
+    return L1_asid;
+  else
+    return 0;
+}
 
-  set_cache_timer(cache, timestamp + 1);
+uint64_t* cache_set_state(uint64_t* cache, uint64_t index) {
+  return get_set_states(cache) + index * (get_associativity(cache) + 1);
+}
 
-  return timestamp;
+uint64_t* cache_bucket(uint64_t* cache, uint64_t tag, uint64_t index) {
+  // tag and index together identify the physical cache block
+  return get_tag_index(cache) + (tag * (cache_set_size(cache) / get_cache_block_size(cache)) + index)
+    % (get_cache_size(cache) / get_cache_block_size(cache));
 }
 
-uint64_t* cache_lookup(uint64_t* cache, uint64_t vaddr, uint64_t paddr, uint64_t is_access) {
-  uint64_t tag;
-  uint64_t* set;
-  uint64_t i;
-  uint64_t* lru_block;
-  uint64_t* cache_block;
+void hash_cache_block(uint64_t* cache, uint64_t* cache_block) {
+  uint64_t* bucket;
 
-  tag = cache_tag(cache, paddr);
-  set = cache_set(cache, vaddr);
+  bucket = cache_bucket(cache, get_tag(cache_block), get_block_index(cache_block));
 
-  i = 0;
+  set_next_in_chain(cache_block, (uint64_t*) *bucket);
 
-  lru_block = (uint64_t*) *set;
+  *bucket = (uint64_t) cache_block;
+}
 
-  while (i < get_associativity(cache)) {
-    cache_block = (uint64_t*) *(set + i);
+void unhash_cache_block(uint64_t* cache, uint64_t* cache_block) {
+  uint64_t* bucket;
+  uint64_t* previous;
 
-    if (get_timestamp(cache_block) < get_timestamp(lru_block))
-      lru_block = cache_block;
+  bucket = cache_bucket(cache, get_tag(cache_block), get_block_index(cache_block));
 
-    if (get_valid_flag(cache_block))
-      if (get_tag(cache_block) == tag) {
-        // cache hit
+  if ((uint64_t*) *bucket == cache_block)
+    *bucket = (uint64_t) get_next_in_chain(cache_block);
+  else {
+    previous = (uint64_t*) *bucket;
 
-        if (is_access) {
-          set_cache_hits(cache, get_cache_hits(cache) + 1);
+    while (get_next_in_chain(previous) != cache_block)
+      previous = get_next_in_chain(previous);
 
-          set_timestamp(cache_block, get_new_timestamp(cache));
-        }
+    set_next_in_chain(previous, get_next_in_chain(cache_block));
+  }
+
+  set_next_in_chain(cache_block, (uint64_t*) 0);
+}
+
+uint64_t* find_cache_block(uint64_t* cache, uint64_t tag, uint64_t index) {
+  uint64_t* cache_block;
+
+  // only valid cache blocks are indexed, there is at most
+  // one valid copy of each block across all address spaces
+  cache_block = (uint64_t*) *cache_bucket(cache, tag, index);
 
+  while (cache_block != (uint64_t*) 0) {
+    if (get_tag(cache_block) == tag)
+      if (get_block_index(cache_block) == index)
         return cache_block;
+
+    cache_block = get_next_in_chain(cache_block);
+  }
+
+  return (uint64_t*) 0;
+}
+
+void unlink_cache_block(uint64_t* set_state, uint64_t* cache_block) {
+  if (get_newer_block(cache_block) != (uint64_t*) 0)
+    set_older_block(get_newer_block(cache_block), get_older_block(cache_block));
+  else
+    set_newest_block(set_state, get_older_block(cache_block));
+
+  if (get_older_block(cache_block) != (uint64_t*) 0)
+    set_newer_block(get_older_block(cache_block), get_newer_block(cache_block));
+  else
+    set_oldest_block(set_state, get_newer_block(cache_block));
+
+  set_newer_block(cache_block, (uint64_t*) 0);
+  set_older_block(cache_block, (uint64_t*) 0);
+}
+
+void make_newest_block(uint64_t* set_state, uint64_t* cache_block) {
+  if (get_newest_block(set_state) != cache_block) {
+    // blocks other than the newest block are linked to a newer block
+    // unless the set is being initialized
+    if (get_newer_block(cache_block) != (uint64_t*) 0)
+      unlink_cache_block(set_state, cache_block);
+
+    set_older_block(cache_block, get_newest_block(set_state));
+
+    if (get_newest_block(set_state) != (uint64_t*) 0)
+      set_newer_block(get_newest_block(set_state), cache_block);
+    else
+      set_oldest_block(set_state, cache_block);
+
+    set_newest_block(set_state, cache_block);
+  }
+}
+
+void make_oldest_block(uint64_t* set_state, uint64_t* cache_block) {
+  if (get_oldest_block(set_state) != cache_block) {
+    unlink_cache_block(set_state, cache_block);
+
+    set_newer_block(cache_block, get_oldest_block(set_state));
+    set_older_block(get_oldest_block(set_state), cache_block);
+
+    set_oldest_block(set_state, cache_block);
+  }
+}
+
+void touch_plru_tree(uint64_t* cache, uint64_t* cache_block) {
+  uint64_t* tree;
+  uint64_t node;
+  uint64_t parent;
+
+  tree = get_plru_tree(cache_set_state(cache, get_block_index(cache_block)));
+
+  // tree-PLRU:
+  // binary tree with associativity - 1 nodes stored level by level
+  // where each node points to the subtree (0 left, 1 right) that
+  // was accessed less recently, and ways are the leaves of the tree
+
+  node = get_associativity(cache) - 1 + get_block_way(cache_block);
+
+  while (node > 0) {
+    parent = (node - 1) / 2;
+
+    // make parent point away from accessed block
+    if (node == 2 * parent + 1)
+      *(tree + parent) = 1;
+    else
+      *(tree + parent) = 0;
+
+    node = parent;
+  }
+}
+
+uint64_t plru_victim_way(uint64_t* cache, uint64_t* set_state) {
+  uint64_t* tree;
+  uint64_t node;
+
+  tree = get_plru_tree(set_state);
+
+  node = 0;
+
+  // follow pointers from root to least recently accessed leaf
+  while (node < get_associativity(cache) - 1)
+    if (*(tree + node) == 0)
+      node = 2 * node + 1;
+    else
+      node = 2 * node + 2;
+
+  return node - (get_associativity(cache) - 1);
+}
+
+uint64_t random_victim_way(uint64_t* cache) {
+  uint64_t state;
+
+  // linear congruential generator seeded per cache for reproducible runs
+  state = get_random_state(cache) * 1103515245 + 12345;
+
+  set_random_state(cache, state);
+
+  // low-order bits of the generator are not random
+  return state / 65536 % get_associativity(cache);
+}
+
+void touch_cache_block(uint64_t* cache, uint64_t* cache_block) {
+  if (get_replacement_policy(cache) == CACHE_LRU)
+    make_newest_block(cache_set_state(cache, get_block_index(cache_block)), cache_block);
+  else if (get_replacement_policy(cache) == CACHE_PLRU)
+    touch_plru_tree(cache, cache_block);
+
+  // FIFO and random replacement ignore hits
+}
+
+void drop_cache_block(uint64_t* cache, uint64_t* cache_block) {
+  // assert: get_valid_flag(cache_block) == 1
+
+  unhash_cache_block(cache, cache_block);
+
+  set_valid_flag(cache_block, 0);
+
+  // invalid blocks are replaced first
+  make_oldest_block(cache_set_state(cache, get_block_index(cache_block)), cache_block);
+}
+
+uint64_t* cache_lookup(uint64_t* cache, uint64_t vaddr, uint64_t paddr, uint64_t is_access) {
+  uint64_t* cache_block;
+
+  cache_block = find_cache_block(cache, cache_tag(cache, paddr), cache_index(cache, vaddr));
+
+  if (cache_block != (uint64_t*) 0) {
+    if (get_block_asid(cache_block) == cache_asid(cache)) {
+      // cache hit
+
+      if (is_access) {
+        set_cache_hits(cache, get_cache_hits(cache) + 1);
+
+        touch_cache_block(cache, cache_block);
       }
 
-    i = i + 1;
+      return cache_block;
+    } else if (is_access) {
+      // same physical block cached for another address space:
+      // invalidate it to keep at most one copy of each block
+      if (get_dirty_flag(cache_block))
+        write_back_cache_block(cache, cache_block);
+
+      drop_cache_block(cache, cache_block);
+
+      L1_synonym_invalidations = L1_synonym_invalidations + 1;
+    } else
+      // coherency lookups ignore address spaces
+      return cache_block;
   }
 
   // cache miss
 
-  set_valid_flag(lru_block, 0);
+  return (uint64_t*) 0;
+}
+
+uint64_t* cache_victim(uint64_t* cache, uint64_t* set) {
+  uint64_t* set_state;
+  uint64_t* cache_block;
+
+  set_state = cache_set_state(cache, get_block_index((uint64_t*) *set));
+
+  // invalid cache blocks are oldest and replaced first
+  cache_block = get_oldest_block(set_state);
 
-  return lru_block;
+  if (get_valid_flag(cache_block) == 0)
+    return cache_block;
+  else if (get_replacement_policy(cache) == CACHE_PLRU)
+    return (uint64_t*) *(set + plru_victim_way(cache, set_state));
+  else if (get_replacement_policy(cache) == CACHE_RANDOM)
+    return (uint64_t*) *(set + random_victim_way(cache));
+  else
+    // least recently used (LRU) or installed (FIFO) block
+    return cache_block;
 }
 
 void fill_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr) {
@@ -8406,22 +9443,118 @@ void fill_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr) {
   }
 }
 
-uint64_t* handle_cache_miss(uint64_t* cache, uint64_t* cache_block, uint64_t paddr, uint64_t is_access) {
-  if (is_access) {
-    set_cache_misses(cache, get_cache_misses(cache) + 1);
+void install_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr) {
+  set_tag(cache_block, cache_tag(cache, paddr));
+  set_block_asid(cache_block, cache_asid(cache));
 
-    // make sure the entire cache block contains valid data
-    fill_cache_block(cache, cache_block, paddr);
+  set_valid_flag(cache_block, 1);
 
-    set_tag(cache_block, cache_tag(cache, paddr));
+  hash_cache_block(cache, cache_block);
 
-    set_timestamp(cache_block, get_new_timestamp(cache));
+  make_newest_block(cache_set_state(cache, get_block_index(cache_block)), cache_block);
 
-    set_valid_flag(cache_block, 1);
+  if (get_replacement_policy(cache) == CACHE_PLRU)
+    touch_plru_tree(cache, cache_block);
+}
 
-    return cache_block;
-  } else
-    return (uint64_t*) 0;
+void evict_cache_block(uint64_t* cache, uint64_t* cache_block) {
+  uint64_t paddr;
+
+  if (get_dirty_flag(cache_block))
+    write_back_cache_block(cache, cache_block);
+
+  if (get_valid_flag(cache_block)) {
+    paddr = cache_block_paddr(cache, cache_block);
+
+    drop_cache_block(cache, cache_block);
+
+    if (cache_inclusion == CACHE_EXCLUSIVE) {
+      // next level holds blocks evicted from this level
+      if (get_next_level(cache) != (uint64_t*) 0)
+        insert_cache_block(get_next_level(cache), paddr);
+    } else if (get_cache_level(cache) == 2) {
+      // upper levels may only hold blocks held by this level
+      evict_inclusive_copies(cache, L1_DCACHE, paddr);
+      evict_inclusive_copies(cache, L1_ICACHE, paddr);
+    } else if (get_cache_level(cache) == 3)
+      evict_inclusive_copies(cache, L2_CACHE, paddr);
+  }
+}
+
+void evict_inclusive_copies(uint64_t* cache, uint64_t* upper_cache, uint64_t paddr) {
+  uint64_t address;
+  uint64_t* cache_block;
+
+  // assert: paddr is aligned to cache block of cache
+
+  address = paddr;
+
+  // cache block may be larger than blocks of upper cache
+  while (address < paddr + get_cache_block_size(cache)) {
+    cache_block = cache_lookup(upper_cache, address, address, 0);
+
+    if (cache_block != (uint64_t*) 0)
+      evict_cache_block(upper_cache, cache_block);
+
+    address = address + get_cache_block_size(upper_cache);
+  }
+}
+
+void insert_cache_block(uint64_t* cache, uint64_t paddr) {
+  uint64_t* cache_block;
+
+  // block may already be held if evicted from L1 data and instruction cache
+  if (cache_lookup(cache, paddr, paddr, 0) == (uint64_t*) 0) {
+    cache_block = cache_victim(cache, cache_set(cache, paddr));
+
+    evict_cache_block(cache, cache_block);
+
+    install_cache_block(cache, cache_block, paddr);
+  }
+}
+
+void fetch_from_next_level(uint64_t* cache, uint64_t paddr) {
+  uint64_t* next_level;
+  uint64_t* cache_block;
+
+  next_level = get_next_level(cache);
+
+  if (next_level == (uint64_t*) 0)
+    memory_fetches = memory_fetches + 1;
+  else {
+    // next-level caches are physically indexed
+    cache_block = cache_lookup(next_level, paddr, paddr, 1);
+
+    if (cache_block != (uint64_t*) 0) {
+      if (cache_inclusion == CACHE_EXCLUSIVE) {
+        // block moves up to this level
+        drop_cache_block(next_level, cache_block);
+      }
+    } else if (cache_inclusion == CACHE_EXCLUSIVE) {
+      set_cache_misses(next_level, get_cache_misses(next_level) + 1);
+
+      // next level only holds block once evicted from this level
+      fetch_from_next_level(next_level, paddr);
+    } else
+      handle_cache_miss(next_level, cache_victim(next_level, cache_set(next_level, paddr)), paddr);
+  }
+}
+
+uint64_t* handle_cache_miss(uint64_t* cache, uint64_t* cache_block, uint64_t paddr) {
+  set_cache_misses(cache, get_cache_misses(cache) + 1);
+
+  // fetch missing block before replacing victim block
+  fetch_from_next_level(cache, paddr);
+
+  evict_cache_block(cache, cache_block);
+
+  if (get_cache_level(cache) == 1)
+    // make sure the entire cache block contains valid data
+    fill_cache_block(cache, cache_block, paddr);
+
+  install_cache_block(cache, cache_block, paddr);
+
+  return cache_block;
 }
 
 uint64_t* retrieve_cache_block(uint64_t* cache, uint64_t vaddr, uint64_t paddr, uint64_t is_access) {
@@ -8429,11 +9562,14 @@ uint64_t* retrieve_cache_block(uint64_t* cache, uint64_t vaddr, uint64_t paddr,
 
   cache_block = cache_lookup(cache, vaddr, paddr, is_access);
 
-  if (get_valid_flag(cache_block))
+  if (cache_block != (uint64_t*) 0)
     // cache hit
     return cache_block;
+  else if (is_access)
+    return handle_cache_miss(cache, cache_victim(cache, cache_set(cache, vaddr)), paddr);
   else
-    return handle_cache_miss(cache, cache_block, paddr, is_access);
+    // coherency miss
+    return cache_block;
 }
 
 void flush_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr) {
@@ -8458,6 +9594,26 @@ void flush_cache_block(uint64_t* cache, uint64_t* cache_block, uint64_t paddr) {
   }
 }
 
+void write_back_cache_block(uint64_t* cache, uint64_t* cache_block) {
+  flush_cache_block(cache, cache_block, cache_block_paddr(cache, cache_block));
+
+  set_dirty_flag(cache_block, 0);
+
+  set_cache_write_backs(cache, get_cache_write_backs(cache) + 1);
+}
+
+void invalidate_cache_block(uint64_t* cache, uint64_t vaddr, uint64_t paddr) {
+  uint64_t* cache_block;
+
+  // there is at most one copy of each block across all address spaces
+  cache_block = find_cache_block(cache, cache_tag(cache, paddr), cache_index(cache, vaddr));
+
+  if (cache_block != (uint64_t*) 0)
+    // assert: get_dirty_flag(cache_block) == 0 since the caches
+    // are written back before the kernel stores anything
+    drop_cache_block(cache, cache_block);
+}
+
 uint64_t load_from_cache(uint64_t* cache, uint64_t vaddr, uint64_t paddr) {
   uint64_t* cache_block;
   uint64_t* block_memory;
@@ -8479,7 +9635,20 @@ void store_in_cache(uint64_t* cache, uint64_t vaddr, uint64_t paddr, uint64_t da
 
   *(block_memory + cache_byte_offset(cache, vaddr) / sizeof(uint64_t)) = data;
 
-  flush_cache_block(cache, cache_block, paddr);
+  if (get_write_policy(cache) == CACHE_WRITE_BACK) {
+    if (get_dirty_flag(cache_block) == 0) {
+      if (get_number_of_dirty(cache) == get_cache_size(cache) / get_cache_block_size(cache))
+        // blocks evicted and made dirty again may be listed more than once
+        write_back_cache(cache);
+
+      *(get_dirty_blocks(cache) + get_number_of_dirty(cache)) = (uint64_t) cache_block;
+
+      set_number_of_dirty(cache, get_number_of_dirty(cache) + 1);
+
+      set_dirty_flag(cache_block, 1);
+    }
+  } else
+    flush_cache_block(cache, cache_block, paddr);
 }
 
 uint64_t load_instruction_from_cache(uint64_t vaddr, uint64_t paddr) {
@@ -8491,6 +9660,9 @@ uint64_t load_instruction_from_cache(uint64_t vaddr, uint64_t paddr) {
 uint64_t load_data_from_cache(uint64_t vaddr, uint64_t paddr) {
   // assert: is_valid_virtual_address(vaddr) == 1
 
+  if (number_of_sweep_caches > 0)
+    access_all_sweep_caches(paddr);
+
   return load_from_cache(L1_DCACHE, vaddr, paddr);
 }
 
@@ -8499,6 +9671,9 @@ void store_data_in_cache(uint64_t vaddr, uint64_t paddr, uint64_t data) {
 
   // assert: is_valid_virtual_address(vaddr) == 1
 
+  if (number_of_sweep_caches > 0)
+    access_all_sweep_caches(paddr);
+
   store_in_cache(L1_DCACHE, vaddr, paddr, data);
 
   if (L1_CACHE_COHERENCY) {
@@ -8509,14 +9684,46 @@ void store_data_in_cache(uint64_t vaddr, uint64_t paddr, uint64_t data) {
     // a code segment that is currently cached in the processor causes the associated
     // cache line (or lines) to be invalidated")
     if (cache_block != (uint64_t*) 0) {
-      set_valid_flag(cache_block, 0);
-      set_timestamp(cache_block, 0);
+      drop_cache_block(L1_ICACHE, cache_block);
 
       L1_icache_coherency_invalidations = L1_icache_coherency_invalidations + 1;
     }
   }
 }
 
+uint64_t peek_data_in_cache(uint64_t vaddr, uint64_t paddr) {
+  uint64_t* cache_block;
+
+  // assert: is_valid_virtual_address(vaddr) == 1
+
+  // data cached by a write-back cache may not be in memory yet
+  cache_block = retrieve_cache_block(L1_DCACHE, vaddr, paddr, 0);
+
+  if (cache_block != (uint64_t*) 0)
+    return *(get_block_memory(cache_block) + cache_byte_offset(L1_DCACHE, vaddr) / sizeof(uint64_t));
+  else
+    return load_physical_memory((uint64_t*) paddr);
+}
+
+void snoop_caches(uint64_t vaddr, uint64_t paddr) {
+  uint64_t i;
+
+  // stores by the kernel bypass the caches, similar to DMA, and used
+  // to be made visible by flushing the caches on each context switch
+
+  invalidate_cache_block(L1_DCACHE, vaddr, paddr);
+  invalidate_cache_block(L1_ICACHE, vaddr, paddr);
+
+  i = 0;
+
+  // sweep caches mimic the L1 data cache
+  while (i < number_of_sweep_caches) {
+    invalidate_cache_block((uint64_t*) *(sweep_caches + i), paddr, paddr);
+
+    i = i + 1;
+  }
+}
+
 void print_cache_profile(uint64_t hits, uint64_t misses, char* cache_name) {
   uint64_t accesses;
 
@@ -8532,89 +9739,557 @@ void print_cache_profile(uint64_t hits, uint64_t misses, char* cache_name) {
     percentage_format_fractional_2(accesses, misses));
 }
 
-// -----------------------------------------------------------------
-// ---------------------------- MEMORY -----------------------------
-// -----------------------------------------------------------------
-
-uint64_t load_physical_memory(uint64_t* paddr) {
-  return *paddr;
-}
-
-void store_physical_memory(uint64_t* paddr, uint64_t data) {
-  *paddr = data;
-}
-
-uint64_t root_PDE_offset(uint64_t page) {
-  // with 4GB (2^32B) virtual memory there are 2^(32-12) 4KB (2^12B) pages;
-  // in a two-level page table with 4KB (2^12B) pages as leaf nodes and
-  // 64-bit pointers (2^3B), each leaf node accommodates 2^(12-3) PTEs;
-  // thus bits 9 through 19 encode the root PDE (page directory entry) offset
-  return page / NUMBEROFLEAFPTES; // right shift by 9 bits
-}
-
-uint64_t leaf_PTE_offset(uint64_t page) {
-  // bits 0 through 8 encode the leaf PTE (page table entry) offset
-  return page - root_PDE_offset(page) * NUMBEROFLEAFPTES; // extract the 9 LSBs
+uint64_t cache_cycles(uint64_t* cache) {
+  // every access of a cache costs its latency, hit or miss
+  return (get_cache_hits(cache) + get_cache_misses(cache)) * get_cache_latency(cache);
 }
 
-uint64_t* get_PTE_address(uint64_t* parent_table, uint64_t* table, uint64_t page) {
-  uint64_t* leaf_pt;
+void print_cache_hierarchy_profile() {
+  uint64_t accesses;
+  uint64_t L2_cycles;
+  uint64_t L3_cycles;
+  uint64_t cycles;
 
-  // assert: 0 <= page < NUMBEROFPAGES
+  L2_cycles = 0;
+  L3_cycles = 0;
 
-  if (PAGETABLETREE == 0)
-    // just pointer arithmetic, no access!
-    return table + page;
-  else {
-    // to get leaf page table, root page directory access is required!
-    if (parent_table == (uint64_t*) 0)
-      leaf_pt = (uint64_t*) *(table + root_PDE_offset(page));
+  if (L2_CACHE_ENABLED) {
+    if (cache_inclusion == CACHE_EXCLUSIVE)
+      printf("%s: L2+L3 caches:  accesses,hits,misses (exclusive)\n", selfie_name);
     else
-      // table is in address space of parent_table
-      leaf_pt = (uint64_t*) load_virtual_memory(parent_table, (uint64_t) (table + root_PDE_offset(page)));
+      printf("%s: L2+L3 caches:  accesses,hits,misses (inclusive)\n", selfie_name);
 
-    if (leaf_pt == (uint64_t*) 0)
-      return (uint64_t*) 0;
-    else
-      // again, just pointer arithmetic, no access!
-      return leaf_pt + leaf_PTE_offset(page);
-  }
-}
+    print_cache_profile(get_cache_hits(L2_CACHE), get_cache_misses(L2_CACHE), "unified L2:    ");
+    println();
 
-uint64_t get_page_frame(uint64_t* table, uint64_t page) {
-  uint64_t* PTE_address;
+    L2_cycles = cache_cycles(L2_CACHE);
 
-  // TODO: translation lookaside buffer (TLB)
+    if (L3_CACHE_ENABLED) {
+      print_cache_profile(get_cache_hits(L3_CACHE), get_cache_misses(L3_CACHE), "unified L3:    ");
+      println();
 
-  PTE_address = get_PTE_address(0, table, page);
+      L3_cycles = cache_cycles(L3_CACHE);
+    }
+  }
 
-  if (PTE_address == (uint64_t*) 0)
-    return 0;
+  accesses = get_cache_hits(L1_DCACHE) + get_cache_misses(L1_DCACHE)
+    + get_cache_hits(L1_ICACHE) + get_cache_misses(L1_ICACHE);
+
+  cycles = cache_cycles(L1_DCACHE) + cache_cycles(L1_ICACHE)
+    + L2_cycles + L3_cycles + memory_fetches * MEMORY_LATENCY;
+
+  printf("%s: cycles:        L1,L2,L3,memory[average memory access time]\n", selfie_name);
+  printf("%s: latencies:     %lu,%lu,%lu,%lu\n", selfie_name,
+    L1_CACHE_LATENCY,
+    L2_CACHE_LATENCY,
+    L3_CACHE_LATENCY,
+    MEMORY_LATENCY);
+  printf("%s: total:         %lu,%lu,%lu,%lu[%lu.%.2lu]\n", selfie_name,
+    cache_cycles(L1_DCACHE) + cache_cycles(L1_ICACHE),
+    L2_cycles,
+    L3_cycles,
+    memory_fetches * MEMORY_LATENCY,
+    ratio_format_integral_2(cycles, accesses),
+    ratio_format_fractional_2(cycles, accesses));
+}
+
+uint64_t parse_replacement_policy(char* name) {
+  if (string_compare(name, "lru"))
+    return CACHE_LRU;
+  else if (string_compare(name, "plru"))
+    return CACHE_PLRU;
+  else if (string_compare(name, "fifo"))
+    return CACHE_FIFO;
+  else if (string_compare(name, "random"))
+    return CACHE_RANDOM;
   else
-    return (uint64_t) *PTE_address;
+    return UINT64_MAX;
 }
 
-uint64_t is_page_mapped(uint64_t* table, uint64_t page) {
-  if (get_page_frame(table, page) != 0)
-    return 1;
+char* replacement_policy_name(uint64_t policy) {
+  if (policy == CACHE_LRU)
+    return "lru";
+  else if (policy == CACHE_PLRU)
+    return "plru";
+  else if (policy == CACHE_FIFO)
+    return "fifo";
   else
-    return 0;
+    return "random";
 }
 
-void set_page_frame(uint64_t* table, uint64_t page, uint64_t frame) {
-  uint64_t* leaf_pt;
+uint64_t init_sweep_configurations(uint64_t* caches) {
+  uint64_t number_of_caches;
+  uint64_t cache_size;
+  uint64_t associativity;
+  uint64_t cache_block_size;
+  uint64_t* cache;
+
+  // counts configurations and also initializes sweep caches
+  // in caches unless caches is 0, independently of sweep_caches
+  // which may still point to the caches of a previous sweep
+
+  // assert: sweep_min_size and sweep_max_size are powers of 2
+
+  number_of_caches = 0;
+
+  cache_size = sweep_min_size;
+
+  while (cache_size <= sweep_max_size) {
+    associativity = 1;
+
+    while (associativity <= SWEEP_MAX_ASSOCIATIVITY) {
+      cache_block_size = SWEEP_MIN_BLOCK_SIZE;
+
+      while (cache_block_size <= SWEEP_MAX_BLOCK_SIZE) {
+        // each cache has at least one set
+        if (associativity * cache_block_size <= cache_size) {
+          if (caches != (uint64_t*) 0) {
+            cache = allocate_cache();
+
+            // sweep caches are physically indexed, ignore ASIDs like
+            // L2 and L3 caches, and only track which blocks they hold
+            init_cache(cache, cache_size, associativity, cache_block_size, CACHE_WRITE_THROUGH, 0);
+
+            *(caches + number_of_caches) = (uint64_t) cache;
+          }
+
+          number_of_caches = number_of_caches + 1;
+        }
+
+        cache_block_size = cache_block_size * 2;
+      }
+
+      associativity = associativity * 2;
+    }
+
+    cache_size = cache_size * 2;
+  }
+
+  return number_of_caches;
+}
+
+void init_sweep_caches() {
+  number_of_sweep_caches = init_sweep_configurations((uint64_t*) 0);
+
+  sweep_caches = smalloc(number_of_sweep_caches * sizeof(uint64_t*));
+
+  init_sweep_configurations(sweep_caches);
+}
+
+void access_sweep_cache(uint64_t* cache, uint64_t paddr) {
+  uint64_t* cache_block;
+
+  if (cache_lookup(cache, paddr, paddr, 1) == (uint64_t*) 0) {
+    set_cache_misses(cache, get_cache_misses(cache) + 1);
+
+    cache_block = cache_victim(cache, cache_set(cache, paddr));
+
+    // sweep caches hold no data and thus nothing to write back
+    if (get_valid_flag(cache_block))
+      drop_cache_block(cache, cache_block);
+
+    install_cache_block(cache, cache_block, paddr);
+  }
+}
+
+void access_all_sweep_caches(uint64_t paddr) {
+  uint64_t i;
+
+  i = 0;
+
+  while (i < number_of_sweep_caches) {
+    access_sweep_cache((uint64_t*) *(sweep_caches + i), paddr);
+
+    i = i + 1;
+  }
+}
+
+void print_cache_sweep_profile() {
+  uint64_t i;
+  uint64_t* cache;
+
+  printf("%s: L1 data-cache sweep: size,ways,block:accesses,hits,misses (%s replacement)\n", selfie_name,
+    replacement_policy_name(cache_replacement));
+
+  i = 0;
+
+  while (i < number_of_sweep_caches) {
+    cache = (uint64_t*) *(sweep_caches + i);
+
+    sprintf(string_buffer, "%lu,%lu,%lu: ", get_cache_size(cache),
+      get_associativity(cache), get_cache_block_size(cache));
+
+    print_cache_profile(get_cache_hits(cache), get_cache_misses(cache), string_buffer);
+    println();
+
+    i = i + 1;
+  }
+}
+
+// -----------------------------------------------------------------
+// ---------------------------- TRACER -----------------------------
+// -----------------------------------------------------------------
+
+void open_trace() {
+  trace_fd = open_write_only(trace_name, S_IRUSR_IWUSR_IRGRP_IROTH);
+
+  if (signed_less_than(trace_fd, 0)) {
+    printf("%s: could not create trace file %s\n", selfie_name, trace_name);
+
+    exit(EXITCODE_IOERROR);
+  }
+
+  if (trace_buffer == (uint64_t*) 0)
+    trace_buffer = smalloc(TRACEBUFFERSIZE);
+
+  traced_addresses = zmalloc(TRACE_TYPES * sizeof(uint64_t));
+  traced_accesses  = zmalloc(TRACE_TYPES * sizeof(uint64_t));
+
+  trace_cursor = 0;
+  trace_size   = 0;
+
+  *binary_buffer = TRACEMAGIC;
+
+  if (write(trace_fd, binary_buffer, sizeof(uint64_t)) != sizeof(uint64_t)) {
+    printf("%s: could not write into trace file %s\n", selfie_name, trace_name);
+
+    exit(EXITCODE_IOERROR);
+  }
+
+  trace_size = sizeof(uint64_t);
+
+  tracing = 1;
+}
+
+void flush_trace() {
+  if (write(trace_fd, trace_buffer, trace_cursor) != trace_cursor) {
+    printf("%s: could not write into trace file %s\n", selfie_name, trace_name);
+
+    exit(EXITCODE_IOERROR);
+  }
+
+  trace_size = trace_size + trace_cursor;
+
+  trace_cursor = 0;
+}
+
+void close_trace() {
+  flush_trace();
+
+  printf("%s: traced %lu fetches, %lu loads, and %lu stores in %lu bytes into %s\n", selfie_name,
+    *(traced_accesses + TRACE_FETCH),
+    *(traced_accesses + TRACE_LOAD),
+    *(traced_accesses + TRACE_STORE),
+    trace_size,
+    trace_name);
+
+  tracing = 0;
+}
+
+void trace_byte(uint64_t b) {
+  if (trace_cursor == TRACEBUFFERSIZE)
+    flush_trace();
+
+  // bytes are packed into words without going through characters
+  // which may be signed on some hosts
+  if (trace_cursor % sizeof(uint64_t) == 0)
+    *(trace_buffer + trace_cursor / sizeof(uint64_t)) = b;
+  else
+    *(trace_buffer + trace_cursor / sizeof(uint64_t)) = *(trace_buffer + trace_cursor / sizeof(uint64_t))
+      + left_shift(b, (trace_cursor % sizeof(uint64_t)) * 8);
+
+  trace_cursor = trace_cursor + 1;
+}
+
+void trace_address(uint64_t type, uint64_t paddr) {
+  uint64_t previous;
+  uint64_t record;
+
+  previous = *(traced_addresses + type);
+
+  // zigzag encoding of signed delta
+  if (paddr >= previous)
+    record = (paddr - previous) * 2;
+  else
+    record = (previous - paddr) * 2 - 1;
+
+  record = record * TRACE_TYPES + type;
+
+  // varint encoding of record
+  while (record >= 128) {
+    trace_byte(record % 128 + 128);
+
+    record = record / 128;
+  }
+
+  trace_byte(record);
+
+  *(traced_addresses + type) = paddr;
+  *(traced_accesses + type)  = *(traced_accesses + type) + 1;
+}
+
+// -----------------------------------------------------------------
+// ---------------------------- MEMORY -----------------------------
+// -----------------------------------------------------------------
+
+uint64_t load_physical_memory(uint64_t* paddr) {
+  return *paddr;
+}
+
+void store_physical_memory(uint64_t* paddr, uint64_t data) {
+  *paddr = data;
+}
+
+uint64_t root_PDE_offset(uint64_t page) {
+  // with 4GB (2^32B) virtual memory there are 2^(32-12) 4KB (2^12B) pages;
+  // in a two-level page table with 4KB (2^12B) pages as leaf nodes and
+  // 64-bit pointers (2^3B), each leaf node accommodates 2^(12-3) PTEs;
+  // thus bits 9 through 19 encode the root PDE (page directory entry) offset
+  return page / NUMBEROFLEAFPTES; // right shift by 9 bits
+}
+
+uint64_t leaf_PTE_offset(uint64_t page) {
+  // bits 0 through 8 encode the leaf PTE (page table entry) offset
+  return page - root_PDE_offset(page) * NUMBEROFLEAFPTES; // extract the 9 LSBs
+}
+
+uint64_t* get_PTE_address(uint64_t* parent_table, uint64_t* table, uint64_t page) {
+  uint64_t* leaf_pt;
 
   // assert: 0 <= page < NUMBEROFPAGES
 
   if (PAGETABLETREE == 0)
-    *(table + page) = frame;
+    // just pointer arithmetic, no access!
+    return table + page;
   else {
+    // to get leaf page table, root page directory access is required!
+    if (parent_table == (uint64_t*) 0)
+      leaf_pt = (uint64_t*) *(table + root_PDE_offset(page));
+    else
+      // table is in address space of parent_table
+      leaf_pt = (uint64_t*) load_virtual_memory(parent_table, (uint64_t) (table + root_PDE_offset(page)));
+
+    if (leaf_pt == (uint64_t*) 0)
+      return (uint64_t*) 0;
+    else if (is_superpage_PDE((uint64_t) leaf_pt))
+      // superpages have no leaf page table
+      return (uint64_t*) 0;
+    else
+      // again, just pointer arithmetic, no access!
+      return leaf_pt + leaf_PTE_offset(page);
+  }
+}
+
+uint64_t is_superpage_PDE(uint64_t PDE) {
+  // leaf page tables are PAGEFRAMESIZE-aligned, superpage PDEs are odd
+  return PDE % 2;
+}
+
+uint64_t get_superpage_frame(uint64_t* parent_table, uint64_t* table, uint64_t page) {
+  uint64_t PDE;
+
+  if (PAGETABLETREE == 0)
+    return 0;
+
+  if (parent_table == (uint64_t*) 0)
+    PDE = *(table + root_PDE_offset(page));
+  else
+    // table is in address space of parent_table
+    PDE = load_virtual_memory(parent_table, (uint64_t) (table + root_PDE_offset(page)));
+
+  if (is_superpage_PDE(PDE))
+    // page frames of a superpage are contiguous in its superframe
+    return PDE - 1 + leaf_PTE_offset(page) * PAGEFRAMESIZE;
+  else
+    return 0;
+}
+
+uint64_t walk_page_table(uint64_t* table, uint64_t page) {
+  uint64_t* PTE_address;
+
+  // page frame of page without TLB lookup, 0 if page is unmapped
+
+  PTE_address = get_PTE_address(0, table, page);
+
+  if (PTE_address == (uint64_t*) 0)
+    return get_superpage_frame(0, table, page);
+  else
+    return *PTE_address;
+}
+
+uint64_t next_walked_page(uint64_t* table, uint64_t page) {
+  if (PAGETABLETREE)
+    if (*(table + root_PDE_offset(page)) == 0)
+      // skip pages without leaf page table or superpage
+      return (root_PDE_offset(page) + 1) * NUMBEROFLEAFPTES;
+
+  return page + 1;
+}
+
+uint64_t* get_TLB_entry(uint64_t page) {
+  return TLB + page % TLB_SIZE * TLBENTRIES;
+}
+
+void invalidate_TLB_entry(uint64_t* table, uint64_t page) {
+  uint64_t* entry;
+
+  entry = get_TLB_entry(page);
+
+  if (get_TLB_table(entry) == table)
+    if (get_TLB_page(entry) == page)
+      set_TLB_table(entry, (uint64_t*) 0);
+}
+
+uint64_t* get_PWC_entry(uint64_t* table, uint64_t root) {
+  return PWC + ((uint64_t) table / sizeof(uint64_t*) + root) % PWC_SIZE * PWCENTRIES;
+}
+
+void flush_PWC() {
+  if (PWC_used) {
+    zero_memory(PWC, PWC_SIZE * PWCENTRIES * sizeof(uint64_t));
+
+    PWC_used = 0;
+  }
+}
+
+uint64_t* get_nested_PTE(uint64_t* parent_table, uint64_t* table, uint64_t page) {
+  uint64_t* entry;
+  uint64_t PTE_address;
+  uint64_t* PTE;
+
+  // table is in address space of parent_table,
+  // returns host pointer to PTE of page in table
+
+  entry = get_PWC_entry(table, root_PDE_offset(page));
+
+  if (PAGETABLETREE) {
+    if (get_PWC_parent_table(entry) == parent_table)
+      if (get_PWC_table(entry) == table)
+        if (get_PWC_root(entry) == root_PDE_offset(page)) {
+          PWC_hits = PWC_hits + 1;
+
+          // PTEs of a leaf page table are contiguous in its page frame
+          return get_PWC_leaf_pt(entry) + leaf_PTE_offset(page);
+        }
+
+    PWC_misses = PWC_misses + 1;
+  }
+
+  // PTE address of page in page table in parent address space
+  PTE_address = (uint64_t) get_PTE_address(parent_table, table, page);
+
+  if (PTE_address == 0)
+    // leaf page table does not exist
+    return (uint64_t*) 0;
+
+  // PTEs in page table in parent address space may be unmapped
+  if (is_virtual_address_mapped(parent_table, PTE_address) == 0)
+    return (uint64_t*) 0;
+
+  PTE = translate_virtual_to_physical(parent_table, PTE_address);
+
+  if (PAGETABLETREE) {
+    // assert: leaf page table is PAGEFRAMESIZE-aligned and thus in a single page
+    set_PWC_parent_table(entry, parent_table);
+    set_PWC_table(entry, table);
+    set_PWC_root(entry, root_PDE_offset(page));
+    set_PWC_leaf_pt(entry, PTE - leaf_PTE_offset(page));
+
+    PWC_used = 1;
+  }
+
+  return PTE;
+}
+
+uint64_t get_page_frame(uint64_t* table, uint64_t page) {
+  uint64_t* entry;
+  uint64_t frame;
+
+  entry = get_TLB_entry(page);
+
+  if (get_TLB_table(entry) == table)
+    if (get_TLB_page(entry) == page) {
+      TLB_hits = TLB_hits + 1;
+
+      return get_TLB_frame(entry);
+    }
+
+  TLB_misses = TLB_misses + 1;
+
+  frame = walk_page_table(table, page);
+
+  if (frame != 0) {
+    // only cache translations of mapped pages
+    set_TLB_table(entry, table);
+    set_TLB_page(entry, page);
+    set_TLB_frame(entry, frame);
+  }
+
+  return frame;
+}
+
+uint64_t is_page_mapped(uint64_t* table, uint64_t page) {
+  if (get_page_frame(table, page) != 0)
+    return 1;
+  else
+    return 0;
+}
+
+uint64_t* demote_superpage(uint64_t* table, uint64_t page) {
+  uint64_t superframe;
+  uint64_t* leaf_pt;
+  uint64_t leaf;
+
+  superframe = *(table + root_PDE_offset(page)) - 1;
+
+  leaf_pt = palloc(); // 4KB leaf page table
+
+  leaf = 0;
+
+  // page frames of superframe remain mapped, now individually
+  while (leaf < NUMBEROFLEAFPTES) {
+    *(leaf_pt + leaf) = superframe + leaf * PAGEFRAMESIZE;
+
+    leaf = leaf + 1;
+  }
+
+  *(table + root_PDE_offset(page)) = (uint64_t) leaf_pt;
+
+  demoted_superpages = demoted_superpages + 1;
+
+  return leaf_pt;
+}
+
+void set_page_frame(uint64_t* table, uint64_t page, uint64_t frame) {
+  uint64_t* leaf_pt;
+
+  // assert: 0 <= page < NUMBEROFPAGES
+
+  invalidate_TLB_entry(table, page);
+
+  if (PAGETABLETREE == 0) {
+    if (*(table + page) != 0)
+      if (*(table + page) != frame)
+        // page may contain page tables cached in PWC
+        flush_PWC();
+
+    *(table + page) = frame;
+  } else {
     leaf_pt = (uint64_t*) *(table + root_PDE_offset(page));
 
     if (leaf_pt == (uint64_t*) 0) {
       leaf_pt = palloc(); // 4KB leaf page table
 
       *(table + root_PDE_offset(page)) = (uint64_t) leaf_pt;
+    } else {
+      if (is_superpage_PDE((uint64_t) leaf_pt))
+        // remapping or unmapping a page of a superpage requires a leaf page table
+        leaf_pt = demote_superpage(table, page);
+
+      if (*(leaf_pt + leaf_PTE_offset(page)) != 0)
+        if (*(leaf_pt + leaf_PTE_offset(page)) != frame)
+          // page may contain page tables cached in PWC
+          flush_PWC();
     }
 
     *(leaf_pt + leaf_PTE_offset(page)) = frame;
@@ -8680,10 +10355,20 @@ uint64_t load_virtual_memory(uint64_t* table, uint64_t vaddr) {
 }
 
 void store_virtual_memory(uint64_t* table, uint64_t vaddr, uint64_t data) {
+  uint64_t* paddr;
+
   // assert: is_virtual_address_valid(vaddr, WORDSIZE) == 1
   // assert: is_virtual_address_mapped(table, vaddr) == 1
 
-  store_physical_memory(translate_virtual_to_physical(table, vaddr), data);
+  if (shared_page_frames > 0)
+    copy_on_write(table, page_of_virtual_address(vaddr));
+
+  paddr = translate_virtual_to_physical(table, vaddr);
+
+  store_physical_memory(paddr, data);
+
+  if (L1_CACHE_ENABLED)
+    snoop_caches(vaddr, (uint64_t) paddr);
 }
 
 uint64_t load_cached_virtual_memory(uint64_t* table, uint64_t vaddr) {
@@ -8696,14 +10381,26 @@ uint64_t load_cached_virtual_memory(uint64_t* table, uint64_t vaddr) {
 }
 
 void store_cached_virtual_memory(uint64_t* table, uint64_t vaddr, uint64_t data) {
-  if (L1_CACHE_ENABLED)
+  if (L1_CACHE_ENABLED) {
     // assert: is_virtual_address_valid(vaddr, WORDSIZE) == 1
     // assert: is_virtual_address_mapped(table, vaddr) == 1
+    if (shared_page_frames > 0)
+      copy_on_write(table, page_of_virtual_address(vaddr));
+
     store_data_in_cache(vaddr, (uint64_t) translate_virtual_to_physical(table, vaddr), data);
-  else
+  } else
     store_virtual_memory(table, vaddr, data);
 }
 
+uint64_t peek_cached_virtual_memory(uint64_t* table, uint64_t vaddr) {
+  if (L1_CACHE_ENABLED)
+    // assert: is_virtual_address_valid(vaddr, WORDSIZE) == 1
+    // assert: is_virtual_address_mapped(table, vaddr) == 1
+    return peek_data_in_cache(vaddr, (uint64_t) translate_virtual_to_physical(table, vaddr));
+  else
+    return load_virtual_memory(table, vaddr);
+}
+
 uint64_t load_cached_instruction_word(uint64_t* table, uint64_t vaddr) {
   if (L1_CACHE_ENABLED)
     // assert: is_virtual_address_valid(vaddr, WORDSIZE) == 1
@@ -9090,6 +10787,9 @@ uint64_t do_load() {
   if (is_virtual_address_valid(vaddr, WORDSIZE)) {
     if (is_valid_segment_read(vaddr)) {
       if (is_virtual_address_mapped(pt, vaddr)) {
+        if (tracing)
+          trace_address(TRACE_LOAD, (uint64_t) translate_virtual_to_physical(pt, vaddr));
+
         if (rd != REG_ZR) {
           // semantics of load (double) word
           next_rd_value = load_cached_virtual_memory(pt, vaddr);
@@ -9192,8 +10892,11 @@ uint64_t do_store() {
         // tolerate storing unwrapped values
         read_register_check_wrap(rs2, 0);
 
+        if (tracing)
+          trace_address(TRACE_STORE, (uint64_t) translate_virtual_to_physical(pt, vaddr));
+
         // semantics of store (double) word
-        if (load_virtual_memory(pt, vaddr) != *(registers + rs2))
+        if (peek_cached_virtual_memory(pt, vaddr) != *(registers + rs2))
           store_cached_virtual_memory(pt, vaddr, *(registers + rs2));
         else {
           nopc_store = nopc_store + 1;
@@ -9767,6 +11470,9 @@ void fetch() {
     if (is_code_address(current_context, pc)) {
       // assert: is_virtual_address_mapped(pt, pc) == 1
 
+      if (tracing)
+        trace_address(TRACE_FETCH, (uint64_t) translate_virtual_to_physical(pt, pc));
+
       if (pc % WORDSIZE == 0)
         ir = get_low_word(load_cached_instruction_word(pt, pc));
       else
@@ -9868,6 +11574,252 @@ void decode() {
   }
 }
 
+uint64_t* predecoded_instruction(uint64_t* context, uint64_t vaddr) {
+  uint64_t code_seg_start;
+
+  code_seg_start = get_code_seg_start(context);
+
+  // avoid integer overflow with vaddr below code segment
+  if (vaddr - code_seg_start < get_code_seg_size(context))
+    if (vaddr % INSTRUCTIONSIZE == 0) {
+      if (get_predecoded_code(context) == (uint64_t*) 0)
+        // allocate predecoded code lazily when first executing code
+        set_predecoded_code(context,
+          zmalloc(get_code_seg_size(context) / INSTRUCTIONSIZE * PREDECODEDENTRIES * sizeof(uint64_t)));
+
+      return get_predecoded_code(context) + (vaddr - code_seg_start) / INSTRUCTIONSIZE * PREDECODEDENTRIES;
+    }
+
+  return (uint64_t*) 0;
+}
+
+void invalidate_predecoded_code(uint64_t* context, uint64_t vaddr, uint64_t size) {
+  uint64_t* entry;
+  uint64_t start;
+  uint64_t fused;
+
+  if (get_predecoded_code(context) != (uint64_t*) 0) {
+    predecoded_code_invalidations = predecoded_code_invalidations + 1;
+
+    start = vaddr;
+
+    // avoid integer overflow with vaddr + size
+    while (size >= INSTRUCTIONSIZE) {
+      entry = predecoded_instruction(context, vaddr);
+
+      if (entry != (uint64_t*) 0)
+        set_predecoded_is(entry, 0);
+
+      vaddr = vaddr + INSTRUCTIONSIZE;
+      size  = size - INSTRUCTIONSIZE;
+    }
+
+    // unfuse superinstructions that may include invalidated code
+    fused = 1;
+
+    while (fused < MAXFUSEDLENGTH) {
+      entry = predecoded_instruction(context, start - fused * INSTRUCTIONSIZE);
+
+      if (entry != (uint64_t*) 0)
+        set_predecoded_si(entry, get_predecoded_is(entry));
+
+      fused = fused + 1;
+    }
+  }
+}
+
+void predecode(uint64_t* entry) {
+  set_predecoded_ir(entry, ir);
+  set_predecoded_is(entry, is);
+  set_predecoded_rd(entry, rd);
+  set_predecoded_rs1(entry, rs1);
+  set_predecoded_rs2(entry, rs2);
+  set_predecoded_imm(entry, imm);
+  set_predecoded_si(entry, is);
+}
+
+void fetch_predecoded() {
+  uint64_t* entry;
+
+  entry = predecoded_instruction(current_context, pc);
+
+  if (entry != (uint64_t*) 0)
+    if (get_predecoded_is(entry) != 0) {
+      if (L1_CACHE_ENABLED)
+        // instruction fetch still changes the icache state
+        fetch();
+      else if (tracing)
+        // and is still traced
+        fetch();
+
+      ir  = get_predecoded_ir(entry);
+      is  = get_predecoded_is(entry);
+      rd  = get_predecoded_rd(entry);
+      rs1 = get_predecoded_rs1(entry);
+      rs2 = get_predecoded_rs2(entry);
+      imm = get_predecoded_imm(entry);
+
+      return;
+    }
+
+  fetch();
+  decode();
+
+  if (entry != (uint64_t*) 0)
+    if (is != 0) {
+      // only predecode known instructions
+      predecode(entry);
+
+      fuse_predecoded(pc);
+    }
+}
+
+uint64_t is_predecoded_addi(uint64_t* entry, uint64_t rd, uint64_t rs1, uint64_t imm) {
+  if (get_predecoded_is(entry) == ADDI)
+    if (get_predecoded_rd(entry) == rd)
+      if (get_predecoded_rs1(entry) == rs1)
+        if (get_predecoded_imm(entry) == imm)
+          return 1;
+
+  return 0;
+}
+
+uint64_t is_predecoded_stack_access(uint64_t* entry, uint64_t is, uint64_t reg) {
+  // reg is rd of loads and rs2 of stores
+  if (get_predecoded_is(entry) == is)
+    if (get_predecoded_rs1(entry) == REG_SP)
+      if (get_predecoded_imm(entry) == 0) {
+        if (is == LOAD)
+          return get_predecoded_rd(entry) == reg;
+        else
+          return get_predecoded_rs2(entry) == reg;
+      }
+
+  return 0;
+}
+
+uint64_t match_superinstruction(uint64_t vaddr) {
+  uint64_t* entry;
+  uint64_t* next;
+  uint64_t reg;
+
+  if (SIZEOFUINT64INBITS != WORDSIZEINBITS)
+    // superinstructions do not wrap values
+    return 0;
+
+  entry = predecoded_instruction(current_context, vaddr);
+
+  // assert: entry != (uint64_t*) 0
+
+  if (predecoded_instruction(current_context, vaddr + INSTRUCTIONSIZE) == (uint64_t*) 0)
+    // end of code segment
+    return 0;
+
+  // assert: predecoded code is contiguous
+  next = entry + PREDECODEDENTRIES;
+
+  if (is_predecoded_addi(entry, REG_SP, REG_SP, -WORDSIZE)) {
+    if (predecoded_instruction(current_context, vaddr + (FUSEDLENGTH_PROLOGUE - 1) * INSTRUCTIONSIZE) != (uint64_t*) 0)
+      if (is_predecoded_stack_access(next, STORE, REG_RA))
+        if (is_predecoded_addi(next + PREDECODEDENTRIES, REG_SP, REG_SP, -WORDSIZE))
+          if (is_predecoded_stack_access(next + 2 * PREDECODEDENTRIES, STORE, REG_S0))
+            if (is_predecoded_addi(next + 3 * PREDECODEDENTRIES, REG_S0, REG_SP, 0))
+              return FUSED_PROLOGUE;
+
+    if (get_predecoded_is(next) == STORE) {
+      reg = get_predecoded_rs2(next);
+
+      // pushing sp is not fused
+      if (reg != REG_SP)
+        if (is_predecoded_stack_access(next, STORE, reg))
+          return FUSED_PUSH;
+    }
+  } else if (get_predecoded_is(entry) == LOAD) {
+    reg = get_predecoded_rd(entry);
+
+    if (reg != REG_ZR)
+      if (reg != REG_SP)
+        if (is_predecoded_stack_access(entry, LOAD, reg))
+          if (is_predecoded_addi(next, REG_SP, REG_SP, WORDSIZE)) {
+            if (reg == REG_S0)
+              if (predecoded_instruction(current_context, vaddr + (FUSEDLENGTH_EPILOGUE - 1) * INSTRUCTIONSIZE) != (uint64_t*) 0)
+                if (is_predecoded_stack_access(next + PREDECODEDENTRIES, LOAD, REG_RA))
+                  if (get_predecoded_is(next + 2 * PREDECODEDENTRIES) == ADDI)
+                    if (get_predecoded_rd(next + 2 * PREDECODEDENTRIES) == REG_SP)
+                      if (get_predecoded_rs1(next + 2 * PREDECODEDENTRIES) == REG_SP)
+                        return FUSED_EPILOGUE;
+
+            return FUSED_POP;
+          }
+  } else if (get_predecoded_is(entry) == LUI) {
+    reg = get_predecoded_rd(entry);
+
+    // loading sp is not fused since superinstructions write back sp
+    if (reg != REG_ZR)
+      if (reg != REG_SP)
+        if (is_predecoded_addi(next, reg, reg, get_predecoded_imm(next)))
+          return FUSED_LI;
+  }
+
+  return 0;
+}
+
+uint64_t get_superinstruction_length(uint64_t si) {
+  if (si == FUSED_PROLOGUE)
+    return FUSEDLENGTH_PROLOGUE;
+  else if (si == FUSED_EPILOGUE)
+    return FUSEDLENGTH_EPILOGUE;
+  else
+    // push, pop, and li
+    return 2;
+}
+
+void fuse_predecoded(uint64_t vaddr) {
+  uint64_t* entry;
+  uint64_t i;
+  uint64_t si;
+
+  // vaddr is the most recently predecoded instruction which
+  // may complete superinstructions that start before vaddr
+
+  i = 0;
+
+  while (i < MAXFUSEDLENGTH) {
+    entry = predecoded_instruction(current_context, vaddr - i * INSTRUCTIONSIZE);
+
+    if (entry != (uint64_t*) 0)
+      if (get_predecoded_is(entry) != 0) {
+        si = match_superinstruction(vaddr - i * INSTRUCTIONSIZE);
+
+        if (si != 0)
+          if (get_superinstruction_length(si) > i)
+            set_predecoded_si(entry, si);
+      }
+
+    i = i + 1;
+  }
+}
+
+void fetch_fast() {
+  uint64_t* entry;
+
+  entry = predecoded_instruction(current_context, pc);
+
+  if (entry != (uint64_t*) 0)
+    if (get_predecoded_is(entry) != 0) {
+      ir  = get_predecoded_ir(entry);
+      is  = get_predecoded_si(entry);
+      rd  = get_predecoded_rd(entry);
+      rs1 = get_predecoded_rs1(entry);
+      rs2 = get_predecoded_rs2(entry);
+      imm = get_predecoded_imm(entry);
+
+      return;
+    }
+
+  fetch_predecoded();
+}
+
 void execute() {
   if (debug) {
     if (record)
@@ -10032,138 +11984,494 @@ void execute_debug() {
   println();
 }
 
-void interrupt() {
-  if (timer != TIMEROFF) {
-    timer = timer - 1;
+void write_register_fast(uint64_t reg, uint64_t value) {
+  if (reg != REG_ZR) {
+    if (SIZEOFUINT64INBITS != WORDSIZEINBITS)
+      value = sign_shrink(value, WORDSIZEINBITS);
 
-    if (timer == 0) {
-      if (get_exception(current_context) == EXCEPTION_NOEXCEPTION)
-        // only throw exception if no other is pending
-        // TODO: handle multiple pending exceptions
-        throw_exception(EXCEPTION_TIMER, 0);
-      else
-        // trigger timer in the next interrupt cycle
-        timer = 1;
-    }
+    *(registers + reg) = value;
   }
 }
 
-void run_until_exception() {
-  trap = 0;
+uint64_t do_load_fast() {
+  uint64_t vaddr;
 
-  while (trap == 0) {
-    fetch();
-    decode();
-    execute();
+  vaddr = *(registers + rs1) + imm;
 
-    interrupt();
-  }
+  if (is_virtual_address_valid(vaddr, WORDSIZE)) {
+    if (is_data_stack_heap_address(current_context, vaddr)) {
+      if (is_virtual_address_mapped(pt, vaddr)) {
+        if (rd != REG_ZR)
+          // load values unwrapped
+          *(registers + rd) = load_virtual_memory(pt, vaddr);
 
-  trap = 0;
+        pc = pc + INSTRUCTIONSIZE;
+
+        ic_load = ic_load + 1;
+      } else
+        throw_exception(EXCEPTION_PAGEFAULT, page_of_virtual_address(vaddr));
+    } else
+      throw_exception(EXCEPTION_SEGMENTATIONFAULT, vaddr);
+  } else
+    throw_exception(EXCEPTION_INVALIDADDRESS, vaddr);
+
+  return vaddr;
 }
 
-uint64_t instruction_with_max_counter(uint64_t* counters, uint64_t max) {
-  uint64_t a;
-  uint64_t n;
-  uint64_t i;
-  uint64_t c;
+uint64_t do_store_fast() {
+  uint64_t vaddr;
 
-  a = UINT64_MAX;
+  vaddr = *(registers + rs1) + imm;
 
-  n = 0;
-  i = 0;
+  if (is_virtual_address_valid(vaddr, WORDSIZE)) {
+    if (is_data_stack_heap_address(current_context, vaddr)) {
+      if (is_virtual_address_mapped(pt, vaddr)) {
+        store_virtual_memory(pt, vaddr, *(registers + rs2));
 
-  while (i < code_size / INSTRUCTIONSIZE) {
-    c = *(counters + i);
+        pc = pc + INSTRUCTIONSIZE;
 
-    if (n < c) {
-      if (c < max) {
-        n = c;
-        a = i;
+        ic_store = ic_store + 1;
       } else
-        return i * INSTRUCTIONSIZE;
-    }
-
-    i = i + 1;
-  }
+        throw_exception(EXCEPTION_PAGEFAULT, page_of_virtual_address(vaddr));
+    } else
+      throw_exception(EXCEPTION_SEGMENTATIONFAULT, vaddr);
+  } else
+    throw_exception(EXCEPTION_INVALIDADDRESS, vaddr);
 
-  if (a != UINT64_MAX)
-    return a * INSTRUCTIONSIZE;
-  else
-    return UINT64_MAX;
+  return vaddr;
 }
 
-uint64_t print_per_instruction_counter(uint64_t total, uint64_t* counters, uint64_t max) {
-  uint64_t a;
-  uint64_t c;
+void execute_fast() {
+  uint64_t next_pc;
 
-  a = instruction_with_max_counter(counters, max);
+  // same semantics as execute() but without profiling, without
+  // checking for reads from uninitialized registers and unwrapped
+  // values, and only counting executed instructions by type
 
-  if (a != UINT64_MAX) {
-    c = *(counters + a / INSTRUCTIONSIZE);
+  // assert: 0 <= is <= number of RISC-U instructions
+  if (is == ADDI) {
+    write_register_fast(rd, *(registers + rs1) + imm);
 
-    // CAUTION: we reset counter to avoid reporting it again
-    *(counters + a / INSTRUCTIONSIZE) = 0;
+    pc = pc + INSTRUCTIONSIZE;
 
-    printf(",%lu(%lu.%.2lu%%)@0x%lX", c,
-      percentage_format_integral_2(total, c),
-      percentage_format_fractional_2(total, c), a);
-    if (code_line_number != (uint64_t*) 0)
-      printf("(~%lu)", *(code_line_number + a / INSTRUCTIONSIZE));
+    ic_addi = ic_addi + 1;
+  } else if (is == LOAD)
+    do_load_fast();
+  else if (is == STORE)
+    do_store_fast();
+  else if (is == ADD) {
+    write_register_fast(rd, *(registers + rs1) + *(registers + rs2));
 
-    return c;
-  } else {
-    printf(",0(0.00%%)");
+    pc = pc + INSTRUCTIONSIZE;
 
-    return 0;
-  }
-}
+    ic_add = ic_add + 1;
+  } else if (is == SUB) {
+    write_register_fast(rd, *(registers + rs1) - *(registers + rs2));
 
-void print_per_instruction_profile(char* message, uint64_t total, uint64_t* counters) {
-  printf("%s: %s%lu", selfie_name, message, total);
-  print_per_instruction_counter(total, counters, print_per_instruction_counter(total, counters, print_per_instruction_counter(total, counters, UINT64_MAX)));
-  println();
-}
+    pc = pc + INSTRUCTIONSIZE;
 
-void print_access_profile(char* message, char* padding, uint64_t reads, uint64_t writes) {
-  if (reads + writes > 0) {
-    if (writes == 0)
-      // may happen in read-only memory segments
-      writes = 1;
+    ic_sub = ic_sub + 1;
+  } else if (is == MUL) {
+    write_register_fast(rd, *(registers + rs1) * *(registers + rs2));
 
-    printf("%s: %s%s%lu,%lu,%lu[%lu.%.2lu]\n", selfie_name, message, padding,
-      reads + writes, reads, writes,
-      ratio_format_integral_2(reads, writes),
-      ratio_format_fractional_2(reads, writes));
-  }
-}
+    pc = pc + INSTRUCTIONSIZE;
 
-void print_per_register_profile(uint64_t reg) {
-  print_access_profile(get_register_name(reg), " register:   ", *(reads_per_register + reg), *(writes_per_register + reg));
-}
+    ic_mul = ic_mul + 1;
+  } else if (is == DIVU) {
+    if (*(registers + rs2) != 0) {
+      write_register_fast(rd, *(registers + rs1) / *(registers + rs2));
 
-void print_register_memory_profile() {
-  uint64_t reg;
+      pc = pc + INSTRUCTIONSIZE;
+    } else
+      throw_exception(EXCEPTION_DIVISIONBYZERO, pc);
 
-  printf("%s: CPU+memory:    reads+writes,reads,writes[reads/writes]\n", selfie_name);
+    ic_divu = ic_divu + 1;
+  } else if (is == REMU) {
+    if (*(registers + rs2) != 0) {
+      write_register_fast(rd, *(registers + rs1) % *(registers + rs2));
 
-  print_access_profile("heap segment:  ", "", heap_reads, heap_writes);
+      pc = pc + INSTRUCTIONSIZE;
+    } else
+      throw_exception(EXCEPTION_DIVISIONBYZERO, pc);
 
-  print_per_register_profile(REG_GP);
-  print_access_profile("data segment:  ", "", data_reads, data_writes);
+    ic_remu = ic_remu + 1;
+  } else if (is == SLTU) {
+    if (*(registers + rs1) < *(registers + rs2))
+      write_register_fast(rd, 1);
+    else
+      write_register_fast(rd, 0);
 
-  reg = 1;
+    pc = pc + INSTRUCTIONSIZE;
 
-  while (reg < NUMBEROFREGISTERS) {
-    if (is_stack_register(reg)) {
-      stack_register_reads  = stack_register_reads + *(reads_per_register + reg);
-      stack_register_writes = stack_register_writes + *(writes_per_register + reg);
+    ic_sltu = ic_sltu + 1;
+  } else if (is == BEQ) {
+    if (*(registers + rs1) == *(registers + rs2))
+      pc = pc + imm;
+    else
+      pc = pc + INSTRUCTIONSIZE;
 
-      print_per_register_profile(reg);
-    }
+    ic_beq = ic_beq + 1;
+  } else if (is == JAL) {
+    write_register_fast(rd, pc + INSTRUCTIONSIZE);
 
-    reg = reg + 1;
-  }
+    pc = pc + imm;
+
+    ic_jal = ic_jal + 1;
+  } else if (is == JALR) {
+    // prepare jump rs1-relative with LSB reset before linking (works even if rd == rs1)
+    next_pc = left_shift(right_shift(*(registers + rs1) + imm, 1), 1);
+
+    write_register_fast(rd, pc + INSTRUCTIONSIZE);
+
+    pc = next_pc;
+
+    ic_jalr = ic_jalr + 1;
+  } else if (is == LUI) {
+    write_register_fast(rd, left_shift(imm, 12));
+
+    pc = pc + INSTRUCTIONSIZE;
+
+    ic_lui = ic_lui + 1;
+  } else if (is == ECALL) {
+    ic_ecall = ic_ecall + 1;
+
+    if (*(registers + REG_A7) == SYSCALL_SWITCH) {
+      pc = pc + INSTRUCTIONSIZE;
+
+      implement_switch();
+    } else
+      // all system calls other than switch are handled by exception
+      throw_exception(EXCEPTION_SYSCALL, *(registers + REG_A7));
+  }
+}
+
+uint64_t is_accessible_fast(uint64_t vaddr) {
+  // same checks as do_load_fast and do_store_fast
+  if (is_virtual_address_valid(vaddr, WORDSIZE))
+    if (is_data_stack_heap_address(current_context, vaddr))
+      return is_virtual_address_mapped(pt, vaddr);
+
+  return 0;
+}
+
+uint64_t execute_stepwise(uint64_t* entry, uint64_t n) {
+  uint64_t i;
+
+  // execute n predecoded instructions one by one
+  // and return number of instructions executed without trap
+
+  i = 0;
+
+  while (i < n) {
+    ir  = get_predecoded_ir(entry);
+    is  = get_predecoded_is(entry);
+    rd  = get_predecoded_rd(entry);
+    rs1 = get_predecoded_rs1(entry);
+    rs2 = get_predecoded_rs2(entry);
+    imm = get_predecoded_imm(entry);
+
+    execute_fast();
+
+    if (trap)
+      return i;
+
+    entry = entry + PREDECODEDENTRIES;
+
+    i = i + 1;
+  }
+
+  return n;
+}
+
+uint64_t execute_superinstruction(uint64_t remaining) {
+  uint64_t* entry;
+  uint64_t n;
+  uint64_t sp;
+
+  // execute superinstruction with up to remaining many instructions,
+  // and return number of instructions executed without trap
+
+  entry = predecoded_instruction(current_context, pc);
+
+  n = get_superinstruction_length(is);
+
+  if (n > remaining)
+    // timer expires within superinstruction
+    return execute_stepwise(entry, 1);
+
+  sp = *(registers + REG_SP);
+
+  if (is == FUSED_PUSH) {
+    if (is_accessible_fast(sp - WORDSIZE) == 0)
+      // let the store throw the exception
+      return execute_stepwise(entry, n);
+
+    sp = sp - WORDSIZE;
+
+    store_virtual_memory(pt, sp, *(registers + get_predecoded_rs2(entry + PREDECODEDENTRIES)));
+
+    ic_addi  = ic_addi + 1;
+    ic_store = ic_store + 1;
+  } else if (is == FUSED_POP) {
+    if (is_accessible_fast(sp) == 0)
+      return execute_stepwise(entry, n);
+
+    *(registers + rd) = load_virtual_memory(pt, sp);
+
+    sp = sp + WORDSIZE;
+
+    ic_load = ic_load + 1;
+    ic_addi = ic_addi + 1;
+  } else if (is == FUSED_PROLOGUE) {
+    if (is_accessible_fast(sp - WORDSIZE) == 0)
+      return execute_stepwise(entry, n);
+    else if (is_accessible_fast(sp - 2 * WORDSIZE) == 0)
+      return execute_stepwise(entry, n);
+
+    store_virtual_memory(pt, sp - WORDSIZE, *(registers + REG_RA));
+    store_virtual_memory(pt, sp - 2 * WORDSIZE, *(registers + REG_S0));
+
+    sp = sp - 2 * WORDSIZE;
+
+    *(registers + REG_S0) = sp;
+
+    ic_addi  = ic_addi + 3;
+    ic_store = ic_store + 2;
+  } else if (is == FUSED_EPILOGUE) {
+    if (is_accessible_fast(sp) == 0)
+      return execute_stepwise(entry, n);
+    else if (is_accessible_fast(sp + WORDSIZE) == 0)
+      return execute_stepwise(entry, n);
+
+    *(registers + REG_S0) = load_virtual_memory(pt, sp);
+    *(registers + REG_RA) = load_virtual_memory(pt, sp + WORDSIZE);
+
+    sp = sp + WORDSIZE + get_predecoded_imm(entry + 3 * PREDECODEDENTRIES);
+
+    ic_load = ic_load + 2;
+    ic_addi = ic_addi + 2;
+  } else if (is == FUSED_LI) {
+    *(registers + rd) = left_shift(imm, 12) + get_predecoded_imm(entry + PREDECODEDENTRIES);
+
+    ic_lui  = ic_lui + 1;
+    ic_addi = ic_addi + 1;
+  }
+
+  *(registers + REG_SP) = sp;
+
+  pc = pc + n * INSTRUCTIONSIZE;
+
+  superinstructions  = superinstructions + 1;
+  fused_instructions = fused_instructions + n;
+
+  return n;
+}
+
+void interrupt() {
+  if (switched) {
+    // context switches trap without exception
+    switched = 0;
+
+    trap = 0;
+  }
+
+  if (timer != TIMEROFF) {
+    timer = timer - 1;
+
+    if (timer == 0) {
+      if (get_exception(current_context) == EXCEPTION_NOEXCEPTION)
+        // only throw exception if no other is pending
+        // TODO: handle multiple pending exceptions
+        throw_exception(EXCEPTION_TIMER, 0);
+      else
+        // trigger timer in the next interrupt cycle
+        timer = 1;
+    }
+  }
+}
+
+uint64_t execute_budget(uint64_t budget) {
+  uint64_t executed;
+  uint64_t n;
+
+  // execute up to budget many instructions without interrupt
+  // and return number of instructions executed without trap
+
+  executed = 0;
+
+  if (fast)
+    while (executed < budget) {
+      fetch_fast();
+
+      if (is > ECALL) {
+        // superinstructions execute more than one instruction
+        n = execute_superinstruction(budget - executed);
+
+        if (trap)
+          return executed + n;
+
+        executed = executed + n;
+      } else {
+        execute_fast();
+
+        if (trap)
+          return executed;
+
+        executed = executed + 1;
+      }
+    }
+  else
+    while (executed < budget) {
+      fetch_predecoded();
+      execute();
+
+      if (trap)
+        return executed;
+
+      executed = executed + 1;
+    }
+
+  return executed;
+}
+
+void run_until_exception() {
+  uint64_t executed;
+
+  trap = 0;
+
+  while (trap == 0) {
+    // instead of interrupting after every instruction, execute all
+    // instructions before the timer expires in one budget and only
+    // interrupt after the last instruction, or after any trap
+    if (timer == TIMEROFF)
+      executed = execute_budget(UINT64_MAX);
+    else {
+      executed = execute_budget(timer - 1);
+
+      if (switched == 0)
+        // assert: timer > executed
+        timer = timer - executed;
+    }
+
+    if (trap == 0) {
+      fetch_predecoded();
+
+      if (fast)
+        execute_fast();
+      else
+        execute();
+    }
+
+    interrupt();
+  }
+
+  trap = 0;
+
+  write_back_all_caches();
+}
+
+uint64_t instruction_with_max_counter(uint64_t* counters, uint64_t max) {
+  uint64_t a;
+  uint64_t n;
+  uint64_t i;
+  uint64_t c;
+
+  a = UINT64_MAX;
+
+  n = 0;
+  i = 0;
+
+  while (i < code_size / INSTRUCTIONSIZE) {
+    c = *(counters + i);
+
+    if (n < c) {
+      if (c < max) {
+        n = c;
+        a = i;
+      } else
+        return i * INSTRUCTIONSIZE;
+    }
+
+    i = i + 1;
+  }
+
+  if (a != UINT64_MAX)
+    return a * INSTRUCTIONSIZE;
+  else
+    return UINT64_MAX;
+}
+
+uint64_t print_per_instruction_counter(uint64_t total, uint64_t* counters, uint64_t max) {
+  uint64_t a;
+  uint64_t c;
+
+  a = instruction_with_max_counter(counters, max);
+
+  if (a != UINT64_MAX) {
+    c = *(counters + a / INSTRUCTIONSIZE);
+
+    // CAUTION: we reset counter to avoid reporting it again
+    *(counters + a / INSTRUCTIONSIZE) = 0;
+
+    printf(",%lu(%lu.%.2lu%%)@0x%lX", c,
+      percentage_format_integral_2(total, c),
+      percentage_format_fractional_2(total, c), a);
+    if (code_line_number != (uint64_t*) 0)
+      printf("(~%lu)", *(code_line_number + a / INSTRUCTIONSIZE));
+
+    return c;
+  } else {
+    printf(",0(0.00%%)");
+
+    return 0;
+  }
+}
+
+void print_per_instruction_profile(char* message, uint64_t total, uint64_t* counters) {
+  printf("%s: %s%lu", selfie_name, message, total);
+  print_per_instruction_counter(total, counters, print_per_instruction_counter(total, counters, print_per_instruction_counter(total, counters, UINT64_MAX)));
+  println();
+}
+
+void print_access_profile(char* message, char* padding, uint64_t reads, uint64_t writes) {
+  if (reads + writes > 0) {
+    if (writes == 0)
+      // may happen in read-only memory segments
+      writes = 1;
+
+    printf("%s: %s%s%lu,%lu,%lu[%lu.%.2lu]\n", selfie_name, message, padding,
+      reads + writes, reads, writes,
+      ratio_format_integral_2(reads, writes),
+      ratio_format_fractional_2(reads, writes));
+  }
+}
+
+void print_per_register_profile(uint64_t reg) {
+  print_access_profile(get_register_name(reg), " register:   ", *(reads_per_register + reg), *(writes_per_register + reg));
+}
+
+void print_register_memory_profile() {
+  uint64_t reg;
+
+  printf("%s: CPU+memory:    reads+writes,reads,writes[reads/writes]\n", selfie_name);
+
+  print_access_profile("heap segment:  ", "", heap_reads, heap_writes);
+
+  print_per_register_profile(REG_GP);
+  print_access_profile("data segment:  ", "", data_reads, data_writes);
+
+  reg = 1;
+
+  while (reg < NUMBEROFREGISTERS) {
+    if (is_stack_register(reg)) {
+      stack_register_reads  = stack_register_reads + *(reads_per_register + reg);
+      stack_register_writes = stack_register_writes + *(writes_per_register + reg);
+
+      print_per_register_profile(reg);
+    }
+
+    reg = reg + 1;
+  }
 
   print_access_profile("stack total:   ", "", stack_register_reads, stack_register_writes);
   print_access_profile("stack segment: ", "", stack_reads, stack_writes);
@@ -10199,24 +12507,30 @@ void print_register_memory_profile() {
   print_access_profile("temps total:   ", "", temporary_register_reads, temporary_register_writes);
 }
 
-void down_load_profiles() {
-  uint64_t* context;
+void down_load_profile(uint64_t* context) {
   uint64_t* parent_table;
   uint64_t* vctxt;
 
+  parent_table = get_pt(get_parent(context));
+  vctxt        = get_virtual_context(context);
+
+  set_lc_malloc(context, load_virtual_memory(parent_table, lc_malloc(vctxt)));
+  set_mc_mapped_heap(context, load_virtual_memory(parent_table, mc_mapped_heap(vctxt)));
+  set_ec_syscall(context, load_virtual_memory(parent_table, ec_syscall(vctxt)));
+  set_ec_page_fault(context, load_virtual_memory(parent_table, ec_page_fault(vctxt)));
+  set_ec_timer(context, load_virtual_memory(parent_table, ec_timer(vctxt)));
+}
+
+void down_load_profiles() {
+  uint64_t* context;
+
   context = used_contexts;
 
   while (context != (uint64_t*) 0) {
-    if (get_parent(context) != MY_CONTEXT) {
-      parent_table = get_pt(get_parent(context));
-      vctxt        = get_virtual_context(context);
-
-      set_lc_malloc(context, load_virtual_memory(parent_table, lc_malloc(vctxt)));
-      set_mc_mapped_heap(context, load_virtual_memory(parent_table, mc_mapped_heap(vctxt)));
-      set_ec_syscall(context, load_virtual_memory(parent_table, ec_syscall(vctxt)));
-      set_ec_page_fault(context, load_virtual_memory(parent_table, ec_page_fault(vctxt)));
-      set_ec_timer(context, load_virtual_memory(parent_table, ec_timer(vctxt)));
-    }
+    if (get_parent(context) != MY_CONTEXT)
+      // profiles of exited contexts were down loaded before their parents exited
+      if (get_context_state(context) != CONTEXT_EXITED)
+        down_load_profile(context);
 
     context = get_next_context(context);
   }
@@ -10273,11 +12587,32 @@ void print_profile() {
     printf("%s:          ", selfie_name);
   }
   printf("%lu.%.2luMB mapped memory [%lu.%.2lu%% of %luMB physical memory]\n",
-    ratio_format_integral_2(pused(), MEGABYTE),
-    ratio_format_fractional_2(pused(), MEGABYTE),
-    percentage_format_integral_2(PHYSICALMEMORYSIZE, pused()),
-    percentage_format_fractional_2(PHYSICALMEMORYSIZE, pused()),
+    ratio_format_integral_2(ppeak(), MEGABYTE),
+    ratio_format_fractional_2(ppeak(), MEGABYTE),
+    percentage_format_integral_2(PHYSICALMEMORYSIZE, ppeak()),
+    percentage_format_fractional_2(PHYSICALMEMORYSIZE, ppeak()),
     PHYSICALMEMORYSIZE / MEGABYTE);
+  if (reclaimed_page_frames > 0)
+    printf("%s:          %lu page frames reclaimed, %lu reused\n", selfie_name,
+      reclaimed_page_frames,
+      reused_page_frames);
+  if (promoted_superpages > 0)
+    printf("%s:          %lu superpages promoted, %lu demoted\n", selfie_name,
+      promoted_superpages,
+      demoted_superpages);
+  if (forked_contexts > 0)
+    printf("%s:          %lu contexts forked, %lu page frames copied on write\n", selfie_name,
+      forked_contexts,
+      copied_page_frames);
+  if (schedules > 0)
+    printf("%s:          %lu scheduling decisions by %s scheduler\n", selfie_name,
+      schedules,
+      scheduling_policy_name(SCHEDULER));
+  if (nested_switches > 0)
+    printf("%s:          %lu nested context switches syncing %lu.%.2lu register and state words each\n", selfie_name,
+      nested_switches,
+      ratio_format_integral_2(synced_words, nested_switches),
+      ratio_format_fractional_2(synced_words, nested_switches));
 
   down_load_profiles();
 
@@ -10301,6 +12636,11 @@ void print_profile() {
           get_mc_mapped_heap(context)),
         percentage_format_fractional_2(round_up(get_program_break(context) - get_heap_seg_start(context), PAGESIZE),
             get_mc_mapped_heap(context)));
+      if (get_time_slices(context) > 0)
+        printf("%s:          %lu time slices of %lu executed instructions on average at priority %lu\n", selfie_name,
+          get_time_slices(context),
+          ratio_format_integral_2(get_ic_all(context), get_time_slices(context)),
+          get_priority(context));
     }
     if (get_ec_syscall(context) + get_ec_page_fault(context) + get_ec_timer(context) > 0) {
       printf("%s:          %lu exceptions handled by ", selfie_name,
@@ -10345,15 +12685,38 @@ void print_profile() {
 
   if (L1_CACHE_ENABLED) {
     printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
-    printf("%s: L1 caches:     accesses,hits,misses\n", selfie_name);
+    printf("%s: L1 caches:     accesses,hits,misses (%s replacement)\n", selfie_name,
+      replacement_policy_name(cache_replacement));
 
     print_cache_profile(get_cache_hits(L1_DCACHE), get_cache_misses(L1_DCACHE), "data:          ");
+    if (get_write_policy(L1_DCACHE) == CACHE_WRITE_BACK)
+      printf(" (write-backs: %lu)", get_cache_write_backs(L1_DCACHE));
     println();
 
     print_cache_profile(get_cache_hits(L1_ICACHE), get_cache_misses(L1_ICACHE), "instruction:   ");
     if (L1_CACHE_COHERENCY)
       printf(" (coherency invalidations: %lu)", L1_icache_coherency_invalidations);
     println();
+
+    if (L1_synonym_invalidations > 0)
+      printf("%s: synonyms:      %lu blocks invalidated across address spaces\n", selfie_name,
+        L1_synonym_invalidations);
+
+    print_cache_hierarchy_profile();
+
+    if (number_of_sweep_caches > 0)
+      print_cache_sweep_profile();
+  }
+
+  printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
+  printf("%s: TLB:           accesses,hits,misses\n", selfie_name);
+
+  print_cache_profile(TLB_hits, TLB_misses, "translations:  ");
+  println();
+
+  if (PWC_hits + PWC_misses > 0) {
+    print_cache_profile(PWC_hits, PWC_misses, "nested walks:  ");
+    println();
   }
 }
 
@@ -10438,6 +12801,18 @@ uint64_t is_data_stack_heap_address(uint64_t* context, uint64_t vaddr) {
     return 0;
 }
 
+uint64_t data_stack_heap_segment_end(uint64_t* context, uint64_t vaddr) {
+  // end of segment containing vaddr, or 0 if vaddr is not in data, stack, or heap
+  if (is_data_address(context, vaddr))
+    return get_data_seg_start(context) + get_data_seg_size(context);
+  else if (is_stack_address(context, vaddr))
+    return HIGHESTVIRTUALADDRESS + 1;
+  else if (is_heap_address(context, vaddr))
+    return get_program_break(context);
+  else
+    return 0;
+}
+
 // -----------------------------------------------------------------
 // ---------------------- GARBAGE COLLECTOR ------------------------
 // -----------------------------------------------------------------
@@ -10556,6 +12931,37 @@ uint64_t* allocate_metadata(uint64_t* context) {
     return smalloc(GC_METADATA_SIZE);
 }
 
+uint64_t* copy_metadata_list(uint64_t* context, uint64_t* entry) {
+  uint64_t* head;
+  uint64_t* tail;
+  uint64_t* copy;
+
+  // returns a copy of the list of metadata entries from entry on, in the same order
+
+  head = (uint64_t*) 0;
+  tail = (uint64_t*) 0;
+
+  while (entry != (uint64_t*) 0) {
+    copy = allocate_metadata(context);
+
+    set_metadata_next(copy, (uint64_t*) 0);
+    set_metadata_memory(copy, get_metadata_memory(entry));
+    set_metadata_size(copy, get_metadata_size(entry));
+    set_metadata_markbit(copy, get_metadata_markbit(entry));
+
+    if (head == (uint64_t*) 0)
+      head = copy;
+    else
+      set_metadata_next(tail, copy);
+
+    tail = copy;
+
+    entry = get_metadata_next(entry);
+  }
+
+  return head;
+}
+
 uint64_t get_stack_seg_start_gc(uint64_t* context) {
   if (is_gc_library(context))
     return fetch_stack_pointer();
@@ -11060,6 +13466,213 @@ void print_gc_profile(uint64_t is_gc_kernel) {
   println();
 }
 
+// -----------------------------------------------------------------
+// --------------------------- SCHEDULER ---------------------------
+// -----------------------------------------------------------------
+
+void init_scheduler() {
+  context_table = zmalloc(CONTEXTBUCKETS * sizeof(uint64_t*));
+
+  ready_heads = zmalloc(NUMBEROFPRIORITIES * sizeof(uint64_t*));
+  ready_tails = zmalloc(NUMBEROFPRIORITIES * sizeof(uint64_t*));
+}
+
+uint64_t* get_bucket(uint64_t* parent, uint64_t* vctxt) {
+  // contexts as well as virtual contexts are word-aligned
+  return context_table +
+    ((uint64_t) parent / sizeof(uint64_t) + (uint64_t) vctxt / sizeof(uint64_t)) % CONTEXTBUCKETS;
+}
+
+void hash_context(uint64_t* context) {
+  uint64_t* bucket;
+
+  bucket = get_bucket(get_parent(context), get_virtual_context(context));
+
+  set_next_in_bucket(context, (uint64_t*) *bucket);
+
+  *bucket = (uint64_t) context;
+}
+
+void unhash_context(uint64_t* context) {
+  uint64_t* bucket;
+  uint64_t* previous;
+  uint64_t* next;
+
+  bucket = get_bucket(get_parent(context), get_virtual_context(context));
+
+  previous = (uint64_t*) 0;
+  next     = (uint64_t*) *bucket;
+
+  // contexts that were never hashed, such as symbolic contexts, are not found
+  while (next != (uint64_t*) 0) {
+    if (next == context) {
+      if (previous == (uint64_t*) 0)
+        *bucket = (uint64_t) get_next_in_bucket(context);
+      else
+        set_next_in_bucket(previous, get_next_in_bucket(context));
+
+      set_next_in_bucket(context, (uint64_t*) 0);
+
+      return;
+    }
+
+    previous = next;
+    next     = get_next_in_bucket(next);
+  }
+}
+
+void enqueue_context(uint64_t* context) {
+  uint64_t priority;
+
+  priority = get_priority(context);
+
+  set_next_ready(context, (uint64_t*) 0);
+
+  if (*(ready_tails + priority) == 0)
+    *(ready_heads + priority) = (uint64_t) context;
+  else
+    set_next_ready((uint64_t*) *(ready_tails + priority), context);
+
+  *(ready_tails + priority) = (uint64_t) context;
+
+  number_of_ready_contexts = number_of_ready_contexts + 1;
+}
+
+uint64_t* dequeue_context(uint64_t priority) {
+  uint64_t* context;
+
+  context = (uint64_t*) *(ready_heads + priority);
+
+  if (context != (uint64_t*) 0) {
+    *(ready_heads + priority) = (uint64_t) get_next_ready(context);
+
+    if (*(ready_heads + priority) == 0)
+      *(ready_tails + priority) = 0;
+
+    set_next_ready(context, (uint64_t*) 0);
+
+    number_of_ready_contexts = number_of_ready_contexts - 1;
+  }
+
+  return context;
+}
+
+void ready_context(uint64_t* context) {
+  set_context_state(context, CONTEXT_READY);
+
+  enqueue_context(context);
+}
+
+void block_context(uint64_t* context) {
+  set_context_state(context, CONTEXT_BLOCKED);
+}
+
+void exit_context(uint64_t* context) {
+  uint64_t* hosted;
+
+  set_context_state(context, CONTEXT_EXITED);
+
+  hosted = used_contexts;
+
+  // contexts hosted by an exited context never run again
+  while (hosted != (uint64_t*) 0) {
+    if (get_parent(hosted) == context)
+      if (get_context_state(hosted) != CONTEXT_EXITED) {
+        // down load profile while memory of context is still mapped
+        down_load_profile(hosted);
+
+        exit_context(hosted);
+      }
+
+    hosted = get_next_context(hosted);
+  }
+
+  // cache blocks must not outlive the page frames they cache
+  flush_all_caches();
+
+  // page frames and leaf page tables are reused by palloc
+  reclaim_context(context);
+}
+
+void dispatch_context(uint64_t* context) {
+  // a context switching to another context waits for that
+  // context (or one of its descendants) to switch back
+  if (current_context != context)
+    if (get_context_state(current_context) == CONTEXT_RUNNING)
+      block_context(current_context);
+
+  set_context_state(context, CONTEXT_RUNNING);
+
+  set_time_slices(context, get_time_slices(context) + 1);
+}
+
+void account_context(uint64_t* context) {
+  if (SCHEDULER == PRIORITY) {
+    if (get_exception(context) == EXCEPTION_TIMER) {
+      // context used up its time slice: lower its priority
+      if (get_priority(context) < NUMBEROFPRIORITIES - 1)
+        set_priority(context, get_priority(context) + 1);
+    } else if (get_priority(context) > 0)
+      // context trapped before its time slice ended: raise its priority
+      set_priority(context, get_priority(context) - 1);
+  }
+}
+
+uint64_t* schedule() {
+  uint64_t priority;
+  uint64_t* context;
+
+  if (number_of_ready_contexts == 0)
+    return (uint64_t*) 0;
+
+  schedules = schedules + 1;
+
+  if (schedules % STARVATIONPERIOD == 0) {
+    // avoid starvation by scheduling the lowest priority level first
+    priority = NUMBEROFPRIORITIES;
+
+    while (priority > 0) {
+      priority = priority - 1;
+
+      context = dequeue_context(priority);
+
+      if (context != (uint64_t*) 0)
+        return context;
+    }
+  }
+
+  priority = 0;
+
+  // constant number of priority levels, no scans over contexts
+  while (priority < NUMBEROFPRIORITIES) {
+    context = dequeue_context(priority);
+
+    if (context != (uint64_t*) 0)
+      return context;
+
+    priority = priority + 1;
+  }
+
+  // unreachable
+  return (uint64_t*) 0;
+}
+
+uint64_t parse_scheduling_policy(char* name) {
+  if (string_compare(name, "rr"))
+    return ROUNDROBIN;
+  else if (string_compare(name, "priority"))
+    return PRIORITY;
+  else
+    return UINT64_MAX;
+}
+
+char* scheduling_policy_name(uint64_t policy) {
+  if (policy == ROUNDROBIN)
+    return "round-robin";
+  else
+    return "priority";
+}
+
 // -----------------------------------------------------------------
 // -------------------------- MICROKERNEL --------------------------
 // -----------------------------------------------------------------
@@ -11093,6 +13706,8 @@ void free_context(uint64_t* context) {
 }
 
 uint64_t* delete_context(uint64_t* context, uint64_t* from) {
+  unhash_context(context);
+
   if (get_next_context(context) != (uint64_t*) 0)
     set_prev_context(get_next_context(context), get_prev_context(context));
 
@@ -11138,7 +13753,14 @@ void init_context(uint64_t* context, uint64_t* parent, uint64_t* vctxt) {
   set_lowest_hi_page(context, page_of_virtual_address(HIGHESTVIRTUALADDRESS));
   set_highest_hi_page(context, get_lowest_hi_page(context));
 
+  // allocate memory for logging pages mapped in between caching
+  set_page_log(context, smalloc(PAGELOGSIZE * sizeof(uint64_t)));
+  set_logged_pages(context, 0);
+
   if (parent != MY_CONTEXT) {
+    // allocate memory for registers and state as last synced with virtual context
+    set_synced_state(context, smalloc((NUMBEROFREGISTERS + SYNCEDFIELDS) * sizeof(uint64_t)));
+
     set_code_seg_start(context, load_virtual_memory(get_pt(parent), code_seg_start(vctxt)));
     set_code_seg_size(context, load_virtual_memory(get_pt(parent), code_seg_size(vctxt)));
     set_data_seg_start(context, load_virtual_memory(get_pt(parent), data_seg_start(vctxt)));
@@ -11174,555 +13796,1739 @@ void init_context(uint64_t* context, uint64_t* parent, uint64_t* vctxt) {
   set_free_list_head(context, (uint64_t*) 0);
   set_gcs_in_period(context, 0);
   set_use_gc_kernel(context, GC_DISABLED);
+
+  // code is predecoded when first executed
+  set_predecoded_code(context, (uint64_t*) 0);
+
+  // scheduler
+  set_next_in_bucket(context, (uint64_t*) 0);
+  set_next_ready(context, (uint64_t*) 0);
+  set_context_state(context, CONTEXT_READY);
+  set_priority(context, 0);
+  set_time_slices(context, 0);
+
+  // ASID is allocated when first switching to context
+  set_asid(context, 0);
+}
+
+uint64_t* create_context(uint64_t* parent, uint64_t* vctxt) {
+  uint64_t* context;
+
+  context = new_context();
+
+  init_context(context, parent, vctxt);
+
+  hash_context(context);
+
+  if (debug_create)
+    printf("%s: parent context %s created child context %s\n", selfie_name,
+      get_name(parent), get_name(used_contexts));
+
+  return context;
+}
+
+uint64_t* find_context(uint64_t* parent, uint64_t* vctxt) {
+  uint64_t* context;
+
+  // only contexts in the same bucket of the context table are compared
+  context = (uint64_t*) *get_bucket(parent, vctxt);
+
+  while (context != (uint64_t*) 0) {
+    if (get_parent(context) == parent)
+      if (get_virtual_context(context) == vctxt)
+        return context;
+
+    context = get_next_in_bucket(context);
+  }
+
+  return (uint64_t*) 0;
+}
+
+uint64_t* cache_context(uint64_t* vctxt) {
+  uint64_t* context;
+
+  // find cached context on my boot level
+  context = find_context(current_context, vctxt);
+
+  if (context == (uint64_t*) 0)
+    // create cached context on my boot level
+    context = create_context(current_context, vctxt);
+
+  return context;
+}
+
+void down_load_virtual_words(uint64_t* table, uint64_t vaddr, uint64_t* words, uint64_t n) {
+  uint64_t* paddr;
+
+  // assert: all n words from vaddr on are mapped in table
+
+  paddr = translate_virtual_to_physical(table, vaddr);
+
+  synced_words = synced_words + n;
+
+  while (n > 0) {
+    *words = load_physical_memory(paddr);
+
+    words = words + 1;
+    n     = n - 1;
+
+    vaddr = vaddr + WORDSIZE;
+
+    if (n > 0) {
+      if (vaddr % PAGESIZE == 0)
+        // translate only once per page
+        paddr = translate_virtual_to_physical(table, vaddr);
+      else
+        // words of a page are contiguous in its page frame
+        paddr = paddr + 1;
+    }
+  }
+}
+
+void up_load_changed_words(uint64_t* table, uint64_t vaddr, uint64_t* words, uint64_t* synced, uint64_t n) {
+  uint64_t* paddr;
+
+  // translate only once per page and only if page contains changed words
+  paddr = (uint64_t*) 0;
+
+  while (n > 0) {
+    if (*words != *synced) {
+      if (paddr == (uint64_t*) 0)
+        paddr = translate_virtual_to_physical(table, vaddr);
+
+      store_physical_memory(paddr, *words);
+
+      if (L1_CACHE_ENABLED)
+        snoop_caches(vaddr, (uint64_t) paddr);
+
+      *synced = *words;
+
+      synced_words = synced_words + 1;
+    }
+
+    words  = words + 1;
+    synced = synced + 1;
+    n      = n - 1;
+
+    vaddr = vaddr + WORDSIZE;
+
+    if (vaddr % PAGESIZE == 0)
+      paddr = (uint64_t*) 0;
+    else if (paddr != (uint64_t*) 0)
+      paddr = paddr + 1;
+  }
+}
+
+void up_load_changed_word(uint64_t* table, uint64_t vaddr, uint64_t* synced, uint64_t word) {
+  if (word != *synced) {
+    store_virtual_memory(table, vaddr, word);
+
+    *synced = word;
+
+    synced_words = synced_words + 1;
+  }
+}
+
+void save_context(uint64_t* context) {
+  uint64_t* parent_table;
+  uint64_t* vctxt;
+  uint64_t r;
+  uint64_t* synced;
+
+  // save machine state
+  set_pc(context, pc);
+
+  if (get_parent(context) != MY_CONTEXT) {
+    // upload changes in context to virtual context in parent address space
+    parent_table = get_pt(get_parent(context));
+
+    vctxt = get_virtual_context(context);
+
+    store_virtual_memory(parent_table, program_counter(vctxt), get_pc(context));
+
+    // assert: virtual context is unchanged since restore_context synced it
+
+    synced = get_synced_state(context);
+
+    up_load_changed_words(parent_table, load_virtual_memory(parent_table, regs(vctxt)),
+      get_regs(context), synced, NUMBEROFREGISTERS);
+
+    synced = synced + NUMBEROFREGISTERS;
+
+    up_load_changed_word(parent_table, program_break(vctxt), synced, get_program_break(context));
+
+    up_load_changed_word(parent_table, exception(vctxt), synced + 1, get_exception(context));
+    up_load_changed_word(parent_table, fault(vctxt), synced + 2, get_fault(context));
+    up_load_changed_word(parent_table, exit_code(vctxt), synced + 3, get_exit_code(context));
+
+    // garbage collector state (only necessary if context is gced by different gcs)
+
+    up_load_changed_word(parent_table, used_list_head(vctxt), synced + 4, (uint64_t) get_used_list_head(context));
+    up_load_changed_word(parent_table, free_list_head(vctxt), synced + 5, (uint64_t) get_free_list_head(context));
+    up_load_changed_word(parent_table, gcs_in_period(vctxt), synced + 6, get_gcs_in_period(context));
+    up_load_changed_word(parent_table, use_gc_kernel(vctxt), synced + 7, get_use_gc_kernel(context));
+  }
+
+  set_ic_all(context, get_total_number_of_instructions() - get_ic_all(context));
+
+  // number of bytes currently allocated on stack
+  r = VIRTUALMEMORYSIZE * GIGABYTE - *(get_regs(context) + REG_SP);
+
+  if (r > get_mc_stack_peak(context))
+    // keep track of peak amount of stack allocation
+    set_mc_stack_peak(context, r);
 }
 
-uint64_t* create_context(uint64_t* parent, uint64_t* vctxt) {
-  uint64_t* context;
+uint64_t lowest_page(uint64_t page, uint64_t lo) {
+  if (page < lo)
+    return page;
+  else
+    return lo;
+}
+
+uint64_t highest_page(uint64_t page, uint64_t hi) {
+  if (page >= hi)
+    // only lo <= page < hi will be cached
+    return page + 1;
+  else
+    return hi;
+}
+
+void map_page(uint64_t* context, uint64_t page, uint64_t frame) {
+  uint64_t* table;
+  uint64_t logged;
+
+  table = get_pt(context);
+
+  // assert: page is unmapped
+
+  set_page_frame(table, page, frame);
+
+  if (is_code_address(context, virtual_address_of_page(page)))
+    // remapped code must be predecoded again
+    invalidate_predecoded_code(context, virtual_address_of_page(page), PAGESIZE);
+
+  // exploit spatial locality in page table caching
+  if (page <= page_of_virtual_address(get_program_break(context) - WORDSIZE)) {
+    set_lowest_lo_page(context, lowest_page(page, get_lowest_lo_page(context)));
+    set_highest_lo_page(context, highest_page(page, get_highest_lo_page(context)));
+  } else {
+    set_lowest_hi_page(context, lowest_page(page, get_lowest_hi_page(context)));
+    set_highest_hi_page(context, highest_page(page, get_highest_hi_page(context)));
+  }
+
+  // log mapped page for caching only this page rather than page ranges
+  logged = get_logged_pages(context);
+
+  if (logged < PAGELOGSIZE)
+    *(get_page_log(context) + logged) = page;
+
+  // count beyond PAGELOGSIZE to indicate log overflow
+  set_logged_pages(context, logged + 1);
+
+  if (debug_map)
+    printf("%s: page 0x%04lX mapped to frame 0x%08lX in context %s\n", selfie_name,
+      page, (uint64_t) frame, get_name(context));
+}
+
+void cache_page_table(uint64_t* context, uint64_t* table, uint64_t* parent_table, uint64_t lo, uint64_t hi) {
+  uint64_t* PTE;
+  uint64_t frame;
+
+  while (lo < hi) {
+    // PTE of lo page in page table in parent address space
+    PTE = get_nested_PTE(parent_table, table, lo);
+
+    if (PTE != (uint64_t*) 0)
+      // page frame of lo page in parent address space
+      frame = load_physical_memory(PTE);
+    else
+      // lo page may be mapped by a superpage without leaf page table
+      frame = get_superpage_frame(parent_table, table, lo);
+
+    // page may be unmapped even if PTE of page is mapped
+    if (frame != 0) {
+      // assert: page frame in parent address space is mapped
+      frame = get_page_frame(parent_table, page_of_virtual_address(frame));
+
+      map_page(context, lo, frame);
+    }
+
+    lo = lo + 1;
+  }
+}
+
+void cache_logged_pages(uint64_t* context, uint64_t* table, uint64_t* parent_table, uint64_t* log, uint64_t logged) {
+  uint64_t page;
+
+  // assert: log is in address space of parent_table and logged <= PAGELOGSIZE
+
+  while (logged > 0) {
+    logged = logged - 1;
+
+    page = load_virtual_memory(parent_table, (uint64_t) (log + logged));
+
+    cache_page_table(context, table, parent_table, page, page + 1);
+  }
+}
+
+void recache_hosted_contexts(uint64_t* parent) {
+  uint64_t* parent_table;
+  uint64_t* context;
+  uint64_t* table;
+
+  // page tables of contexts hosted by parent are cached with page frames
+  // of parent address space which are stale once parent pages are remapped
+
+  parent_table = get_pt(parent);
+
+  context = used_contexts;
+
+  while (context != (uint64_t*) 0) {
+    if (get_parent(context) == parent) {
+      table = (uint64_t*) load_virtual_memory(parent_table, page_table(get_virtual_context(context)));
+
+      // remapping cached pages invalidates their TLB entries
+      cache_page_table(context, table, parent_table, get_lowest_lo_page(context), get_highest_lo_page(context));
+      cache_page_table(context, table, parent_table, get_lowest_hi_page(context), get_highest_hi_page(context));
+
+      // page tables of contexts hosted by context are cached with the same page frames
+      recache_hosted_contexts(context);
+    }
+
+    context = get_next_context(context);
+  }
+}
+
+void restore_context(uint64_t* context) {
+  uint64_t* parent_table;
+  uint64_t* vctxt;
+  uint64_t r;
+  uint64_t* pregs;
+  uint64_t* synced;
+  uint64_t* table;
+  uint64_t logged;
+  uint64_t lo;
+  uint64_t hi;
+
+  if (get_parent(context) != MY_CONTEXT) {
+    // download changes in virtual context in parent address space to context
+    parent_table = get_pt(get_parent(context));
+
+    vctxt = get_virtual_context(context);
+
+    nested_switches = nested_switches + 1;
+
+    set_pc(context, load_virtual_memory(parent_table, program_counter(vctxt)));
+
+    // remember downloaded registers and state for uploading only changes in save_context
+
+    synced = get_synced_state(context);
+
+    down_load_virtual_words(parent_table, load_virtual_memory(parent_table, regs(vctxt)),
+      synced, NUMBEROFREGISTERS);
+
+    r = 0;
+
+    pregs = get_regs(context);
+
+    while (r < NUMBEROFREGISTERS) {
+      *(pregs + r) = *(synced + r);
+
+      r = r + 1;
+    }
+
+    synced = synced + NUMBEROFREGISTERS;
+
+    // assert: program break, exception, fault, and exit code are contiguous in virtual context
+
+    down_load_virtual_words(parent_table, program_break(vctxt), synced, 4);
+
+    set_program_break(context, *synced);
+
+    set_exception(context, *(synced + 1));
+    set_fault(context, *(synced + 2));
+
+    set_exit_code(context, *(synced + 3));
+
+    table = (uint64_t*) load_virtual_memory(parent_table, page_table(vctxt));
+
+    // context page table persists across context switches as
+    // shadow of virtual context page table: only pages mapped
+    // since virtual context page table was last cached are synced
+
+    logged = load_virtual_memory(parent_table, logged_pages(vctxt));
+
+    if (logged <= PAGELOGSIZE)
+      cache_logged_pages(context, table, parent_table,
+        (uint64_t*) load_virtual_memory(parent_table, page_log(vctxt)), logged);
+
+    // assert: virtual context page table is only mapped from beginning up and end down
+
+    if (logged > PAGELOGSIZE)
+      // page log also overflows when promoting superpages in virtual context
+      // page table which replaces leaf page tables that may be cached in PWC
+      flush_PWC();
+
+    lo = load_virtual_memory(parent_table, lowest_lo_page(vctxt));
+    hi = load_virtual_memory(parent_table, highest_lo_page(vctxt));
+
+    if (logged > PAGELOGSIZE)
+      // page log overflowed
+      cache_page_table(context, table, parent_table, lo, hi);
+
+    store_virtual_memory(parent_table, lowest_lo_page(vctxt), hi);
+
+    lo = load_virtual_memory(parent_table, lowest_hi_page(vctxt));
+    hi = load_virtual_memory(parent_table, highest_hi_page(vctxt));
+
+    if (logged > PAGELOGSIZE)
+      cache_page_table(context, table, parent_table, lo, hi);
+
+    store_virtual_memory(parent_table, highest_hi_page(vctxt), lo);
+
+    store_virtual_memory(parent_table, logged_pages(vctxt), 0);
+
+    // garbage collector state (only necessary if context is gced by different gcs)
+
+    // assert: garbage collector fields are contiguous in virtual context
+
+    down_load_virtual_words(parent_table, used_list_head(vctxt), synced + 4, 4);
+
+    set_used_list_head(context, (uint64_t*) *(synced + 4));
+    set_free_list_head(context, (uint64_t*) *(synced + 5));
+    set_gcs_in_period(context, *(synced + 6));
+    set_use_gc_kernel(context, *(synced + 7));
+  }
+
+  // restore machine state
+  pc        = get_pc(context);
+  registers = get_regs(context);
+  pt        = get_pt(context);
+
+  // ASID-tagged caches need not be flushed
+  L1_asid = activate_asid(context);
+
+  set_ic_all(context, get_total_number_of_instructions() - get_ic_all(context));
+}
+
+uint64_t activate_asid(uint64_t* context) {
+  if (get_asid(context) / NUMBEROFASIDS != asid_generation) {
+    // context has no ASID in current generation
+    if (next_asid == NUMBEROFASIDS) {
+      // all ASIDs are taken: start new generation,
+      // the only event that invalidates all cache blocks
+      asid_generation = asid_generation + 1;
+
+      next_asid = 0;
+
+      flush_all_caches();
+    }
+
+    set_asid(context, asid_generation * NUMBEROFASIDS + next_asid);
+
+    next_asid = next_asid + 1;
+  }
+
+  return get_asid(context) % NUMBEROFASIDS;
+}
+
+uint64_t pavailable() {
+  if (free_page_frame_memory > 0)
+    return 1;
+  else if (free_page_frames != (uint64_t*) 0)
+    return 1;
+  else if (allocated_page_frame_memory + MEGABYTE <= PHYSICALMEMORYSIZE * PHYSICALMEMORYEXCESS)
+    return 1;
+  else
+    return 0;
+}
+
+uint64_t pused() {
+  return allocated_page_frame_memory - free_page_frame_memory - freed_page_frame_memory;
+}
+
+uint64_t ppeak() {
+  if (pused() > peak_page_frame_memory)
+    return pused();
+  else
+    return peak_page_frame_memory;
+}
+
+uint64_t* palloc() {
+  uint64_t block;
+  uint64_t frame;
+
+  // assert: PHYSICALMEMORYSIZE is equal to or a multiple of MEGABYTE
+  // assert: PAGEFRAMESIZE is a factor of MEGABYTE strictly less than MEGABYTE
+
+  if (free_page_frames != (uint64_t*) 0) {
+    // reuse freed page frames first
+    frame = (uint64_t) free_page_frames;
+
+    free_page_frames = (uint64_t*) *free_page_frames;
+
+    freed_page_frame_memory = freed_page_frame_memory - PAGEFRAMESIZE;
+
+    reused_page_frames = reused_page_frames + 1;
+
+    // page frames are zeroed as on allocation
+    zero_memory((uint64_t*) frame, PAGEFRAMESIZE);
+
+    return (uint64_t*) frame;
+  }
+
+  if (free_page_frame_memory == 0) {
+    if (pavailable()) {
+      // single word on 32-bit target occupies double word on 64-bit system
+      free_page_frame_memory = MEGABYTE * (PAGEFRAMESIZE / PAGESIZE);
+
+      // avoid zeroing, and thus committing, the whole megabyte up front
+      block = (uint64_t) smalloc_system(free_page_frame_memory);
+
+      allocated_page_frame_memory = allocated_page_frame_memory + free_page_frame_memory;
+
+      // page frames must be PAGEFRAMESIZE-aligned in memory
+      next_page_frame = round_up(block, PAGEFRAMESIZE);
+
+      if (next_page_frame > block)
+        // losing one page frame to alignment
+        free_page_frame_memory = free_page_frame_memory - PAGEFRAMESIZE;
+    } else {
+      printf("%s: palloc out of physical memory\n", selfie_name);
+
+      exit(EXITCODE_OUTOFPHYSICALMEMORY);
+    }
+  }
+
+  frame = next_page_frame;
+
+  next_page_frame = next_page_frame + PAGEFRAMESIZE;
+
+  free_page_frame_memory = free_page_frame_memory - PAGEFRAMESIZE;
+
+  if (is_fresh_memory_zeroed())
+    // touching is only necessary on boot levels higher than 0
+    return touch((uint64_t*) frame, PAGEFRAMESIZE);
+  else {
+    // zero page frames one at a time when they are allocated
+    zero_memory((uint64_t*) frame, PAGEFRAMESIZE);
+
+    return (uint64_t*) frame;
+  }
+}
+
+void pfree(uint64_t* frame) {
+  // page frame memory in use only shrinks when freeing page frames
+  peak_page_frame_memory = ppeak();
+
+  // link freed page frames through their first word
+  *frame = (uint64_t) free_page_frames;
+
+  free_page_frames = frame;
+
+  freed_page_frame_memory = freed_page_frame_memory + PAGEFRAMESIZE;
+
+  reclaimed_page_frames = reclaimed_page_frames + 1;
+}
+
+uint64_t* palloc_superframe() {
+  uint64_t size;
+  uint64_t block;
+
+  // page frames of a superpage, contiguous in memory
+  size = NUMBEROFLEAFPTES * PAGEFRAMESIZE;
+
+  if (allocated_page_frame_memory + size > PHYSICALMEMORYSIZE * PHYSICALMEMORYEXCESS)
+    return (uint64_t*) 0;
+
+  // allocate one more page frame for alignment
+  block = (uint64_t) smalloc_system(size + PAGEFRAMESIZE);
+
+  allocated_page_frame_memory = allocated_page_frame_memory + size;
+
+  // superframes must be PAGEFRAMESIZE-aligned in memory
+  block = round_up(block, PAGEFRAMESIZE);
+
+  if (is_fresh_memory_zeroed())
+    return touch((uint64_t*) block, size);
+  else {
+    zero_memory((uint64_t*) block, size);
+
+    return (uint64_t*) block;
+  }
+}
+
+uint64_t promote_superpage(uint64_t* context, uint64_t page) {
+  uint64_t* table;
+  uint64_t* leaf_pt;
+  uint64_t* superframe;
+  uint64_t leaf;
+  uint64_t frame;
+  uint64_t i;
+
+  // returns 1 if all pages in range of the root PDE of page are mapped
+  // and their page frames are copied into a superframe, 0 otherwise
+
+  // assert: get_parent(context) == MY_CONTEXT
+
+  if (PAGETABLETREE == 0)
+    return 0;
+  else if (is_boot_level_zero() == 0)
+    // on higher boot levels, superframes are virtual memory of the hosting
+    // selfie which caches page tables page by page anyway, so promoting
+    // would only cost another superframe of memory
+    return 0;
+
+  table = get_pt(context);
+
+  leaf_pt = (uint64_t*) *(table + root_PDE_offset(page));
+
+  if (leaf_pt == (uint64_t*) 0)
+    return 0;
+  else if (is_superpage_PDE((uint64_t) leaf_pt))
+    return 0;
+
+  leaf = NUMBEROFLEAFPTES;
+
+  // sequential heap faults map ranges from beginning up,
+  // so unmapped pages are usually found at the end of the range
+  while (leaf > 0) {
+    leaf = leaf - 1;
+
+    if (*(leaf_pt + leaf) == 0)
+      return 0;
+  }
+
+  superframe = palloc_superframe();
+
+  if (superframe == (uint64_t*) 0)
+    return 0;
+
+  page = page - leaf_PTE_offset(page);
+
+  while (leaf < NUMBEROFLEAFPTES) {
+    frame = *(leaf_pt + leaf);
+
+    i = 0;
+
+    while (i < PAGEFRAMESIZE / sizeof(uint64_t)) {
+      *(superframe + leaf * (PAGEFRAMESIZE / sizeof(uint64_t)) + i) = *((uint64_t*) frame + i);
+
+      i = i + 1;
+    }
+
+    // page frames shared copy-on-write remain mapped in other page tables
+    release_page_frame(frame);
+
+    invalidate_TLB_entry(table, page + leaf);
+
+    leaf = leaf + 1;
+  }
+
+  *(table + root_PDE_offset(page)) = (uint64_t) superframe + 1;
+
+  pfree(leaf_pt);
+
+  // released page frames and leaf page table may be cached in PWC
+  flush_PWC();
+
+  // released page frames may also be cached in page tables of hosted contexts
+  recache_hosted_contexts(context);
+
+  // cache blocks of released page frames must not survive their reuse,
+  // assert: caches were written back when the kernel took over
+  flush_all_caches();
+
+  // assert: copied pages have the same content, predecoded code remains valid
+
+  set_lowest_lo_page(context, lowest_page(page, get_lowest_lo_page(context)));
+  set_highest_lo_page(context, highest_page(page + NUMBEROFLEAFPTES - 1, get_highest_lo_page(context)));
+
+  // overflow page log to cache superpage as page range
+  set_logged_pages(context, get_logged_pages(context) + NUMBEROFLEAFPTES);
+
+  promoted_superpages = promoted_superpages + 1;
+
+  if (debug_map)
+    printf("%s: superpage 0x%04lX promoted to superframe 0x%08lX in context %s\n", selfie_name,
+      page, (uint64_t) superframe, get_name(context));
+
+  return 1;
+}
+
+uint64_t* get_frame_bucket(uint64_t frame) {
+  if (shared_frame_table == (uint64_t*) 0)
+    shared_frame_table = zmalloc(FRAMEBUCKETS * sizeof(uint64_t*));
+
+  return shared_frame_table + frame / PAGEFRAMESIZE % FRAMEBUCKETS;
+}
+
+uint64_t* find_shared_frame(uint64_t frame) {
+  uint64_t* entry;
+
+  entry = (uint64_t*) *(get_frame_bucket(frame));
+
+  while (entry != (uint64_t*) 0) {
+    if (get_shared_frame(entry) == frame)
+      return entry;
+
+    entry = get_next_shared_frame(entry);
+  }
+
+  return (uint64_t*) 0;
+}
+
+void share_page_frame(uint64_t frame) {
+  uint64_t* bucket;
+  uint64_t* entry;
+
+  entry = find_shared_frame(frame);
+
+  if (entry == (uint64_t*) 0) {
+    if (free_shared_frames == (uint64_t*) 0)
+      entry = smalloc(3 * sizeof(uint64_t));
+    else {
+      entry = free_shared_frames;
+
+      free_shared_frames = get_next_shared_frame(free_shared_frames);
+    }
+
+    bucket = get_frame_bucket(frame);
+
+    set_next_shared_frame(entry, (uint64_t*) *bucket);
+    set_shared_frame(entry, frame);
+
+    // page frame is mapped in its original page table and one more
+    set_frame_sharers(entry, 2);
+
+    *bucket = (uint64_t) entry;
+
+    shared_page_frames = shared_page_frames + 1;
+  } else
+    set_frame_sharers(entry, get_frame_sharers(entry) + 1);
+}
+
+void unshare_page_frame(uint64_t* entry) {
+  uint64_t* bucket;
+  uint64_t* previous;
+
+  set_frame_sharers(entry, get_frame_sharers(entry) - 1);
+
+  if (get_frame_sharers(entry) == 1) {
+    // last page table mapping page frame owns it exclusively again
+    bucket = get_frame_bucket(get_shared_frame(entry));
+
+    if ((uint64_t*) *bucket == entry)
+      *bucket = (uint64_t) get_next_shared_frame(entry);
+    else {
+      previous = (uint64_t*) *bucket;
+
+      while (get_next_shared_frame(previous) != entry)
+        previous = get_next_shared_frame(previous);
+
+      set_next_shared_frame(previous, get_next_shared_frame(entry));
+    }
+
+    set_next_shared_frame(entry, free_shared_frames);
+
+    free_shared_frames = entry;
+
+    shared_page_frames = shared_page_frames - 1;
+  }
+}
+
+void release_page_frame(uint64_t frame) {
+  uint64_t* entry;
+
+  if (shared_page_frames > 0)
+    entry = find_shared_frame(frame);
+  else
+    entry = (uint64_t*) 0;
+
+  if (entry != (uint64_t*) 0)
+    // page frame remains mapped in other page tables
+    unshare_page_frame(entry);
+  else
+    pfree((uint64_t*) frame);
+}
+
+void copy_on_write(uint64_t* table, uint64_t page) {
+  uint64_t frame;
+  uint64_t* entry;
+  uint64_t* copy;
+  uint64_t i;
+
+  // assert: shared_page_frames > 0
+
+  frame = get_page_frame(table, page);
+
+  if (frame != 0) {
+    entry = find_shared_frame(frame);
+
+    if (entry != (uint64_t*) 0) {
+      // first write to shared page frame through table
+      copy = palloc();
+
+      i = 0;
+
+      while (i < PAGEFRAMESIZE / sizeof(uint64_t)) {
+        *(copy + i) = *((uint64_t*) frame + i);
+
+        i = i + 1;
+      }
+
+      unshare_page_frame(entry);
+
+      // assert: copy and frame have the same content, predecoded code remains valid
+      set_page_frame(table, page, (uint64_t) copy);
+
+      copied_page_frames = copied_page_frames + 1;
+    }
+  }
+}
+
+uint64_t* fork_context(uint64_t* context) {
+  uint64_t* child;
+  uint64_t* table;
+  uint64_t page;
+  uint64_t frame;
+  uint64_t r;
+
+  // assert: get_parent(context) == MY_CONTEXT
+
+  // forks have no virtual context of their own, so they are not hashed
+  // under the (parent, virtual context) key of the original, leaving
+  // find_context unambiguous
+  child = new_context();
+
+  init_context(child, get_parent(context), get_virtual_context(context));
+
+  set_pc(child, get_pc(context));
+
+  r = 0;
+
+  while (r < NUMBEROFREGISTERS) {
+    *(get_regs(child) + r) = *(get_regs(context) + r);
+
+    r = r + 1;
+  }
+
+  set_code_seg_start(child, get_code_seg_start(context));
+  set_code_seg_size(child, get_code_seg_size(context));
+  set_data_seg_start(child, get_data_seg_start(context));
+  set_data_seg_size(child, get_data_seg_size(context));
+  set_heap_seg_start(child, get_heap_seg_start(context));
+  set_program_break(child, get_program_break(context));
+
+  set_exception(child, get_exception(context));
+  set_fault(child, get_fault(context));
+  set_exit_code(child, get_exit_code(context));
+
+  set_name(child, get_name(context));
+
+  // the kernel garbage collector marks and frees objects through the
+  // metadata lists of a context, so the child gets its own copies
+  set_used_list_head(child, copy_metadata_list(child, get_used_list_head(context)));
+  set_free_list_head(child, copy_metadata_list(child, get_free_list_head(context)));
+  set_gcs_in_period(child, get_gcs_in_period(context));
+  set_use_gc_kernel(child, get_use_gc_kernel(context));
+
+  // share all mapped page frames read-only until first written
+
+  table = get_pt(context);
+
+  page = 0;
+
+  while (page < NUMBEROFPAGES) {
+    frame = walk_page_table(table, page);
+
+    if (frame != 0) {
+      share_page_frame(frame);
+
+      map_page(child, page, frame);
+    }
+
+    page = next_walked_page(table, page);
+  }
+
+  forked_contexts = forked_contexts + 1;
+
+  return child;
+}
+
+void reclaim_context(uint64_t* context) {
+  uint64_t* table;
+  uint64_t owns_frames;
+  uint64_t page;
+  uint64_t root;
+  uint64_t* leaf_pt;
+  uint64_t superpage;
+  uint64_t leaf;
+  uint64_t frame;
+  uint64_t reclaimed_roots;
+
+  table = get_pt(context);
+
+  // page frames of hosted contexts belong to their parent
+  // while their leaf page tables are cached on my boot level
+  if (get_parent(context) == MY_CONTEXT)
+    owns_frames = 1;
+  else
+    owns_frames = 0;
+
+  if (PAGETABLETREE == 0) {
+    if (owns_frames) {
+      page = 0;
+
+      while (page < NUMBEROFPAGES) {
+        if (*(table + page) != 0) {
+          release_page_frame(*(table + page));
+
+          set_page_frame(table, page, 0);
+        }
+
+        page = page + 1;
+      }
+    }
+  } else {
+    reclaimed_roots = 0;
+
+    root = 0;
+
+    while (root < NUMBEROFPAGES / NUMBEROFLEAFPTES) {
+      leaf_pt = (uint64_t*) *(table + root);
+
+      if (leaf_pt != (uint64_t*) 0) {
+        superpage = is_superpage_PDE((uint64_t) leaf_pt);
+
+        leaf = 0;
+
+        while (leaf < NUMBEROFLEAFPTES) {
+          if (superpage)
+            // page frames of superframe are reclaimed individually
+            frame = (uint64_t) leaf_pt - 1 + leaf * PAGEFRAMESIZE;
+          else
+            frame = *(leaf_pt + leaf);
+
+          if (frame != 0) {
+            if (owns_frames)
+              release_page_frame(frame);
+
+            invalidate_TLB_entry(table, root * NUMBEROFLEAFPTES + leaf);
+          }
+
+          leaf = leaf + 1;
+        }
+
+        // page tables shared by contexts, as in symbolic execution, are reclaimed once
+        *(table + root) = 0;
+
+        reclaimed_roots = 1;
+
+        if (superpage == 0)
+          pfree(leaf_pt);
+      }
+
+      root = root + 1;
+    }
+
+    if (reclaimed_roots)
+      // page tables in reclaimed page frames may be cached in PWC,
+      // flushed once before any reclaimed page frame is reused
+      flush_PWC();
+  }
+}
+
+void map_and_store(uint64_t* context, uint64_t vaddr, uint64_t data) {
+  // assert: is_virtual_address_valid(vaddr, WORDSIZE) == 1
+
+  if (is_virtual_address_mapped(get_pt(context), vaddr) == 0)
+    map_page(context, page_of_virtual_address(vaddr), (uint64_t) palloc());
+
+  store_virtual_memory(get_pt(context), vaddr, data);
+
+  if (is_code_address(context, vaddr))
+    // stores in the code segment invalidate predecoded instructions
+    invalidate_predecoded_code(context, vaddr, WORDSIZE);
+}
+
+void map_unmapped_pages(uint64_t* context) {
+  uint64_t page;
+
+  // assert: page table is only mapped from beginning up and end down
+
+  page = get_lowest_lo_page(context);
+
+  while (is_page_mapped(get_pt(context), page))
+    page = page + 1;
+
+  while (pavailable()) {
+    map_page(context, page, (uint64_t) palloc());
+
+    if (leaf_PTE_offset(page) == NUMBEROFLEAFPTES - 1)
+      // page frames of promoted superpage are reused for mapping more pages
+      promote_superpage(context, page);
+
+    page = page + 1;
+  }
+
+  // allowing more palloc for caching tree page tables
+  PHYSICALMEMORYEXCESS = PHYSICALMEMORYEXCESS + PAGEFRAMESIZE / PAGESIZE;
+}
+
+// -----------------------------------------------------------------
+// ---------------------------- KERNEL -----------------------------
+// -----------------------------------------------------------------
+
+void up_load_segment(uint64_t* context, uint64_t vaddr, uint64_t* binary, uint64_t size) {
+  uint64_t baddr;
+  uint64_t start;
+  uint64_t end;
+  uint64_t* paddr;
+
+  baddr = 0;
+
+  while (baddr < size) {
+    // map and translate only once per page
+    if (is_virtual_address_mapped(get_pt(context), vaddr + baddr) == 0)
+      map_page(context, page_of_virtual_address(vaddr + baddr), (uint64_t) palloc());
+
+    start = baddr;
+
+    // up to the end of the page or the segment
+    end = virtual_address_of_page(page_of_virtual_address(vaddr + baddr) + 1) - vaddr;
+
+    if (end > size)
+      end = size;
+
+    // words of a page are contiguous in its page frame
+    paddr = translate_virtual_to_physical(get_pt(context), vaddr + baddr);
+
+    while (baddr < end) {
+      store_physical_memory(paddr, load_word(binary, baddr, 1));
+
+      if (L1_CACHE_ENABLED)
+        snoop_caches(vaddr + baddr, (uint64_t) paddr);
+
+      baddr = baddr + WORDSIZE;
+      paddr = paddr + 1;
+    }
+
+    if (is_code_address(context, vaddr + start))
+      // stores in the code segment invalidate predecoded instructions
+      invalidate_predecoded_code(context, vaddr + start, baddr - start);
+  }
+}
+
+void up_load_binary(uint64_t* context) {
+  // assert: e_entry is multiple of PAGESIZE and INSTRUCTIONSIZE
+
+  set_pc(context, e_entry);
+
+  // setting up page table cache
+
+  set_lowest_lo_page(context, page_of_virtual_address(code_start));
+  set_highest_lo_page(context, get_lowest_lo_page(context));
+
+  // setting up memory segments
+
+  set_code_seg_start(context, code_start);
+  set_code_seg_size(context, code_size);
+  set_data_seg_start(context, data_start);
+  set_data_seg_size(context, data_size);
+  set_heap_seg_start(context, round_up(data_start + data_size, PAGESIZE));
+  set_program_break(context, get_heap_seg_start(context));
+
+  up_load_segment(context, get_code_seg_start(context), code_binary, code_size);
+  up_load_segment(context, get_data_seg_start(context), data_binary, data_size);
+}
+
+uint64_t up_load_string(uint64_t* context, char* s, uint64_t SP) {
+  uint64_t bytes;
+  uint64_t i;
+
+  bytes = round_up(string_length(s) + 1, WORDSIZE);
+
+  // allocate memory for storing string
+  SP = SP - bytes;
+
+  i = 0;
+
+  while (i < bytes) {
+    map_and_store(context, SP + i, load_word((uint64_t*) s, i, 1));
+
+    i = i + WORDSIZE;
+  }
+
+  return SP;
+}
+
+void up_load_arguments(uint64_t* context, uint64_t argc, uint64_t* argv) {
+  /* upload arguments like a UNIX system
+
+      SP
+      |
+      V
+   | argc | argv[0] | ... | argv[n] | 0 | env[0] | ... | env[m] | 0 |
+
+     with argc > 0, n == argc - 1, and m == 0 (that is, env is empty) */
+  uint64_t SP;
+  uint64_t* vargv;
+  uint64_t i;
+
+  // the call stack grows top down
+  SP = VIRTUALMEMORYSIZE * GIGABYTE;
+
+  vargv = smalloc(argc * sizeof(uint64_t*));
+
+  i = 0;
+
+  // push program parameters onto the stack
+  while (i < argc) {
+    SP = up_load_string(context, (char*) *(argv + i), SP);
+
+    // store pointer in virtual *argv
+    *(vargv + i) = SP;
+
+    i = i + 1;
+  }
+
+  // allocate memory for termination of env table
+  SP = SP - WORDSIZE;
+
+  // push null value to terminate env table
+  map_and_store(context, SP, 0);
+
+  // allocate memory for termination of argv table
+  SP = SP - WORDSIZE;
+
+  // push null value to terminate argv table
+  map_and_store(context, SP, 0);
+
+  // assert: i == argc
+
+  // push argv table onto the stack
+  while (i > 0) {
+    // allocate memory for argv table entry
+    SP = SP - WORDSIZE;
+
+    i = i - 1;
+
+    // push argv table entry
+    map_and_store(context, SP, *(vargv + i));
+  }
+
+  // allocate memory for argc
+  SP = SP - WORDSIZE;
+
+  // push argc
+  map_and_store(context, SP, argc);
+
+  // store stack pointer value in stack pointer register
+  *(get_regs(context) + REG_SP) = SP;
+
+  // initialize frame pointer register for completeness (redundant)
+  *(get_regs(context) + REG_S0) = 0;
+}
+
+char* replace_extension(char* filename, char* suffix, char* extension) {
+  char* s;
+  uint64_t i;
+  uint64_t c;
+  char* filename_without_extension;
+
+  // assert: string_length(filename) + string_length(suffix) + 1 + string_length(extension) < MAX_FILENAME_LENGTH
+
+  s = string_alloc(string_length(filename) + string_length(suffix) + 1 + string_length(extension));
+
+  // start reading at end of filename
+  i = string_length(filename);
+
+  c = 0;
+
+  // look for extension
+  while (c != '.') {
+    if (c == '/')
+      i = 0;
+
+    if (i > 0) {
+      i = i - 1;
+
+      c = load_character(filename, i);
+    } else
+      c = '.';
+  }
+
+  if (i == 0)
+    // filename has no extension
+    filename_without_extension = filename;
+  else {
+    filename_without_extension = string_alloc(i);
+
+    // assert: filename_without_extension is zeroed and thus null-terminated
 
-  context = new_context();
+    // copy filename without extension and null-terminator into filename_without_extension
+    while (i > 0) {
+      i = i - 1;
 
-  init_context(context, parent, vctxt);
+      store_character(filename_without_extension, i, load_character(filename, i));
+    }
+  }
 
-  if (debug_create)
-    printf("%s: parent context %s created child context %s\n", selfie_name,
-      get_name(parent), get_name(used_contexts));
+  // writing filename_without_extension with suffix dot extension into s
+  sprintf(s, "%s%s.%s", filename_without_extension, suffix, extension);
 
-  return context;
+  return s;
 }
 
-uint64_t* find_context(uint64_t* parent, uint64_t* vctxt) {
-  uint64_t* context;
+char* boot_level_prefix(char* s) {
+  uint64_t l;
+  char* t;
+  uint64_t i;
 
-  context = used_contexts;
+  l = string_length(s);
 
-  while (context != (uint64_t*) 0) {
-    if (get_parent(context) == parent)
-      if (get_virtual_context(context) == vctxt)
-        return context;
+  t = string_alloc(l);
 
-    context = get_next_context(context);
+  i = 0;
+
+  while (i < l) {
+    if (load_character(s, i) == '>') {
+      store_character(t, i, '>');
+
+      i = i + 1;
+    } else {
+      store_character(t, i, 0);
+
+      return t;
+    }
   }
 
-  return (uint64_t*) 0;
+  return t;
 }
 
-uint64_t* cache_context(uint64_t* vctxt) {
-  uint64_t* context;
+char* increment_boot_level_prefix(char* s, char* t) {
+  char* p;
+  char* u;
 
-  // find cached context on my boot level
-  context = find_context(current_context, vctxt);
+  p = boot_level_prefix(s);
 
-  if (context == (uint64_t*) 0)
-    // create cached context on my boot level
-    context = create_context(current_context, vctxt);
+  u = string_alloc(string_length(p) + 1 + 1 + string_length(t));
 
-  return context;
+  sprintf(u, "%s> %s", p, t);
+
+  return u;
 }
 
-void save_context(uint64_t* context) {
-  uint64_t* parent_table;
-  uint64_t* vctxt;
-  uint64_t r;
-  uint64_t* pregs;
-  uint64_t* vregs;
+void boot_loader(uint64_t* context) {
+  up_load_binary(context);
 
-  // save machine state
-  set_pc(context, pc);
+  set_name(context, increment_boot_level_prefix(selfie_name, binary_name));
 
-  if (get_parent(context) != MY_CONTEXT) {
-    // upload changes in context to virtual context in parent address space
-    parent_table = get_pt(get_parent(context));
+  // pass binary name as first argument by replacing next argument
+  set_argument(get_name(context));
 
-    vctxt = get_virtual_context(context);
+  up_load_arguments(context, number_of_remaining_arguments(), remaining_arguments());
+}
 
-    store_virtual_memory(parent_table, program_counter(vctxt), get_pc(context));
+uint64_t* find_indexed_frame(uint64_t frame) {
+  uint64_t* entry;
 
-    r = 0;
+  entry = (uint64_t*) *(frame_index_table + frame / PAGEFRAMESIZE % FRAMEBUCKETS);
 
-    pregs = get_regs(context);
-    vregs = (uint64_t*) load_virtual_memory(parent_table, regs(vctxt));
+  while (entry != (uint64_t*) 0) {
+    if (get_indexed_frame(entry) == frame)
+      return entry;
 
-    while (r < NUMBEROFREGISTERS) {
-      store_virtual_memory(parent_table, (uint64_t) (vregs + r), *(pregs + r));
+    entry = get_next_indexed_frame(entry);
+  }
 
-      r = r + 1;
-    }
+  return (uint64_t*) 0;
+}
 
-    store_virtual_memory(parent_table, program_break(vctxt), get_program_break(context));
+uint64_t index_page_frame(uint64_t frame) {
+  uint64_t* bucket;
+  uint64_t* entry;
 
-    store_virtual_memory(parent_table, exception(vctxt), get_exception(context));
-    store_virtual_memory(parent_table, fault(vctxt), get_fault(context));
-    store_virtual_memory(parent_table, exit_code(vctxt), get_exit_code(context));
+  entry = find_indexed_frame(frame);
 
-    // garbage collector state (only necessary if context is gced by different gcs)
+  if (entry == (uint64_t*) 0) {
+    // page frames mapped in more than one page table are checkpointed only once
+    entry = smalloc(2 * sizeof(uint64_t) + 2 * sizeof(uint64_t*));
 
-    store_virtual_memory(parent_table, used_list_head(vctxt), (uint64_t) get_used_list_head(context));
-    store_virtual_memory(parent_table, free_list_head(vctxt), (uint64_t) get_free_list_head(context));
-    store_virtual_memory(parent_table, gcs_in_period(vctxt), get_gcs_in_period(context));
-    store_virtual_memory(parent_table, use_gc_kernel(vctxt), get_use_gc_kernel(context));
-  }
+    bucket = frame_index_table + frame / PAGEFRAMESIZE % FRAMEBUCKETS;
 
-  set_ic_all(context, get_total_number_of_instructions() - get_ic_all(context));
+    set_next_indexed_frame(entry, (uint64_t*) *bucket);
+    set_indexed_frame(entry, frame);
+    set_frame_index(entry, indexed_frames);
+    set_frame_indexed_next(entry, (uint64_t*) 0);
 
-  // number of bytes currently allocated on stack
-  r = VIRTUALMEMORYSIZE * GIGABYTE - *(get_regs(context) + REG_SP);
+    *bucket = (uint64_t) entry;
 
-  if (r > get_mc_stack_peak(context))
-    // keep track of peak amount of stack allocation
-    set_mc_stack_peak(context, r);
-}
+    if (first_indexed_frame == (uint64_t*) 0)
+      first_indexed_frame = entry;
+    else
+      set_frame_indexed_next(last_indexed_frame, entry);
 
-uint64_t lowest_page(uint64_t page, uint64_t lo) {
-  if (page < lo)
-    return page;
-  else
-    return lo;
-}
+    last_indexed_frame = entry;
 
-uint64_t highest_page(uint64_t page, uint64_t hi) {
-  if (page >= hi)
-    // only lo <= page < hi will be cached
-    return page + 1;
-  else
-    return hi;
+    indexed_frames = indexed_frames + 1;
+  }
+
+  return get_frame_index(entry);
 }
 
-void map_page(uint64_t* context, uint64_t page, uint64_t frame) {
+uint64_t index_page_table(uint64_t* context) {
   uint64_t* table;
+  uint64_t page;
+  uint64_t frame;
+  uint64_t mapped;
 
   table = get_pt(context);
 
-  // assert: page is unmapped
+  mapped = 0;
 
-  set_page_frame(table, page, frame);
+  page = 0;
 
-  // exploit spatial locality in page table caching
-  if (page <= page_of_virtual_address(get_program_break(context) - WORDSIZE)) {
-    set_lowest_lo_page(context, lowest_page(page, get_lowest_lo_page(context)));
-    set_highest_lo_page(context, highest_page(page, get_highest_lo_page(context)));
-  } else {
-    set_lowest_hi_page(context, lowest_page(page, get_lowest_hi_page(context)));
-    set_highest_hi_page(context, highest_page(page, get_highest_hi_page(context)));
+  while (page < NUMBEROFPAGES) {
+    frame = walk_page_table(table, page);
+
+    if (frame != 0) {
+      index_page_frame(frame);
+
+      mapped = mapped + 1;
+    }
+
+    page = next_walked_page(table, page);
   }
 
-  if (debug_map)
-    printf("%s: page 0x%04lX mapped to frame 0x%08lX in context %s\n", selfie_name,
-      page, (uint64_t) frame, get_name(context));
+  return mapped;
 }
 
-void cache_page_table(uint64_t* context, uint64_t* table, uint64_t* parent_table, uint64_t lo, uint64_t hi) {
-  uint64_t PTE_address;
-  uint64_t frame;
+void write_checkpoint(uint64_t fd, uint64_t* buffer, uint64_t bytes) {
+  if (write(fd, buffer, bytes) != bytes) {
+    printf("%s: could not write into checkpoint file %s\n", selfie_name, checkpoint_name);
 
-  while (lo < hi) {
-    // PTE address of lo page in page table in parent address space
-    PTE_address = (uint64_t) get_PTE_address(parent_table, table, lo);
+    exit(EXITCODE_IOERROR);
+  }
+}
 
-    // PTEs in page table in parent address space may be unmapped
-    if (is_virtual_address_mapped(parent_table, PTE_address)) {
-      // page frame of lo page in parent address space
-      frame = load_virtual_memory(parent_table, PTE_address);
+void read_checkpoint(uint64_t fd, uint64_t* buffer, uint64_t bytes) {
+  if (read(fd, touch(buffer, bytes), bytes) != bytes) {
+    printf("%s: could not read from checkpoint file %s\n", selfie_name, restore_name);
 
-      // page may be unmapped even if PTE of page is mapped
-      if (frame != 0) {
-        // assert: page frame in parent address space is mapped
-        frame = get_page_frame(parent_table, page_of_virtual_address(frame));
+    exit(EXITCODE_IOERROR);
+  }
+}
 
-        map_page(context, lo, frame);
-      }
-    }
+void write_checkpoint_word(uint64_t fd, uint64_t word) {
+  *binary_buffer = word;
 
-    lo = lo + 1;
-  }
+  write_checkpoint(fd, binary_buffer, sizeof(uint64_t));
 }
 
-void restore_context(uint64_t* context) {
-  uint64_t* parent_table;
-  uint64_t* vctxt;
-  uint64_t r;
-  uint64_t* pregs;
-  uint64_t* vregs;
+uint64_t read_checkpoint_word(uint64_t fd) {
+  read_checkpoint(fd, binary_buffer, sizeof(uint64_t));
+
+  return *binary_buffer;
+}
+
+void write_page_table(uint64_t fd, uint64_t* context, uint64_t mapped) {
   uint64_t* table;
-  uint64_t lo;
-  uint64_t hi;
+  uint64_t* pages;
+  uint64_t* entries;
+  uint64_t page;
+  uint64_t frame;
 
-  if (get_parent(context) != MY_CONTEXT) {
-    // download changes in virtual context in parent address space to context
-    parent_table = get_pt(get_parent(context));
+  // page-indexed entries: page number followed by index of its page frame
+  pages = smalloc(mapped * 2 * sizeof(uint64_t));
 
-    vctxt = get_virtual_context(context);
+  entries = pages;
 
-    set_pc(context, load_virtual_memory(parent_table, program_counter(vctxt)));
+  table = get_pt(context);
 
-    r = 0;
+  page = 0;
 
-    pregs = get_regs(context);
-    vregs = (uint64_t*) load_virtual_memory(parent_table, regs(vctxt));
+  while (page < NUMBEROFPAGES) {
+    frame = walk_page_table(table, page);
 
-    while (r < NUMBEROFREGISTERS) {
-      *(pregs + r) = load_virtual_memory(parent_table, (uint64_t) (vregs + r));
+    if (frame != 0) {
+      *entries       = page;
+      *(entries + 1) = get_frame_index(find_indexed_frame(frame));
 
-      r = r + 1;
+      entries = entries + 2;
     }
 
-    set_program_break(context, load_virtual_memory(parent_table, program_break(vctxt)));
+    page = next_walked_page(table, page);
+  }
 
-    set_exception(context, load_virtual_memory(parent_table, exception(vctxt)));
-    set_fault(context, load_virtual_memory(parent_table, fault(vctxt)));
+  write_checkpoint_word(fd, mapped);
 
-    set_exit_code(context, load_virtual_memory(parent_table, exit_code(vctxt)));
+  if (mapped > 0)
+    write_checkpoint(fd, pages, mapped * 2 * sizeof(uint64_t));
+}
 
-    table = (uint64_t*) load_virtual_memory(parent_table, page_table(vctxt));
+void read_page_table(uint64_t fd, uint64_t* context, uint64_t* frames, uint64_t* mapped_frames) {
+  uint64_t mapped;
+  uint64_t* pages;
+  uint64_t index;
 
-    // assert: virtual context page table is only mapped from beginning up and end down
+  mapped = read_checkpoint_word(fd);
 
-    lo = load_virtual_memory(parent_table, lowest_lo_page(vctxt));
-    hi = load_virtual_memory(parent_table, highest_lo_page(vctxt));
+  if (mapped > 0) {
+    pages = smalloc(mapped * 2 * sizeof(uint64_t));
 
-    cache_page_table(context, table, parent_table, lo, hi);
+    read_checkpoint(fd, pages, mapped * 2 * sizeof(uint64_t));
 
-    store_virtual_memory(parent_table, lowest_lo_page(vctxt), hi);
+    while (mapped > 0) {
+      index = *(pages + 1);
 
-    lo = load_virtual_memory(parent_table, lowest_hi_page(vctxt));
-    hi = load_virtual_memory(parent_table, highest_hi_page(vctxt));
+      if (get_parent(context) == MY_CONTEXT) {
+        // page frames mapped in more than one context on my boot level are shared copy-on-write
+        if (*(mapped_frames + index))
+          share_page_frame(*(frames + index));
+        else
+          *(mapped_frames + index) = 1;
+      }
 
-    cache_page_table(context, table, parent_table, lo, hi);
+      map_page(context, *pages, *(frames + index));
 
-    store_virtual_memory(parent_table, highest_hi_page(vctxt), lo);
+      pages  = pages + 2;
+      mapped = mapped - 1;
+    }
+  }
+}
 
-    // garbage collector state (only necessary if context is gced by different gcs)
+uint64_t context_index(uint64_t* context) {
+  uint64_t* c;
+  uint64_t index;
 
-    set_used_list_head(context, (uint64_t*) load_virtual_memory(parent_table, used_list_head(vctxt)));
-    set_free_list_head(context, (uint64_t*) load_virtual_memory(parent_table, free_list_head(vctxt)));
-    set_gcs_in_period(context, load_virtual_memory(parent_table, gcs_in_period(vctxt)));
-    set_use_gc_kernel(context, load_virtual_memory(parent_table, use_gc_kernel(vctxt)));
-  }
+  if (context == MY_CONTEXT)
+    return 0;
 
-  // restore machine state
-  pc        = get_pc(context);
-  registers = get_regs(context);
-  pt        = get_pt(context);
+  // contexts are checkpointed from least to most recently created
+  index = 0;
 
-  flush_all_caches();
+  c = context;
 
-  set_ic_all(context, get_total_number_of_instructions() - get_ic_all(context));
-}
+  while (c != (uint64_t*) 0) {
+    index = index + 1;
 
-uint64_t pavailable() {
-  if (free_page_frame_memory > 0)
-    return 1;
-  else if (allocated_page_frame_memory + MEGABYTE <= PHYSICALMEMORYSIZE * PHYSICALMEMORYEXCESS)
-    return 1;
-  else
-    return 0;
-}
+    c = get_next_context(c);
+  }
 
-uint64_t pused() {
-  return allocated_page_frame_memory - free_page_frame_memory;
+  return index;
 }
 
-uint64_t* palloc() {
-  uint64_t block;
-  uint64_t frame;
-
-  // assert: PHYSICALMEMORYSIZE is equal to or a multiple of MEGABYTE
-  // assert: PAGEFRAMESIZE is a factor of MEGABYTE strictly less than MEGABYTE
+void checkpoint_contexts(uint64_t* to_context) {
+  uint64_t fd;
+  uint64_t* context;
+  uint64_t number_of_contexts;
+  uint64_t* oldest;
+  uint64_t* entry;
+  uint64_t priority;
 
-  if (free_page_frame_memory == 0) {
-    if (pavailable()) {
-      // single word on 32-bit target occupies double word on 64-bit system
-      free_page_frame_memory = MEGABYTE * (PAGEFRAMESIZE / PAGESIZE);
+  // assert: all contexts are saved and to_context is scheduled to run next
 
-      // on boot level 0 allocate zeroed memory
-      block = (uint64_t) zmalloc(free_page_frame_memory);
+  fd = open_write_only(checkpoint_name, S_IRUSR_IWUSR_IRGRP_IROTH);
 
-      allocated_page_frame_memory = allocated_page_frame_memory + free_page_frame_memory;
+  if (signed_less_than(fd, 0)) {
+    printf("%s: could not create checkpoint file %s\n", selfie_name, checkpoint_name);
 
-      // page frames must be PAGEFRAMESIZE-aligned in memory
-      next_page_frame = round_up(block, PAGEFRAMESIZE);
+    exit(EXITCODE_IOERROR);
+  }
 
-      if (next_page_frame > block)
-        // losing one page frame to alignment
-        free_page_frame_memory = free_page_frame_memory - PAGEFRAMESIZE;
-    } else {
-      printf("%s: palloc out of physical memory\n", selfie_name);
+  frame_index_table = zmalloc(FRAMEBUCKETS * sizeof(uint64_t*));
 
-      exit(EXITCODE_OUTOFPHYSICALMEMORY);
-    }
-  }
+  first_indexed_frame = (uint64_t*) 0;
+  last_indexed_frame  = (uint64_t*) 0;
 
-  frame = next_page_frame;
+  indexed_frames = 0;
 
-  next_page_frame = next_page_frame + PAGEFRAMESIZE;
+  number_of_contexts = 0;
 
-  free_page_frame_memory = free_page_frame_memory - PAGEFRAMESIZE;
+  oldest = (uint64_t*) 0;
 
-  // strictly, touching is only necessary on boot levels higher than 0
-  return touch((uint64_t*) frame, PAGEFRAMESIZE);
-}
+  context = used_contexts;
 
-void pfree(uint64_t* frame) {
-  // TODO: implement free list of page frames
-  frame = frame + 1;
-}
+  while (context != (uint64_t*) 0) {
+    index_page_table(context);
 
-void map_and_store(uint64_t* context, uint64_t vaddr, uint64_t data) {
-  // assert: is_virtual_address_valid(vaddr, WORDSIZE) == 1
+    number_of_contexts = number_of_contexts + 1;
 
-  if (is_virtual_address_mapped(get_pt(context), vaddr) == 0)
-    map_page(context, page_of_virtual_address(vaddr), (uint64_t) palloc());
+    if (get_next_context(context) == (uint64_t*) 0)
+      oldest = context;
 
-  store_virtual_memory(get_pt(context), vaddr, data);
-}
+    context = get_next_context(context);
+  }
 
-void map_unmapped_pages(uint64_t* context) {
-  uint64_t page;
+  write_checkpoint_word(fd, CHECKPOINTMAGIC);
+  write_checkpoint_word(fd, WORDSIZE);
+  write_checkpoint_word(fd, PAGEFRAMESIZE);
+  write_checkpoint_word(fd, get_total_number_of_instructions());
+  write_checkpoint_word(fd, schedules);
+  write_checkpoint_word(fd, code_start);
+  write_checkpoint_word(fd, code_size);
+  write_checkpoint_word(fd, data_start);
+  write_checkpoint_word(fd, data_size);
+  write_checkpoint_word(fd, number_of_contexts);
+  write_checkpoint_word(fd, indexed_frames);
+  write_checkpoint_word(fd, context_index(to_context));
 
-  // assert: page table is only mapped from beginning up and end down
+  write_checkpoint_word(fd, string_length(binary_name));
+  write_checkpoint(fd, (uint64_t*) binary_name, string_length(binary_name));
 
-  page = get_lowest_lo_page(context);
+  // page frames are written once, in the order they were indexed
 
-  while (is_page_mapped(get_pt(context), page))
-    page = page + 1;
+  entry = first_indexed_frame;
 
-  while (pavailable()) {
-    map_page(context, page, (uint64_t) palloc());
+  while (entry != (uint64_t*) 0) {
+    write_checkpoint(fd, (uint64_t*) get_indexed_frame(entry), PAGEFRAMESIZE);
 
-    page = page + 1;
+    entry = get_frame_indexed_next(entry);
   }
 
-  // allowing more palloc for caching tree page tables
-  PHYSICALMEMORYEXCESS = PHYSICALMEMORYEXCESS + PAGEFRAMESIZE / PAGESIZE;
-}
-
-// -----------------------------------------------------------------
-// ---------------------------- KERNEL -----------------------------
-// -----------------------------------------------------------------
+  // parents are created before, and thus checkpointed before, their children
 
-void up_load_binary(uint64_t* context) {
-  uint64_t baddr;
+  context = oldest;
 
-  // assert: e_entry is multiple of PAGESIZE and INSTRUCTIONSIZE
+  while (context != (uint64_t*) 0) {
+    write_checkpoint_word(fd, context_index(get_parent(context)));
+    write_checkpoint_word(fd, (uint64_t) get_virtual_context(context));
 
-  set_pc(context, e_entry);
+    write_checkpoint_word(fd, get_pc(context));
+    write_checkpoint(fd, get_regs(context), NUMBEROFREGISTERS * sizeof(uint64_t));
 
-  // setting up page table cache
+    write_checkpoint_word(fd, get_code_seg_start(context));
+    write_checkpoint_word(fd, get_code_seg_size(context));
+    write_checkpoint_word(fd, get_data_seg_start(context));
+    write_checkpoint_word(fd, get_data_seg_size(context));
+    write_checkpoint_word(fd, get_heap_seg_start(context));
+    write_checkpoint_word(fd, get_program_break(context));
 
-  set_lowest_lo_page(context, page_of_virtual_address(code_start));
-  set_highest_lo_page(context, get_lowest_lo_page(context));
+    write_checkpoint_word(fd, get_exception(context));
+    write_checkpoint_word(fd, get_fault(context));
+    write_checkpoint_word(fd, get_exit_code(context));
 
-  // setting up memory segments
+    write_checkpoint_word(fd, (uint64_t) get_used_list_head(context));
+    write_checkpoint_word(fd, (uint64_t) get_free_list_head(context));
+    write_checkpoint_word(fd, get_gcs_in_period(context));
+    write_checkpoint_word(fd, get_use_gc_kernel(context));
 
-  set_code_seg_start(context, code_start);
-  set_code_seg_size(context, code_size);
-  set_data_seg_start(context, data_start);
-  set_data_seg_size(context, data_size);
-  set_heap_seg_start(context, round_up(data_start + data_size, PAGESIZE));
-  set_program_break(context, get_heap_seg_start(context));
+    write_checkpoint_word(fd, get_context_state(context));
+    write_checkpoint_word(fd, get_priority(context));
+    write_checkpoint_word(fd, get_time_slices(context));
 
-  baddr = 0;
+    write_checkpoint_word(fd, string_length(get_name(context)));
+    write_checkpoint(fd, (uint64_t*) get_name(context), string_length(get_name(context)));
 
-  while (baddr < code_size) {
-    map_and_store(context, get_code_seg_start(context) + baddr, load_code(baddr));
+    write_page_table(fd, context, index_page_table(context));
 
-    baddr = baddr + WORDSIZE;
+    context = get_prev_context(context);
   }
 
-  baddr = 0;
+  // ready queues in scheduling order
+
+  write_checkpoint_word(fd, number_of_ready_contexts);
+
+  priority = 0;
 
-  while (baddr < data_size) {
-    map_and_store(context, get_data_seg_start(context) + baddr, load_data(baddr));
+  while (priority < NUMBEROFPRIORITIES) {
+    context = (uint64_t*) *(ready_heads + priority);
 
-    baddr = baddr + WORDSIZE;
+    while (context != (uint64_t*) 0) {
+      write_checkpoint_word(fd, context_index(context));
+
+      context = get_next_ready(context);
+    }
+
+    priority = priority + 1;
   }
+
+  printf("%s: checkpointed %lu contexts with %lu page frames after %lu executed instructions into %s\n", selfie_name,
+    number_of_contexts,
+    indexed_frames,
+    get_total_number_of_instructions(),
+    checkpoint_name);
+
+  // checkpoint only once
+  checkpoint_name = (char*) 0;
 }
 
-uint64_t up_load_string(uint64_t* context, char* s, uint64_t SP) {
-  uint64_t bytes;
+uint64_t* restore_contexts(char* filename) {
+  uint64_t fd;
+  uint64_t instructions;
+  uint64_t number_of_contexts;
+  uint64_t number_of_frames;
+  uint64_t to_context;
+  uint64_t length;
+  uint64_t* frames;
+  uint64_t* mapped_frames;
+  uint64_t* contexts;
+  uint64_t* context;
+  uint64_t parent;
   uint64_t i;
 
-  bytes = round_up(string_length(s) + 1, WORDSIZE);
+  restore_name = filename;
 
-  // allocate memory for storing string
-  SP = SP - bytes;
+  // assert: restore_name is mapped and not longer than MAX_FILENAME_LENGTH
 
-  i = 0;
+  fd = open_read_only(restore_name);
 
-  while (i < bytes) {
-    map_and_store(context, SP + i, load_word((uint64_t*) s, i, 1));
+  if (signed_less_than(fd, 0)) {
+    printf("%s: could not open checkpoint file %s\n", selfie_name, restore_name);
 
-    i = i + WORDSIZE;
+    exit(EXITCODE_IOERROR);
   }
 
-  return SP;
-}
+  if (read_checkpoint_word(fd) != CHECKPOINTMAGIC) {
+    printf("%s: %s is not a checkpoint file\n", selfie_name, restore_name);
 
-void up_load_arguments(uint64_t* context, uint64_t argc, uint64_t* argv) {
-  /* upload arguments like a UNIX system
+    exit(EXITCODE_IOERROR);
+  } else if (read_checkpoint_word(fd) != WORDSIZE) {
+    printf("%s: checkpoint file %s is for a different target\n", selfie_name, restore_name);
 
-      SP
-      |
-      V
-   | argc | argv[0] | ... | argv[n] | 0 | env[0] | ... | env[m] | 0 |
+    exit(EXITCODE_IOERROR);
+  } else if (read_checkpoint_word(fd) != PAGEFRAMESIZE) {
+    printf("%s: checkpoint file %s is for a different host\n", selfie_name, restore_name);
 
-     with argc > 0, n == argc - 1, and m == 0 (that is, env is empty) */
-  uint64_t SP;
-  uint64_t* vargv;
-  uint64_t i;
+    exit(EXITCODE_IOERROR);
+  }
 
-  // the call stack grows top down
-  SP = VIRTUALMEMORYSIZE * GIGABYTE;
+  instructions = read_checkpoint_word(fd);
 
-  vargv = smalloc(argc * sizeof(uint64_t*));
+  schedules = read_checkpoint_word(fd);
 
-  i = 0;
+  code_start = read_checkpoint_word(fd);
+  code_size  = read_checkpoint_word(fd);
+  data_start = read_checkpoint_word(fd);
+  data_size  = read_checkpoint_word(fd);
 
-  // push program parameters onto the stack
-  while (i < argc) {
-    SP = up_load_string(context, (char*) *(argv + i), SP);
+  // source profile is indexed by code of restored binary
+  reset_source_profile();
 
-    // store pointer in virtual *argv
-    *(vargv + i) = SP;
+  i = 0;
+
+  // registers of restored contexts were written before checkpointing
+  while (i < NUMBEROFREGISTERS) {
+    if (*(writes_per_register + i) == 0)
+      *(writes_per_register + i) = 1;
 
     i = i + 1;
   }
 
-  // allocate memory for termination of env table
-  SP = SP - WORDSIZE;
-
-  // push null value to terminate env table
-  map_and_store(context, SP, 0);
-
-  // allocate memory for termination of argv table
-  SP = SP - WORDSIZE;
-
-  // push null value to terminate argv table
-  map_and_store(context, SP, 0);
+  number_of_contexts = read_checkpoint_word(fd);
+  number_of_frames   = read_checkpoint_word(fd);
 
-  // assert: i == argc
+  to_context = read_checkpoint_word(fd);
 
-  // push argv table onto the stack
-  while (i > 0) {
-    // allocate memory for argv table entry
-    SP = SP - WORDSIZE;
+  length = read_checkpoint_word(fd);
 
-    i = i - 1;
+  binary_name = string_alloc(length);
 
-    // push argv table entry
-    map_and_store(context, SP, *(vargv + i));
-  }
+  read_checkpoint(fd, (uint64_t*) binary_name, length);
 
-  // allocate memory for argc
-  SP = SP - WORDSIZE;
+  // read page frames directly into newly allocated page frames
 
-  // push argc
-  map_and_store(context, SP, argc);
+  frames        = smalloc(number_of_frames * sizeof(uint64_t));
+  mapped_frames = zmalloc(number_of_frames * sizeof(uint64_t));
 
-  // store stack pointer value in stack pointer register
-  *(get_regs(context) + REG_SP) = SP;
+  i = 0;
 
-  // initialize frame pointer register for completeness (redundant)
-  *(get_regs(context) + REG_S0) = 0;
-}
+  while (i < number_of_frames) {
+    if (pavailable() == 0) {
+      printf("%s: checkpoint file %s does not fit into %luMB physical memory\n", selfie_name,
+        restore_name,
+        PHYSICALMEMORYSIZE / MEGABYTE);
 
-char* replace_extension(char* filename, char* suffix, char* extension) {
-  char* s;
-  uint64_t i;
-  uint64_t c;
-  char* filename_without_extension;
+      exit(EXITCODE_OUTOFPHYSICALMEMORY);
+    }
 
-  // assert: string_length(filename) + string_length(suffix) + 1 + string_length(extension) < MAX_FILENAME_LENGTH
+    *(frames + i) = (uint64_t) palloc();
 
-  s = string_alloc(string_length(filename) + string_length(suffix) + 1 + string_length(extension));
+    read_checkpoint(fd, (uint64_t*) *(frames + i), PAGEFRAMESIZE);
 
-  // start reading at end of filename
-  i = string_length(filename);
+    i = i + 1;
+  }
 
-  c = 0;
+  // context index 0 is my context
 
-  // look for extension
-  while (c != '.') {
-    if (c == '/')
-      i = 0;
+  contexts = smalloc((number_of_contexts + 1) * sizeof(uint64_t*));
 
-    if (i > 0) {
-      i = i - 1;
+  *contexts = (uint64_t) MY_CONTEXT;
 
-      c = load_character(filename, i);
-    } else
-      c = '.';
-  }
+  i = 1;
 
-  if (i == 0)
-    // filename has no extension
-    filename_without_extension = filename;
-  else {
-    filename_without_extension = string_alloc(i);
+  while (i <= number_of_contexts) {
+    context = new_context();
 
-    // assert: filename_without_extension is zeroed and thus null-terminated
+    init_context(context, MY_CONTEXT, (uint64_t*) 0);
 
-    // copy filename without extension and null-terminator into filename_without_extension
-    while (i > 0) {
-      i = i - 1;
+    parent = read_checkpoint_word(fd);
 
-      store_character(filename_without_extension, i, load_character(filename, i));
-    }
-  }
+    set_parent(context, (uint64_t*) *(contexts + parent));
+    set_virtual_context(context, (uint64_t*) read_checkpoint_word(fd));
 
-  // writing filename_without_extension with suffix dot extension into s
-  sprintf(s, "%s%s.%s", filename_without_extension, suffix, extension);
+    if (parent != 0)
+      // registers and state are synced with virtual context when switching to context
+      set_synced_state(context, smalloc((NUMBEROFREGISTERS + SYNCEDFIELDS) * sizeof(uint64_t)));
 
-  return s;
-}
+    hash_context(context);
 
-char* boot_level_prefix(char* s) {
-  uint64_t l;
-  char* t;
-  uint64_t i;
+    set_pc(context, read_checkpoint_word(fd));
+    read_checkpoint(fd, get_regs(context), NUMBEROFREGISTERS * sizeof(uint64_t));
 
-  l = string_length(s);
+    set_code_seg_start(context, read_checkpoint_word(fd));
+    set_code_seg_size(context, read_checkpoint_word(fd));
+    set_data_seg_start(context, read_checkpoint_word(fd));
+    set_data_seg_size(context, read_checkpoint_word(fd));
+    set_heap_seg_start(context, read_checkpoint_word(fd));
+    set_program_break(context, read_checkpoint_word(fd));
 
-  t = string_alloc(l);
+    set_exception(context, read_checkpoint_word(fd));
+    set_fault(context, read_checkpoint_word(fd));
+    set_exit_code(context, read_checkpoint_word(fd));
 
-  i = 0;
+    set_used_list_head(context, (uint64_t*) read_checkpoint_word(fd));
+    set_free_list_head(context, (uint64_t*) read_checkpoint_word(fd));
+    set_gcs_in_period(context, read_checkpoint_word(fd));
+    set_use_gc_kernel(context, read_checkpoint_word(fd));
 
-  while (i < l) {
-    if (load_character(s, i) == '>') {
-      store_character(t, i, '>');
+    set_context_state(context, read_checkpoint_word(fd));
+    set_priority(context, read_checkpoint_word(fd));
+    set_time_slices(context, read_checkpoint_word(fd));
 
-      i = i + 1;
-    } else {
-      store_character(t, i, 0);
+    length = read_checkpoint_word(fd);
 
-      return t;
-    }
-  }
+    set_name(context, string_alloc(length));
 
-  return t;
-}
+    read_checkpoint(fd, (uint64_t*) get_name(context), length);
 
-char* increment_boot_level_prefix(char* s, char* t) {
-  char* p;
-  char* u;
+    read_page_table(fd, context, frames, mapped_frames);
 
-  p = boot_level_prefix(s);
+    *(contexts + i) = (uint64_t) context;
 
-  u = string_alloc(string_length(p) + 1 + 1 + string_length(t));
+    i = i + 1;
+  }
 
-  sprintf(u, "%s> %s", p, t);
+  // ready queues in scheduling order
 
-  return u;
-}
+  i = read_checkpoint_word(fd);
 
-void boot_loader(uint64_t* context) {
-  up_load_binary(context);
+  while (i > 0) {
+    enqueue_context((uint64_t*) *(contexts + read_checkpoint_word(fd)));
 
-  set_name(context, increment_boot_level_prefix(selfie_name, binary_name));
+    i = i - 1;
+  }
 
-  // pass binary name as first argument by replacing next argument
-  set_argument(get_name(context));
+  printf("%s: restored %lu contexts with %lu page frames after %lu executed instructions from %s\n", selfie_name,
+    number_of_contexts,
+    number_of_frames,
+    instructions,
+    restore_name);
 
-  up_load_arguments(context, number_of_remaining_arguments(), remaining_arguments());
+  return (uint64_t*) *(contexts + to_context);
 }
 
 uint64_t handle_system_call(uint64_t* context) {
@@ -11771,12 +15577,16 @@ uint64_t handle_page_fault(uint64_t* context) {
   page = get_fault(context);
 
   if (pavailable()) {
-    // TODO: reuse frames
     map_page(context, page, (uint64_t) palloc());
 
-    if (is_heap_address(context, virtual_address_of_page(page)))
+    if (is_heap_address(context, virtual_address_of_page(page))) {
+      // each heap page is accounted once, before and after promotion
       set_mc_mapped_heap(context, get_mc_mapped_heap(context) + PAGESIZE);
 
+      // promote range of sequential heap faults once all its pages are mapped
+      promote_superpage(context, page);
+    }
+
     return DONOTEXIT;
   } else {
     printf("%s: page fault at 0x%lX out of physical memory\n", selfie_name, page);
@@ -11848,16 +15658,30 @@ uint64_t mipster(uint64_t* to_context) {
 
     if (get_parent(from_context) != MY_CONTEXT) {
       // dispatch exception handling to parent
+      block_context(from_context);
+
       to_context = get_parent(from_context);
 
       timeout = TIMEROFF;
-    } else if (handle_exception(from_context) == EXIT)
-      return get_exit_code(from_context);
-    else {
-      // TODO: scheduler should go here
-      to_context = from_context;
+    } else {
+      account_context(from_context);
+
+      if (handle_exception(from_context) == EXIT)
+        exit_context(from_context);
+      else
+        ready_context(from_context);
+
+      to_context = schedule();
+
+      if (to_context == (uint64_t*) 0)
+        // all contexts on my boot level exited
+        return get_exit_code(from_context);
 
       timeout = TIMESLICE;
+
+      if (checkpoint_name != (char*) 0)
+        if (get_total_number_of_instructions() >= checkpoint_instructions)
+          checkpoint_contexts(to_context);
     }
   }
 }
@@ -11868,11 +15692,18 @@ uint64_t hypster(uint64_t* to_context) {
   while (1) {
     from_context = hypster_switch(to_context, TIMESLICE);
 
+    account_context(from_context);
+
     if (handle_exception(from_context) == EXIT)
-      return get_exit_code(from_context);
+      exit_context(from_context);
     else
-      // TODO: scheduler should go here
-      to_context = from_context;
+      ready_context(from_context);
+
+    to_context = schedule();
+
+    if (to_context == (uint64_t*) 0)
+      // all contexts on my boot level exited
+      return get_exit_code(from_context);
   }
 }
 
@@ -11909,14 +15740,24 @@ uint64_t mixter(uint64_t* to_context, uint64_t mix) {
 
     if (get_parent(from_context) != MY_CONTEXT) {
       // dispatch exception handling to parent
+      block_context(from_context);
+
       to_context = get_parent(from_context);
 
       timeout = TIMEROFF;
-    } else if (handle_exception(from_context) == EXIT)
-      return get_exit_code(from_context);
-    else {
-      // TODO: scheduler should go here
-      to_context = from_context;
+    } else {
+      account_context(from_context);
+
+      if (handle_exception(from_context) == EXIT)
+        exit_context(from_context);
+      else
+        ready_context(from_context);
+
+      to_context = schedule();
+
+      if (to_context == (uint64_t*) 0)
+        // all contexts on my boot level exited
+        return get_exit_code(from_context);
 
       if (mix) {
         if (mslice != TIMESLICE) {
@@ -11944,6 +15785,8 @@ uint64_t minmob(uint64_t* to_context) {
 
     if (get_parent(from_context) != MY_CONTEXT) {
       // dispatch exception handling to parent
+      block_context(from_context);
+
       to_context = get_parent(from_context);
 
       timeout = TIMEROFF;
@@ -11955,11 +15798,20 @@ uint64_t minmob(uint64_t* to_context) {
         println();
 
         return EXITCODE_UNCAUGHTEXCEPTION;
-      } else if (handle_exception(from_context) == EXIT)
-        return get_exit_code(from_context);
+      }
+
+      account_context(from_context);
 
-      // TODO: scheduler should go here
-      to_context = from_context;
+      if (handle_exception(from_context) == EXIT)
+        exit_context(from_context);
+      else
+        ready_context(from_context);
+
+      to_context = schedule();
+
+      if (to_context == (uint64_t*) 0)
+        // all contexts on my boot level exited
+        return get_exit_code(from_context);
 
       timeout = TIMESLICE;
     }
@@ -11984,11 +15836,14 @@ uint64_t mobster(uint64_t* to_context) {
 uint64_t selfie_run(uint64_t machine) {
   uint64_t exit_code;
 
-  if (code_size == 0) {
-    printf("%s: nothing to run, debug, or host\n", selfie_name);
+  if (code_size == 0)
+    if (restore_name == (char*) 0) {
+      printf("%s: nothing to run, debug, or host\n", selfie_name);
 
-    return EXITCODE_BADARGUMENTS;
-  } else if (machine == HYPSTER) {
+      return EXITCODE_BADARGUMENTS;
+    }
+
+  if (machine == HYPSTER) {
     if (OS != SELFIE) {
       printf("%s: hypster only runs on mipster\n", selfie_name);
 
@@ -12011,6 +15866,12 @@ uint64_t selfie_run(uint64_t machine) {
 
     L1_CACHE_ENABLED = 1;
 
+    machine = MIPSTER;
+  } else if (machine == FASTER) {
+    // superinstructions bypass fetch, load, and store tracing
+    if (trace_name == (char*) 0)
+      fast = 1;
+
     machine = MIPSTER;
   }
 
@@ -12020,14 +15881,22 @@ uint64_t selfie_run(uint64_t machine) {
 
   init_memory(atoi(peek_argument(0)));
 
-  current_context = create_context(MY_CONTEXT, 0);
+  if (restore_name != (char*) 0)
+    // remaining arguments are already in restored memory
+    current_context = restore_contexts(restore_name);
+  else {
+    current_context = create_context(MY_CONTEXT, 0);
 
-  // assert: number_of_remaining_arguments() > 0
+    // assert: number_of_remaining_arguments() > 0
 
-  boot_loader(current_context);
+    boot_loader(current_context);
+  }
 
   // current_context is ready to run
 
+  if (trace_name != (char*) 0)
+    open_trace();
+
   run = 1;
 
   printf("%s: %lu-bit %s executing %lu-bit RISC-U binary %s with %luMB physical memory", selfie_name,
@@ -12076,10 +15945,27 @@ uint64_t selfie_run(uint64_t machine) {
     binary_name,
     sign_extend(exit_code, SYSCALL_BITWIDTH));
 
-  print_profile();
+  if (tracing)
+    close_trace();
+
+  if (fast)
+    printf("%s: summary: %lu executed instructions in total, %lu(%lu.%.2lu%%) fused into %lu superinstructions\n", selfie_name,
+      get_total_number_of_instructions(),
+      fused_instructions,
+      percentage_format_integral_2(get_total_number_of_instructions(), fused_instructions),
+      percentage_format_fractional_2(get_total_number_of_instructions(), fused_instructions),
+      superinstructions);
+  else
+    print_profile();
 
   run = 0;
 
+  fast = 0;
+
+  checkpoint_name = (char*) 0;
+  restore_name    = (char*) 0;
+  trace_name      = (char*) 0;
+
   record = 0;
 
   debug_syscalls = 0;
@@ -12182,7 +16068,45 @@ uint64_t selfie(uint64_t extras) {
         selfie_disassemble(1);
       else if (string_compare(argument, "-l"))
         selfie_load(get_argument());
-      else if (extras == 0) {
+      else if (string_compare(argument, "-checkpoint")) {
+        checkpoint_name = get_argument();
+
+        if (number_of_remaining_arguments() == 0)
+          return EXITCODE_BADARGUMENTS;
+
+        checkpoint_instructions = atoi(get_argument());
+      } else if (string_compare(argument, "-restore"))
+        restore_name = get_argument();
+      else if (string_compare(argument, "-trace"))
+        trace_name = get_argument();
+      else if (string_compare(argument, "-sweep")) {
+        sweep_min_size = atoi(get_argument());
+
+        if (number_of_remaining_arguments() == 0)
+          return EXITCODE_BADARGUMENTS;
+
+        sweep_max_size = atoi(get_argument());
+
+        if (is_power_of_two(sweep_min_size) == 0)
+          return EXITCODE_BADARGUMENTS;
+        else if (is_power_of_two(sweep_max_size) == 0)
+          return EXITCODE_BADARGUMENTS;
+        else if (sweep_min_size > sweep_max_size)
+          return EXITCODE_BADARGUMENTS;
+      } else if (string_compare(argument, "-replacement")) {
+        cache_replacement = parse_replacement_policy(get_argument());
+
+        if (cache_replacement == UINT64_MAX)
+          return EXITCODE_BADARGUMENTS;
+      } else if (string_compare(argument, "-scheduler")) {
+        SCHEDULER = parse_scheduling_policy(get_argument());
+
+        if (SCHEDULER == UINT64_MAX)
+          return EXITCODE_BADARGUMENTS;
+      } else if (string_compare(argument, "-exclusive")) {
+        // applies to L2 and L3 caches of -L2 and -L3
+        cache_inclusion = CACHE_EXCLUSIVE;
+      } else if (extras == 0) {
         if (string_compare(argument, "-m"))
           return selfie_run(MIPSTER);
         else if (string_compare(argument, "-d"))
@@ -12197,6 +16121,17 @@ uint64_t selfie(uint64_t extras) {
           return selfie_run(MOBSTER);
         else if (string_compare(argument, "-L1"))
           return selfie_run(CAPSTER);
+        else if (string_compare(argument, "-L2")) {
+          L2_CACHE_ENABLED = 1;
+
+          return selfie_run(CAPSTER);
+        } else if (string_compare(argument, "-L3")) {
+          L2_CACHE_ENABLED = 1;
+          L3_CACHE_ENABLED = 1;
+
+          return selfie_run(CAPSTER);
+        } else if (string_compare(argument, "-mfast"))
+          return selfie_run(FASTER);
         else
           return EXITCODE_BADARGUMENTS;
       } else
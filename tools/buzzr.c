@@ -156,6 +156,9 @@ void implement_buzzed_read(uint64_t* context) {
     if (is_virtual_address_valid(vbuffer, WORDSIZE))
       if (is_data_stack_heap_address(context, vbuffer))
         if (is_virtual_address_mapped(get_pt(context), vbuffer)) {
+          if (shared_page_frames > 0)
+            copy_on_write(get_pt(context), page_of_virtual_address(vbuffer));
+
           buffer = translate_virtual_to_physical(get_pt(context), vbuffer);
 
           actually_read = buzz_read(buffer, bytes_to_read);
@@ -268,7 +271,6 @@ uint64_t handle_buzzed_page_fault(uint64_t* context) {
 
   page = get_fault(context);
 
-  // TODO: reuse frames
   if (pavailable()) {
     map_page(context, page, (uint64_t) palloc());
 
@@ -347,6 +349,7 @@ uint64_t buzzr(uint64_t* to_context) {
 }
 
 uint64_t selfie_buzz() {
+  uint64_t* booted_context;
   uint64_t keep_buzzing;
   uint64_t exit_code;
 
@@ -373,19 +376,28 @@ uint64_t selfie_buzz() {
 
       TIMESLICE = 10000000;
 
-      keep_buzzing = 1;
+      booted_context = create_context(MY_CONTEXT, 0);
 
-      while (keep_buzzing) {
-        current_context = create_context(MY_CONTEXT, 0);
+      // assert: number_of_remaining_arguments() > 0
 
-        // assert: number_of_remaining_arguments() > 0
+      // boot only once, booted_context is never run
+      boot_loader(booted_context);
 
-        boot_loader(current_context);
+      keep_buzzing = 1;
+
+      while (keep_buzzing) {
+        // share page frames of booted context until written
+        current_context = fork_context(booted_context);
 
         // current_context is ready to run
 
         exit_code = buzzr(current_context);
 
+        // reuse page frames copied on write by buzzed context in next run
+        reclaim_context(current_context);
+
+        used_contexts = delete_context(current_context, used_contexts);
+
         if (number_of_buzzed_inputs == 0) {
           printf("%s: unbuzzed %lu-bit RISC-U binary %s terminating with exit code %ld\n", selfie_name,
             WORDSIZEINBITS,
@@ -410,6 +422,10 @@ uint64_t selfie_buzz() {
 
       printf("%s: <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<\n", selfie_name);
 
+      printf("%s: %lu runs forked from booted context with %lu page frames copied on write\n", selfie_name,
+        forked_contexts,
+        copied_page_frames);
+
       run = 0;
 
       printf("%s: ################################################################################\n", selfie_name);
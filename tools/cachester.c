@@ -0,0 +1,361 @@
+/*
+Copyright (c) the Selfie Project authors. All rights reserved.
+Please see the AUTHORS file for details. Use of this source code is
+governed by a BSD license that can be found in the LICENSE file.
+
+Selfie is a project of the Computational Systems Group at the
+Department of Computer Sciences of the University of Salzburg
+in Austria. For further information and code please refer to:
+
+selfie.cs.uni-salzburg.at
+
+Cachester replays memory-access traces recorded by mipster with the
+-trace option through any number of cache configurations without
+emulating the traced execution again. Instruction fetches are fed
+to instruction caches, loads and stores to data caches.
+
+Cachester uses the cache code of selfie. All caches are physically
+indexed and only track which cache blocks they hold, just like the
+caches of a cache sweep in selfie. Replays are deterministic since
+even random replacement uses a fixed seed per cache. Note that kernel
+stores, which bypass the caches, are not traced. Miss counts may
+therefore differ slightly from the L1 caches of the traced execution.
+
+Cachester is written in C* and thus runs natively as well as on
+mipster. See selfie's Makefile for details on how to build it.
+*/
+
+// -----------------------------------------------------------------
+// --------------------------- CACHESTER ---------------------------
+// -----------------------------------------------------------------
+
+void add_replay_cache(uint64_t stream, uint64_t* cache);
+uint64_t add_replay_configuration(uint64_t stream);
+
+uint64_t parse_replay_arguments();
+
+void replay_access(uint64_t type, uint64_t paddr);
+void replay_record(uint64_t record);
+void replay_trace_file();
+
+void print_replay_profile();
+
+uint64_t selfie_replay_trace();
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+uint64_t REPLAY_INSTRUCTIONS = 0;
+uint64_t REPLAY_DATA         = 1;
+
+uint64_t MAXREPLAYCACHES = 1024;
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+char* replay_trace_name = (char*) 0;
+
+uint64_t* replay_caches  = (uint64_t*) 0; // pointers to caches fed by the trace
+uint64_t* replay_streams = (uint64_t*) 0; // instruction or data stream of each cache
+
+uint64_t number_of_replay_caches = 0;
+
+uint64_t* replayed_addresses = (uint64_t*) 0; // previous physical address of each type
+uint64_t* replayed_accesses  = (uint64_t*) 0; // number of replayed accesses of each type
+
+// -----------------------------------------------------------------
+// --------------------------- CACHESTER ---------------------------
+// -----------------------------------------------------------------
+
+void add_replay_cache(uint64_t stream, uint64_t* cache) {
+  if (number_of_replay_caches == MAXREPLAYCACHES) {
+    printf("%s: more than %lu cache configurations\n", selfie_name, MAXREPLAYCACHES);
+
+    exit(EXITCODE_BADARGUMENTS);
+  }
+
+  *(replay_caches + number_of_replay_caches)  = (uint64_t) cache;
+  *(replay_streams + number_of_replay_caches) = stream;
+
+  number_of_replay_caches = number_of_replay_caches + 1;
+}
+
+uint64_t add_replay_configuration(uint64_t stream) {
+  uint64_t cache_size;
+  uint64_t associativity;
+  uint64_t cache_block_size;
+  uint64_t* cache;
+
+  if (number_of_remaining_arguments() < 3)
+    return EXITCODE_BADARGUMENTS;
+
+  cache_size       = atoi(get_argument());
+  associativity    = atoi(get_argument());
+  cache_block_size = atoi(get_argument());
+
+  // cache indexing requires powers of two
+  if (is_power_of_two(cache_size) == 0)
+    return EXITCODE_BADARGUMENTS;
+  else if (is_power_of_two(associativity) == 0)
+    return EXITCODE_BADARGUMENTS;
+  else if (is_power_of_two(cache_block_size) == 0)
+    return EXITCODE_BADARGUMENTS;
+  else if (associativity * cache_block_size > cache_size)
+    // each cache has at least one set
+    return EXITCODE_BADARGUMENTS;
+
+  cache = allocate_cache();
+
+  init_cache(cache, cache_size, associativity, cache_block_size, CACHE_WRITE_THROUGH, 0);
+
+  add_replay_cache(stream, cache);
+
+  return EXITCODE_NOERROR;
+}
+
+uint64_t parse_replay_arguments() {
+  uint64_t exit_code;
+  uint64_t i;
+
+  if (number_of_remaining_arguments() == 0)
+    return EXITCODE_NOARGUMENTS;
+
+  replay_trace_name = get_argument();
+
+  replay_caches  = smalloc(MAXREPLAYCACHES * sizeof(uint64_t*));
+  replay_streams = smalloc(MAXREPLAYCACHES * sizeof(uint64_t));
+
+  while (number_of_remaining_arguments() > 0) {
+    get_argument();
+
+    exit_code = EXITCODE_NOERROR;
+
+    if (number_of_remaining_arguments() == 0)
+      // all options have at least one argument
+      return EXITCODE_BADARGUMENTS;
+    else if (string_compare(argument, "-replacement")) {
+      // applies to all caches configured after this option
+      cache_replacement = parse_replacement_policy(get_argument());
+
+      if (cache_replacement == UINT64_MAX)
+        return EXITCODE_BADARGUMENTS;
+    } else if (string_compare(argument, "-i"))
+      exit_code = add_replay_configuration(REPLAY_INSTRUCTIONS);
+    else if (string_compare(argument, "-d"))
+      exit_code = add_replay_configuration(REPLAY_DATA);
+    else if (string_compare(argument, "-sweep")) {
+      sweep_min_size = atoi(get_argument());
+
+      if (number_of_remaining_arguments() == 0)
+        return EXITCODE_BADARGUMENTS;
+
+      sweep_max_size = atoi(get_argument());
+
+      if (is_power_of_two(sweep_min_size) == 0)
+        return EXITCODE_BADARGUMENTS;
+      else if (is_power_of_two(sweep_max_size) == 0)
+        return EXITCODE_BADARGUMENTS;
+      else if (sweep_min_size > sweep_max_size)
+        return EXITCODE_BADARGUMENTS;
+
+      init_sweep_caches();
+
+      i = 0;
+
+      while (i < number_of_sweep_caches) {
+        add_replay_cache(REPLAY_DATA, (uint64_t*) *(sweep_caches + i));
+
+        i = i + 1;
+      }
+    } else
+      return EXITCODE_BADARGUMENTS;
+
+    if (exit_code != EXITCODE_NOERROR)
+      return exit_code;
+  }
+
+  if (number_of_replay_caches == 0)
+    return EXITCODE_BADARGUMENTS;
+
+  return EXITCODE_NOERROR;
+}
+
+void replay_access(uint64_t type, uint64_t paddr) {
+  uint64_t stream;
+  uint64_t i;
+
+  if (type == TRACE_FETCH)
+    stream = REPLAY_INSTRUCTIONS;
+  else
+    stream = REPLAY_DATA;
+
+  i = 0;
+
+  while (i < number_of_replay_caches) {
+    if (*(replay_streams + i) == stream)
+      access_sweep_cache((uint64_t*) *(replay_caches + i), paddr);
+
+    i = i + 1;
+  }
+}
+
+void replay_record(uint64_t record) {
+  uint64_t type;
+  uint64_t paddr;
+
+  type   = record % TRACE_TYPES;
+  record = record / TRACE_TYPES;
+
+  // undo zigzag encoding of signed delta
+  if (record % 2 == 0)
+    paddr = *(replayed_addresses + type) + record / 2;
+  else
+    paddr = *(replayed_addresses + type) - (record + 1) / 2;
+
+  *(replayed_addresses + type) = paddr;
+  *(replayed_accesses + type)  = *(replayed_accesses + type) + 1;
+
+  replay_access(type, paddr);
+}
+
+void replay_trace_file() {
+  uint64_t fd;
+  uint64_t* buffer;
+  uint64_t number_of_bytes;
+  uint64_t cursor;
+  uint64_t b;
+  uint64_t record;
+  uint64_t weight;
+
+  fd = open_read_only(replay_trace_name);
+
+  if (signed_less_than(fd, 0)) {
+    printf("%s: could not open trace file %s\n", selfie_name, replay_trace_name);
+
+    exit(EXITCODE_IOERROR);
+  }
+
+  if (read(fd, binary_buffer, sizeof(uint64_t)) != sizeof(uint64_t)) {
+    printf("%s: could not read from trace file %s\n", selfie_name, replay_trace_name);
+
+    exit(EXITCODE_IOERROR);
+  } else if (*binary_buffer != TRACEMAGIC) {
+    printf("%s: %s is not a trace file\n", selfie_name, replay_trace_name);
+
+    exit(EXITCODE_IOERROR);
+  }
+
+  replayed_addresses = zmalloc(TRACE_TYPES * sizeof(uint64_t));
+  replayed_accesses  = zmalloc(TRACE_TYPES * sizeof(uint64_t));
+
+  // buffer must be fully mapped for read syscalls on mipster
+  buffer = touch(smalloc(TRACEBUFFERSIZE), TRACEBUFFERSIZE);
+
+  record = 0;
+  weight = 1;
+
+  number_of_bytes = read(fd, buffer, TRACEBUFFERSIZE);
+
+  // stream through trace one buffer at a time
+  while (signed_less_than(0, number_of_bytes)) {
+    cursor = 0;
+
+    while (cursor < number_of_bytes) {
+      b = get_bits(*(buffer + cursor / sizeof(uint64_t)), (cursor % sizeof(uint64_t)) * 8, 8);
+
+      // varint decoding of record
+      if (b >= 128) {
+        record = record + (b - 128) * weight;
+        weight = weight * 128;
+      } else {
+        replay_record(record + b * weight);
+
+        record = 0;
+        weight = 1;
+      }
+
+      cursor = cursor + 1;
+    }
+
+    number_of_bytes = read(fd, buffer, TRACEBUFFERSIZE);
+  }
+
+  if (weight != 1) {
+    printf("%s: trace file %s ends with incomplete record\n", selfie_name, replay_trace_name);
+
+    exit(EXITCODE_IOERROR);
+  }
+}
+
+void print_replay_profile() {
+  uint64_t i;
+  uint64_t* cache;
+
+  printf("%s: replayed %lu fetches, %lu loads, and %lu stores from %s\n", selfie_name,
+    *(replayed_accesses + TRACE_FETCH),
+    *(replayed_accesses + TRACE_LOAD),
+    *(replayed_accesses + TRACE_STORE),
+    replay_trace_name);
+
+  printf("%s: --------------------------------------------------------------------------------\n", selfie_name);
+  printf("%s: caches:        size,ways,block(replacement):accesses,hits,misses\n", selfie_name);
+
+  i = 0;
+
+  while (i < number_of_replay_caches) {
+    cache = (uint64_t*) *(replay_caches + i);
+
+    if (*(replay_streams + i) == REPLAY_INSTRUCTIONS)
+      sprintf(string_buffer, "instruction:   %lu,%lu,%lu(%s): ", get_cache_size(cache),
+        get_associativity(cache), get_cache_block_size(cache),
+        replacement_policy_name(get_replacement_policy(cache)));
+    else
+      sprintf(string_buffer, "data:          %lu,%lu,%lu(%s): ", get_cache_size(cache),
+        get_associativity(cache), get_cache_block_size(cache),
+        replacement_policy_name(get_replacement_policy(cache)));
+
+    print_cache_profile(get_cache_hits(cache), get_cache_misses(cache), string_buffer);
+    println();
+
+    i = i + 1;
+  }
+}
+
+uint64_t selfie_replay_trace() {
+  uint64_t exit_code;
+
+  exit_code = parse_replay_arguments();
+
+  if (exit_code != EXITCODE_NOERROR)
+    return exit_code;
+
+  replay_trace_file();
+
+  print_replay_profile();
+
+  return EXITCODE_NOERROR;
+}
+
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+// -----------------------------------------------------------------
+// ----------------------------   M A I N   ------------------------
+// -----------------------------------------------------------------
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+
+int main(int argc, char** argv) {
+  uint64_t exit_code;
+
+  init_selfie((uint64_t) argc, (uint64_t*) argv);
+
+  init_library();
+
+  exit_code = selfie_replay_trace();
+
+  if (exit_code == EXITCODE_NOARGUMENTS) {
+    printf("%s trace [ -replacement ( lru | plru | fifo | random ) ] ( ( -i | -d ) size ways block | -sweep min max ) ...\n",
+      selfie_name);
+
+    exit_code = EXITCODE_NOERROR;
+  } else if (exit_code == EXITCODE_BADARGUMENTS)
+    printf("%s: bad cache configuration\n", selfie_name);
+
+  return exit_code;
+}
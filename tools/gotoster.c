@@ -0,0 +1,325 @@
+/*
+Copyright (c) the Selfie Project authors. All rights reserved.
+Please see the AUTHORS file for details. Use of this source code is
+governed by a BSD license that can be found in the LICENSE file.
+
+Selfie is a project of the Computational Systems Group at the
+Department of Computer Sciences of the University of Salzburg
+in Austria. For further information and code please refer to:
+
+selfie.cs.uni-salzburg.at
+
+Gotoster is mipster with threaded dispatch. Instead of comparing
+the ID of each instruction with up to 14 instruction IDs in the
+if-else chain of execute(), gotoster jumps through a table of
+labels indexed by instruction ID directly to the handler of the
+instruction. Each handler fetches the next instruction and jumps
+to its handler on its own so that the host branch predictor sees
+one indirect jump per handler rather than a single shared one.
+
+Gotoster executes the exact same instructions, exceptions, and timer
+interrupts as mipster, and profiles them the same way as well, which
+makes the two directly comparable with make bench-dispatch.
+
+Unlike the other tools, gotoster is not written in C* since it uses
+labels as values, a GNU C extension also supported by clang. It
+therefore cannot be self-compiled by selfie, and selfie itself
+keeps dispatching with the if-else chain to remain in C*.
+
+*/
+
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+// -----------------------------------------------------------------
+// -------------------     I N T E R F A C E     -------------------
+// -----------------------------------------------------------------
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+
+// -----------------------------------------------------------------
+// --------------------------- GOTOSTER ----------------------------
+// -----------------------------------------------------------------
+
+uint64_t execute_budget_threaded(uint64_t budget);
+
+void run_threaded_until_exception();
+
+uint64_t* gotoster_switch(uint64_t* to_context, uint64_t timeout);
+
+uint64_t gotoster(uint64_t* to_context);
+
+uint64_t selfie_goto();
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+// size of the label table: 0 is reserved for unknown instructions,
+// followed by the IDs of all RISC-U instructions from LUI to ECALL
+#define LABELS 15
+
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+// -----------------------------------------------------------------
+// ----------------------    R U N T I M E    ----------------------
+// -----------------------------------------------------------------
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+
+// -----------------------------------------------------------------
+// --------------------------- GOTOSTER ----------------------------
+// -----------------------------------------------------------------
+
+// after executing an instruction, stop on trap or when the budget
+// is used up, and otherwise fetch the next instruction and jump to
+// its handler, just like the loop in execute_budget
+#define DISPATCH \
+  if (trap) \
+    return executed; \
+  executed = executed + 1; \
+  if (executed >= budget) \
+    return executed; \
+  fetch_predecoded(); \
+  goto *labels[is]
+
+uint64_t execute_budget_threaded(uint64_t budget) {
+  static void* labels[LABELS];
+
+  uint64_t executed;
+
+  // instruction IDs are variables in selfie, so the
+  // label table is initialized on the first invocation
+  if (labels[0] == (void*) 0) {
+    labels[0]     = &&unknown;
+    labels[LUI]   = &&lui;
+    labels[ADDI]  = &&addi;
+    labels[ADD]   = &&add;
+    labels[SUB]   = &&sub;
+    labels[MUL]   = &&mul;
+    labels[DIVU]  = &&divu;
+    labels[REMU]  = &&remu;
+    labels[SLTU]  = &&sltu;
+    labels[LOAD]  = &&load;
+    labels[STORE] = &&store;
+    labels[BEQ]   = &&beq;
+    labels[JAL]   = &&jal;
+    labels[JALR]  = &&jalr;
+    labels[ECALL] = &&ecall;
+  }
+
+  if (debug)
+    // recording and debugging remain in execute()
+    return execute_budget(budget);
+
+  executed = 0;
+
+  if (budget == 0)
+    return executed;
+
+  fetch_predecoded();
+
+  // assert: 0 <= is <= ECALL
+  goto *labels[is];
+
+unknown:
+  // unknown instructions already trapped in decode
+  DISPATCH;
+lui:
+  do_lui();
+  DISPATCH;
+addi:
+  do_addi();
+  DISPATCH;
+add:
+  do_add();
+  DISPATCH;
+sub:
+  do_sub();
+  DISPATCH;
+mul:
+  do_mul();
+  DISPATCH;
+divu:
+  do_divu();
+  DISPATCH;
+remu:
+  do_remu();
+  DISPATCH;
+sltu:
+  do_sltu();
+  DISPATCH;
+load:
+  do_load();
+  DISPATCH;
+store:
+  do_store();
+  DISPATCH;
+beq:
+  do_beq();
+  DISPATCH;
+jal:
+  do_jal();
+  DISPATCH;
+jalr:
+  do_jalr();
+  DISPATCH;
+ecall:
+  do_ecall();
+  DISPATCH;
+}
+
+void run_threaded_until_exception() {
+  uint64_t executed;
+
+  trap = 0;
+
+  while (trap == 0) {
+    // same as run_until_exception but with threaded dispatch
+    if (timer == TIMEROFF)
+      executed = execute_budget_threaded(UINT64_MAX);
+    else {
+      executed = execute_budget_threaded(timer - 1);
+
+      if (switched == 0)
+        // assert: timer > executed
+        timer = timer - executed;
+    }
+
+    if (trap == 0) {
+      fetch_predecoded();
+      execute();
+    }
+
+    interrupt();
+  }
+
+  trap = 0;
+
+  write_back_all_caches();
+}
+
+uint64_t* gotoster_switch(uint64_t* to_context, uint64_t timeout) {
+  restore_context(to_context);
+
+  do_switch(to_context, timeout);
+
+  run_threaded_until_exception();
+
+  save_context(current_context);
+
+  return current_context;
+}
+
+uint64_t gotoster(uint64_t* to_context) {
+  uint64_t timeout;
+  uint64_t* from_context;
+
+  timeout = TIMESLICE;
+
+  while (1) {
+    from_context = gotoster_switch(to_context, timeout);
+
+    if (get_parent(from_context) != MY_CONTEXT) {
+      // dispatch exception handling to parent
+      block_context(from_context);
+
+      to_context = get_parent(from_context);
+
+      timeout = TIMEROFF;
+    } else {
+      account_context(from_context);
+
+      if (handle_exception(from_context) == EXIT)
+        exit_context(from_context);
+      else
+        ready_context(from_context);
+
+      to_context = schedule();
+
+      if (to_context == (uint64_t*) 0)
+        // all contexts on my boot level exited
+        return get_exit_code(from_context);
+
+      timeout = TIMESLICE;
+    }
+  }
+}
+
+uint64_t selfie_goto() {
+  uint64_t exit_code;
+
+  if (string_compare(argument, "-")) {
+    if (number_of_remaining_arguments() > 0) {
+      if (code_size == 0) {
+        printf("%s: nothing to run\n", selfie_name);
+
+        return EXITCODE_BADARGUMENTS;
+      } else if (ECALL >= LABELS) {
+        printf("%s: gotoster label table too small for %lu instructions\n", selfie_name, ECALL);
+
+        return EXITCODE_BADARGUMENTS;
+      }
+
+      reset_interpreter();
+      reset_profiler();
+      reset_microkernel();
+
+      init_memory(atoi(peek_argument(0)));
+
+      current_context = create_context(MY_CONTEXT, 0);
+
+      // assert: number_of_remaining_arguments() > 0
+
+      boot_loader(current_context);
+
+      // current_context is ready to run
+
+      run = 1;
+
+      printf("%s: %lu-bit gotoster executing %lu-bit RISC-U binary %s with %luMB physical memory\n", selfie_name,
+        SIZEOFUINT64INBITS,
+        WORDSIZEINBITS,
+        binary_name,
+        PHYSICALMEMORYSIZE / MEGABYTE);
+      printf("%s: >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\n\n", selfie_name);
+
+      exit_code = gotoster(current_context);
+
+      printf("\n%s: <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<\n", selfie_name);
+
+      printf("%s: %lu-bit gotoster terminating %lu-bit RISC-U binary %s with exit code %ld\n", selfie_name,
+        SIZEOFUINT64INBITS,
+        WORDSIZEINBITS,
+        binary_name,
+        sign_extend(exit_code, SYSCALL_BITWIDTH));
+
+      print_profile();
+
+      run = 0;
+
+      printf("%s: ################################################################################\n", selfie_name);
+
+      return exit_code;
+    } else
+      return EXITCODE_BADARGUMENTS;
+  } else
+    return EXITCODE_BADARGUMENTS;
+}
+
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+// -----------------------------------------------------------------
+// ----------------------------   M A I N   ------------------------
+// -----------------------------------------------------------------
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+
+int main(int argc, char** argv) {
+  uint64_t exit_code;
+
+  init_selfie((uint64_t) argc, (uint64_t*) argv);
+
+  init_library();
+  init_system();
+  init_target();
+  init_kernel();
+
+  exit_code = selfie(1);
+
+  if (exit_code == EXITCODE_MOREARGUMENTS)
+    exit_code = selfie_goto();
+
+  return exit_selfie(exit_code, " - ...");
+}
@@ -0,0 +1,600 @@
+/*
+Copyright (c) the Selfie Project authors. All rights reserved.
+Please see the AUTHORS file for details. Use of this source code is
+governed by a BSD license that can be found in the LICENSE file.
+
+Selfie is a project of the Computational Systems Group at the
+Department of Computer Sciences of the University of Salzburg
+in Austria. For further information and code please refer to:
+
+selfie.cs.uni-salzburg.at
+
+Hartster is mipster on multiple harts (hardware threads) where each
+hart is emulated by its own host thread. Hartster boots one context
+per hart, all with the same console arguments, and then lets the
+harts pick ready contexts from the ready queue of one shared kernel,
+for throughput with many guest processes.
+
+Hartster uses selfie-mt.h, a version of selfie in which the machine
+state, that is, the global variables of the architecture part, the
+instruction counters, and the current context, is thread-local. All
+other global variables, in particular the contexts, the ready queue,
+and the page frames, are shared by all harts. Harts execute code
+without any locking but enter the kernel, to switch contexts and to
+handle exceptions, only while holding the kernel lock. Page frames
+are allocated from one pool shared by all harts which is protected
+by its own lock, independently of the kernel lock.
+
+In addition to RISC-U, hartster executes the load-reserved (lr.d)
+and store-conditional (sc.d) instructions of the RISC-V A extension
+atomically across harts. Selfie does not generate these instructions
+but binaries that do, for example, for thread-safe memory allocation
+or lock-free data structures, run on hartster. A store-conditional
+succeeds if the word still contains the value loaded by the previous
+load-reserved on the same hart, using an atomic compare-and-swap on
+the host, and fails if the hart switched contexts in between.
+
+Unlike the other tools, hartster is not written in C* since it uses
+pthreads and thread-local variables, and cannot be self-compiled by
+selfie. Hartster only runs 64-bit RISC-U code and supports neither
+the debugger, tracing, caches, nor the garbage collector.
+
+*/
+
+#include <pthread.h>
+
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+// -----------------------------------------------------------------
+// -------------------     I N T E R F A C E     -------------------
+// -----------------------------------------------------------------
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+
+// -----------------------------------------------------------------
+// ---------------------------- ATOMICS ----------------------------
+// -----------------------------------------------------------------
+
+uint64_t is_atomic_instruction();
+void     execute_atomic();
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+uint64_t OP_AMO = 47; // 0101111, R format (LR, SC)
+
+uint64_t F3_AMO_D = 3; // 011
+
+uint64_t F5_LR = 2; // 00010
+uint64_t F5_SC = 3; // 00011
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+// thread-local, reservation of the most recent lr.d of the hart
+
+__thread uint64_t* reserved_word  = (uint64_t*) 0; // physical address of reserved word, 0 if none
+__thread uint64_t  reserved_value = 0;             // value of reserved word loaded by lr.d
+
+__thread uint64_t ic_lr = 0;
+__thread uint64_t ic_sc = 0;
+
+__thread uint64_t failed_sc = 0; // number of store-conditionals that failed
+
+// -----------------------------------------------------------------
+// ------------------------- PAGE FRAMES ---------------------------
+// -----------------------------------------------------------------
+
+uint64_t* palloc();
+void      pfree(uint64_t* frame);
+
+uint64_t* palloc_superframe();
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+pthread_mutex_t frame_lock = PTHREAD_MUTEX_INITIALIZER; // protects page frame pool of all harts
+
+// -----------------------------------------------------------------
+// ---------------------------- HARTSTER ---------------------------
+// -----------------------------------------------------------------
+
+void implement_switch();
+
+void flush_TLB();
+
+void run_hart_until_exception();
+
+uint64_t* hart_switch(uint64_t* to_context, uint64_t timeout);
+
+uint64_t* schedule_hart();
+
+void* hart(void* id);
+
+uint64_t hartster();
+
+uint64_t selfie_harts();
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+uint64_t MAXHARTS = 256;
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+pthread_mutex_t kernel_lock     = PTHREAD_MUTEX_INITIALIZER; // held by harts while in the kernel
+pthread_cond_t  ready_condition = PTHREAD_COND_INITIALIZER;  // signaled when contexts may have become ready
+
+uint64_t number_of_harts = 0;
+
+uint64_t hart_megabytes = 0; // physical memory shared by all harts
+
+uint64_t running_harts = 0; // number of harts executing code outside the kernel
+
+uint64_t hart_exit_code = 0; // exit code of first context exiting with non-zero exit code
+
+uint64_t* hart_instructions = (uint64_t*) 0; // number of instructions executed by each hart
+uint64_t* hart_atomics      = (uint64_t*) 0; // number of lr.d, sc.d, and failed sc.d executed by each hart
+
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+// -----------------------------------------------------------------
+// ----------------------    R U N T I M E    ----------------------
+// -----------------------------------------------------------------
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+
+// -----------------------------------------------------------------
+// ---------------------------- ATOMICS ----------------------------
+// -----------------------------------------------------------------
+
+uint64_t is_atomic_instruction() {
+  // lr.d and sc.d are unknown to selfie and trap in decode
+  if (get_exception(current_context) == EXCEPTION_UNKNOWNINSTRUCTION)
+    if (get_opcode(ir) == OP_AMO)
+      if (get_funct3(ir) == F3_AMO_D) {
+        // ignore acquire and release bits, harts are sequentially consistent
+        if (get_funct7(ir) / 4 == F5_LR)
+          return get_rs2(ir) == REG_ZR;
+        else if (get_funct7(ir) / 4 == F5_SC)
+          return 1;
+      }
+
+  return 0;
+}
+
+void execute_atomic() {
+  uint64_t vaddr;
+  uint64_t* paddr;
+  uint64_t expected;
+  uint64_t failed;
+
+  // assert: is_atomic_instruction() == 1
+
+  set_exception(current_context, EXCEPTION_NOEXCEPTION);
+  set_fault(current_context, 0);
+
+  decode_r_format();
+
+  vaddr = *(registers + rs1);
+
+  // same checks as do_load and do_store, the latter for sc.d,
+  // re-executing the instruction after handling the exception
+  if (is_virtual_address_valid(vaddr, WORDSIZE) == 0)
+    throw_exception(EXCEPTION_INVALIDADDRESS, vaddr);
+  else if (is_data_stack_heap_address(current_context, vaddr) == 0)
+    throw_exception(EXCEPTION_SEGMENTATIONFAULT, vaddr);
+  else if (is_virtual_address_mapped(pt, vaddr) == 0)
+    throw_exception(EXCEPTION_PAGEFAULT, page_of_virtual_address(vaddr));
+  else {
+    paddr = translate_virtual_to_physical(pt, vaddr);
+
+    if (get_funct7(ir) / 4 == F5_LR) {
+      reserved_word  = paddr;
+      reserved_value = __atomic_load_n(paddr, __ATOMIC_SEQ_CST);
+
+      if (rd != REG_ZR)
+        *(registers + rd) = reserved_value;
+
+      ic_lr = ic_lr + 1;
+    } else {
+      failed = 1;
+
+      if (reserved_word == paddr) {
+        if (shared_page_frames > 0) {
+          // page frames shared copy-on-write are copied
+          // before the first store, as in store_virtual_memory
+          pthread_mutex_lock(&kernel_lock);
+
+          copy_on_write(pt, page_of_virtual_address(vaddr));
+
+          pthread_mutex_unlock(&kernel_lock);
+
+          paddr = translate_virtual_to_physical(pt, vaddr);
+        }
+
+        expected = reserved_value;
+
+        // fails if any hart stored a different value in the meantime
+        if (__atomic_compare_exchange_n(paddr, &expected, *(registers + rs2), 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+          failed = 0;
+      }
+
+      // any sc.d ends the reservation
+      reserved_word = (uint64_t*) 0;
+
+      if (failed)
+        failed_sc = failed_sc + 1;
+
+      if (rd != REG_ZR)
+        *(registers + rd) = failed;
+
+      ic_sc = ic_sc + 1;
+    }
+
+    pc = pc + INSTRUCTIONSIZE;
+  }
+}
+
+// -----------------------------------------------------------------
+// ------------------------- PAGE FRAMES ---------------------------
+// -----------------------------------------------------------------
+
+uint64_t* palloc() {
+  uint64_t* frame;
+
+  pthread_mutex_lock(&frame_lock);
+
+  frame = palloc_unlocked();
+
+  pthread_mutex_unlock(&frame_lock);
+
+  return frame;
+}
+
+void pfree(uint64_t* frame) {
+  pthread_mutex_lock(&frame_lock);
+
+  pfree_unlocked(frame);
+
+  pthread_mutex_unlock(&frame_lock);
+}
+
+uint64_t* palloc_superframe() {
+  uint64_t* superframe;
+
+  pthread_mutex_lock(&frame_lock);
+
+  superframe = palloc_superframe_unlocked();
+
+  pthread_mutex_unlock(&frame_lock);
+
+  return superframe;
+}
+
+// -----------------------------------------------------------------
+// ---------------------------- HARTSTER ---------------------------
+// -----------------------------------------------------------------
+
+void implement_switch() {
+  // switching to hosted contexts enters the kernel while executing code
+  pthread_mutex_lock(&kernel_lock);
+
+  implement_switch_unlocked();
+
+  pthread_mutex_unlock(&kernel_lock);
+}
+
+void flush_TLB() {
+  zero_memory(TLB, TLB_SIZE * TLBENTRIES * sizeof(uint64_t));
+}
+
+void run_hart_until_exception() {
+  run_until_exception();
+
+  while (is_atomic_instruction()) {
+    execute_atomic();
+
+    if (get_exception(current_context) == EXCEPTION_NOEXCEPTION)
+      // continue with remaining time slice
+      run_until_exception();
+    else
+      return;
+  }
+}
+
+uint64_t* hart_switch(uint64_t* to_context, uint64_t timeout) {
+  // assert: kernel lock is held
+
+  // page tables may have changed on other harts since this hart last
+  // executed code, for example, when reclaiming page frames of contexts
+  flush_TLB();
+  flush_PWC();
+
+  reserved_word = (uint64_t*) 0;
+
+  restore_context(to_context);
+
+  do_switch(to_context, timeout);
+
+  running_harts = running_harts + 1;
+
+  pthread_mutex_unlock(&kernel_lock);
+
+  run_hart_until_exception();
+
+  pthread_mutex_lock(&kernel_lock);
+
+  running_harts = running_harts - 1;
+
+  save_context(current_context);
+
+  return current_context;
+}
+
+uint64_t* schedule_hart() {
+  uint64_t* context;
+
+  // assert: kernel lock is held
+
+  context = schedule();
+
+  while (context == (uint64_t*) 0) {
+    if (running_harts == 0)
+      // no context is ready and no hart executes code
+      // that could make any context ready: all contexts exited
+      return (uint64_t*) 0;
+
+    // other harts may reuse the previous context of this hart
+    // while waiting, so the hart no longer switches from it
+    current_context = (uint64_t*) 0;
+
+    pthread_cond_wait(&ready_condition, &kernel_lock);
+
+    context = schedule();
+  }
+
+  if (current_context == (uint64_t*) 0)
+    // like a booted context, switch from the context itself
+    current_context = context;
+
+  return context;
+}
+
+void* hart(void* id) {
+  uint64_t timeout;
+  uint64_t* from_context;
+  uint64_t* to_context;
+
+  // thread-local machine state of this hart
+
+  init_memory(hart_megabytes);
+
+  init_interpreter();
+  init_disassembler();
+
+  reset_interpreter();
+  reset_profiler();
+
+  run = 1;
+
+  // contexts migrate between harts, so registers written on one
+  // hart may be read on another hart, which rules out the checks
+  // for uninitialized registers, done per hart, as well as profiling
+  fast = 1;
+
+  pthread_mutex_lock(&kernel_lock);
+
+  to_context = schedule_hart();
+
+  timeout = TIMESLICE;
+
+  while (to_context != (uint64_t*) 0) {
+    from_context = hart_switch(to_context, timeout);
+
+    if (get_parent(from_context) != MY_CONTEXT) {
+      // dispatch exception handling to parent on the same hart
+      block_context(from_context);
+
+      to_context = get_parent(from_context);
+
+      timeout = TIMEROFF;
+    } else {
+      account_context(from_context);
+
+      if (handle_exception(from_context) == EXIT) {
+        if (hart_exit_code == EXITCODE_NOERROR)
+          hart_exit_code = get_exit_code(from_context);
+
+        exit_context(from_context);
+      } else
+        ready_context(from_context);
+
+      // wake up waiting harts to run the ready context or to terminate
+      pthread_cond_broadcast(&ready_condition);
+
+      to_context = schedule_hart();
+
+      timeout = TIMESLICE;
+    }
+  }
+
+  pthread_cond_broadcast(&ready_condition);
+
+  pthread_mutex_unlock(&kernel_lock);
+
+  *(hart_instructions + (uint64_t) id) = get_total_number_of_instructions();
+
+  *(hart_atomics + (uint64_t) id * 3)     = ic_lr;
+  *(hart_atomics + (uint64_t) id * 3 + 1) = ic_sc;
+  *(hart_atomics + (uint64_t) id * 3 + 2) = failed_sc;
+
+  return (void*) 0;
+}
+
+uint64_t hartster() {
+  uint64_t* threads;
+  uint64_t i;
+
+  threads = smalloc(number_of_harts * sizeof(pthread_t));
+
+  hart_instructions = zmalloc(number_of_harts * sizeof(uint64_t));
+  hart_atomics      = zmalloc(number_of_harts * 3 * sizeof(uint64_t));
+
+  i = 0;
+
+  while (i < number_of_harts) {
+    if (pthread_create((pthread_t*) (threads + i), (pthread_attr_t*) 0, hart, (void*) i) != 0) {
+      printf("%s: could not create host thread for hart %lu\n", selfie_name, i);
+
+      exit(EXITCODE_SYSTEMERROR);
+    }
+
+    i = i + 1;
+  }
+
+  i = 0;
+
+  while (i < number_of_harts) {
+    pthread_join((pthread_t) *(threads + i), (void**) 0);
+
+    i = i + 1;
+  }
+
+  return hart_exit_code;
+}
+
+uint64_t selfie_harts() {
+  uint64_t exit_code;
+  uint64_t total;
+  uint64_t i;
+  uint64_t* context;
+
+  if (string_compare(argument, "-")) {
+    if (number_of_remaining_arguments() > 1) {
+      if (code_size == 0) {
+        printf("%s: nothing to run\n", selfie_name);
+
+        return EXITCODE_BADARGUMENTS;
+      } else if (IS64BITTARGET == 0) {
+        printf("%s: hartster only runs 64-bit RISC-U code\n", selfie_name);
+
+        return EXITCODE_BADARGUMENTS;
+      } else if (GC_ON) {
+        printf("%s: hartster does not support the garbage collector\n", selfie_name);
+
+        return EXITCODE_BADARGUMENTS;
+      }
+
+      number_of_harts = atoi(get_argument());
+
+      if (number_of_harts == 0)
+        return EXITCODE_BADARGUMENTS;
+      else if (number_of_harts > MAXHARTS)
+        return EXITCODE_BADARGUMENTS;
+
+      reset_interpreter();
+      reset_profiler();
+      reset_microkernel();
+
+      hart_megabytes = atoi(peek_argument(0));
+
+      init_memory(hart_megabytes);
+
+      i = 0;
+
+      while (i < number_of_harts) {
+        // booted contexts share the key (MY_CONTEXT, 0) of the
+        // context table and are never looked up, so not hashed
+        context = new_context();
+
+        init_context(context, MY_CONTEXT, (uint64_t*) 0);
+
+        // assert: number_of_remaining_arguments() > 0
+
+        // all contexts get the same console arguments
+        boot_loader(context);
+
+        ready_context(context);
+
+        i = i + 1;
+      }
+
+      current_context = (uint64_t*) 0;
+
+      printf("%s: %lu-bit hartster executing %lu-bit RISC-U binary %s on %lu harts with %luMB physical memory\n", selfie_name,
+        SIZEOFUINT64INBITS,
+        WORDSIZEINBITS,
+        binary_name,
+        number_of_harts,
+        PHYSICALMEMORYSIZE / MEGABYTE);
+      printf("%s: >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\n\n", selfie_name);
+
+      exit_code = hartster();
+
+      printf("\n%s: <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<\n", selfie_name);
+
+      printf("%s: %lu-bit hartster terminating %lu-bit RISC-U binary %s with exit code %ld\n", selfie_name,
+        SIZEOFUINT64INBITS,
+        WORDSIZEINBITS,
+        binary_name,
+        sign_extend(exit_code, SYSCALL_BITWIDTH));
+
+      total = 0;
+
+      i = 0;
+
+      while (i < number_of_harts) {
+        total = total + *(hart_instructions + i);
+
+        i = i + 1;
+      }
+
+      printf("%s: summary: %lu executed instructions in total on %lu harts\n", selfie_name, total, number_of_harts);
+      printf("%s:          %lu.%.2luMB mapped memory [%lu.%.2lu%% of %luMB physical memory]\n", selfie_name,
+        ratio_format_integral_2(ppeak(), MEGABYTE),
+        ratio_format_fractional_2(ppeak(), MEGABYTE),
+        percentage_format_integral_2(PHYSICALMEMORYSIZE, ppeak()),
+        percentage_format_fractional_2(PHYSICALMEMORYSIZE, ppeak()),
+        PHYSICALMEMORYSIZE / MEGABYTE);
+
+      i = 0;
+
+      while (i < number_of_harts) {
+        printf("%s: hart %lu:  %lu executed instructions [%lu.%.2lu%% share], %lu lr.d, %lu sc.d (%lu failed)\n", selfie_name, i,
+          *(hart_instructions + i),
+          percentage_format_integral_2(total, *(hart_instructions + i)),
+          percentage_format_fractional_2(total, *(hart_instructions + i)),
+          *(hart_atomics + i * 3),
+          *(hart_atomics + i * 3 + 1),
+          *(hart_atomics + i * 3 + 2));
+
+        i = i + 1;
+      }
+
+      run = 0;
+
+      printf("%s: ################################################################################\n", selfie_name);
+
+      return exit_code;
+    } else
+      return EXITCODE_BADARGUMENTS;
+  } else
+    return EXITCODE_BADARGUMENTS;
+}
+
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+// -----------------------------------------------------------------
+// ----------------------------   M A I N   ------------------------
+// -----------------------------------------------------------------
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+
+int main(int argc, char** argv) {
+  uint64_t exit_code;
+
+  init_selfie((uint64_t) argc, (uint64_t*) argv);
+
+  init_library();
+  init_system();
+  init_target();
+  init_kernel();
+
+  exit_code = selfie(1);
+
+  if (exit_code == EXITCODE_MOREARGUMENTS)
+    exit_code = selfie_harts();
+
+  return exit_selfie(exit_code, " - 1-256 0-4096 ...");
+}
@@ -0,0 +1,890 @@
+/*
+Copyright (c) the Selfie Project authors. All rights reserved.
+Please see the AUTHORS file for details. Use of this source code is
+governed by a BSD license that can be found in the LICENSE file.
+
+Selfie is a project of the Computational Systems Group at the
+Department of Computer Sciences of the University of Salzburg
+in Austria. For further information and code please refer to:
+
+selfie.cs.uni-salzburg.at
+
+Jitster is a just-in-time compiler of 64-bit RISC-U code to x86-64
+code for mipster on Linux hosts. Jitster counts how often mipster
+reaches any given instruction and translates basic blocks starting
+at hot instructions into x86-64 code in an executable memory arena.
+Translated blocks operate directly on the registers of the current
+context and call back into selfie for translating virtual addresses.
+
+Jitster executes a translated block only if the timer does not
+expire before the end of the block. Otherwise, and whenever a load,
+store, or division would cause an exception, jitster exits the
+block right before the faulting instruction which is then executed
+by mipster to throw the exception as usual. System calls always end
+a block and are executed by mipster as well. Exceptions and timer
+interrupts thus occur at exactly the same instructions as on mipster.
+
+Unlike the other tools, jitster is not written in C* since it needs
+to call generated code. It therefore only compiles on x86-64 hosts
+and cannot be self-compiled by selfie.
+
+*/
+
+#include <sys/mman.h>
+
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+// -----------------------------------------------------------------
+// -------------------     I N T E R F A C E     -------------------
+// -----------------------------------------------------------------
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+
+// -----------------------------------------------------------------
+// ---------------------------- X86-64 -----------------------------
+// -----------------------------------------------------------------
+
+void emit_x86_byte(uint64_t b);
+void emit_x86_word(uint64_t w);
+void emit_x86_double_word(uint64_t d);
+
+void emit_x86_load_register(uint64_t x86_reg, uint64_t reg);
+void emit_x86_store_register(uint64_t x86_reg, uint64_t reg);
+void emit_x86_move_immediate(uint64_t x86_reg, uint64_t value);
+void emit_x86_side_exit(uint64_t vaddr, uint64_t executed);
+void emit_x86_exit(uint64_t executed);
+
+void emit_x86_translate_address(uint64_t rs1, uint64_t imm, uint64_t vaddr, uint64_t executed, uint64_t store);
+void emit_x86_division(uint64_t rd, uint64_t rs1, uint64_t rs2, uint64_t vaddr, uint64_t executed, uint64_t remainder);
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+// x86-64 register numbers as used in ModRM bytes
+
+uint64_t X86_RAX = 0;
+uint64_t X86_RCX = 1;
+uint64_t X86_RDX = 2;
+uint64_t X86_RDI = 7;
+
+uint64_t X86_SIDEEXITSIZE = 30; // in bytes, see emit_x86_side_exit
+
+// -----------------------------------------------------------------
+// ------------------------- TRANSLATOR ----------------------------
+// -----------------------------------------------------------------
+
+uint64_t jit_translate_address(uint64_t vaddr);
+uint64_t jit_translate_store_address(uint64_t vaddr);
+
+uint64_t translate_instruction(uint64_t vaddr, uint64_t* entry, uint64_t executed);
+uint64_t translate_block(uint64_t* block, uint64_t vaddr);
+
+// ------------------------ GLOBAL CONSTANTS -----------------------
+
+uint64_t ARENASIZE = 67108864; // 64MB of executable memory
+
+uint64_t MAXBLOCKLENGTH = 64;   // in instructions
+uint64_t MAXBLOCKSIZE   = 8192; // in bytes, upper bound on code of longest block
+
+uint64_t HOTNESS = 16; // number of executions before translating a block
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+char* arena      = (char*) 0; // executable memory for translated code
+char* arena_free = (char*) 0; // next free byte in arena
+
+uint64_t translated_blocks       = 0;
+uint64_t translated_instructions = 0;
+
+// -----------------------------------------------------------------
+// ------------------------- BLOCK CACHE ---------------------------
+// -----------------------------------------------------------------
+
+void init_block_cache();
+void flush_block_cache();
+
+uint64_t* get_block_table(uint64_t* context);
+uint64_t* get_block(uint64_t* context, uint64_t vaddr);
+
+// block table list entry
+// +---+-----------------+
+// | 0 | next            | pointer to next entry
+// | 1 | predecoded code | predecoded code of context
+// | 2 | block table     | blocks indexed by instruction
+// | 3 | size            | size of block table in bytes
+// +---+-----------------+
+
+uint64_t BLOCKTABLEENTRIES = 4;
+
+uint64_t* get_next_block_table(uint64_t* entry)   { return (uint64_t*) *entry; }
+uint64_t* get_block_table_code(uint64_t* entry)   { return (uint64_t*) *(entry + 1); }
+uint64_t* get_block_table_blocks(uint64_t* entry) { return (uint64_t*) *(entry + 2); }
+uint64_t  get_block_table_size(uint64_t* entry)   { return             *(entry + 3); }
+
+void set_next_block_table(uint64_t* entry, uint64_t* next)     { *entry       = (uint64_t) next; }
+void set_block_table_code(uint64_t* entry, uint64_t* code)     { *(entry + 1) = (uint64_t) code; }
+void set_block_table_blocks(uint64_t* entry, uint64_t* blocks) { *(entry + 2) = (uint64_t) blocks; }
+void set_block_table_size(uint64_t* entry, uint64_t size)      { *(entry + 3) = size; }
+
+// block
+// +---+---------+
+// | 0 | counter | number of executions by mipster
+// | 1 | code    | translated x86-64 code, 0 if not translated
+// | 2 | length  | number of translated instructions
+// +---+---------+
+
+uint64_t BLOCKENTRIES = 3;
+
+uint64_t  get_block_counter(uint64_t* block) { return             *block; }
+uint64_t* get_block_code(uint64_t* block)    { return (uint64_t*) *(block + 1); }
+uint64_t  get_block_length(uint64_t* block)  { return             *(block + 2); }
+
+void set_block_counter(uint64_t* block, uint64_t counter) { *block       = counter; }
+void set_block_code(uint64_t* block, uint64_t* code)      { *(block + 1) = (uint64_t) code; }
+void set_block_length(uint64_t* block, uint64_t length)   { *(block + 2) = length; }
+
+// ------------------------ GLOBAL VARIABLES -----------------------
+
+uint64_t* block_tables = (uint64_t*) 0; // list of block tables
+
+uint64_t* last_block_table = (uint64_t*) 0; // most recently used block table
+
+uint64_t seen_invalidations = 0; // predecoded code invalidations seen so far
+
+uint64_t jitted_instructions = 0; // number of instructions executed in translated code
+
+uint64_t side_exits = 0; // number of exits from translated code before faulting instructions
+
+// -----------------------------------------------------------------
+// ---------------------------- JITSTER ----------------------------
+// -----------------------------------------------------------------
+
+uint64_t is_block_within_time_slice(uint64_t* block);
+
+void run_jitted_until_exception();
+
+uint64_t* jitster_switch(uint64_t* to_context, uint64_t timeout);
+
+uint64_t jitster(uint64_t* to_context);
+
+uint64_t selfie_jit();
+
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+// -----------------------------------------------------------------
+// ----------------------    R U N T I M E    ----------------------
+// -----------------------------------------------------------------
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+
+// -----------------------------------------------------------------
+// ---------------------------- X86-64 -----------------------------
+// -----------------------------------------------------------------
+
+void emit_x86_byte(uint64_t b) {
+  *arena_free = (char) b;
+
+  arena_free = arena_free + 1;
+}
+
+void emit_x86_word(uint64_t w) {
+  // little endian, truncated to 32 bits
+  emit_x86_byte(w % 256);
+  emit_x86_byte(w / 256 % 256);
+  emit_x86_byte(w / 65536 % 256);
+  emit_x86_byte(w / 16777216 % 256);
+}
+
+void emit_x86_double_word(uint64_t d) {
+  emit_x86_word(d);
+  emit_x86_word(d / 4294967296);
+}
+
+void emit_x86_load_register(uint64_t x86_reg, uint64_t reg) {
+  // mov x86_reg, [rbx + reg * 8]
+  emit_x86_byte(72);
+  emit_x86_byte(139);
+  emit_x86_byte(131 + x86_reg * 8);
+  emit_x86_word(reg * 8);
+}
+
+void emit_x86_store_register(uint64_t x86_reg, uint64_t reg) {
+  // register zero is never written
+  if (reg != REG_ZR) {
+    // mov [rbx + reg * 8], x86_reg
+    emit_x86_byte(72);
+    emit_x86_byte(137);
+    emit_x86_byte(131 + x86_reg * 8);
+    emit_x86_word(reg * 8);
+  }
+}
+
+void emit_x86_move_immediate(uint64_t x86_reg, uint64_t value) {
+  // movabs x86_reg, value
+  emit_x86_byte(72);
+  emit_x86_byte(184 + x86_reg);
+  emit_x86_double_word(value);
+}
+
+void emit_x86_side_exit(uint64_t vaddr, uint64_t executed) {
+  // set pc to vaddr and return number of executed instructions,
+  // code size must be X86_SIDEEXITSIZE bytes
+  emit_x86_move_immediate(X86_RAX, vaddr);
+  emit_x86_move_immediate(X86_RCX, (uint64_t) &pc);
+
+  // mov [rcx], rax
+  emit_x86_byte(72);
+  emit_x86_byte(137);
+  emit_x86_byte(1);
+
+  // mov eax, executed
+  emit_x86_byte(184);
+  emit_x86_word(executed);
+
+  // pop rbx; ret
+  emit_x86_byte(91);
+  emit_x86_byte(195);
+}
+
+void emit_x86_exit(uint64_t executed) {
+  // assert: rax contains next pc
+
+  emit_x86_move_immediate(X86_RCX, (uint64_t) &pc);
+
+  // mov [rcx], rax
+  emit_x86_byte(72);
+  emit_x86_byte(137);
+  emit_x86_byte(1);
+
+  // mov eax, executed
+  emit_x86_byte(184);
+  emit_x86_word(executed);
+
+  // pop rbx; ret
+  emit_x86_byte(91);
+  emit_x86_byte(195);
+}
+
+void emit_x86_translate_address(uint64_t rs1, uint64_t imm, uint64_t vaddr, uint64_t executed, uint64_t store) {
+  emit_x86_load_register(X86_RDI, rs1);
+
+  // add rdi, imm32
+  emit_x86_byte(72);
+  emit_x86_byte(129);
+  emit_x86_byte(199);
+  emit_x86_word(imm);
+
+  if (store)
+    emit_x86_move_immediate(X86_RAX, (uint64_t) jit_translate_store_address);
+  else
+    emit_x86_move_immediate(X86_RAX, (uint64_t) jit_translate_address);
+
+  // call rax; test rax, rax; jnz over side exit
+  emit_x86_byte(255);
+  emit_x86_byte(208);
+  emit_x86_byte(72);
+  emit_x86_byte(133);
+  emit_x86_byte(192);
+  emit_x86_byte(117);
+  emit_x86_byte(X86_SIDEEXITSIZE);
+
+  emit_x86_side_exit(vaddr, executed);
+
+  // assert: rax contains physical address
+}
+
+void emit_x86_division(uint64_t rd, uint64_t rs1, uint64_t rs2, uint64_t vaddr, uint64_t executed, uint64_t remainder) {
+  emit_x86_load_register(X86_RCX, rs2);
+
+  // test rcx, rcx; jnz over side exit
+  emit_x86_byte(72);
+  emit_x86_byte(133);
+  emit_x86_byte(201);
+  emit_x86_byte(117);
+  emit_x86_byte(X86_SIDEEXITSIZE);
+
+  emit_x86_side_exit(vaddr, executed);
+
+  emit_x86_load_register(X86_RAX, rs1);
+
+  // xor edx, edx; div rcx
+  emit_x86_byte(49);
+  emit_x86_byte(210);
+  emit_x86_byte(72);
+  emit_x86_byte(247);
+  emit_x86_byte(241);
+
+  if (remainder)
+    emit_x86_store_register(X86_RDX, rd);
+  else
+    emit_x86_store_register(X86_RAX, rd);
+}
+
+// -----------------------------------------------------------------
+// ------------------------- TRANSLATOR ----------------------------
+// -----------------------------------------------------------------
+
+uint64_t jit_translate_address(uint64_t vaddr) {
+  uint64_t page;
+  uint64_t frame;
+
+  // same checks as do_load_fast and do_store_fast,
+  // returns 0 if the access would cause an exception
+  if (is_virtual_address_valid(vaddr, WORDSIZE))
+    if (is_data_stack_heap_address(current_context, vaddr)) {
+      page = page_of_virtual_address(vaddr);
+
+      // look up page frame only once, unlike translate_virtual_to_physical
+      frame = get_page_frame(pt, page);
+
+      if (frame != 0)
+        return (vaddr - page * PAGESIZE) * (PAGEFRAMESIZE / PAGESIZE) + frame;
+    }
+
+  return 0;
+}
+
+uint64_t jit_translate_store_address(uint64_t vaddr) {
+  // page frames shared copy-on-write with forked contexts
+  // are copied before the first store, as in store_virtual_memory
+  if (shared_page_frames > 0)
+    if (jit_translate_address(vaddr) != 0)
+      copy_on_write(pt, page_of_virtual_address(vaddr));
+
+  return jit_translate_address(vaddr);
+}
+
+uint64_t translate_instruction(uint64_t vaddr, uint64_t* entry, uint64_t executed) {
+  uint64_t is;
+  uint64_t rd;
+  uint64_t rs1;
+  uint64_t rs2;
+  uint64_t imm;
+
+  // returns 1 if the instruction ends the block
+
+  is  = get_predecoded_is(entry);
+  rd  = get_predecoded_rd(entry);
+  rs1 = get_predecoded_rs1(entry);
+  rs2 = get_predecoded_rs2(entry);
+  imm = get_predecoded_imm(entry);
+
+  if (is == ADDI) {
+    emit_x86_load_register(X86_RAX, rs1);
+
+    // add rax, imm32 (sign-extended 12-bit immediate)
+    emit_x86_byte(72);
+    emit_x86_byte(5);
+    emit_x86_word(imm);
+
+    emit_x86_store_register(X86_RAX, rd);
+  } else if (is == LOAD) {
+    emit_x86_translate_address(rs1, imm, vaddr, executed, 0);
+
+    // mov rax, [rax]
+    emit_x86_byte(72);
+    emit_x86_byte(139);
+    emit_x86_byte(0);
+
+    emit_x86_store_register(X86_RAX, rd);
+  } else if (is == STORE) {
+    emit_x86_translate_address(rs1, imm, vaddr, executed, 1);
+
+    emit_x86_load_register(X86_RCX, rs2);
+
+    // mov [rax], rcx
+    emit_x86_byte(72);
+    emit_x86_byte(137);
+    emit_x86_byte(8);
+  } else if (is == ADD) {
+    emit_x86_load_register(X86_RAX, rs1);
+
+    // add rax, [rbx + rs2 * 8]
+    emit_x86_byte(72);
+    emit_x86_byte(3);
+    emit_x86_byte(131);
+    emit_x86_word(rs2 * 8);
+
+    emit_x86_store_register(X86_RAX, rd);
+  } else if (is == SUB) {
+    emit_x86_load_register(X86_RAX, rs1);
+
+    // sub rax, [rbx + rs2 * 8]
+    emit_x86_byte(72);
+    emit_x86_byte(43);
+    emit_x86_byte(131);
+    emit_x86_word(rs2 * 8);
+
+    emit_x86_store_register(X86_RAX, rd);
+  } else if (is == MUL) {
+    emit_x86_load_register(X86_RAX, rs1);
+
+    // imul rax, [rbx + rs2 * 8]
+    emit_x86_byte(72);
+    emit_x86_byte(15);
+    emit_x86_byte(175);
+    emit_x86_byte(131);
+    emit_x86_word(rs2 * 8);
+
+    emit_x86_store_register(X86_RAX, rd);
+  } else if (is == DIVU)
+    emit_x86_division(rd, rs1, rs2, vaddr, executed, 0);
+  else if (is == REMU)
+    emit_x86_division(rd, rs1, rs2, vaddr, executed, 1);
+  else if (is == SLTU) {
+    emit_x86_load_register(X86_RAX, rs1);
+
+    // cmp rax, [rbx + rs2 * 8]
+    emit_x86_byte(72);
+    emit_x86_byte(59);
+    emit_x86_byte(131);
+    emit_x86_word(rs2 * 8);
+
+    // setb al; movzx eax, al
+    emit_x86_byte(15);
+    emit_x86_byte(146);
+    emit_x86_byte(192);
+    emit_x86_byte(15);
+    emit_x86_byte(182);
+    emit_x86_byte(192);
+
+    emit_x86_store_register(X86_RAX, rd);
+  } else if (is == LUI) {
+    emit_x86_move_immediate(X86_RAX, left_shift(imm, 12));
+
+    emit_x86_store_register(X86_RAX, rd);
+  } else if (is == BEQ) {
+    emit_x86_load_register(X86_RAX, rs1);
+
+    // cmp rax, [rbx + rs2 * 8]
+    emit_x86_byte(72);
+    emit_x86_byte(59);
+    emit_x86_byte(131);
+    emit_x86_word(rs2 * 8);
+
+    emit_x86_move_immediate(X86_RAX, vaddr + imm);
+    emit_x86_move_immediate(X86_RCX, vaddr + INSTRUCTIONSIZE);
+
+    // cmovne rax, rcx
+    emit_x86_byte(72);
+    emit_x86_byte(15);
+    emit_x86_byte(69);
+    emit_x86_byte(193);
+
+    emit_x86_exit(executed + 1);
+
+    return 1;
+  } else if (is == JAL) {
+    emit_x86_move_immediate(X86_RAX, vaddr + INSTRUCTIONSIZE);
+    emit_x86_store_register(X86_RAX, rd);
+
+    emit_x86_move_immediate(X86_RAX, vaddr + imm);
+
+    emit_x86_exit(executed + 1);
+
+    return 1;
+  } else if (is == JALR) {
+    // prepare jump rs1-relative with LSB reset before linking (works even if rd == rs1)
+    emit_x86_load_register(X86_RDX, rs1);
+
+    // add rdx, imm32; and rdx, -2
+    emit_x86_byte(72);
+    emit_x86_byte(129);
+    emit_x86_byte(194);
+    emit_x86_word(imm);
+    emit_x86_byte(72);
+    emit_x86_byte(131);
+    emit_x86_byte(226);
+    emit_x86_byte(254);
+
+    emit_x86_move_immediate(X86_RAX, vaddr + INSTRUCTIONSIZE);
+    emit_x86_store_register(X86_RAX, rd);
+
+    // mov rax, rdx
+    emit_x86_byte(72);
+    emit_x86_byte(137);
+    emit_x86_byte(208);
+
+    emit_x86_exit(executed + 1);
+
+    return 1;
+  }
+
+  return 0;
+}
+
+uint64_t translate_block(uint64_t* block, uint64_t vaddr) {
+  uint64_t* entry;
+  uint64_t length;
+  uint64_t done;
+
+  if (arena_free + MAXBLOCKSIZE > arena + ARENASIZE)
+    // arena is full, start over
+    flush_block_cache();
+
+  set_block_code(block, (uint64_t*) arena_free);
+
+  // push rbx; mov rbx, rdi (registers of current context)
+  emit_x86_byte(83);
+  emit_x86_byte(72);
+  emit_x86_byte(137);
+  emit_x86_byte(251);
+
+  length = 0;
+  done   = 0;
+
+  while (done == 0) {
+    entry = predecoded_instruction(current_context, vaddr);
+
+    if (entry == (uint64_t*) 0)
+      // end of code segment
+      done = 2;
+    else if (get_predecoded_is(entry) == 0)
+      // only translate instructions mipster has already predecoded
+      done = 2;
+    else if (get_predecoded_is(entry) == ECALL)
+      // system calls are always executed by mipster
+      done = 2;
+    else {
+      // translated control-flow instructions end the block
+      done = translate_instruction(vaddr, entry, length);
+
+      length = length + 1;
+      vaddr  = vaddr + INSTRUCTIONSIZE;
+
+      if (done == 0)
+        if (length == MAXBLOCKLENGTH)
+          done = 2;
+    }
+  }
+
+  if (length == 0) {
+    // nothing to translate, reclaim code
+    arena_free = (char*) get_block_code(block);
+
+    set_block_code(block, (uint64_t*) 0);
+
+    return 0;
+  }
+
+  if (done == 2) {
+    // fall through to next instruction
+    emit_x86_move_immediate(X86_RAX, vaddr);
+
+    emit_x86_exit(length);
+  }
+
+  set_block_length(block, length);
+
+  translated_blocks       = translated_blocks + 1;
+  translated_instructions = translated_instructions + length;
+
+  return length;
+}
+
+// -----------------------------------------------------------------
+// ------------------------- BLOCK CACHE ---------------------------
+// -----------------------------------------------------------------
+
+void init_block_cache() {
+  arena = (char*) mmap((void*) 0, ARENASIZE,
+    PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+  if (arena == (char*) MAP_FAILED) {
+    printf("%s: could not allocate %luMB of executable memory\n", selfie_name, ARENASIZE / MEGABYTE);
+
+    exit(EXITCODE_SYSTEMERROR);
+  }
+
+  arena_free = arena;
+
+  seen_invalidations = predecoded_code_invalidations;
+}
+
+void flush_block_cache() {
+  uint64_t* entry;
+
+  entry = block_tables;
+
+  while (entry != (uint64_t*) 0) {
+    zero_memory(get_block_table_blocks(entry), get_block_table_size(entry));
+
+    entry = get_next_block_table(entry);
+  }
+
+  arena_free = arena;
+
+  seen_invalidations = predecoded_code_invalidations;
+}
+
+uint64_t* get_block_table(uint64_t* context) {
+  uint64_t* code;
+  uint64_t* entry;
+
+  code = get_predecoded_code(context);
+
+  if (code == (uint64_t*) 0)
+    // mipster has not yet executed any code of context
+    return (uint64_t*) 0;
+
+  if (last_block_table != (uint64_t*) 0)
+    if (get_block_table_code(last_block_table) == code)
+      return last_block_table;
+
+  // predecoded code identifies contexts even when context memory is reused
+  entry = block_tables;
+
+  while (entry != (uint64_t*) 0) {
+    if (get_block_table_code(entry) == code) {
+      last_block_table = entry;
+
+      return entry;
+    }
+
+    entry = get_next_block_table(entry);
+  }
+
+  entry = smalloc(BLOCKTABLEENTRIES * sizeof(uint64_t));
+
+  set_block_table_code(entry, code);
+  set_block_table_size(entry, get_code_seg_size(context) / INSTRUCTIONSIZE * BLOCKENTRIES * sizeof(uint64_t));
+  set_block_table_blocks(entry, zmalloc(get_block_table_size(entry)));
+
+  set_next_block_table(entry, block_tables);
+
+  block_tables = entry;
+
+  last_block_table = entry;
+
+  return entry;
+}
+
+uint64_t* get_block(uint64_t* context, uint64_t vaddr) {
+  uint64_t* entry;
+  uint64_t code_seg_start;
+
+  if (seen_invalidations != predecoded_code_invalidations)
+    // code may have changed, discard all translated code
+    flush_block_cache();
+
+  entry = get_block_table(context);
+
+  if (entry == (uint64_t*) 0)
+    return (uint64_t*) 0;
+
+  code_seg_start = get_code_seg_start(context);
+
+  // avoid integer overflow with vaddr below code segment
+  if (vaddr - code_seg_start < get_code_seg_size(context))
+    if (vaddr % INSTRUCTIONSIZE == 0)
+      return get_block_table_blocks(entry) + (vaddr - code_seg_start) / INSTRUCTIONSIZE * BLOCKENTRIES;
+
+  return (uint64_t*) 0;
+}
+
+// -----------------------------------------------------------------
+// ---------------------------- JITSTER ----------------------------
+// -----------------------------------------------------------------
+
+uint64_t is_block_within_time_slice(uint64_t* block) {
+  if (timer == TIMEROFF)
+    return 1;
+  else if (timer > get_block_length(block))
+    // timer does not expire before end of block
+    return 1;
+  else
+    return 0;
+}
+
+void run_jitted_until_exception() {
+  uint64_t* block;
+  uint64_t executed;
+  uint64_t interpret;
+
+  trap = 0;
+
+  while (trap == 0) {
+    block = get_block(current_context, pc);
+
+    interpret = 1;
+
+    if (block != (uint64_t*) 0) {
+      if (get_block_code(block) == (uint64_t*) 0) {
+        set_block_counter(block, get_block_counter(block) + 1);
+
+        if (get_block_counter(block) == HOTNESS)
+          translate_block(block, pc);
+      }
+
+      if (get_block_code(block) != (uint64_t*) 0)
+        if (is_block_within_time_slice(block)) {
+          executed = ((uint64_t (*)(uint64_t*)) get_block_code(block))(registers);
+
+          if (timer != TIMEROFF)
+            timer = timer - executed;
+
+          jitted_instructions = jitted_instructions + executed;
+
+          if (executed < get_block_length(block))
+            // pc is at faulting instruction, let mipster throw the exception
+            side_exits = side_exits + 1;
+          else
+            interpret = 0;
+        }
+    }
+
+    if (interpret) {
+      fetch_predecoded();
+      execute_fast();
+
+      interrupt();
+    }
+  }
+
+  trap = 0;
+}
+
+uint64_t* jitster_switch(uint64_t* to_context, uint64_t timeout) {
+  restore_context(to_context);
+
+  do_switch(to_context, timeout);
+
+  run_jitted_until_exception();
+
+  save_context(current_context);
+
+  return current_context;
+}
+
+uint64_t jitster(uint64_t* to_context) {
+  uint64_t timeout;
+  uint64_t* from_context;
+
+  timeout = TIMESLICE;
+
+  while (1) {
+    from_context = jitster_switch(to_context, timeout);
+
+    if (get_parent(from_context) != MY_CONTEXT) {
+      // dispatch exception handling to parent
+      block_context(from_context);
+
+      to_context = get_parent(from_context);
+
+      timeout = TIMEROFF;
+    } else {
+      account_context(from_context);
+
+      if (handle_exception(from_context) == EXIT)
+        exit_context(from_context);
+      else
+        ready_context(from_context);
+
+      to_context = schedule();
+
+      if (to_context == (uint64_t*) 0)
+        // all contexts on my boot level exited
+        return get_exit_code(from_context);
+
+      timeout = TIMESLICE;
+    }
+  }
+}
+
+uint64_t selfie_jit() {
+  uint64_t exit_code;
+  uint64_t total;
+
+  if (string_compare(argument, "-")) {
+    if (number_of_remaining_arguments() > 0) {
+      if (code_size == 0) {
+        printf("%s: nothing to run\n", selfie_name);
+
+        return EXITCODE_BADARGUMENTS;
+      } else if (IS64BITTARGET == 0) {
+        printf("%s: jitster only runs 64-bit RISC-U code\n", selfie_name);
+
+        return EXITCODE_BADARGUMENTS;
+      }
+
+      reset_interpreter();
+      reset_profiler();
+      reset_microkernel();
+
+      init_memory(atoi(peek_argument(0)));
+
+      init_block_cache();
+
+      current_context = create_context(MY_CONTEXT, 0);
+
+      // assert: number_of_remaining_arguments() > 0
+
+      boot_loader(current_context);
+
+      // current_context is ready to run
+
+      run = 1;
+
+      // mipster executes code that is not translated without profiling
+      fast = 1;
+
+      printf("%s: %lu-bit jitster executing %lu-bit RISC-U binary %s with %luMB physical memory\n", selfie_name,
+        SIZEOFUINT64INBITS,
+        WORDSIZEINBITS,
+        binary_name,
+        PHYSICALMEMORYSIZE / MEGABYTE);
+      printf("%s: >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\n\n", selfie_name);
+
+      exit_code = jitster(current_context);
+
+      printf("\n%s: <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<\n", selfie_name);
+
+      printf("%s: %lu-bit jitster terminating %lu-bit RISC-U binary %s with exit code %ld\n", selfie_name,
+        SIZEOFUINT64INBITS,
+        WORDSIZEINBITS,
+        binary_name,
+        sign_extend(exit_code, SYSCALL_BITWIDTH));
+
+      total = get_total_number_of_instructions() + jitted_instructions;
+
+      printf("%s: summary: %lu executed instructions in total, %lu(%lu.%.2lu%%) in translated code\n", selfie_name,
+        total,
+        jitted_instructions,
+        percentage_format_integral_2(total, jitted_instructions),
+        percentage_format_fractional_2(total, jitted_instructions));
+      printf("%s: translation: %lu instructions in %lu blocks, %lu side exits\n", selfie_name,
+        translated_instructions,
+        translated_blocks,
+        side_exits);
+
+      run = 0;
+
+      fast = 0;
+
+      printf("%s: ################################################################################\n", selfie_name);
+
+      return exit_code;
+    } else
+      return EXITCODE_BADARGUMENTS;
+  } else
+    return EXITCODE_BADARGUMENTS;
+}
+
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+// -----------------------------------------------------------------
+// ----------------------------   M A I N   ------------------------
+// -----------------------------------------------------------------
+// *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~ *~*~
+
+int main(int argc, char** argv) {
+  uint64_t exit_code;
+
+  init_selfie((uint64_t) argc, (uint64_t*) argv);
+
+  init_library();
+  init_system();
+  init_target();
+  init_kernel();
+
+  exit_code = selfie(1);
+
+  if (exit_code == EXITCODE_MOREARGUMENTS)
+    exit_code = selfie_jit();
+
+  return exit_selfie(exit_code, " - ...");
+}
@@ -1052,6 +1052,18 @@ uint64_t* copy_symbolic_context(uint64_t* original, uint64_t location, char* con
   set_mc_stack_peak(context, 0);
   set_mc_mapped_heap(context, 0);
 
+  // scheduler
+  set_next_in_bucket(context, (uint64_t*) 0);
+  set_next_ready(context, (uint64_t*) 0);
+  set_context_state(context, CONTEXT_READY);
+  set_priority(context, 0);
+  set_time_slices(context, 0);
+  set_asid(context, 0);
+
+  // page table cache
+  set_page_log(context, smalloc(PAGELOGSIZE * sizeof(uint64_t)));
+  set_logged_pages(context, 0);
+
   set_execution_depth(context, get_execution_depth(original));
   set_path_condition(context, condition);
   set_beq_counter(context, get_beq_counter(original));